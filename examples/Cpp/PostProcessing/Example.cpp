@@ -6,15 +6,13 @@
  */
 
 #include <ExampleBase.h>
+#include <LLGL/FrameGraph.h>
 
 //#define DEBUG_FPS
 #ifdef DEBUG_FPS
 #include <chrono>//!!!
 #endif
 
-// Enables custom render pass to clear at the begin of a render pass section (more efficient)
-//#define ENABLE_CUSTOM_RENDER_PASS
-
 
 class Example_PostProcessing : public ExampleBase
 {
@@ -50,18 +48,21 @@ class Example_PostProcessing : public ExampleBase
     LLGL::Sampler*          colorMapSampler     = nullptr;
     LLGL::Sampler*          glossMapSampler     = nullptr;
 
-    LLGL::Texture*          colorMap            = nullptr;
-    LLGL::Texture*          glossMap            = nullptr;
-    LLGL::Texture*          glossMapBlurX       = nullptr;
-    LLGL::Texture*          glossMapBlurY       = nullptr;
+    LLGL::RenderPass*       renderPassScene     = nullptr;
+    LLGL::RenderPass*       renderPassBlur      = nullptr;
 
-    LLGL::RenderTarget*     renderTargetScene   = nullptr;
-    LLGL::RenderTarget*     renderTargetBlurX   = nullptr;
-    LLGL::RenderTarget*     renderTargetBlurY   = nullptr;
+    // Frame graph manages the textures and render targets of all passes
+    LLGL::FrameGraph        frameGraph;
 
-    #ifdef ENABLE_CUSTOM_RENDER_PASS
-    LLGL::RenderPass*       renderPassScene     = nullptr;
-    #endif
+    LLGL::FrameGraphResource colorMap           = LLGL::Constants::invalidFrameGraphResource;
+    LLGL::FrameGraphResource glossMap           = LLGL::Constants::invalidFrameGraphResource;
+    LLGL::FrameGraphResource depthMap           = LLGL::Constants::invalidFrameGraphResource;
+    LLGL::FrameGraphResource glossMapBlurX      = LLGL::Constants::invalidFrameGraphResource;
+    LLGL::FrameGraphResource glossMapBlurY      = LLGL::Constants::invalidFrameGraphResource;
+
+    LLGL::Extent2D          screenSize          = { 800, 600 };
+    float                   innerModelRotation  = 0.0f;
+    Gs::Vector2f            outerModelDeltaRotation;
 
     struct SceneSettings
     {
@@ -84,19 +85,17 @@ class Example_PostProcessing : public ExampleBase
 public:
 
     Example_PostProcessing() :
-        ExampleBase { L"LLGL Example: PostProcessing" }
+        ExampleBase { L"LLGL Example: PostProcessing" },
+        frameGraph  { *renderer                       }
     {
         // Create all graphics objects
         CreateBuffers();
         LoadShaders();
         CreateSamplers();
-        CreateTextures();
-        CreateRenderTargets();
-        #ifdef ENABLE_CUSTOM_RENDER_PASS
         CreateRenderPasses();
-        #endif
         CreatePipelineLayouts();
         CreatePipelines();
+        CreateFrameGraph();
         CreateResourceHeaps();
 
         // Show some information
@@ -262,11 +261,9 @@ public:
         glossMapSampler = renderer->CreateSampler(samplerDesc);
     }
 
-    void CreateTextures()
+    // Returns the descriptor for the transient color and gloss maps in the specified resolution.
+    LLGL::TextureDescriptor GetColorMapDesc(const LLGL::Extent2D& resolution) const
     {
-        // Create empty color and gloss map
-        auto resolution = context->GetVideoMode().resolution;
-
         LLGL::TextureDescriptor texDesc;
         {
             texDesc.type            = LLGL::TextureType::Texture2D;
@@ -277,81 +274,31 @@ public:
             texDesc.extent.height   = resolution.height;
             texDesc.mipLevels       = 1;
         }
-        colorMap = renderer->CreateTexture(texDesc);
-        glossMap = renderer->CreateTexture(texDesc);
-
-        // Create empty blur pass maps (in quarter resolution)
-        texDesc.extent.width  /= 4;
-        texDesc.extent.height /= 4;
-
-        glossMapBlurX = renderer->CreateTexture(texDesc);
-        glossMapBlurY = renderer->CreateTexture(texDesc);
+        return texDesc;
     }
 
-    void CreateRenderTargets()
+    // Creates the render passes the pipelines are created with. These are compatible with the render passes the frame graph creates,
+    // because they only differ in their load and store operations.
+    void CreateRenderPasses()
     {
-        auto resolution = context->GetVideoMode().resolution;
-
-        // Create render-target for scene rendering
-        LLGL::RenderTargetDescriptor renderTargetDesc;
+        LLGL::RenderPassDescriptor renderPassSceneDesc;
         {
-            renderTargetDesc.resolution = resolution;
-            renderTargetDesc.attachments =
+            renderPassSceneDesc.colorAttachments =
             {
-                LLGL::AttachmentDescriptor{ LLGL::AttachmentType::Depth },
-                LLGL::AttachmentDescriptor{ LLGL::AttachmentType::Color, colorMap },
-                LLGL::AttachmentDescriptor{ LLGL::AttachmentType::Color, glossMap },
+                LLGL::AttachmentFormatDescriptor{ LLGL::Format::RGBA8UNorm },
+                LLGL::AttachmentFormatDescriptor{ LLGL::Format::RGBA8UNorm },
             };
-            renderTargetDesc.samples = GetSampleCount();
+            renderPassSceneDesc.depthAttachment = LLGL::AttachmentFormatDescriptor{ LLGL::Format::D32Float };
         }
-        renderTargetScene = renderer->CreateRenderTarget(renderTargetDesc);
-
-        // Create render-target for horizontal blur pass (no depth buffer needed)
-        resolution.width    /= 4;
-        resolution.height   /= 4;
-
-        LLGL::RenderTargetDescriptor renderTargetBlurXDesc;
-        {
-            renderTargetBlurXDesc.resolution = resolution;
-            renderTargetBlurXDesc.attachments =
-            {
-                LLGL::AttachmentDescriptor{ LLGL::AttachmentType::Color, glossMapBlurX }
-            };
-        }
-        renderTargetBlurX = renderer->CreateRenderTarget(renderTargetBlurXDesc);
-
-        // Create render-target for vertical blur pass (no depth buffer needed)
-        LLGL::RenderTargetDescriptor renderTargetBlurYDesc;
-        {
-            renderTargetBlurYDesc.resolution = resolution;
-            renderTargetBlurYDesc.attachments =
-            {
-                LLGL::AttachmentDescriptor{ LLGL::AttachmentType::Color, glossMapBlurY }
-            };
-        }
-        renderTargetBlurY = renderer->CreateRenderTarget(renderTargetBlurYDesc);
-    }
+        renderPassScene = renderer->CreateRenderPass(renderPassSceneDesc);
 
-    #ifdef ENABLE_CUSTOM_RENDER_PASS
-
-    void CreateRenderPasses()
-    {
-        //TODO: should be able to query depth-stencil format from <RenderTarget> just like with <RenderContext>
-        LLGL::RenderPassDescriptor renderPassDesc;
+        LLGL::RenderPassDescriptor renderPassBlurDesc;
         {
-            renderPassDesc.colorAttachments =
-            {
-                LLGL::AttachmentFormatDescriptor{ colorMap->GetDesc().format, LLGL::AttachmentLoadOp::Clear },
-                LLGL::AttachmentFormatDescriptor{ glossMap->GetDesc().format, LLGL::AttachmentLoadOp::Clear },
-            };
-            renderPassDesc.depthAttachment  = LLGL::AttachmentFormatDescriptor{ LLGL::Format::D32Float, LLGL::AttachmentLoadOp::Clear };
-            renderPassDesc.samples          = GetSampleCount();
+            renderPassBlurDesc.colorAttachments = { LLGL::AttachmentFormatDescriptor{ LLGL::Format::RGBA8UNorm } };
         }
-        renderPassScene = renderer->CreateRenderPass(renderPassDesc);
+        renderPassBlur = renderer->CreateRenderPass(renderPassBlurDesc);
     }
 
-    #endif // /ENABLE_CUSTOM_RENDER_PASS
-
     // The utility function <LLGL::PipelineLayoutDesc> is used here, to simplify the description of the pipeline layouts
     void CreatePipelineLayouts()
     {
@@ -379,14 +326,13 @@ public:
         LLGL::GraphicsPipelineDescriptor pipelineDescScene;
         {
             pipelineDescScene.shaderProgram                 = shaderProgramScene;
-            pipelineDescScene.renderPass                    = renderTargetScene->GetRenderPass();
+            pipelineDescScene.renderPass                    = renderPassScene;
             pipelineDescScene.pipelineLayout                = layoutScene;
 
             pipelineDescScene.depth.testEnabled             = true;
             pipelineDescScene.depth.writeEnabled            = true;
 
             pipelineDescScene.rasterizer.cullMode           = LLGL::CullMode::Back;
-            pipelineDescScene.rasterizer.multiSampleEnabled = (GetSampleCount() > 1);
         }
         pipelineScene = renderer->CreatePipelineState(pipelineDescScene);
 
@@ -394,7 +340,7 @@ public:
         LLGL::GraphicsPipelineDescriptor pipelineDescPP;
         {
             pipelineDescPP.shaderProgram    = shaderProgramBlur;
-            pipelineDescPP.renderPass       = renderTargetBlurX->GetRenderPass();
+            pipelineDescPP.renderPass       = renderPassBlur;
             pipelineDescPP.pipelineLayout   = layoutBlur;
         }
         pipelineBlur = renderer->CreatePipelineState(pipelineDescPP);
@@ -410,6 +356,82 @@ public:
         pipelineFinal = renderer->CreatePipelineState(pipelineDescFinal);
     }
 
+    // Declares all passes and their textures, and compiles the frame graph for the current resolution
+    void CreateFrameGraph()
+    {
+        // Remove passes and resources of the previous resolution (the textures are reused by the next compilation if they match)
+        frameGraph.Reset();
+
+        auto resolution = context->GetVideoMode().resolution;
+
+        // Declare color and gloss map, and depth buffer for scene rendering
+        auto texDesc = GetColorMapDesc(resolution);
+
+        colorMap = frameGraph.CreateTexture("ColorMap", texDesc);
+        glossMap = frameGraph.CreateTexture("GlossMap", texDesc);
+
+        auto depthDesc = texDesc;
+        {
+            depthDesc.format    = LLGL::Format::D32Float;
+            depthDesc.bindFlags = LLGL::BindFlags::DepthStencilAttachment;
+        }
+        depthMap = frameGraph.CreateTexture("DepthMap", depthDesc);
+
+        // Declare blur pass maps (in quarter resolution)
+        texDesc = GetColorMapDesc({ resolution.width / 4, resolution.height / 4 });
+
+        glossMapBlurX = frameGraph.CreateTexture("GlossMapBlurX", texDesc);
+        glossMapBlurY = frameGraph.CreateTexture("GlossMapBlurY", texDesc);
+
+        // Import render context for the final post-processor
+        auto backBuffer = frameGraph.ImportRenderTarget("BackBuffer", *context);
+
+        // Draw scene into multi-render-target (1st target: color, 2nd target: glossiness)
+        LLGL::ClearValue clearColor;
+        clearColor.color = backgroundColor;
+
+        LLGL::FrameGraphPassDescriptor passDescScene;
+        {
+            passDescScene.name                      = "Scene";
+            passDescScene.colorAttachments          = { { colorMap, clearColor }, { glossMap, LLGL::ClearValue{} } };
+            passDescScene.depthStencilAttachment    = { depthMap, LLGL::ClearValue{} };
+            passDescScene.execute                   = [this](LLGL::CommandBuffer&) { DrawScene(); };
+        }
+        frameGraph.AddPass(passDescScene);
+
+        // Draw horizontal blur pass
+        LLGL::FrameGraphPassDescriptor passDescBlurX;
+        {
+            passDescBlurX.name                      = "BlurX";
+            passDescBlurX.inputs                    = { glossMap };
+            passDescBlurX.colorAttachments          = { glossMapBlurX };
+            passDescBlurX.execute                   = [this](LLGL::CommandBuffer&) { DrawBlur({ 4.0f / static_cast<float>(screenSize.width), 0.0f }, 0); };
+        }
+        frameGraph.AddPass(passDescBlurX);
+
+        // Draw vertical blur pass
+        LLGL::FrameGraphPassDescriptor passDescBlurY;
+        {
+            passDescBlurY.name                      = "BlurY";
+            passDescBlurY.inputs                    = { glossMapBlurX };
+            passDescBlurY.colorAttachments          = { glossMapBlurY };
+            passDescBlurY.execute                   = [this](LLGL::CommandBuffer&) { DrawBlur({ 0.0f, 4.0f / static_cast<float>(screenSize.height) }, 1); };
+        }
+        frameGraph.AddPass(passDescBlurY);
+
+        // Draw final post-processing pass
+        LLGL::FrameGraphPassDescriptor passDescFinal;
+        {
+            passDescFinal.name                      = "Final";
+            passDescFinal.inputs                    = { colorMap, glossMapBlurY };
+            passDescFinal.colorAttachments          = { backBuffer };
+            passDescFinal.execute                   = [this](LLGL::CommandBuffer&) { DrawFinal(); };
+        }
+        frameGraph.AddPass(passDescFinal);
+
+        frameGraph.Compile();
+    }
+
     void CreateResourceHeaps()
     {
         // Create resource heap for scene rendering
@@ -427,8 +449,8 @@ public:
             heapDescBlur.pipelineLayout    = layoutBlur;
             heapDescBlur.resourceViews     =
             {
-                constantBufferBlur, glossMap,      glossMapSampler, // Resources for blur-X pass
-                constantBufferBlur, glossMapBlurX, glossMapSampler, // Resources for blur-Y pass
+                constantBufferBlur, frameGraph.GetTexture(glossMap),      glossMapSampler, // Resources for blur-X pass
+                constantBufferBlur, frameGraph.GetTexture(glossMapBlurX), glossMapSampler, // Resources for blur-Y pass
             };
         }
         resourceHeapBlur = renderer->CreateResourceHeap(heapDescBlur);
@@ -438,7 +460,14 @@ public:
         LLGL::ResourceHeapDescriptor heapDescFinal;
         {
             heapDescFinal.pipelineLayout    = layoutFinal;
-            heapDescFinal.resourceViews     = { constantBufferScene, colorMap, glossMapBlurY, colorMapSampler, glossMapSampler };
+            heapDescFinal.resourceViews     =
+            {
+                constantBufferScene,
+                frameGraph.GetTexture(colorMap),
+                frameGraph.GetTexture(glossMapBlurY),
+                colorMapSampler,
+                glossMapSampler,
+            };
         }
         resourceHeapFinal = renderer->CreateResourceHeap(heapDescFinal);
         resourceHeapFinal->SetName("ResourceHeap.Final");
@@ -446,29 +475,14 @@ public:
 
     void UpdateScreenSize()
     {
-        // Release previous textures
-        renderer->Release(*renderTargetScene);
-        renderer->Release(*renderTargetBlurX);
-        renderer->Release(*renderTargetBlurY);
-
+        // Release resource heaps that refer to the previous textures
         renderer->Release(*resourceHeapScene);
         renderer->Release(*resourceHeapBlur);
         renderer->Release(*resourceHeapFinal);
 
-        renderer->Release(*colorMap);
-        renderer->Release(*glossMap);
-        renderer->Release(*glossMapBlurX);
-        renderer->Release(*glossMapBlurY);
-
-        renderer->Release(*pipelineScene);
-        renderer->Release(*pipelineBlur);
-        renderer->Release(*pipelineFinal);
-
-        // Recreate objects
-        CreateTextures();
+        // Recompile frame graph and recreate resource heaps with its new textures
+        CreateFrameGraph();
         CreateResourceHeaps();
-        CreateRenderTargets();
-        CreatePipelines();
     }
 
 private:
@@ -523,6 +537,53 @@ private:
         commands->UpdateBuffer(*constantBufferBlur, 0, &blurSettings, sizeof(blurSettings));
     }
 
+    void DrawScene()
+    {
+        // Set viewport to full size
+        commands->SetViewport(screenSize);
+
+        // Set graphics pipeline and vertex buffer for scene rendering
+        commands->SetVertexBuffer(*vertexBufferScene);
+        commands->SetPipelineState(*pipelineScene);
+        commands->SetResourceHeap(*resourceHeapScene);
+
+        // Draw outer scene model
+        SetSceneSettingsOuterModel(outerModelDeltaRotation.y, outerModelDeltaRotation.x);
+        commands->Draw(numSceneVertices, 0);
+
+        // Draw inner scene model
+        SetSceneSettingsInnerModel(innerModelRotation);
+        commands->Draw(numSceneVertices, 0);
+    }
+
+    void DrawBlur(const Gs::Vector2f& blurShift, std::uint32_t descriptorSet)
+    {
+        // Draw blur passes in quarter resolution
+        commands->SetViewport(LLGL::Extent2D{ screenSize.width / 4, screenSize.height / 4 });
+
+        // Set graphics pipeline and vertex buffer for post-processors
+        commands->SetVertexBuffer(*vertexBufferNull);
+        commands->SetPipelineState(*pipelineBlur);
+        commands->SetResourceHeap(*resourceHeapBlur, descriptorSet);
+
+        // Draw fullscreen triangle (triangle is spanned in the vertex shader)
+        SetBlurSettings(blurShift);
+        commands->Draw(3, 0);
+    }
+
+    void DrawFinal()
+    {
+        // Set viewport back to full resolution
+        commands->SetViewport(screenSize);
+
+        commands->SetVertexBuffer(*vertexBufferNull);
+        commands->SetPipelineState(*pipelineFinal);
+        commands->SetResourceHeap(*resourceHeapFinal);
+
+        // Draw fullscreen triangle (triangle is spanned in the vertex shader)
+        commands->Draw(3, 0);
+    }
+
     void OnDrawFrame() override
     {
         #ifdef DEBUG_FPS
@@ -546,7 +607,6 @@ private:
         #endif
 
         // Update rotation of inner model
-        static float innerModelRotation;
         innerModelRotation += 0.01f;
 
         // Update rotation of outer model
@@ -556,9 +616,10 @@ private:
             static_cast<float>(input->GetMouseMotion().y),
         };
 
-        Gs::Vector2f outerModelDeltaRotation;
         if (input->KeyPressed(LLGL::Key::LButton))
             outerModelDeltaRotation = mouseMotion*0.005f;
+        else
+            outerModelDeltaRotation = Gs::Vector2f();
 
         // Update effect intensity animation
         if (input->KeyPressed(LLGL::Key::RButton))
@@ -570,109 +631,16 @@ private:
         }
 
         // Check if screen size has changed (this could also be done with an event listener)
-        static LLGL::Extent2D screenSize { 800, 600 };
-
         if (screenSize != context->GetVideoMode().resolution)
         {
             screenSize = context->GetVideoMode().resolution;
             UpdateScreenSize();
         }
 
-        // Initialize viewports
-        const LLGL::Viewport viewportFull{ { 0, 0 }, screenSize };
-        const LLGL::Viewport viewportQuarter{ { 0, 0 }, { screenSize.width / 4, screenSize.height/ 4 } };
-
+        // Record all passes of the frame graph
         commands->Begin();
         {
-            // Set graphics pipeline and vertex buffer for scene rendering
-            commands->SetVertexBuffer(*vertexBufferScene);
-
-            #ifdef ENABLE_CUSTOM_RENDER_PASS
-
-            // Clear scene render target with render pass and initial clear values
-            LLGL::ClearValue clearValues[3];
-            clearValues[0].color = backgroundColor;
-            clearValues[1].color = LLGL::ColorRGBAf{ 0, 0, 0, 1 };
-            clearValues[2].depth = 1.0f;
-
-            // Draw scene into multi-render-target (1st target: color, 2nd target: glossiness)
-            commands->BeginRenderPass(*renderTargetScene, renderPassScene, 3, clearValues);
-
-            #else
-
-            commands->BeginRenderPass(*renderTargetScene);
-
-            #endif // /ENABLE_CUSTOM_RENDER_PASS
-            {
-                // Set viewport to full size
-                commands->SetViewport(viewportFull);
-
-                #ifndef ENABLE_CUSTOM_RENDER_PASS
-
-                // Clear individual buffers in render target (color, glossiness, depth)
-                LLGL::AttachmentClear clearCmds[3] =
-                {
-                    LLGL::AttachmentClear{ backgroundColor, 0 },
-                    LLGL::AttachmentClear{ LLGL::ColorRGBAf{ 0, 0, 0, 0 }, 1 },
-                    LLGL::AttachmentClear{ 1.0f }
-                };
-                commands->ClearAttachments(3, clearCmds);
-
-                #endif // /ENABLE_CUSTOM_RENDER_PASS
-
-                // Bind pipeline and resources
-                commands->SetPipelineState(*pipelineScene);
-                commands->SetResourceHeap(*resourceHeapScene);
-
-                // Draw outer scene model
-                SetSceneSettingsOuterModel(outerModelDeltaRotation.y, outerModelDeltaRotation.x);
-                commands->Draw(numSceneVertices, 0);
-
-                // Draw inner scene model
-                SetSceneSettingsInnerModel(innerModelRotation);
-                commands->Draw(numSceneVertices, 0);
-            }
-            commands->EndRenderPass();
-
-            // Set graphics pipeline and vertex buffer for post-processors
-            commands->SetVertexBuffer(*vertexBufferNull);
-
-            // Draw horizontal blur pass
-            SetBlurSettings({ 4.0f / static_cast<float>(screenSize.width), 0.0f });
-            commands->BeginRenderPass(*renderTargetBlurX);
-            {
-                // Draw blur passes in quarter resolution
-                commands->SetViewport(viewportQuarter);
-
-                // Draw fullscreen triangle (triangle is spanned in the vertex shader)
-                commands->SetPipelineState(*pipelineBlur);
-                commands->SetResourceHeap(*resourceHeapBlur, 0);
-                commands->Draw(3, 0);
-            }
-            commands->EndRenderPass();
-
-            // Draw vertical blur pass
-            SetBlurSettings({ 0.0f, 4.0f / static_cast<float>(screenSize.height) });
-            commands->BeginRenderPass(*renderTargetBlurY);
-            {
-                // Draw fullscreen triangle (triangle is spanned in the vertex shader)
-                commands->SetResourceHeap(*resourceHeapBlur, 1);
-                commands->Draw(3, 0);
-            }
-            commands->EndRenderPass();
-
-            // Draw final post-processing pass
-            commands->BeginRenderPass(*context);
-            {
-                // Set viewport back to full resolution
-                commands->SetViewport(viewportFull);
-                commands->SetPipelineState(*pipelineFinal);
-                commands->SetResourceHeap(*resourceHeapFinal);
-
-                // Draw fullscreen triangle (triangle is spanned in the vertex shader)
-                commands->Draw(3, 0);
-            }
-            commands->EndRenderPass();
+            frameGraph.Execute(*commands);
         }
         commands->End();
         commandQueue->Submit(*commands);
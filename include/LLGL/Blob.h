@@ -20,6 +20,19 @@ namespace LLGL
 {
 
 
+/**
+\brief Hint for the memory access pattern of a memory mapped Blob.
+\see Blob::CreateFromMappedFile
+*/
+enum class BlobAccessHint
+{
+    Default,    //!< No access hint. The operating system uses its default paging behavior.
+    Sequential, //!< The data will be read sequentially from the beginning to the end. The operating system may read ahead more aggressively.
+    Random,     //!< The data will be read in random order. The operating system may disable read-ahead.
+    WillNeed,   //!< The data will be read soon. The operating system may start to read the entire file in the background.
+};
+
+
 /**
 \brief CPU read-only buffer of arbitrary size.
 \see RenderSystem::CreatePipelineState
@@ -73,6 +86,32 @@ class LLGL_EXPORT Blob : public NonCopyable
         */
         static std::unique_ptr<Blob> CreateFromFile(const std::string& filename);
 
+        /**
+        \brief Creates a new Blob instance that maps the content of the specified file into memory instead of reading it.
+        \param[in] filename Specifies the file that is to be mapped.
+        \param[in] accessHint Specifies a hint for how the data will be read. This is only passed on to the operating system
+        (e.g. with \c madvise on POSIX platforms) and does not restrict how the data can be accessed. By default BlobAccessHint::Default.
+        \return New instance of Blob that refers to the read-only memory mapping of the specified file or null if the file could not be mapped.
+        \remarks The file is not read until its pages are accessed, and no intermediate copy is made, i.e. the data of the mapping can be passed directly
+        to RenderSystem::CreateShader (see ShaderSourceType::BinaryBuffer), RenderSystem::CreateTexture, RenderSystem::WriteBuffer, and RenderSystem::CreatePipelineState.
+        The mapping is released when the Blob instance is destroyed, so the data must not be accessed afterwards.
+        The file must not be modified by another process as long as it is mapped.
+        \code
+        if (auto myShaderBinary = LLGL::Blob::CreateFromMappedFile("MyShader.spv", LLGL::BlobAccessHint::Sequential))
+        {
+            auto myShader = myRenderer->CreateShader(LLGL::ShaderDescFromBlob(LLGL::ShaderType::Vertex, *myShaderBinary));
+        }
+        \endcode
+        \see ShaderDescFromBlob
+        */
+        static std::unique_ptr<Blob> CreateFromMappedFile(const char* filename, const BlobAccessHint accessHint = BlobAccessHint::Default);
+
+        /**
+        \brief Creates a new Blob instance that maps the content of the specified file into memory instead of reading it.
+        \see CreateFromMappedFile(const char*, const BlobAccessHint)
+        */
+        static std::unique_ptr<Blob> CreateFromMappedFile(const std::string& filename, const BlobAccessHint accessHint = BlobAccessHint::Default);
+
     public:
 
         //! Returns a constant pointer to the internal buffer.
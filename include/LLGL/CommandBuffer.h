@@ -74,7 +74,8 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         This command buffer must have been created with the flag CommandBufferFlags::DeferredSubmit.
         \remarks This function can only be used by primary command buffers, i.e. command buffers that have not been created with the flag CommandBufferFlags::DeferredSubmit.
         \see CommandBufferFlags
-        \todo Incomplete for: D3D12, Vulkan, Metal.
+        \see CommandBufferDescriptor::renderPass
+        \todo Incomplete for: D3D12, Metal.
         */
         virtual void Execute(CommandBuffer& deferredCommandBuffer) = 0;
 
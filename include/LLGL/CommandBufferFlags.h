@@ -10,6 +10,7 @@
 
 
 #include "ColorRGBA.h"
+#include "ForwardDecls.h"
 
 
 namespace LLGL
@@ -83,7 +84,14 @@ struct CommandBufferFlags
         /**
         \brief Specifies that the encoded command buffer will be submitted as a secondary command buffer.
         \remarks If this is specified, the command buffer must be submitted using the \c Execute function of a primary command buffer.
+        Secondary command buffers are never synchronized with the GPU on their own:
+        encoding begins by resetting the next of the CommandBufferDescriptor::numNativeBuffers internal native command buffers without waiting for a fence.
+        Hence, a secondary command buffer must not be encoded again before all primary command buffers,
+        that executed the same native command buffer, have been completed on the GPU.
+        This is satisfied if a secondary command buffer is encoded at most once per encoding of its primary command buffer
+        and both have been created with the same number of native buffers.
         \see CommandBuffer::Execute
+        \see CommandBufferDescriptor::numNativeBuffers
         \todo Rename to \c Secondary
         */
         DeferredSubmit  = (1 << 0),
@@ -247,7 +255,7 @@ struct CommandBufferDescriptor
     the command buffer must be encoded again after it has been submitted to the command queue.
     \see CommandBufferFlags
     */
-    long            flags               = 0;
+    long                flags               = 0;
 
     /**
     \brief Specifies the number of internal native command buffers. By default 2.
@@ -258,7 +266,21 @@ struct CommandBufferDescriptor
     because it waits for a command buffer to be completed before it can be reused.
     \see CommandBuffer::Begin
     */
-    std::uint32_t   numNativeBuffers    = 2;
+    std::uint32_t       numNativeBuffers    = 2;
+
+    /**
+    \brief Specifies the render pass a secondary command buffer will be executed in. By default null.
+    \remarks This is only used for command buffers that have been created with the flag CommandBufferFlags::DeferredSubmit.
+    If this is non-null, the secondary command buffer continues the render pass of the primary command buffer it is executed in,
+    i.e. it can encode drawing commands without calling CommandBuffer::BeginRenderPass itself.
+    Secondary command buffers can be encoded in parallel on multiple threads, as long as each command buffer is only encoded by one thread at a time.
+    The same lifetime constraint as for all secondary command buffers applies, i.e. they must not be encoded again while a primary command buffer they were executed in is still in flight.
+    \note Only supported with: Vulkan.
+    \see CommandBufferFlags::DeferredSubmit
+    \see CommandBuffer::Execute
+    \see RenderTarget::GetRenderPass
+    */
+    const RenderPass*   renderPass          = nullptr;
 };
 
 
@@ -52,6 +52,12 @@ static const std::uint64_t  wholeSize       = ~0ull;
 */
 static const std::uint32_t invalidTimerID   = 0u;
 
+/**
+\brief Specifies an invalid frame graph resource, e.g. to leave the depth-stencil attachment of a frame graph pass unused.
+\see FrameGraphAttachment::resource
+*/
+static const std::uint32_t invalidFrameGraphResource = ~0u;
+
 
 } // /namespace Constants
 
@@ -13,6 +13,7 @@ namespace LLGL
 {
 
 
+class Blob;
 class Buffer;
 class BufferArray;
 class Canvas;
@@ -0,0 +1,348 @@
+/*
+ * FrameGraph.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_FRAME_GRAPH_H
+#define LLGL_FRAME_GRAPH_H
+
+
+#include "Export.h"
+#include "NonCopyable.h"
+#include "ForwardDecls.h"
+#include "Constants.h"
+#include "TextureFlags.h"
+#include "RenderPassFlags.h"
+#include "CommandBufferFlags.h"
+#include <functional>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Handle of a texture or render target within a frame graph.
+\see FrameGraph::CreateTexture
+\see FrameGraph::ImportTexture
+\see FrameGraph::ImportRenderTarget
+*/
+using FrameGraphResource = std::uint32_t;
+
+/**
+\brief Function that records the commands of a frame graph pass.
+\remarks If the pass has attachments, the render pass is already active when this function is called.
+\see FrameGraphPassDescriptor::execute
+*/
+using FrameGraphExecuteFunction = std::function<void(CommandBuffer& commandBuffer)>;
+
+/**
+\brief Frame graph pass attachment structure.
+\see FrameGraphPassDescriptor::colorAttachments
+\see FrameGraphPassDescriptor::depthStencilAttachment
+*/
+struct FrameGraphAttachment
+{
+    FrameGraphAttachment() = default;
+    FrameGraphAttachment(const FrameGraphAttachment&) = default;
+
+    //! Constructor to initialize the resource and optionally the load operation.
+    inline FrameGraphAttachment(FrameGraphResource resource, AttachmentLoadOp loadOp = AttachmentLoadOp::Undefined) :
+        resource { resource },
+        loadOp   { loadOp   }
+    {
+    }
+
+    //! Constructor to initialize the resource with a clear value.
+    inline FrameGraphAttachment(FrameGraphResource resource, const ClearValue& clearValue) :
+        resource   { resource                },
+        loadOp     { AttachmentLoadOp::Clear },
+        clearValue { clearValue              }
+    {
+    }
+
+    //! Resource that is written by this attachment. By default Constants::invalidFrameGraphResource, i.e. the attachment is unused.
+    FrameGraphResource  resource    = Constants::invalidFrameGraphResource;
+
+    /**
+    \brief Load operation of the previous content. By default AttachmentLoadOp::Undefined.
+    \remarks AttachmentLoadOp::Load makes the pass depend on the previous pass that wrote this resource.
+    The store operation is determined by the frame graph: the content is only stored if a subsequent pass depends on it or if the resource is imported.
+    */
+    AttachmentLoadOp    loadOp      = AttachmentLoadOp::Undefined;
+
+    //! Clear value that is used if \c loadOp is AttachmentLoadOp::Clear.
+    ClearValue          clearValue;
+};
+
+/**
+\brief Frame graph pass descriptor structure.
+\remarks All accesses to a resource are resolved in the order the passes are added to the frame graph,
+i.e. a pass that reads a resource depends on the latest pass that was added before it and writes that resource.
+\see FrameGraph::AddPass
+*/
+struct FrameGraphPassDescriptor
+{
+    //! Name of the pass for debugging purposes. This is also used as debug group name (see CommandBuffer::PushDebugGroup).
+    std::string                         name;
+
+    /**
+    \brief Textures that are read by this pass, e.g. sampled textures of a post-processing pass.
+    \remarks Transient textures must have been created with the binding flag BindFlags::Sampled or BindFlags::Storage.
+    */
+    std::vector<FrameGraphResource>     inputs;
+
+    /**
+    \brief Textures that are written by this pass without being attachments, e.g. storage textures of a compute pass.
+    \remarks These are written entirely, i.e. the pass does not depend on their previous content unless they are also specified as \c inputs.
+    */
+    std::vector<FrameGraphResource>     outputs;
+
+    /**
+    \brief Color attachments of this pass.
+    \remarks If one of these refers to an imported render target (see FrameGraph::ImportRenderTarget),
+    it must be the only attachment of this pass and the render target is used as is, including its own depth-stencil buffer.
+    Otherwise, the frame graph creates a render target with all attachments of this pass.
+    */
+    std::vector<FrameGraphAttachment>   colorAttachments;
+
+    //! Depth-stencil attachment of this pass. By default unused.
+    FrameGraphAttachment                depthStencilAttachment;
+
+    /**
+    \brief Specifies whether this pass has side effects the frame graph cannot see, e.g. writing a buffer that is read by the application. By default false.
+    \remarks Passes without side effects are culled if none of their outputs are used. Passes that write imported resources always have side effects.
+    */
+    bool                                sideEffects             = false;
+
+    //! Function that records the commands of this pass. This must not be empty.
+    FrameGraphExecuteFunction           execute;
+};
+
+/**
+\brief Statistics of the latest compiled frame graph.
+\see FrameGraph::GetStatistics
+*/
+struct FrameGraphStatistics
+{
+    //! Number of passes that are executed.
+    std::uint32_t numPasses             = 0;
+
+    //! Number of passes that were culled, because none of their outputs are used.
+    std::uint32_t numCulledPasses       = 0;
+
+    //! Number of transient textures that are used by the executed passes.
+    std::uint32_t numTransientTextures  = 0;
+
+    //! Number of textures that have been allocated for all transient textures.
+    std::uint32_t numPhysicalTextures   = 0;
+
+    //! Memory footprint (in bytes) all transient textures would have without aliasing.
+    std::uint64_t transientMemory       = 0;
+
+    //! Memory footprint (in bytes) of all textures that have been allocated for the transient textures.
+    std::uint64_t physicalMemory        = 0;
+};
+
+/**
+\brief Frame graph that schedules render passes by their declared inputs and outputs and aliases transient textures.
+\remarks The passes and resources of a frame are declared once and then compiled. Compiling culls all passes whose outputs are not used,
+determines the store operation of each attachment, and assigns the same texture to all transient textures that have equal descriptors
+and whose lifetimes do not overlap. A post-processing chain of N equally sized buffers, for instance, only requires two textures.
+The compiled graph can then be executed every frame until it is reset.
+\remarks Resource state transitions are handled by the render systems at render pass boundaries, so the frame graph does not insert any explicit barriers.
+\code
+auto gBuffer     = myFrameGraph.CreateTexture("GBuffer", myGBufferDesc);
+auto depthBuffer = myFrameGraph.CreateTexture("Depth", myDepthDesc);
+auto lighting    = myFrameGraph.CreateTexture("Lighting", myHDRDesc);
+auto backBuffer  = myFrameGraph.ImportRenderTarget("BackBuffer", *myContext, myContextRenderPass);
+
+LLGL::FrameGraphPassDescriptor gBufferPass;
+{
+    gBufferPass.name                    = "GBuffer";
+    gBufferPass.colorAttachments        = { { gBuffer, LLGL::ClearValue{} } };
+    gBufferPass.depthStencilAttachment  = { depthBuffer, LLGL::ClearValue{} };
+    gBufferPass.execute                 = [&](LLGL::CommandBuffer& cmdBuffer) { DrawScene(cmdBuffer); };
+}
+myFrameGraph.AddPass(gBufferPass);
+// ...
+myFrameGraph.Compile();
+
+// Once per frame
+myCmdBuffer->Begin();
+myFrameGraph.Execute(*myCmdBuffer);
+myCmdBuffer->End();
+\endcode
+*/
+class LLGL_EXPORT FrameGraph : public NonCopyable
+{
+
+    public:
+
+        /**
+        \brief Initializes an empty frame graph.
+        \param[in] renderSystem Specifies the render system that is used to create the transient textures and render targets. It must outlive this frame graph.
+        */
+        FrameGraph(RenderSystem& renderSystem);
+
+        //! Releases all textures, render targets, and render passes this frame graph has created.
+        ~FrameGraph();
+
+        /**
+        \brief Declares a transient texture whose memory is managed by the frame graph.
+        \param[in] name Specifies the name of the texture for debugging purposes. This must not be null.
+        \param[in] textureDesc Specifies the texture descriptor. The texture is created without initial data (see MiscFlags::NoInitialData).
+        \return Handle of the new resource.
+        \remarks The actual texture is only available after Compile and may be shared with other transient textures (see GetTexture).
+        */
+        FrameGraphResource CreateTexture(const char* name, const TextureDescriptor& textureDesc);
+
+        /**
+        \brief Imports a texture that is owned by the application, e.g. a shadow map that is also used in the next frame.
+        \remarks Passes that write an imported texture are never culled.
+        */
+        FrameGraphResource ImportTexture(const char* name, Texture& texture);
+
+        /**
+        \brief Imports a render target that is owned by the application, e.g. the render context.
+        \param[in] renderPass Specifies an optional render pass for CommandBuffer::BeginRenderPass.
+        If this is null, the default render pass of the render target is used. The clear values of the attachment refer to this render pass.
+        \remarks Passes that write an imported render target are never culled.
+        */
+        FrameGraphResource ImportRenderTarget(const char* name, RenderTarget& renderTarget, const RenderPass* renderPass = nullptr);
+
+        /**
+        \brief Adds a new pass to the frame graph.
+        \throws std::invalid_argument If the descriptor refers to an unknown resource, reads a transient texture that is not written by any previous pass,
+        uses an imported render target together with other attachments, or has no execute function.
+        \remarks Passes are executed in the order they are added, except for the passes that are culled.
+        */
+        void AddPass(const FrameGraphPassDescriptor& passDesc);
+
+        /**
+        \brief Compiles the frame graph, i.e. culls unused passes, assigns textures to all transient resources, and creates the render targets of all passes.
+        \remarks Textures of the previous compilation are reused if their descriptors match, so recompiling a similar frame graph does not reallocate them.
+        Textures that are no longer required are released.
+        */
+        void Compile();
+
+        /**
+        \brief Records all passes of the compiled frame graph into the specified command buffer.
+        \throws std::runtime_error If the frame graph has been modified since the last call to Compile.
+        */
+        void Execute(CommandBuffer& commandBuffer);
+
+        /**
+        \brief Removes all passes and resources from the frame graph, e.g. when the resolution changes.
+        \remarks The textures of the previous compilation are kept until the next call to Compile, so they can be reused.
+        */
+        void Reset();
+
+        /**
+        \brief Returns the texture of the specified resource.
+        \return Pointer to the texture, or null if the resource is an imported render target or a transient texture that is not used by any executed pass.
+        \remarks For transient textures, this is only valid after Compile, and the texture may be shared with other transient textures whose lifetimes do not overlap.
+        This can be used to create resource heaps for the passes after the frame graph has been compiled.
+        */
+        Texture* GetTexture(FrameGraphResource resource) const;
+
+        //! Returns the statistics of the latest compilation.
+        inline const FrameGraphStatistics& GetStatistics() const
+        {
+            return stats_;
+        }
+
+    private:
+
+        enum class ResourceType
+        {
+            Transient,
+            ImportedTexture,
+            ImportedRenderTarget,
+        };
+
+        struct ResourceEntry
+        {
+            std::string         name;
+            ResourceType        type            = ResourceType::Transient;
+            TextureDescriptor   textureDesc;
+            Texture*            texture         = nullptr;
+            RenderTarget*       renderTarget    = nullptr;
+            const RenderPass*   renderPass      = nullptr;
+            std::uint32_t       lastWriter      = ~0u;  // Index of the latest pass that has been added and writes this resource
+            std::uint32_t       firstUse        = ~0u;  // Position of the first executed pass that uses this resource
+            std::uint32_t       lastUse         = 0;    // Position of the last executed pass that uses this resource
+            std::uint32_t       physicalTexture = ~0u;
+        };
+
+        struct Dependency
+        {
+            std::uint32_t       pass;
+            FrameGraphResource  resource;
+        };
+
+        struct PassEntry
+        {
+            FrameGraphPassDescriptor    desc;
+            std::vector<Dependency>     dependencies;                   // Previous passes whose outputs are used by this pass
+            std::vector<bool>           storeColor;
+            bool                        storeDepthStencil   = false;
+            bool                        sideEffects         = false;
+            bool                        culled              = false;
+            RenderTarget*               renderTarget        = nullptr;  // Render target that is either imported or owned by this pass
+            const RenderPass*           renderPass          = nullptr;
+            RenderPass*                 ownRenderPass       = nullptr;  // Render pass that is owned by this pass, together with its render target
+            std::vector<ClearValue>     clearValues;
+        };
+
+        struct PhysicalTexture
+        {
+            TextureDescriptor   textureDesc;
+            Texture*            texture = nullptr;
+            std::uint32_t       lastUse = ~0u;  // Position of the last executed pass that uses this texture, or ~0u if it is unused
+        };
+
+    private:
+
+        FrameGraphResource AddResource(const char* name, ResourceType type);
+
+        const ResourceEntry& GetResource(FrameGraphResource resource) const;
+
+        void AddDependency(PassEntry& pass, FrameGraphResource resource);
+        void AddWrite(std::uint32_t passIndex, FrameGraphResource resource);
+
+        void CullPasses();
+        void DetermineLifetimes();
+        void AssignPhysicalTextures();
+        void CreatePassRenderTarget(PassEntry& pass);
+
+        void ReleasePassRenderTargets();
+
+    private:
+
+        RenderSystem&                   renderSystem_;
+
+        std::vector<ResourceEntry>      resources_;
+        std::vector<PassEntry>          passes_;
+        std::vector<std::uint32_t>      executionOrder_;
+        std::vector<PhysicalTexture>    physicalTextures_;
+
+        FrameGraphStatistics            stats_;
+        bool                            compiled_       = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
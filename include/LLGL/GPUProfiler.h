@@ -0,0 +1,196 @@
+/*
+ * GPUProfiler.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GPU_PROFILER_H
+#define LLGL_GPU_PROFILER_H
+
+
+#include "NonCopyable.h"
+#include "ForwardDecls.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Structure with the GPU timing of a single profiler scope.
+\see GPUProfiler::PushScope
+*/
+struct GPUProfileScope
+{
+    //! Name of the scope as specified in GPUProfiler::PushScope.
+    std::string     name;
+
+    //! Nesting depth of the scope, starting with 0 for top-level scopes.
+    std::uint32_t   depth       = 0;
+
+    //! Elapsed GPU time (in nanoseconds) between the beginning and the end of the scope.
+    std::uint64_t   elapsedTime = 0;
+};
+
+/**
+\brief GPU frame profile with the timings of all scopes that were recorded within one frame.
+\see GPUProfiler::GetLatestFrame
+*/
+struct GPUFrameProfile
+{
+    //! Index of the frame (counted by GPUProfiler::BeginFrame) these timings were recorded in.
+    std::uint64_t                   frameIndex  = 0;
+
+    //! List of all scopes in the order they were pushed.
+    std::vector<GPUProfileScope>    scopes;
+};
+
+/**
+\brief GPU profiler descriptor structure.
+\see GPUProfiler::GPUProfiler
+*/
+struct GPUProfilerDescriptor
+{
+    /**
+    \brief Number of frames whose timer queries can be in flight at the same time. By default 3.
+    \remarks Results of a frame are collected at the earliest one frame after it has been recorded, and at the latest when its queries are reused after this number of frames.
+    Results that are not available by then are dropped instead of waiting for the GPU. This must be greater than 1.
+    */
+    std::uint32_t   numFramesInFlight   = 3;
+
+    //! Maximum number of scopes per frame. Additional scopes within the same frame are not measured. By default 256.
+    std::uint32_t   maxScopesPerFrame   = 256;
+
+    //! Specifies whether each scope also pushes a debug group into the command buffer (see CommandBuffer::PushDebugGroup). By default true.
+    bool            debugGroups         = true;
+};
+
+/**
+\brief GPU timing profiler with low overhead that can remain enabled in release builds.
+\remarks This profiler measures the GPU time of nested scopes with a ring of timer query heaps (see QueryType::TimeElapsed).
+The results are collected several frames later without waiting for the GPU, so profiling does not introduce any pipeline stalls.
+\remarks For Vulkan, scopes should begin outside of render passes, because timer queries can only be reset outside of a render pass.
+\code
+// Once per frame
+myProfiler.BeginFrame();
+myCmdBuffer->Begin();
+{
+    myProfiler.PushScope(*myCmdBuffer, "ShadowPass");
+    myCmdBuffer->BeginRenderPass(*myShadowMap);
+    // ...
+    myCmdBuffer->EndRenderPass();
+    myProfiler.PopScope(*myCmdBuffer);
+}
+myCmdBuffer->End();
+myCmdQueue->Submit(*myCmdBuffer);
+myProfiler.EndFrame();
+
+// Print timings of latest frame whose results are available
+for (const auto& scope : myProfiler.GetLatestFrame().scopes)
+    std::cout << std::string(scope.depth * 2, ' ') << scope.name << ": " << scope.elapsedTime << " ns" << std::endl;
+\endcode
+\see QueryType::TimeElapsed
+*/
+class LLGL_EXPORT GPUProfiler : public NonCopyable
+{
+
+    public:
+
+        /**
+        \brief Initializes the profiler and creates one timer query heap for each frame in flight.
+        \param[in] renderSystem Specifies the render system that is used to create the query heaps. It must outlive this profiler.
+        \param[in] commandQueue Specifies the command queue that is used to query the results without waiting. It must outlive this profiler.
+        \param[in] desc Specifies the profiler descriptor.
+        \throws std::invalid_argument If \c desc.numFramesInFlight is less than 2 or \c desc.maxScopesPerFrame is zero.
+        */
+        GPUProfiler(RenderSystem& renderSystem, CommandQueue& commandQueue, const GPUProfilerDescriptor& desc = {});
+
+        //! Releases all query heaps of this profiler.
+        ~GPUProfiler();
+
+        /**
+        \brief Begins a new frame and collects the results of all previous frames that are available.
+        \remarks The results of the frame whose query heap is reused by the new frame are dropped if they are still not available.
+        */
+        void BeginFrame();
+
+        //! Ends the current frame. All scopes must have been popped at this point.
+        void EndFrame();
+
+        /**
+        \brief Begins a new scope in the specified command buffer and measures its GPU time until the respective call to PopScope.
+        \param[in] commandBuffer Specifies the command buffer the timer query is recorded in.
+        \param[in] name Specifies the name of the scope. This must not be null.
+        \remarks Scopes can be nested and may span multiple command buffers, but each PopScope must be recorded in the same command buffer as its PushScope.
+        */
+        void PushScope(CommandBuffer& commandBuffer, const char* name);
+
+        //! Ends the current scope in the specified command buffer.
+        void PopScope(CommandBuffer& commandBuffer);
+
+        //! Returns the profile of the latest frame whose results are available. The frame profile is empty until the first results are available.
+        inline const GPUFrameProfile& GetLatestFrame() const
+        {
+            return latestFrame_;
+        }
+
+        //! Returns the number of frames whose results were dropped, because they were not available in time.
+        inline std::uint64_t GetNumDroppedFrames() const
+        {
+            return numDroppedFrames_;
+        }
+
+    private:
+
+        struct ScopeRecord
+        {
+            std::string     name;
+            std::uint32_t   depth;
+            std::uint32_t   query;
+        };
+
+        struct FrameRecord
+        {
+            QueryHeap*                  queryHeap   = nullptr;
+            std::uint64_t               frameIndex  = 0;
+            std::vector<ScopeRecord>    scopes;
+            std::uint32_t               numQueries  = 0;
+            bool                        pending     = false;
+        };
+
+    private:
+
+        bool ResolveFrame(FrameRecord& frame);
+
+    private:
+
+        RenderSystem&               renderSystem_;
+        CommandQueue&               commandQueue_;
+        GPUProfilerDescriptor       desc_;
+
+        std::vector<FrameRecord>    frames_;
+        std::size_t                 currentFrame_       = 0;
+        std::uint64_t               frameCounter_       = 0;
+        bool                        insideFrame_        = false;
+
+        std::vector<std::uint32_t>  scopeStack_;        // Query indices of the open scopes; ~0u for scopes that are not measured
+        std::vector<std::uint64_t>  results_;
+
+        GPUFrameProfile             latestFrame_;
+        std::uint64_t               numDroppedFrames_   = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
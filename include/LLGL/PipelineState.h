@@ -23,7 +23,22 @@ namespace LLGL
 */
 class LLGL_EXPORT PipelineState : public RenderSystemChild
 {
-    LLGL_DECLARE_INTERFACE( InterfaceID::PipelineState );
+
+        LLGL_DECLARE_INTERFACE( InterfaceID::PipelineState );
+
+    public:
+
+        /**
+        \brief Returns true if this pipeline state can be used without waiting for its shaders to be compiled and linked.
+        \remarks If the render system compiles and links shaders asynchronously, pipeline states are returned immediately by RenderSystem::CreatePipelineState
+        while the driver is still compiling their shaders on its own worker threads. This allows an application to create many pipeline states up front
+        and to poll this function to determine which of them are ready, instead of serializing all shader compilations on the render thread.
+        Using a pipeline state that is not ready yet is still valid, but it will block until its shaders have been linked.
+        \remarks The default implementation always returns true.
+        \note Only supported with: OpenGL (with \c GL_KHR_parallel_shader_compile extension).
+        */
+        virtual bool IsReady() const;
+
 };
 
 
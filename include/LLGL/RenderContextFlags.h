@@ -115,6 +115,14 @@ struct RenderContextDescriptor
     */
     std::uint32_t           samples     = 1;
 
+    /**
+    \brief Specifies whether the depth-stencil buffer and the multi-sampled color buffers of the swap-chain are transient. By default false.
+    \remarks If this is true, the content of these buffers is discarded at the end of each render pass, i.e. only the resolved color buffer is presented.
+    \note Only supported with: Vulkan. All other renderers ignore this hint.
+    \see RenderTargetDescriptor::transientAttachments
+    */
+    bool                    transientAttachments = false;
+
     //! Video mode descriptor.
     VideoModeDescriptor     videoMode;
 };
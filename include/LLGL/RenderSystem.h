@@ -16,6 +16,7 @@
 #include "RenderSystemFlags.h"
 #include "RenderingProfiler.h"
 #include "RenderingDebugger.h"
+#include "RenderingCapture.h"
 
 #include "Blob.h"
 #include "Buffer.h"
@@ -70,6 +71,10 @@ renderSystem->WriteBuffer(*buffer, modificationData, ...);
 // Release object
 renderSystem->Release(*buffer);
 \endcode
+\remarks Creating and releasing objects is thread-safe for the Vulkan render system,
+i.e. resources such as buffers and textures can be created from multiple threads (e.g. asset streaming threads) concurrently.
+Other functions of the render system and all functions of the OpenGL render system must be called from a single thread at a time,
+unless the OpenGL render system is configured with a background upload context (see RendererConfigurationOpenGL::uploadContext).
 */
 class LLGL_EXPORT RenderSystem : public Interface
 {
@@ -94,6 +99,8 @@ class LLGL_EXPORT RenderSystem : public Interface
         \param[in] debugger Optional pointer to a rendering debugger. This is only supported if LLGL was compiled with the \c LLGL_ENABLE_DEBUG_LAYER flag.
         If the default debugger is used (i.e. no sub class of RenderingDebugger), then all reports will be send to the Log.
         In order to see any reports from the Log, use either Log::SetReportCallback or Log::SetReportCallbackStd.
+        \param[in] capture Optional pointer to a rendering capture that records all function calls of the render system. This is only supported if LLGL was compiled with the \c LLGL_ENABLE_DEBUG_LAYER flag.
+        The capture can be replayed with the ReplayCapture function, e.g. to compare the CPU overhead of different versions of a renderer.
         \remarks The descriptor structure can be initialized by only the module name like shown in the following example:
         \code
         // Load the "OpenGL" render system module
@@ -113,11 +120,13 @@ class LLGL_EXPORT RenderSystem : public Interface
         \endcode
         \throws std::runtime_error If loading the render system from the specified module failed.
         \see RenderSystemDescriptor::moduleName
+        \see RenderingCapture
         */
         static std::unique_ptr<RenderSystem> Load(
             const RenderSystemDescriptor&   renderSystemDesc,
             RenderingProfiler*              profiler            = nullptr,
-            RenderingDebugger*              debugger            = nullptr
+            RenderingDebugger*              debugger            = nullptr,
+            RenderingCapture*               capture             = nullptr
         );
 
         /**
@@ -179,6 +188,24 @@ class LLGL_EXPORT RenderSystem : public Interface
             return config_;
         }
 
+        /**
+        \brief Queries the current GPU memory statistics of this render system.
+        \param[out] stats Specifies the output statistics. The heap container is resized to the number of memory heaps of the device.
+        \return True if the statistics could be queried. Otherwise, the render system does not support memory statistics and the output is cleared.
+        \remarks This function is cheap enough to be called every frame, but it must be called on the thread that renders with this render system.
+        \see MemoryStatistics
+        */
+        virtual bool QueryMemoryStatistics(MemoryStatistics& stats);
+
+        /**
+        \brief Queries the statistics of the persistent shader cache of this render system.
+        \param[out] stats Specifies the output statistics.
+        \return True if the statistics could be queried. Otherwise, the render system has no shader cache and the output is cleared.
+        \see ShaderCacheStatistics
+        \see ShaderCacheDescriptor
+        */
+        virtual bool QueryShaderCacheStatistics(ShaderCacheStatistics& stats);
+
         /* ----- Render Context ----- */
 
         /**
@@ -337,13 +364,20 @@ class LLGL_EXPORT RenderSystem : public Interface
         /* ----- Samplers ---- */
 
         /**
-        \brief Creates a new Sampler object.
+        \brief Creates a new Sampler object or returns the one that has already been created with an equal descriptor.
+        \remarks Sampler objects are shared between all equal sampler descriptors, i.e. this function may return the same object for multiple calls.
+        A shared Sampler object is reference counted and only destroyed once it has been released as often as it has been created.
+        Consequently, a debug name that is assigned with Sampler::SetName applies to all users of the same Sampler object.
         \throws std::runtime_error If the renderer does not support Sampler objects (e.g. if OpenGL 3.1 or lower is used).
         \see GetRenderingCaps
         */
         virtual Sampler* CreateSampler(const SamplerDescriptor& desc) = 0;
 
-        //! Releases the specified Sampler object. After this call, the specified object must no longer be used.
+        /**
+        \brief Releases the specified Sampler object. After this call, the specified object must no longer be used.
+        \remarks If the Sampler object is shared, it is destroyed once the last reference to it has been released.
+        \see CreateSampler
+        */
         virtual void Release(Sampler& sampler) = 0;
 
         /* ----- Resource Heaps ----- */
@@ -555,6 +555,15 @@ struct RenderingFeatures
     \see CommandBuffer:BeginRenderCondition
     */
     bool hasRenderCondition             = false;
+
+    /**
+    \brief Specifies whether bindless resource tables are supported.
+    \remarks For OpenGL, this requires the extensions \c GL_ARB_bindless_texture and \c GL_ARB_shader_storage_buffer_object.
+    \remarks For Vulkan, this requires the extension \c VK_EXT_descriptor_indexing with support for runtime descriptor arrays,
+    partially bound descriptors, and updating sampled images after binding.
+    \see ResourceHeapDescriptor::bindless
+    */
+    bool hasBindlessResources           = false;
 };
 
 /**
@@ -749,6 +758,102 @@ struct RenderingCapabilities
     RenderingLimits                 limits;
 };
 
+/**
+\brief Memory statistics of a single memory heap.
+\remarks All sizes are specified in bytes. Values that cannot be determined by the render system are zero.
+\see MemoryStatistics::heaps
+*/
+struct MemoryHeapStatistics
+{
+    //! Total size of this memory heap as reported by the device. This is zero if the renderer cannot determine the heap size.
+    std::uint64_t   size                = 0;
+
+    /**
+    \brief Estimated amount of memory the application can use from this heap before allocations may fail or suffer performance penalties.
+    \remarks The difference between \c budget and \c usage is the amount of memory that can still be allocated.
+    This is zero if the renderer cannot determine a budget, e.g. if \c VK_EXT_memory_budget is not supported by the Vulkan device
+    or neither \c GL_NVX_gpu_memory_info nor \c GL_ATI_meminfo is supported by the GL driver.
+    \see usage
+    */
+    std::uint64_t   budget              = 0;
+
+    /**
+    \brief Estimated amount of memory that is currently in use from this heap.
+    \remarks If the driver does not report its own usage, this is equal to \c allocatedBytes.
+    \see budget
+    */
+    std::uint64_t   usage               = 0;
+
+    //! Amount of memory that has been allocated from the device by LLGL.
+    std::uint64_t   allocatedBytes      = 0;
+
+    //! Amount of allocated memory that is occupied by resources.
+    std::uint64_t   usedBytes           = 0;
+
+    //! Amount of allocated memory that has been freed but is fragmented between resources that are still in use.
+    std::uint64_t   fragmentedBytes     = 0;
+
+    //! Number of device memory allocations, e.g. \c vkAllocateMemory calls that have not been freed yet.
+    std::uint32_t   numAllocations      = 0;
+
+    //! Number of resources that occupy memory from this heap.
+    std::uint32_t   numBlocks           = 0;
+
+    //! Number of fragmented memory regions.
+    std::uint32_t   numFragments        = 0;
+
+    //! Specifies whether or not this heap is local to the device, i.e. video memory.
+    bool            deviceLocal         = false;
+};
+
+/**
+\brief Structure with GPU memory statistics of a render system.
+\remarks This structure is designed to be queried each frame, e.g. to throttle resource uploads before memory is exhausted.
+The same instance should be reused between queries to avoid frequent memory allocations.
+\see RenderSystem::QueryMemoryStatistics
+*/
+struct MemoryStatistics
+{
+    //! Statistics of all memory heaps of the device.
+    std::vector<MemoryHeapStatistics>   heaps;
+
+    //! Number of buffers that are currently allocated by the render system.
+    std::uint32_t                       numBuffers  = 0;
+
+    /**
+    \brief Number of textures that are currently allocated by the render system.
+    \remarks Texture views are not counted, since they share the memory of another texture.
+    */
+    std::uint32_t                       numTextures = 0;
+};
+
+/**
+\brief Structure with statistics of the persistent shader cache of a render system since the render system has been created.
+\remarks The hit rate of the shader cache is <code>numHits / (numHits + numMisses)</code>.
+\see RenderSystem::QueryShaderCacheStatistics
+\see ShaderCacheDescriptor
+*/
+struct ShaderCacheStatistics
+{
+    //! Number of cache entries that have been loaded successfully.
+    std::uint64_t   numHits         = 0;
+
+    //! Number of cache lookups that did not find a valid entry, including corrupted entries.
+    std::uint64_t   numMisses       = 0;
+
+    //! Number of cache entries that have been written.
+    std::uint64_t   numWrites       = 0;
+
+    //! Number of cache entries that have been evicted because the maximum cache size was exceeded.
+    std::uint64_t   numEvictions    = 0;
+
+    //! Number of cache entries that have been discarded because they were corrupted or did not match their key.
+    std::uint64_t   numCorrupted    = 0;
+
+    //! Total size (in bytes) of all cache entries.
+    std::uint64_t   totalSize       = 0;
+};
+
 
 /* ----- Functions ----- */
 
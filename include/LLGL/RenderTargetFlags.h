@@ -176,6 +176,16 @@ struct RenderTargetDescriptor
     */
     std::uint32_t                       samples             = 1;
 
+    /**
+    \brief Specifies whether the internal attachments of the render target are transient. By default false.
+    \remarks Internal attachments are the depth-stencil buffers for attachments without a texture and the multi-sampled color buffers that are resolved into the attached textures.
+    If this is true, the content of these attachments is discarded at the end of each render pass, i.e. it will not be preserved for a subsequent render pass on the same render target.
+    This allows the renderer to allocate them lazily or to keep them in tile memory only, which substantially reduces memory bandwidth for multi-sampling.
+    \note Only supported with: Vulkan. All other renderers ignore this hint.
+    \see MiscFlags::Transient
+    */
+    bool                                transientAttachments = false;
+
     #if 1//TODO: replace this
 
     /**
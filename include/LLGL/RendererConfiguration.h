@@ -62,6 +62,30 @@ struct ApplicationDescriptor
     std::uint32_t   engineVersion;
 };
 
+/**
+\brief Persistent shader cache descriptor structure.
+\remarks The shader cache stores compiled shader artifacts and shader reflections on disk,
+so identical shaders skip compilation and reflection when they are created again, e.g. in subsequent runs of the application.
+Cache entries are identified by the shader source, entry point, profile, macro definitions, compile flags, and shader attributes.
+\note Only supported with: OpenGL, Vulkan.
+\see RendererConfigurationVulkan::shaderCache
+\see RendererConfigurationOpenGL::shaderCache
+*/
+struct ShaderCacheDescriptor
+{
+    /**
+    \brief Specifies the directory where the cache entries are stored. By default empty, which disables the shader cache.
+    \remarks This must refer to an existing directory that is exclusively used by the shader cache.
+    */
+    std::string     path;
+
+    /**
+    \brief Specifies the maximum size (in bytes) of all cache entries. By default 64*1024*1024, i.e. 64 MB.
+    \remarks The least recently used entries are evicted once the total size of all entries exceeds this limit.
+    */
+    std::uint64_t   maxSize = 64*1024*1024;
+};
+
 /**
 \brief Structure for a Vulkan renderer specific configuration.
 \remarks The nomenclature here is "Renderer" instead of "RenderSystem" since the configuration is renderer specific
@@ -98,6 +122,30 @@ struct RendererConfigurationVulkan
     \todo Remove this as soon as Vulkan memory manage has been improved.
     */
     bool                        reduceDeviceMemoryFragmentation = false;
+
+    /**
+    \brief Persistent shader cache configuration. By default disabled.
+    \remarks Vulkan shaders are always loaded from SPIR-V, so the cache stores the shader reflections of shader programs.
+    \see ShaderCacheDescriptor
+    */
+    ShaderCacheDescriptor       shaderCache;
+
+    /**
+    \brief Specifies whether MIP-maps are generated with a compute shader instead of image blits (i.e. \c vkCmdBlitImage). By default false.
+    \remarks If enabled, CommandBuffer::GenerateMips and MiscFlags::GenerateMips generate up to 12 MIP-map levels of all selected array layers in a single compute dispatch,
+    where each work group reduces a 64x64 tile in shared memory and the last work group of each array layer reduces the remaining levels.
+    Each MIP-map level is a 2x2 box filter of the previous level, i.e. for odd sizes the last row or column of the previous level is not taken into account.
+    Source MIP-maps larger than 4096 texels in width or height need more than one dispatch.
+    This requires the \c shaderStorageImageReadWithoutFormat and \c shaderStorageImageWriteWithoutFormat device features
+    and is only used for 2D, 2D array, cube, and cube array textures that were created with the binding flags BindFlags::Sampled and BindFlags::Storage,
+    and whose format is not an integer format and supports storage images (e.g. Format::RGBA8UNorm but not Format::RGBA8UNorm_sRGB).
+    All other textures fall back to image blits.
+    \remarks Image blits are usually executed by dedicated hardware, so only enable this after profiling on the target device,
+    e.g. when blits are slow or not supported for a format.
+    \remarks The compute shader overrides the compute pipeline and the first descriptor set of the compute bind point,
+    so compute pipeline states and resource heaps must be bound again afterwards.
+    */
+    bool                        computeMips                     = false;
 };
 
 /**
@@ -122,6 +170,33 @@ struct RendererConfigurationOpenGL
     \remarks This member is ignored if \c contextProfile is OpenGLContextProfile::CompatibilityProfile.
     */
     int                     minorVersion    = 0;
+
+    /**
+    \brief Persistent shader cache configuration. By default disabled.
+    \remarks The cache stores the program binaries and shader reflections of shader programs.
+    This requires the \c GL_ARB_get_program_binary extension; otherwise, the shader cache is ignored.
+    \see ShaderCacheDescriptor
+    */
+    ShaderCacheDescriptor   shaderCache;
+
+    /**
+    \brief Specifies whether the render system creates its own OpenGL context that does not require a window or display server. By default false.
+    \remarks If enabled, the render system can be used without any RenderContext, e.g. for offscreen rendering into render targets on a server or in a headless CI environment.
+    The context is created with \c EGL_KHR_surfaceless_context if available, and with a pbuffer surface otherwise.
+    A RenderContext cannot be created for a headless render system.
+    \note Only supported with: Linux (requires LLGL to be built with \c LLGL_GL_ENABLE_EGL).
+    */
+    bool                    headless        = false;
+
+    /**
+    \brief Specifies whether the render system creates a background upload context for resource creation off the render thread. By default false.
+    \remarks If enabled, buffers and textures can be created, written, and released from any thread.
+    Such calls from a thread other than the render thread are executed on a worker thread with its own OpenGL context that shares all objects with the render thread.
+    The render thread waits on the GPU for these uploads at the beginning of the next command buffer recording (CommandBuffer::Begin) or submission.
+    Vertex array objects cannot be shared between OpenGL contexts, so the vertex format of new vertex buffers is only built at that point on the render thread.
+    \note Only supported with: Linux.
+    */
+    bool                    uploadContext   = false;
 };
 
 /**
@@ -0,0 +1,126 @@
+/*
+ * RenderingCapture.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_RENDERING_CAPTURE_H
+#define LLGL_RENDERING_CAPTURE_H
+
+
+#include "Export.h"
+#include "NonCopyable.h"
+#include "ForwardDecls.h"
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class CaptureWriter;
+
+/**
+\brief Statistics of a replayed command capture.
+\see ReplayCapture
+*/
+struct CaptureReplayStatistics
+{
+    //! Number of replayed frames, i.e. the number of RenderContext::Present calls in the capture.
+    std::uint32_t       numFrames   = 0;
+
+    //! Number of replayed function calls of all render system objects.
+    std::uint64_t       numCommands = 0;
+
+    /**
+    \brief CPU time (in seconds) of each replayed frame, i.e. of all function calls since the previous frame.
+    \remarks The first frame also includes all function calls before it, e.g. the creation of all initial resources.
+    */
+    std::vector<double> frameTimes;
+
+    //! CPU time (in seconds) of the entire replay.
+    double              totalTime   = 0.0;
+};
+
+/**
+\brief Rendering capture that serializes all render system calls into a binary trace.
+\remarks This is used to replay the rendering of an application without the application itself, e.g. to bisect CPU overhead regressions of the renderer.
+The capture is passed to RenderSystem::Load and records all calls to the render system, command queue, command buffers, and the RenderContext::Present function,
+including the contents of all buffers and textures that are passed to the render system. The capture must outlive the render system.
+\remarks Only the calls that are made between RenderSystem::Load and RenderingCapture::Finalize are recorded,
+so the capture always contains the creation of all objects it refers to. Calls from multiple threads must not overlap.
+\code
+// Capture rendering of the application
+LLGL::RenderingCapture myCapture;
+auto myRenderSystem = LLGL::RenderSystem::Load("OpenGL", nullptr, nullptr, &myCapture);
+// ...
+auto myTrace = myCapture.Finalize();
+std::ofstream file{ "MyApp.llct", std::ios::binary };
+file.write(reinterpret_cast<const char*>(myTrace->GetData()), static_cast<std::streamsize>(myTrace->GetSize()));
+
+// Replay capture with any other render system
+auto myStats = LLGL::ReplayCapture(*myOtherRenderSystem, *LLGL::Blob::CreateFromFile("MyApp.llct"));
+\endcode
+\see RenderSystem::Load
+\see ReplayCapture
+*/
+class LLGL_EXPORT RenderingCapture : public NonCopyable
+{
+
+    public:
+
+        RenderingCapture();
+        ~RenderingCapture();
+
+        /**
+        \brief Ends the capture and returns the serialized trace of all recorded function calls.
+        \return Blob with the binary trace, or null if the capture has already been finalized.
+        \remarks After this call, no more function calls are recorded.
+        */
+        std::unique_ptr<Blob> Finalize();
+
+        //! Returns the number of frames that have been recorded so far, i.e. the number of RenderContext::Present calls.
+        std::uint32_t GetNumFrames() const;
+
+        //! Returns true if this capture has been finalized.
+        bool IsFinalized() const;
+
+    protected:
+
+        friend class DbgRenderSystem;
+
+        // Returns the internal writer of this capture.
+        CaptureWriter& GetWriter();
+
+    private:
+
+        std::unique_ptr<CaptureWriter> writer_;
+
+};
+
+/**
+\brief Replays the specified command capture with the specified render system as fast as possible.
+\param[in] renderSystem Specifies the render system that is used to replay the capture. This can be a different renderer than the one the capture was recorded with.
+\param[in] capture Specifies the binary trace that was returned by RenderingCapture::Finalize.
+\return Statistics with the CPU time of each replayed frame.
+\throws std::runtime_error If the capture is invalid, refers to an unknown object, or was recorded with an incompatible version.
+\remarks Render contexts of the capture are replaced by render targets with the same resolution, so no window is required to replay a capture.
+This allows the capture to be replayed with a headless render system (see RendererConfigurationOpenGL::headless).
+All objects that have not been released by the capture are released after the replay.
+\remarks Query results and texture read-backs are requested as in the capture, but their results are discarded.
+\see RenderingCapture
+*/
+LLGL_EXPORT CaptureReplayStatistics ReplayCapture(RenderSystem& renderSystem, const Blob& capture);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
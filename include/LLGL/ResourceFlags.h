@@ -245,6 +245,17 @@ struct MiscFlags
         \see https://docs.microsoft.com/en-us/windows/win32/api/d3d11/ne-d3d11-d3d11_buffer_uav_flag
         */
         Counter         = (1 << 5),
+
+        /**
+        \brief Hint to the renderer that the texture is only used as a transient attachment, i.e. its content is neither loaded nor stored outside of a render pass.
+        \remarks This is useful for multi-sampled or depth-stencil attachments that are only resolved or discarded at the end of a render pass.
+        On tile-based GPUs, such attachments might never be backed by physical memory.
+        \remarks This can only be used with textures that have the binding flag BindFlags::ColorAttachment or BindFlags::DepthStencilAttachment but no other binding flags.
+        Such textures cannot be initialized with image data, nor read or written by the CPU.
+        \note Only supported with: Vulkan. All other renderers ignore this hint.
+        \see RenderTargetDescriptor::transientAttachments
+        */
+        Transient       = (1 << 6),
     };
 };
 
@@ -101,6 +101,21 @@ struct ResourceHeapDescriptor
     \see PipelineLayoutDescriptor::bindings
     */
     std::vector<ResourceViewDescriptor> resourceViews;
+
+    /**
+    \brief Specifies whether sampled texture bindings are bound as bindless resource tables. By default false.
+    \remarks If enabled, each binding of the pipeline layout with type ResourceType::Texture and the BindFlags::Sampled flag denotes a table of textures,
+    which consumes as many consecutive resource views as specified by BindingDescriptor::arraySize. All other bindings consume one resource view as usual.
+    Shaders address the textures of a table with a dynamically uniform index, so switching between these textures only requires to update an integer (e.g. a uniform or per-instance attribute)
+    instead of binding another resource heap for each draw call.
+    \remarks For OpenGL, a table is a shader storage buffer of texture handles (\c GL_ARB_bindless_texture) that is bound to the binding slot,
+    e.g. <code>layout(std430, binding = 1) readonly buffer TextureTable { sampler2D textures[]; };</code>.
+    These handles combine the texture with its own sampling parameters, i.e. sampler states and texture subresource views are ignored for table entries.
+    \remarks For Vulkan, a table is an array of sampled images, e.g. <code>layout(binding = 1) uniform texture2D textures[256];</code>.
+    \note Only supported with: OpenGL, Vulkan.
+    \see RenderingFeatures::hasBindlessResources
+    */
+    bool                                bindless       = false;
 };
 
 
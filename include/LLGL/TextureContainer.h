@@ -0,0 +1,78 @@
+/*
+ * TextureContainer.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_TEXTURE_CONTAINER_H
+#define LLGL_TEXTURE_CONTAINER_H
+
+
+#include "Export.h"
+#include "ForwardDecls.h"
+#include "TextureFlags.h"
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Texture container file format enumeration.
+\see GetTextureContainerFormat
+*/
+enum class TextureContainerFormat
+{
+    Unknown,    //!< Unknown or unsupported container format.
+    DDS,        //!< DirectDraw Surface (DDS) container, including the DX10 header extension.
+    KTX2,       //!< Khronos Texture 2.0 (KTX2) container without supercompression.
+};
+
+/**
+\brief Returns the texture container format of the specified data by its file identifier.
+\param[in] blob Specifies the container data, e.g. a memory mapped file (see Blob::CreateFromMappedFile).
+\return TextureContainerFormat::DDS or TextureContainerFormat::KTX2 if the identifier matches, otherwise TextureContainerFormat::Unknown.
+*/
+LLGL_EXPORT TextureContainerFormat GetTextureContainerFormat(const Blob& blob);
+
+/**
+\brief Reads the header of the specified texture container and returns the respective texture descriptor.
+\param[in] blob Specifies the container data, e.g. a memory mapped file (see Blob::CreateFromMappedFile).
+\param[in] bindFlags Specifies the binding flags for the output descriptor. By default BindFlags::Sampled.
+\param[in] miscFlags Specifies the miscellaneous flags for the output descriptor. By default 0.
+\return Texture descriptor with the texture type, format, extent, number of array layers, and number of MIP-map levels of the container.
+\throws std::runtime_error If the container format is unknown, the header is invalid, or the pixel format cannot be mapped to LLGL::Format.
+\remarks Only the header is read, so the image data is not accessed.
+\see CreateTextureFromContainer
+*/
+LLGL_EXPORT TextureDescriptor GetTextureContainerDesc(const Blob& blob, long bindFlags = BindFlags::Sampled, long miscFlags = 0);
+
+/**
+\brief Creates a texture from the specified DDS or KTX2 container.
+\param[in] renderSystem Specifies the render system that is used to create and write the texture.
+\param[in] blob Specifies the container data. To avoid reading the entire file into memory, this should be a memory mapped file (see Blob::CreateFromMappedFile).
+\param[in] bindFlags Specifies the binding flags for the new texture. By default BindFlags::Sampled.
+\param[in] miscFlags Specifies the miscellaneous flags for the new texture. By default 0.
+\return Pointer to the new texture with all MIP-map levels and array layers of the container.
+\throws std::runtime_error If the container is invalid or truncated (see GetTextureContainerDesc).
+\remarks The texture is created without initial data and then each MIP-map level of each array layer is written with RenderSystem::WriteTexture
+directly from the container data, i.e. no intermediate image is decoded. This works for block compressed formats (e.g. Format::BC1UNorm) as well,
+as long as the render system supports the respective format. If the container does not specify the number of MIP-map levels, the texture has a single MIP-map level.
+\code
+if (auto myTextureFile = LLGL::Blob::CreateFromMappedFile("MyTexture.dds", LLGL::BlobAccessHint::Sequential))
+    myTexture = LLGL::CreateTextureFromContainer(*myRenderer, *myTextureFile);
+\endcode
+\see GetTextureContainerDesc
+*/
+LLGL_EXPORT Texture* CreateTextureFromContainer(RenderSystem& renderSystem, const Blob& blob, long bindFlags = BindFlags::Sampled, long miscFlags = 0);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
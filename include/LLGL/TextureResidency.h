@@ -0,0 +1,318 @@
+/*
+ * TextureResidency.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_TEXTURE_RESIDENCY_H
+#define LLGL_TEXTURE_RESIDENCY_H
+
+
+#include "Export.h"
+#include "NonCopyable.h"
+#include "ForwardDecls.h"
+#include "TextureFlags.h"
+#include "ResourceHeapFlags.h"
+#include "RenderSystemFlags.h"
+#include <functional>
+#include <unordered_map>
+#include <future>
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Handle of a texture whose residency is managed by a texture residency manager.
+\see TextureResidencyManager::AddTexture
+*/
+using ResidentTexture = std::uint32_t;
+
+/**
+\brief Handle of a resource heap that refers to textures of a texture residency manager.
+\see TextureResidencyManager::CreateResourceHeap
+*/
+using ResidentResourceHeap = std::uint32_t;
+
+/**
+\brief Function that loads the image data of a single MIP-map level of a resident texture.
+\param[in] mipLevel Specifies the MIP-map level that is to be loaded. The first and largest MIP-map level has index zero.
+\param[out] imageData Specifies the output container for the image data. The data must be tightly packed in the hardware format of the texture
+and contain all array layers of this MIP-map level, i.e. the same layout as RenderSystem::WriteTexture expects for compressed formats.
+\return True if the MIP-map level has been loaded successfully.
+\remarks Except for the smallest MIP-map levels, which are loaded when a texture is added, this function is called on a worker thread.
+It must therefore not access the render system and must be safe to call concurrently for different textures.
+\see TextureResidencyManager::AddTexture
+*/
+using TextureMipLoadFunction = std::function<bool(std::uint32_t mipLevel, std::vector<char>& imageData)>;
+
+/**
+\brief Texture residency manager descriptor structure.
+\see TextureResidencyManager::TextureResidencyManager
+*/
+struct TextureResidencyDescriptor
+{
+    /**
+    \brief Memory budget (in bytes) for all resident textures. By default 0.
+    \remarks If this is zero, the budget is determined every frame by RenderSystem::QueryMemoryStatistics, i.e. the remaining budget of all device local heaps
+    plus the memory of the resident textures. If the render system does not report a budget either, textures are never downgraded.
+    */
+    std::uint64_t   budget                  = 0;
+
+    /**
+    \brief Number of the smallest MIP-map levels that always stay resident. By default 7, i.e. up to 64x64 texels.
+    \remarks These MIP-map levels are loaded when a texture is added and are never evicted.
+    */
+    std::uint32_t   minResidentMipLevels    = 7;
+
+    /**
+    \brief Number of frames a texture must remain unused before it can be downgraded to make room for other textures. By default 60.
+    \remarks Textures are only downgraded regardless of their last use if the memory budget is exceeded.
+    */
+    std::uint32_t   evictionDelay           = 60;
+
+    //! Maximum number of bytes that are uploaded per frame (see TextureResidencyManager::Update). This spreads reloading over multiple frames. By default 16 MB.
+    std::uint64_t   uploadBytesPerFrame     = 16*1024*1024;
+
+    //! Maximum number of MIP-map levels that are loaded concurrently by worker threads. By default 4.
+    std::uint32_t   maxPendingLoads         = 4;
+
+    /**
+    \brief Number of frames that can be in flight at the same time. By default 3.
+    \remarks Textures and resource heaps that are replaced are only released after this number of frames, so they are no longer used by the GPU.
+    */
+    std::uint32_t   numFramesInFlight       = 3;
+};
+
+/**
+\brief Statistics of a texture residency manager.
+\see TextureResidencyManager::GetStatistics
+*/
+struct TextureResidencyStatistics
+{
+    //! Memory budget (in bytes) of the latest update.
+    std::uint64_t budget            = 0;
+
+    //! Memory footprint (in bytes) of all resident MIP-map levels.
+    std::uint64_t residentMemory    = 0;
+
+    //! Memory footprint (in bytes) all textures would have if all of their MIP-map levels were resident.
+    std::uint64_t requestedMemory   = 0;
+
+    //! Number of bytes that have been uploaded in the latest update.
+    std::uint64_t uploadedBytes     = 0;
+
+    //! Number of textures that are managed.
+    std::uint32_t numTextures       = 0;
+
+    //! Number of MIP-map levels that are currently loaded by worker threads.
+    std::uint32_t numPendingLoads   = 0;
+
+    //! Number of textures that have been downgraded in the latest update.
+    std::uint32_t numDowngrades     = 0;
+
+    //! Number of textures that have been upgraded in the latest update.
+    std::uint32_t numUpgrades       = 0;
+};
+
+/**
+\brief Texture residency manager that keeps the memory of MIP-mapped textures within a budget.
+\remarks Each managed texture only keeps a range of its MIP-map levels resident, from the first resident MIP-map level down to the smallest one.
+Textures that are used (see UseTexture and UseResourceHeap) are upgraded one MIP-map level at a time: the next larger level is loaded on a worker thread
+and uploaded during a later call to Update. If the budget is exceeded, the least recently used textures are downgraded by dropping their largest MIP-map levels.
+\remarks Since the extent of a texture cannot change, upgrading and downgrading replaces the texture with a new one and copies the remaining MIP-map levels on the GPU.
+Hence, GetTexture may return a different texture after each call to Update, and resource heaps that refer to managed textures
+must be created with CreateResourceHeap, so they can be recreated when one of their textures is replaced.
+\code
+auto myResidentTexture = myResidency.AddTexture(myTextureDesc, [=](std::uint32_t mipLevel, std::vector<char>& imageData) {
+    return MyLoadMipLevelFromFile(myTexturePath, mipLevel, imageData);
+});
+// ...
+auto myResidentHeap = myResidency.CreateResourceHeap(myResourceHeapDesc); // Refers to myResidency.GetTexture(myResidentTexture)
+
+// Once per frame
+myResidency.Update();
+myCmdBuffer->Begin();
+myCmdBuffer->SetResourceHeap(myResidency.UseResourceHeap(myResidentHeap));
+// ...
+\endcode
+*/
+class LLGL_EXPORT TextureResidencyManager : public NonCopyable
+{
+
+    public:
+
+        /**
+        \brief Initializes the residency manager and creates the command buffer that is used to copy MIP-map levels.
+        \param[in] renderSystem Specifies the render system that is used to create the textures and resource heaps. It must outlive this manager.
+        \param[in] desc Specifies the residency descriptor.
+        \throws std::invalid_argument If \c desc.minResidentMipLevels, \c desc.maxPendingLoads, or \c desc.numFramesInFlight is zero.
+        */
+        TextureResidencyManager(RenderSystem& renderSystem, const TextureResidencyDescriptor& desc = {});
+
+        //! Waits for all pending loads and for the command queue to become idle, then releases all textures, resource heaps, and the command buffer of this manager.
+        ~TextureResidencyManager();
+
+        /**
+        \brief Adds a new texture whose residency is managed by this manager.
+        \param[in] textureDesc Specifies the descriptor of the texture with all of its MIP-map levels.
+        The binding flags BindFlags::CopySrc and BindFlags::CopyDst are added implicitly.
+        \param[in] loadFunction Specifies the function that loads the image data of a single MIP-map level. This must not be null.
+        \return Handle of the new texture.
+        \throws std::invalid_argument If the texture is a multi-sampled texture or the load function is null.
+        \throws std::runtime_error If one of the smallest MIP-map levels could not be loaded.
+        \remarks Only the smallest MIP-map levels (see TextureResidencyDescriptor::minResidentMipLevels) are loaded immediately.
+        The larger MIP-map levels are loaded once the texture is used.
+        */
+        ResidentTexture AddTexture(const TextureDescriptor& textureDesc, const TextureMipLoadFunction& loadFunction);
+
+        /**
+        \brief Removes the specified texture from this manager and releases it.
+        \throws std::invalid_argument If a resource heap of this manager still refers to this texture.
+        \remarks This waits for a pending load of this texture. Resource heaps that refer to this texture must be released first (see ReleaseResourceHeap).
+        \remarks The handle becomes invalid and can be returned again by a subsequent call to AddTexture.
+        */
+        void RemoveTexture(ResidentTexture texture);
+
+        //! Returns the current texture of the specified handle. This may change after each call to Update.
+        Texture* GetTexture(ResidentTexture texture) const;
+
+        //! Returns the first resident MIP-map level of the specified texture, i.e. zero if all MIP-map levels are resident.
+        std::uint32_t GetResidentMipLevel(ResidentTexture texture) const;
+
+        //! Marks the specified texture as used in the current frame, e.g. if it is bound without a resource heap of this manager.
+        void UseTexture(ResidentTexture texture);
+
+        /**
+        \brief Creates a resource heap that can refer to the textures of this manager.
+        \param[in] desc Specifies the resource heap descriptor. Managed textures are specified by their current texture (see GetTexture).
+        \return Handle of the new resource heap.
+        \throws std::invalid_argument If a managed texture is referred to with a texture subresource view, since its MIP-map levels change with its residency.
+        \remarks The resource heap is recreated whenever one of its managed textures is replaced.
+        */
+        ResidentResourceHeap CreateResourceHeap(const ResourceHeapDescriptor& desc);
+
+        //! Releases the specified resource heap.
+        void ReleaseResourceHeap(ResidentResourceHeap resourceHeap);
+
+        /**
+        \brief Marks all managed textures of the specified resource heap as used in the current frame and returns the current resource heap.
+        \remarks This must be called every time the resource heap is bound, because the returned resource heap may change after each call to Update.
+        */
+        ResourceHeap& UseResourceHeap(ResidentResourceHeap resourceHeap);
+
+        /**
+        \brief Updates the residency of all textures. This must be called once per frame before any textures or resource heaps are used.
+        \remarks This uploads the MIP-map levels that have been loaded, downgrades the least recently used textures if the budget is exceeded,
+        starts loading the next MIP-map levels of recently used textures, and releases replaced textures that are no longer in flight.
+        Copy commands are submitted to the command queue of the render system before this function returns.
+        */
+        void Update();
+
+        //! Returns the statistics of the latest update.
+        inline const TextureResidencyStatistics& GetStatistics() const
+        {
+            return stats_;
+        }
+
+    private:
+
+        struct PendingLoad
+        {
+            std::uint32_t       mipLevel    = 0;
+            std::vector<char>   imageData;
+            std::future<bool>   result;
+        };
+
+        struct TextureEntry
+        {
+            TextureDescriptor               textureDesc;                // Descriptor with all MIP-map levels
+            TextureMipLoadFunction          loadFunction;
+            Texture*                        texture         = nullptr;
+            std::vector<std::uint64_t>      mipSizes;                   // Memory footprint of each MIP-map level including all array layers
+            std::uint32_t                   residentLevel   = 0;        // First resident MIP-map level
+            std::uint32_t                   tailLevel       = 0;        // First MIP-map level that always stays resident
+            std::uint64_t                   lastUse         = 0;        // Frame of the latest use, or zero if the texture has never been used
+            std::unique_ptr<PendingLoad>    pendingLoad;
+            bool                            loadFailed      = false;
+            bool                            active          = false;
+        };
+
+        struct ResourceHeapEntry
+        {
+            ResourceHeapDescriptor          desc;
+            std::vector<std::uint32_t>      textureViews;               // Indices of resource views that refer to managed textures
+            std::vector<ResidentTexture>    textures;
+            ResourceHeap*                   resourceHeap    = nullptr;
+            bool                            dirty           = false;
+        };
+
+        struct RetiredObject
+        {
+            Texture*                        texture         = nullptr;
+            ResourceHeap*                   resourceHeap    = nullptr;
+            std::uint64_t                   frame           = 0;
+        };
+
+    private:
+
+        TextureEntry& GetTextureEntry(ResidentTexture texture);
+        const TextureEntry& GetTextureEntry(ResidentTexture texture) const;
+        ResourceHeapEntry& GetResourceHeapEntry(ResidentResourceHeap resourceHeap);
+
+        std::uint64_t GetResidentMemory(const TextureEntry& entry, std::uint32_t residentLevel) const;
+        std::uint64_t DetermineBudget();
+
+        Texture* CreateResidentTexture(const TextureEntry& entry, std::uint32_t residentLevel);
+        void WriteMipLevel(Texture& texture, const TextureEntry& entry, std::uint32_t mipLevel, std::uint32_t residentLevel, const std::vector<char>& imageData);
+        void ReplaceTexture(ResidentTexture texture, std::uint32_t residentLevel);
+
+        void UploadPendingLoads();
+        void DowngradeTextures(std::uint64_t maxResidentMemory, std::uint64_t minUnusedFrames);
+        void StartPendingLoads(std::uint64_t budget);
+
+        void BeginCopyCommands();
+        void Retire(Texture* texture, ResourceHeap* resourceHeap);
+        void ReleaseRetiredObjects(bool releaseAll);
+
+    private:
+
+        RenderSystem&                                   renderSystem_;
+        TextureResidencyDescriptor                      desc_;
+        CommandBuffer*                                  commandBuffer_      = nullptr;
+        bool                                            recording_          = false;
+
+        std::vector<TextureEntry>                       textures_;
+        std::vector<ResidentTexture>                    freeTextures_;
+        std::unordered_map<const Texture*, ResidentTexture> textureHandles_;
+
+        std::vector<ResourceHeapEntry>                  resourceHeaps_;
+        std::vector<ResidentResourceHeap>               freeResourceHeaps_;
+
+        std::vector<RetiredObject>                      retiredObjects_;
+        std::vector<ResidentTexture>                    loadCandidates_;    // Reused between updates to avoid frequent memory allocations
+        std::vector<ResidentTexture>                    evictCandidates_;
+
+        std::uint64_t                                   frame_              = 1;
+        std::uint64_t                                   residentMemory_     = 0;
+        std::uint64_t                                   requestedMemory_    = 0;
+        std::uint32_t                                   numPendingLoads_    = 0;
+        MemoryStatistics                                memoryStats_;
+        TextureResidencyStatistics                      stats_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -131,6 +131,15 @@ LLGL_EXPORT BufferDescriptor StorageBufferDesc(uint64_t size, const StorageBuffe
 */
 LLGL_EXPORT ShaderDescriptor ShaderDescFromFile(const ShaderType type, const char* filename, const char* entryPoint = nullptr, const char* profile = nullptr, long flags = 0);
 
+/**
+\brief Returns a ShaderDescriptor structure for a shader binary that refers to the data of the specified Blob (i.e. ShaderSourceType::BinaryBuffer).
+\remarks The blob data is not copied, so the blob must remain valid until the shader has been created.
+This can be used to create a shader directly from a memory mapped file without an intermediate copy.
+\see Blob::CreateFromMappedFile
+\see RenderSystem::CreateShader
+*/
+LLGL_EXPORT ShaderDescriptor ShaderDescFromBlob(const ShaderType type, const Blob& blob, const char* entryPoint = nullptr, const char* profile = nullptr, long flags = 0);
+
 /* ----- ShaderProgramDescriptor utility functions ----- */
 
 /**
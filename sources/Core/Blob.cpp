@@ -7,9 +7,21 @@
 
 #include <LLGL/Blob.h>
 #include <LLGL/ImageFlags.h>
+#include <LLGL/Platform/Platform.h>
 #include <fstream>
+#include <cstdint>
 #include "Helper.h"
 
+#ifdef LLGL_OS_WIN32
+#   include "../Platform/Win32/Win32LeanAndMean.h"
+#   include <Windows.h>
+#else
+#   include <fcntl.h>
+#   include <unistd.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#endif
+
 
 namespace LLGL
 {
@@ -151,6 +163,138 @@ using BlobStdVectorInt8 = BlobContainer<std::vector<std::int8_t>>;
 using BlobStdString     = BlobContainer<std::string>;
 
 
+/*
+ * BlobMappedFile class
+ */
+
+// Memory mapped file implementation of <Blob> interface.
+class BlobMappedFile final : public Blob
+{
+
+    public:
+
+        BlobMappedFile(const void* data, std::size_t size);
+        ~BlobMappedFile();
+
+        // Maps the specified file into memory and returns null on failure.
+        static std::unique_ptr<BlobMappedFile> Map(const char* filename, const BlobAccessHint accessHint);
+
+    public:
+
+        const void* GetData() const override;
+        std::size_t GetSize() const override;
+
+    private:
+
+        const void* data_ = nullptr;
+        std::size_t size_ = 0;
+
+};
+
+BlobMappedFile::BlobMappedFile(const void* data, std::size_t size) :
+    data_ { data },
+    size_ { size }
+{
+}
+
+BlobMappedFile::~BlobMappedFile()
+{
+    #ifdef LLGL_OS_WIN32
+    ::UnmapViewOfFile(data_);
+    #else
+    ::munmap(const_cast<void*>(data_), size_);
+    #endif
+}
+
+#ifdef LLGL_OS_WIN32
+
+std::unique_ptr<BlobMappedFile> BlobMappedFile::Map(const char* filename, const BlobAccessHint accessHint)
+{
+    /* Open file with caching hint for the access pattern */
+    DWORD flags = FILE_ATTRIBUTE_NORMAL;
+    if (accessHint == BlobAccessHint::Sequential)
+        flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+    else if (accessHint == BlobAccessHint::Random)
+        flags |= FILE_FLAG_RANDOM_ACCESS;
+
+    HANDLE file = ::CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    std::unique_ptr<BlobMappedFile> blob;
+
+    LARGE_INTEGER fileSize;
+    if (::GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0 && static_cast<std::uint64_t>(fileSize.QuadPart) <= SIZE_MAX)
+    {
+        /* Map entire file; the view keeps the mapping alive, so both handles can be closed right away */
+        if (HANDLE mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr))
+        {
+            if (auto data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0))
+                blob = MakeUnique<BlobMappedFile>(data, static_cast<std::size_t>(fileSize.QuadPart));
+            ::CloseHandle(mapping);
+        }
+    }
+
+    ::CloseHandle(file);
+
+    return blob;
+}
+
+#else
+
+// Returns the memory advice for the specified access hint.
+static int GetMemoryAdvice(const BlobAccessHint accessHint)
+{
+    switch (accessHint)
+    {
+        case BlobAccessHint::Default:       break;
+        case BlobAccessHint::Sequential:    return MADV_SEQUENTIAL;
+        case BlobAccessHint::Random:        return MADV_RANDOM;
+        case BlobAccessHint::WillNeed:      return MADV_WILLNEED;
+    }
+    return MADV_NORMAL;
+}
+
+std::unique_ptr<BlobMappedFile> BlobMappedFile::Map(const char* filename, const BlobAccessHint accessHint)
+{
+    int fd = ::open(filename, O_RDONLY);
+    if (fd == -1)
+        return nullptr;
+
+    std::unique_ptr<BlobMappedFile> blob;
+
+    struct stat fileStat;
+    if (::fstat(fd, &fileStat) == 0 && fileStat.st_size > 0 && static_cast<std::uint64_t>(fileStat.st_size) <= SIZE_MAX)
+    {
+        /* Map entire file; the mapping keeps the file alive, so the file descriptor can be closed right away */
+        const auto size = static_cast<std::size_t>(fileStat.st_size);
+        auto data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED)
+        {
+            if (accessHint != BlobAccessHint::Default)
+                ::madvise(data, size, GetMemoryAdvice(accessHint));
+            blob = MakeUnique<BlobMappedFile>(data, size);
+        }
+    }
+
+    ::close(fd);
+
+    return blob;
+}
+
+#endif
+
+const void* BlobMappedFile::GetData() const
+{
+    return data_;
+}
+
+std::size_t BlobMappedFile::GetSize() const
+{
+    return size_;
+}
+
+
 /*
  * Blob class
  */
@@ -203,6 +347,23 @@ std::unique_ptr<Blob> Blob::CreateFromFile(const std::string& filename)
     return CreateFromFile(filename.c_str());
 }
 
+std::unique_ptr<Blob> Blob::CreateFromMappedFile(const char* filename, const BlobAccessHint accessHint)
+{
+    if (filename == nullptr || *filename == '\0')
+        return nullptr;
+
+    if (auto blob = BlobMappedFile::Map(filename, accessHint))
+        return blob;
+
+    /* Empty files cannot be mapped, so fall back to reading the file, which also covers files that cannot be mapped at all */
+    return CreateFromFile(filename);
+}
+
+std::unique_ptr<Blob> Blob::CreateFromMappedFile(const std::string& filename, const BlobAccessHint accessHint)
+{
+    return CreateFromMappedFile(filename.c_str(), accessHint);
+}
+
 
 } // /namespace LLGL
 
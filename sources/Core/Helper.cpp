@@ -46,6 +46,17 @@ LLGL_EXPORT std::vector<char> ReadFileBuffer(const char* filename)
     return buffer;
 }
 
+LLGL_EXPORT std::unique_ptr<Blob> MapFileBuffer(const char* filename)
+{
+    // Map file content into memory
+    auto blob = Blob::CreateFromMappedFile(filename, BlobAccessHint::Sequential);
+
+    if (!blob)
+        throw std::runtime_error("failed to open file: " + std::string(filename));
+
+    return blob;
+}
+
 LLGL_EXPORT std::string ToUTF8String(const std::wstring& utf16)
 {
     return std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>>{}.to_bytes(utf16);
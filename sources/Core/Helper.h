@@ -11,6 +11,7 @@
 
 #include "../Renderer/CheckedCast.h"
 #include <LLGL/Export.h>
+#include <LLGL/Blob.h>
 #include <algorithm>
 #include <type_traits>
 #include <memory>
@@ -290,6 +291,9 @@ LLGL_EXPORT std::string ReadFileString(const char* filename);
 // Reads the specified binary file into a buffer.
 LLGL_EXPORT std::vector<char> ReadFileBuffer(const char* filename);
 
+// Maps the specified binary file into memory for sequential reading, so its content is not copied (see Blob::CreateFromMappedFile).
+LLGL_EXPORT std::unique_ptr<Blob> MapFileBuffer(const char* filename);
+
 // Converts the UTF16 input string to UTF8 string.
 LLGL_EXPORT std::string ToUTF8String(const std::wstring& utf16);
 LLGL_EXPORT std::string ToUTF8String(const wchar_t* utf16);
@@ -28,6 +28,11 @@ void RenderSystemChild::SetName(const char* name)
     // dummy
 }
 
+bool PipelineState::IsReady() const
+{
+    return true;
+}
+
 // Implement bases functions of all sub classes of <Interface> here:
 
 LLGL_IMPLEMENT_INTERFACE( RenderSystem,             Interface               )
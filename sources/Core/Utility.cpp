@@ -12,6 +12,7 @@
 #include <LLGL/Texture.h>
 #include <LLGL/Sampler.h>
 #include <LLGL/Shader.h>
+#include <LLGL/Blob.h>
 #include <LLGL/VertexFormat.h>
 #include <cstring>
 #include <cctype>
@@ -245,6 +246,21 @@ LLGL_EXPORT ShaderDescriptor ShaderDescFromFile(const ShaderType type, const cha
     return desc;
 }
 
+LLGL_EXPORT ShaderDescriptor ShaderDescFromBlob(const ShaderType type, const Blob& blob, const char* entryPoint, const char* profile, long flags)
+{
+    ShaderDescriptor desc;
+    {
+        desc.type       = type;
+        desc.source     = static_cast<const char*>(blob.GetData());
+        desc.sourceSize = blob.GetSize();
+        desc.sourceType = ShaderSourceType::BinaryBuffer;
+        desc.entryPoint = entryPoint;
+        desc.profile    = profile;
+        desc.flags      = flags;
+    }
+    return desc;
+}
+
 /* ----- ShaderProgramDescriptor utility functions ----- */
 
 static void AssignShaderToDesc(ShaderProgramDescriptor& desc, Shader* shader)
@@ -8,6 +8,7 @@
 #include "AMD64Assembler.h"
 #include "AMD64Opcode.h"
 #include <limits.h>
+#include <limits>
 
 #include <fstream>//!!!
 #include <iomanip>
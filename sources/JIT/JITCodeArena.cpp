@@ -0,0 +1,183 @@
+/*
+ * JITCodeArena.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "JITCodeArena.h"
+#include "JITMemory.h"
+#include "JITProgram.h"
+#include "../Core/Helper.h"
+#include <algorithm>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+// Alignment of each program within a chunk
+static const std::size_t g_alignment = 16;
+
+// Default size of each chunk (64 KB)
+static const std::size_t g_chunkSize = 65536;
+
+
+/*
+ * JITProgram class
+ */
+
+std::unique_ptr<JITProgram> JITProgram::Create(const void* code, std::size_t size)
+{
+    JITCodeChunk* chunk = nullptr;
+    auto addr = JITCodeArena::Get().Alloc(code, size, chunk);
+    return std::unique_ptr<JITProgram>(new JITProgram(addr, size, chunk));
+}
+
+JITProgram::JITProgram(void* addr, std::size_t size, JITCodeChunk* chunk) :
+    entryPoint_ { reinterpret_cast<EntryPointPtr>(addr) },
+    size_       { size                                  },
+    chunk_      { chunk                                 }
+{
+}
+
+JITProgram::~JITProgram()
+{
+    JITCodeArena::Get().Free(chunk_, size_);
+}
+
+
+/*
+ * JITCodeArena class
+ */
+
+JITCodeArena& JITCodeArena::Get()
+{
+    /* Arena is intentionally leaked, so programs that are destroyed during static destruction can still be freed */
+    static JITCodeArena* instance = new JITCodeArena();
+    return *instance;
+}
+
+JITCodeArena::JITCodeArena() :
+    pageSize_ { GetJITPageSize() }
+{
+}
+
+void* JITCodeArena::Alloc(const void* code, std::size_t size, JITCodeChunk*& chunk)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    const auto alignedSize = GetAlignedSize(size, g_alignment);
+
+    /* Allocate new chunk if the current one is full; programs larger than the default chunk size get their own chunk */
+    if (currentChunk_ == nullptr || currentChunk_->offset + alignedSize > currentChunk_->size)
+    {
+        auto prevChunk = currentChunk_;
+        currentChunk_ = AllocChunk(alignedSize);
+
+        /* Reclaim previous chunk if it is no longer used */
+        if (prevChunk != nullptr && prevChunk->numPrograms == 0)
+            FreeChunk(prevChunk);
+    }
+
+    chunk = currentChunk_;
+    auto addr = chunk->addr + chunk->offset;
+
+    /* Make pages of this program writable only while the code is copied into them */
+    auto pageBegin  = chunk->addr + (chunk->offset / pageSize_) * pageSize_;
+    auto pageEnd    = chunk->addr + GetAlignedSize(chunk->offset + size, pageSize_);
+    auto pageSize   = static_cast<std::size_t>(pageEnd - pageBegin);
+
+    ProtectJITPages(pageBegin, pageSize, false);
+    ::memcpy(addr, code, size);
+    ProtectJITPages(pageBegin, pageSize, true);
+    FlushJITInstructionCache(addr, size);
+
+    chunk->offset += alignedSize;
+    chunk->numPrograms++;
+    chunk->liveSize += alignedSize;
+
+    return addr;
+}
+
+void JITCodeArena::Free(JITCodeChunk* chunk, std::size_t size)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    chunk->numPrograms--;
+    chunk->liveSize -= GetAlignedSize(size, g_alignment);
+
+    if (chunk->numPrograms == 0)
+    {
+        if (chunk == currentChunk_)
+        {
+            /* Reclaim current chunk by starting over at its beginning */
+            chunk->offset = 0;
+            ++numReclaimedChunks_;
+        }
+        else
+            FreeChunk(chunk);
+    }
+}
+
+JITCodeArenaStatistics JITCodeArena::GetStatistics() const
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    JITCodeArenaStatistics stats;
+    {
+        stats.numChunks             = chunks_.size();
+        stats.numReclaimedChunks    = numReclaimedChunks_;
+        for (const auto& chunk : chunks_)
+        {
+            stats.numPrograms   += chunk->numPrograms;
+            stats.reservedSize  += chunk->size;
+            stats.usedSize      += chunk->offset;
+            stats.liveSize      += chunk->liveSize;
+        }
+    }
+    return stats;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+JITCodeChunk* JITCodeArena::AllocChunk(std::size_t minSize)
+{
+    auto chunk = MakeUnique<JITCodeChunk>();
+    {
+        chunk->size = GetAlignedSize(std::max(minSize, g_chunkSize), pageSize_);
+        chunk->addr = static_cast<char*>(AllocJITPages(chunk->size));
+    }
+    auto chunkRef = chunk.get();
+    chunks_.push_back(std::move(chunk));
+    return chunkRef;
+}
+
+void JITCodeArena::FreeChunk(JITCodeChunk* chunk)
+{
+    auto it = std::find_if(
+        chunks_.begin(),
+        chunks_.end(),
+        [chunk](const std::unique_ptr<JITCodeChunk>& entry)
+        {
+            return (entry.get() == chunk);
+        }
+    );
+    if (it != chunks_.end())
+    {
+        FreeJITPages(chunk->addr, chunk->size);
+        chunks_.erase(it);
+        ++numReclaimedChunks_;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
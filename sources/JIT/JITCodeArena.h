@@ -0,0 +1,96 @@
+/*
+ * JITCodeArena.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_JIT_CODE_ARENA_H
+#define LLGL_JIT_CODE_ARENA_H
+
+
+#include <LLGL/NonCopyable.h>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// Chunk of virtual memory pages in the executable code arena. Programs are allocated consecutively within a chunk.
+struct JITCodeChunk
+{
+    char*       addr        = nullptr;
+    std::size_t size        = 0;    // Size of the chunk (multiple of the page size)
+    std::size_t offset      = 0;    // Offset for the next allocation
+    std::size_t numPrograms = 0;    // Number of programs that are still alive in this chunk
+    std::size_t liveSize    = 0;    // Size of all programs that are still alive in this chunk
+};
+
+// Usage statistics of the executable code arena.
+struct JITCodeArenaStatistics
+{
+    std::size_t     numChunks           = 0;    // Number of chunks that are currently allocated
+    std::size_t     numPrograms         = 0;    // Number of programs that are currently alive
+    std::size_t     reservedSize        = 0;    // Size of all chunks (in bytes)
+    std::size_t     usedSize            = 0;    // Size of all allocations that have not been reclaimed yet, including freed programs (in bytes)
+    std::size_t     liveSize            = 0;    // Size of all programs that are still alive (in bytes)
+    std::uint64_t   numReclaimedChunks  = 0;    // Number of chunks that have been reclaimed since the arena was created
+};
+
+/*
+Singleton arena for the executable code of all JIT programs.
+Programs are bump-allocated within chunks of multiple pages, so many small programs share the same pages.
+Pages are only writable while a program is copied into them and are executable otherwise (W^X).
+Freed programs are only reclaimed in bulk, i.e. once all programs of a chunk have been freed.
+Allocating a program temporarily revokes execution access of the pages it is written to,
+so programs must not be executed while other programs are created on another thread (JIT programs are created and executed on the GL context thread).
+The arena is never destroyed, because JIT programs may be owned by static objects whose destruction order is undefined; its pages are released by the OS at process exit.
+*/
+class JITCodeArena final : public NonCopyable
+{
+
+    public:
+
+        // Returns the instance of the arena.
+        static JITCodeArena& Get();
+
+        // Copies the specified code into the arena and returns its executable address as well as the chunk it is allocated in.
+        void* Alloc(const void* code, std::size_t size, JITCodeChunk*& chunk);
+
+        // Frees the specified program from its chunk. The chunk is reclaimed once all of its programs are freed.
+        void Free(JITCodeChunk* chunk, std::size_t size);
+
+        // Returns the current usage statistics.
+        JITCodeArenaStatistics GetStatistics() const;
+
+    private:
+
+        JITCodeArena();
+
+        JITCodeChunk* AllocChunk(std::size_t minSize);
+        void FreeChunk(JITCodeChunk* chunk);
+
+    private:
+
+        std::size_t                                 pageSize_           = 0;
+        std::vector<std::unique_ptr<JITCodeChunk>>  chunks_;
+        JITCodeChunk*                               currentChunk_       = nullptr;
+        std::uint64_t                               numReclaimedChunks_ = 0;
+        mutable std::mutex                          mutex_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -11,11 +11,6 @@
 #include <iomanip>
 
 #include <LLGL/Platform/Platform.h>
-#if defined LLGL_OS_WIN32
-#   include "Platform/Win32/Win32JITProgram.h"
-#else
-#   include "Platform/POSIX/POSIXJITProgram.h"
-#endif
 
 #if defined LLGL_ARCH_ARM
 //#   include "Arch/ARM/ARMAssembler.h"
@@ -0,0 +1,44 @@
+/*
+ * JITMemory.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_JIT_MEMORY_H
+#define LLGL_JIT_MEMORY_H
+
+
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/* ----- Functions ----- */
+
+// Returns the size of virtual memory pages whose protection can be changed individually.
+std::size_t GetJITPageSize();
+
+// Allocates the specified amount of virtual memory (multiple of the page size) with read/write access. Throws std::runtime_error on failure.
+void* AllocJITPages(std::size_t size);
+
+// Releases the specified virtual memory that was allocated with AllocJITPages.
+void FreeJITPages(void* addr, std::size_t size);
+
+// Changes the protection of the specified pages either to read/write or to read/execute access, so pages are never writable and executable at the same time.
+void ProtectJITPages(void* addr, std::size_t size, bool executable);
+
+// Flushes the instruction cache for the specified range of code that has just been written.
+void FlushJITInstructionCache(const void* addr, std::size_t size);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
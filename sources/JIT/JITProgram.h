@@ -18,7 +18,9 @@ namespace LLGL
 {
 
 
-// Wrapper class for platform dependent native code.
+struct JITCodeChunk;
+
+// Wrapper class for platform dependent native code. The code is allocated in the executable code arena (see JITCodeArena).
 class LLGL_EXPORT JITProgram : public NonCopyable
 {
 
@@ -32,25 +34,30 @@ class LLGL_EXPORT JITProgram : public NonCopyable
         // Creates a new JIT program with the specified code.
         static std::unique_ptr<JITProgram> Create(const void* code, std::size_t size);
 
+        // Returns the code of this program to the executable code arena.
+        ~JITProgram();
+
         // Returns the main entry point of the native JIT program.
         inline EntryPointPtr GetEntryPoint() const
         {
             return entryPoint_;
         }
 
-    protected:
-
-        JITProgram() = default;
-
-        // Sets the address for the function pointer that can be executed.
-        inline void SetEntryPoint(void* addr)
+        // Returns the size (in bytes) this program occupies in the executable code arena.
+        inline std::size_t GetSize() const
         {
-            entryPoint_ = reinterpret_cast<EntryPointPtr>(addr);
+            return size_;
         }
 
     private:
 
-        EntryPointPtr entryPoint_ = nullptr;
+        JITProgram(void* addr, std::size_t size, JITCodeChunk* chunk);
+
+    private:
+
+        EntryPointPtr   entryPoint_ = nullptr;
+        std::size_t     size_       = 0;
+        JITCodeChunk*   chunk_      = nullptr;
 
 };
 
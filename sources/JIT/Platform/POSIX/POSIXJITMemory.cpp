@@ -0,0 +1,66 @@
+/*
+ * POSIXJITMemory.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "../../JITMemory.h"
+#include <stdexcept>
+#include <string>
+#include <unistd.h> // sysconf
+#include <sys/mman.h> // mmap
+
+
+namespace LLGL
+{
+
+
+std::size_t GetJITPageSize()
+{
+    return static_cast<std::size_t>(sysconf(_SC_PAGE_SIZE));
+}
+
+void* AllocJITPages(std::size_t size)
+{
+    /* Map virtual memory space with read/write access only */
+    auto addr = ::mmap(
+        nullptr,
+        size,
+        (PROT_READ | PROT_WRITE),
+        (MAP_PRIVATE | MAP_ANONYMOUS),
+        -1, // must be -1 if MAP_ANONYMOUS is used
+        0
+    );
+
+    if (addr == MAP_FAILED)
+        throw std::runtime_error("failed to map " + std::to_string(size) + " byte(s) of virtual memory for executable code");
+
+    return addr;
+}
+
+void FreeJITPages(void* addr, std::size_t size)
+{
+    ::munmap(addr, size);
+}
+
+void ProtectJITPages(void* addr, std::size_t size, bool executable)
+{
+    if (::mprotect(addr, size, (executable ? (PROT_READ | PROT_EXEC) : (PROT_READ | PROT_WRITE))) != 0)
+        throw std::runtime_error("failed to change virtual memory protection for executable code");
+}
+
+void FlushJITInstructionCache(const void* addr, std::size_t size)
+{
+    #if defined __GNUC__ || defined __clang__
+    auto begin = const_cast<char*>(static_cast<const char*>(addr));
+    __builtin___clear_cache(begin, begin + size);
+    #endif
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
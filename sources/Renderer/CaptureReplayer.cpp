@@ -0,0 +1,1255 @@
+/*
+ * CaptureReplayer.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "CaptureReplayer.h"
+#include "../Core/Helper.h"
+#include <LLGL/Timer.h>
+#include <stdexcept>
+#include <string>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+using namespace Serialization;
+
+/* ----- Object type checks ----- */
+
+template <typename T>
+struct CaptureObjectType;
+
+#define LLGL_CAPTURE_OBJECT_TYPE(CLASS)                                         \
+    template <>                                                                 \
+    struct CaptureObjectType<CLASS>                                             \
+    {                                                                           \
+        template <typename TEnum>                                               \
+        static bool Matches(TEnum type) { return (type == TEnum::CLASS); }      \
+    }
+
+LLGL_CAPTURE_OBJECT_TYPE(RenderTarget);
+LLGL_CAPTURE_OBJECT_TYPE(CommandBuffer);
+LLGL_CAPTURE_OBJECT_TYPE(Buffer);
+LLGL_CAPTURE_OBJECT_TYPE(BufferArray);
+LLGL_CAPTURE_OBJECT_TYPE(Texture);
+LLGL_CAPTURE_OBJECT_TYPE(Sampler);
+LLGL_CAPTURE_OBJECT_TYPE(ResourceHeap);
+LLGL_CAPTURE_OBJECT_TYPE(Shader);
+LLGL_CAPTURE_OBJECT_TYPE(ShaderProgram);
+LLGL_CAPTURE_OBJECT_TYPE(PipelineLayout);
+LLGL_CAPTURE_OBJECT_TYPE(PipelineState);
+LLGL_CAPTURE_OBJECT_TYPE(QueryHeap);
+LLGL_CAPTURE_OBJECT_TYPE(Fence);
+
+#undef LLGL_CAPTURE_OBJECT_TYPE
+
+// Render passes can be either created by the client programmer or owned by a render context or render target
+template <>
+struct CaptureObjectType<RenderPass>
+{
+    template <typename TEnum>
+    static bool Matches(TEnum type)
+    {
+        return (type == TEnum::RenderPass || type == TEnum::OwnedRenderPass);
+    }
+};
+
+// Resources can be buffers, textures, or samplers
+template <>
+struct CaptureObjectType<Resource>
+{
+    template <typename TEnum>
+    static bool Matches(TEnum type)
+    {
+        return (type == TEnum::Buffer || type == TEnum::Texture || type == TEnum::Sampler);
+    }
+};
+
+
+/*
+ * CaptureReplayer class
+ */
+
+CaptureReplayer::CaptureReplayer(RenderSystem& renderSystem, const Blob& capture) :
+    renderSystem_ { renderSystem                        },
+    commandQueue_ { renderSystem.GetCommandQueue()      },
+    reader_       { capture                             }
+{
+}
+
+CaptureReplayer::~CaptureReplayer()
+{
+    /* Release remaining objects in reverse order of their creation, since later objects may refer to earlier ones */
+    for (auto it = objects_.rbegin(); it != objects_.rend(); ++it)
+        ReleaseObject(*it);
+}
+
+CaptureReplayStatistics CaptureReplayer::Replay()
+{
+    CaptureReplayStatistics stats;
+
+    ReadHeader();
+
+    auto timer = Timer::Create();
+    const double frequency = static_cast<double>(timer->GetFrequency());
+    std::uint64_t totalTicks = 0;
+
+    timer->Start();
+
+    /* Replay all segments until the terminating segment */
+    for (;;)
+    {
+        if (reader_.IsEnd())
+            throw std::runtime_error("missing terminating segment in command capture");
+
+        const auto ident = static_cast<CaptureIdent>(BeginSegment());
+        if (ident == CaptureIdent_ReservedCapture)
+            break;
+
+        try
+        {
+            ReplayCommand(ident);
+        }
+        catch (const std::out_of_range& e)
+        {
+            /* Segment is shorter than its function call requires */
+            throw std::runtime_error(
+                std::string(e.what()) + " (command capture segment 0x" + ToHex(static_cast<std::uint16_t>(ident)) + ")"
+            );
+        }
+
+        reader_.End();
+        ++stats.numCommands;
+
+        /* Measure elapsed time of each frame */
+        if (ident == CaptureIdent_Present)
+        {
+            const auto ticks = timer->Stop();
+            totalTicks += ticks;
+            stats.frameTimes.push_back(static_cast<double>(ticks) / frequency);
+            ++stats.numFrames;
+            timer->Start();
+        }
+    }
+
+    totalTicks += timer->Stop();
+    stats.totalTime = static_cast<double>(totalTicks) / frequency;
+
+    return stats;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void CaptureReplayer::ReadHeader()
+{
+    if (BeginSegment() != CaptureIdent_Header)
+        throw std::runtime_error("missing header in command capture");
+    {
+        const auto magic    = ReadValue<std::uint32_t>();
+        const auto version  = ReadValue<std::uint32_t>();
+
+        if (magic != g_captureMagic)
+            throw std::runtime_error("invalid magic number in command capture");
+        if (version != g_captureVersion)
+        {
+            throw std::runtime_error(
+                "unsupported command capture version: " + std::to_string(version) +
+                " (expected " + std::to_string(g_captureVersion) + ")"
+            );
+        }
+    }
+    reader_.End();
+}
+
+void CaptureReplayer::ReplayCommand(CaptureIdent ident)
+{
+    switch (ident)
+    {
+        /* ----- RenderSystem ----- */
+
+        case CaptureIdent_CreateRenderContext:
+        {
+            ReplayCreateRenderContext();
+        }
+        break;
+
+        case CaptureIdent_CreateCommandBuffer:
+        {
+            const auto id = ReadValue<std::uint32_t>();
+            CommandBufferDescriptor desc;
+            {
+                desc.flags              = ReadFlags();
+                desc.numNativeBuffers   = ReadValue<std::uint32_t>();
+                desc.renderPass         = ReadObject<RenderPass>();
+            }
+            auto commandBuffer = renderSystem_.CreateCommandBuffer(desc);
+            StoreObject(id, ObjectType::CommandBuffer, commandBuffer);
+        }
+        break;
+
+        case CaptureIdent_CreateBuffer:
+        {
+            const auto id = ReadValue<std::uint32_t>();
+            BufferDescriptor desc;
+            CaptureReadBufferDesc(reader_, desc);
+            std::uint64_t dataSize = 0;
+            auto data = ReadData(dataSize);
+            auto buffer = renderSystem_.CreateBuffer(desc, data);
+            StoreObject(id, ObjectType::Buffer, buffer);
+        }
+        break;
+
+        case CaptureIdent_CreateBufferArray:
+        {
+            const auto id = ReadValue<std::uint32_t>();
+            const auto numBuffers = ReadCount(sizeof(std::uint32_t));
+            bufferRefs_.resize(numBuffers);
+            for (auto& buffer : bufferRefs_)
+                buffer = ReadObject<Buffer>();
+            auto bufferArray = renderSystem_.CreateBufferArray(numBuffers, bufferRefs_.data());
+            StoreObject(id, ObjectType::BufferArray, bufferArray);
+        }
+        break;
+
+        case CaptureIdent_WriteBuffer:
+        {
+            auto& dstBuffer = ReadObjectRef<Buffer>();
+            const auto dstOffset = ReadValue<std::uint64_t>();
+            std::uint64_t dataSize = 0;
+            auto data = ReadData(dataSize);
+            renderSystem_.WriteBuffer(dstBuffer, dstOffset, data, dataSize);
+        }
+        break;
+
+        case CaptureIdent_MapBuffer:
+        {
+            auto& buffer = ReadObjectRef<Buffer>();
+            const auto access = ReadValue<CPUAccess>();
+            auto& mapped = mappedBuffers_[&buffer];
+            {
+                mapped.data = renderSystem_.MapBuffer(buffer, access);
+                mapped.size = buffer.GetDesc().size;
+            }
+        }
+        break;
+
+        case CaptureIdent_UnmapBuffer:
+        {
+            auto& buffer = ReadObjectRef<Buffer>();
+            std::uint64_t dataSize = 0;
+            auto data = ReadData(dataSize);
+
+            MappedBuffer mapped;
+            auto it = mappedBuffers_.find(&buffer);
+            if (it != mappedBuffers_.end())
+            {
+                mapped = it->second;
+                mappedBuffers_.erase(it);
+            }
+
+            /* Restore content that was written into the mapped memory during capture */
+            if (data != nullptr)
+            {
+                if (mapped.data == nullptr)
+                {
+                    renderSystem_.UnmapBuffer(buffer);
+                    throw std::runtime_error("cannot restore content of buffer that is not mapped in command capture");
+                }
+                if (dataSize != mapped.size)
+                {
+                    renderSystem_.UnmapBuffer(buffer);
+                    throw std::runtime_error(
+                        "mismatch in size of mapped buffer content in command capture: read " + std::to_string(dataSize) +
+                        " byte(s), but expected " + std::to_string(mapped.size)
+                    );
+                }
+                ::memcpy(mapped.data, data, static_cast<std::size_t>(dataSize));
+            }
+
+            renderSystem_.UnmapBuffer(buffer);
+        }
+        break;
+
+        case CaptureIdent_CreateTexture:
+        {
+            const auto id = ReadValue<std::uint32_t>();
+            TextureDescriptor textureDesc;
+            CaptureReadTextureDesc(reader_, textureDesc);
+            SrcImageDescriptor imageDesc;
+            {
+                imageDesc.format    = ReadValue<ImageFormat>();
+                imageDesc.dataType  = ReadValue<DataType>();
+                std::uint64_t dataSize = 0;
+                imageDesc.data      = ReadData(dataSize);
+                imageDesc.dataSize  = static_cast<std::size_t>(dataSize);
+            }
+            auto texture = renderSystem_.CreateTexture(textureDesc, (imageDesc.data != nullptr ? &imageDesc : nullptr));
+            StoreObject(id, ObjectType::Texture, texture);
+        }
+        break;
+
+        case CaptureIdent_WriteTexture:
+        {
+            auto& texture = ReadObjectRef<Texture>();
+            const auto textureRegion = ReadValue<TextureRegion>();
+            SrcImageDescriptor imageDesc;
+            {
+                imageDesc.format    = ReadValue<ImageFormat>();
+                imageDesc.dataType  = ReadValue<DataType>();
+                std::uint64_t dataSize = 0;
+                imageDesc.data      = ReadData(dataSize);
+                imageDesc.dataSize  = static_cast<std::size_t>(dataSize);
+            }
+            renderSystem_.WriteTexture(texture, textureRegion, imageDesc);
+        }
+        break;
+
+        case CaptureIdent_ReadTexture:
+        {
+            auto& texture = ReadObjectRef<Texture>();
+            const auto textureRegion = ReadValue<TextureRegion>();
+            DstImageDescriptor imageDesc;
+            {
+                imageDesc.format    = ReadValue<ImageFormat>();
+                imageDesc.dataType  = ReadValue<DataType>();
+                imageDesc.dataSize  = static_cast<std::size_t>(ReadValue<std::uint64_t>());
+                scratchBuffer_.resize(imageDesc.dataSize);
+                imageDesc.data      = scratchBuffer_.data();
+            }
+            renderSystem_.ReadTexture(texture, textureRegion, imageDesc);
+        }
+        break;
+
+        case CaptureIdent_CreateSampler:
+        {
+            const auto id = ReadValue<std::uint32_t>();
+            const auto desc = ReadValue<SamplerDescriptor>();
+            auto sampler = renderSystem_.CreateSampler(desc);
+            StoreObject(id, ObjectType::Sampler, sampler);
+        }
+        break;
+
+        case CaptureIdent_CreateResourceHeap:
+        {
+            const auto id = ReadValue<std::uint32_t>();
+            ResourceHeapDescriptor desc;
+            {
+                desc.pipelineLayout = ReadObject<PipelineLayout>();
+                desc.bindless       = ReadValue<bool>();
+                desc.resourceViews.resize(ReadCount(sizeof(std::uint32_t) + sizeof(TextureViewDescriptor) + sizeof(BufferViewDescriptor)));
+                for (auto& resourceView : desc.resourceViews)
+                {
+                    resourceView.resource       = ReadObject<Resource>();
+                    resourceView.textureView    = ReadValue<TextureViewDescriptor>();
+                    resourceView.bufferView     = ReadValue<BufferViewDescriptor>();
+                }
+            }
+            auto resourceHeap = renderSystem_.CreateResourceHeap(desc);
+            StoreObject(id, ObjectType::ResourceHeap, resourceHeap);
+        }
+        break;
+
+        case CaptureIdent_CreateRenderPass:
+        {
+            const auto id = ReadValue<std::uint32_t>();
+            RenderPassDescriptor desc;
+            CaptureReadRenderPassDesc(reader_, desc);
+            auto renderPass = renderSystem_.CreateRenderPass(desc);
+            StoreObject(id, ObjectType::RenderPass, renderPass);
+        }
+        break;
+
+        case CaptureIdent_CreateRenderTarget:
+        {
+            ReplayCreateRenderTarget();
+        }
+        break;
+
+        case CaptureIdent_GetRenderPass:
+        {
+            const auto id = ReadValue<std::uint32_t>();
+            auto& renderTarget = ReadObjectRef<RenderTarget>();
+            auto renderPass = const_cast<RenderPass*>(renderTarget.GetRenderPass());
+            StoreObject(id, ObjectType::OwnedRenderPass, renderPass);
+        }
+        break;
+
+        case CaptureIdent_CreateShader:
+        {
+            const auto id = ReadValue<std::uint32_t>();
+            ShaderDescriptor desc;
+            std::vector<ShaderMacro> defines;
+            CaptureReadShaderDesc(reader_, desc, defines);
+            auto shader = renderSystem_.CreateShader(desc);
+            StoreObject(id, ObjectType::Shader, shader);
+        }
+        break;
+
+        case CaptureIdent_CreateShaderProgram:
+        {
+            const auto id = ReadValue<std::uint32_t>();
+            ShaderProgramDescriptor desc;
+            {
+                desc.vertexShader           = ReadObject<Shader>();
+                desc.tessControlShader      = ReadObject<Shader>();
+                desc.tessEvaluationShader   = ReadObject<Shader>();
+                desc.geometryShader         = ReadObject<Shader>();
+                desc.fragmentShader         = ReadObject<Shader>();
+                desc.computeShader          = ReadObject<Shader>();
+            }
+            auto shaderProgram = renderSystem_.CreateShaderProgram(desc);
+            StoreObject(id, ObjectType::ShaderProgram, shaderProgram);
+        }
+        break;
+
+        case CaptureIdent_CreatePipelineLayout:
+        {
+            const auto id = ReadValue<std::uint32_t>();
+            PipelineLayoutDescriptor desc;
+            desc.bindings.resize(ReadCount(1));
+            for (auto& binding : desc.bindings)
+                CaptureReadBindingDesc(reader_, binding);
+            auto pipelineLayout = renderSystem_.CreatePipelineLayout(desc);
+            StoreObject(id, ObjectType::PipelineLayout, pipelineLayout);
+        }
+        break;
+
+        case CaptureIdent_CreateGraphicsPipeline:
+        {
+            const auto id = ReadValue<std::uint32_t>();
+            GraphicsPipelineDescriptor desc;
+            {
+                desc.pipelineLayout = ReadObject<PipelineLayout>();
+                desc.shaderProgram  = ReadObject<ShaderProgram>();
+                desc.renderPass     = ReadObject<RenderPass>();
+                CaptureReadGraphicsPipelineStates(reader_, desc);
+            }
+            auto pipelineState = renderSystem_.CreatePipelineState(desc);
+            StoreObject(id, ObjectType::PipelineState, pipelineState);
+        }
+        break;
+
+        case CaptureIdent_CreateComputePipeline:
+        {
+            const auto id = ReadValue<std::uint32_t>();
+            ComputePipelineDescriptor desc;
+            {
+                desc.pipelineLayout = ReadObject<PipelineLayout>();
+                desc.shaderProgram  = ReadObject<ShaderProgram>();
+            }
+            auto pipelineState = renderSystem_.CreatePipelineState(desc);
+            StoreObject(id, ObjectType::PipelineState, pipelineState);
+        }
+        break;
+
+        case CaptureIdent_CreateQueryHeap:
+        {
+            const auto id = ReadValue<std::uint32_t>();
+            const auto desc = ReadValue<QueryHeapDescriptor>();
+            auto queryHeap = renderSystem_.CreateQueryHeap(desc);
+            StoreObject(id, ObjectType::QueryHeap, queryHeap);
+        }
+        break;
+
+        case CaptureIdent_CreateFence:
+        {
+            const auto id = ReadValue<std::uint32_t>();
+            auto fence = renderSystem_.CreateFence();
+            StoreObject(id, ObjectType::Fence, fence);
+        }
+        break;
+
+        case CaptureIdent_Release:
+        {
+            ReplayRelease();
+        }
+        break;
+
+        /* ----- RenderContext ----- */
+
+        case CaptureIdent_Present:
+        {
+            /* Render contexts are replaced by render targets, so this only marks the end of a frame */
+            ReadObjectRef<RenderTarget>();
+        }
+        break;
+
+        /* ----- CommandQueue ----- */
+
+        case CaptureIdent_Submit:
+        {
+            commandQueue_->Submit(ReadObjectRef<CommandBuffer>());
+        }
+        break;
+
+        case CaptureIdent_SubmitFence:
+        {
+            commandQueue_->Submit(ReadObjectRef<Fence>());
+        }
+        break;
+
+        case CaptureIdent_WaitFence:
+        {
+            auto& fence = ReadObjectRef<Fence>();
+            const auto timeout = ReadValue<std::uint64_t>();
+            commandQueue_->WaitFence(fence, timeout);
+        }
+        break;
+
+        case CaptureIdent_WaitIdle:
+        {
+            commandQueue_->WaitIdle();
+        }
+        break;
+
+        case CaptureIdent_QueryResult:
+        {
+            auto& queryHeap = ReadObjectRef<QueryHeap>();
+            const auto firstQuery = ReadValue<std::uint32_t>();
+            const auto numQueries = ReadValue<std::uint32_t>();
+            scratchBuffer_.resize(static_cast<std::size_t>(ReadValue<std::uint64_t>()));
+            commandQueue_->QueryResult(queryHeap, firstQuery, numQueries, scratchBuffer_.data(), scratchBuffer_.size());
+        }
+        break;
+
+        /* ----- CommandBuffer ----- */
+
+        case CaptureIdent_Begin:
+        {
+            ReadObjectRef<CommandBuffer>().Begin();
+        }
+        break;
+
+        case CaptureIdent_End:
+        {
+            ReadObjectRef<CommandBuffer>().End();
+        }
+        break;
+
+        case CaptureIdent_Execute:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            cmdBuffer.Execute(ReadObjectRef<CommandBuffer>());
+        }
+        break;
+
+        case CaptureIdent_UpdateBuffer:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            auto& dstBuffer = ReadObjectRef<Buffer>();
+            const auto dstOffset = ReadValue<std::uint64_t>();
+            std::uint64_t dataSize = 0;
+            auto data = ReadData(dataSize);
+            cmdBuffer.UpdateBuffer(dstBuffer, dstOffset, data, static_cast<std::uint16_t>(dataSize));
+        }
+        break;
+
+        case CaptureIdent_CopyBuffer:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            auto& dstBuffer = ReadObjectRef<Buffer>();
+            const auto dstOffset = ReadValue<std::uint64_t>();
+            auto& srcBuffer = ReadObjectRef<Buffer>();
+            const auto srcOffset = ReadValue<std::uint64_t>();
+            const auto size = ReadValue<std::uint64_t>();
+            cmdBuffer.CopyBuffer(dstBuffer, dstOffset, srcBuffer, srcOffset, size);
+        }
+        break;
+
+        case CaptureIdent_CopyBufferFromTexture:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            auto& dstBuffer = ReadObjectRef<Buffer>();
+            const auto dstOffset = ReadValue<std::uint64_t>();
+            auto& srcTexture = ReadObjectRef<Texture>();
+            const auto srcRegion = ReadValue<TextureRegion>();
+            const auto rowStride = ReadValue<std::uint32_t>();
+            const auto layerStride = ReadValue<std::uint32_t>();
+            cmdBuffer.CopyBufferFromTexture(dstBuffer, dstOffset, srcTexture, srcRegion, rowStride, layerStride);
+        }
+        break;
+
+        case CaptureIdent_FillBuffer:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            auto& dstBuffer = ReadObjectRef<Buffer>();
+            const auto dstOffset = ReadValue<std::uint64_t>();
+            const auto value = ReadValue<std::uint32_t>();
+            const auto fillSize = ReadValue<std::uint64_t>();
+            cmdBuffer.FillBuffer(dstBuffer, dstOffset, value, fillSize);
+        }
+        break;
+
+        case CaptureIdent_CopyTexture:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            auto& dstTexture = ReadObjectRef<Texture>();
+            const auto dstLocation = ReadValue<TextureLocation>();
+            auto& srcTexture = ReadObjectRef<Texture>();
+            const auto srcLocation = ReadValue<TextureLocation>();
+            const auto extent = ReadValue<Extent3D>();
+            cmdBuffer.CopyTexture(dstTexture, dstLocation, srcTexture, srcLocation, extent);
+        }
+        break;
+
+        case CaptureIdent_CopyTextureFromBuffer:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            auto& dstTexture = ReadObjectRef<Texture>();
+            const auto dstRegion = ReadValue<TextureRegion>();
+            auto& srcBuffer = ReadObjectRef<Buffer>();
+            const auto srcOffset = ReadValue<std::uint64_t>();
+            const auto rowStride = ReadValue<std::uint32_t>();
+            const auto layerStride = ReadValue<std::uint32_t>();
+            cmdBuffer.CopyTextureFromBuffer(dstTexture, dstRegion, srcBuffer, srcOffset, rowStride, layerStride);
+        }
+        break;
+
+        case CaptureIdent_GenerateMips:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            cmdBuffer.GenerateMips(ReadObjectRef<Texture>());
+        }
+        break;
+
+        case CaptureIdent_GenerateMipsRange:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            auto& texture = ReadObjectRef<Texture>();
+            cmdBuffer.GenerateMips(texture, ReadValue<TextureSubresource>());
+        }
+        break;
+
+        case CaptureIdent_SetViewport:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            cmdBuffer.SetViewport(ReadValue<Viewport>());
+        }
+        break;
+
+        case CaptureIdent_SetViewports:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            viewports_.resize(ReadCount(sizeof(Viewport)));
+            for (auto& viewport : viewports_)
+                viewport = ReadValue<Viewport>();
+            cmdBuffer.SetViewports(static_cast<std::uint32_t>(viewports_.size()), viewports_.data());
+        }
+        break;
+
+        case CaptureIdent_SetScissor:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            cmdBuffer.SetScissor(ReadValue<Scissor>());
+        }
+        break;
+
+        case CaptureIdent_SetScissors:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            scissors_.resize(ReadCount(sizeof(Scissor)));
+            for (auto& scissor : scissors_)
+                scissor = ReadValue<Scissor>();
+            cmdBuffer.SetScissors(static_cast<std::uint32_t>(scissors_.size()), scissors_.data());
+        }
+        break;
+
+        case CaptureIdent_SetClearColor:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            cmdBuffer.SetClearColor(ReadValue<ColorRGBAf>());
+        }
+        break;
+
+        case CaptureIdent_SetClearDepth:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            cmdBuffer.SetClearDepth(ReadValue<float>());
+        }
+        break;
+
+        case CaptureIdent_SetClearStencil:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            cmdBuffer.SetClearStencil(ReadValue<std::uint32_t>());
+        }
+        break;
+
+        case CaptureIdent_Clear:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            cmdBuffer.Clear(ReadFlags());
+        }
+        break;
+
+        case CaptureIdent_ClearAttachments:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            attachmentClears_.resize(ReadCount(sizeof(std::int64_t) + sizeof(std::uint32_t) + sizeof(ClearValue)));
+            for (auto& attachment : attachmentClears_)
+                CaptureReadAttachmentClear(reader_, attachment);
+            cmdBuffer.ClearAttachments(static_cast<std::uint32_t>(attachmentClears_.size()), attachmentClears_.data());
+        }
+        break;
+
+        case CaptureIdent_SetVertexBuffer:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            cmdBuffer.SetVertexBuffer(ReadObjectRef<Buffer>());
+        }
+        break;
+
+        case CaptureIdent_SetVertexBufferArray:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            cmdBuffer.SetVertexBufferArray(ReadObjectRef<BufferArray>());
+        }
+        break;
+
+        case CaptureIdent_SetIndexBuffer:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            cmdBuffer.SetIndexBuffer(ReadObjectRef<Buffer>());
+        }
+        break;
+
+        case CaptureIdent_SetIndexBufferFormat:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            auto& buffer = ReadObjectRef<Buffer>();
+            const auto format = ReadValue<Format>();
+            const auto offset = ReadValue<std::uint64_t>();
+            cmdBuffer.SetIndexBuffer(buffer, format, offset);
+        }
+        break;
+
+        case CaptureIdent_SetResourceHeap:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            auto& resourceHeap = ReadObjectRef<ResourceHeap>();
+            const auto firstSet = ReadValue<std::uint32_t>();
+            const auto bindPoint = ReadValue<PipelineBindPoint>();
+            cmdBuffer.SetResourceHeap(resourceHeap, firstSet, bindPoint);
+        }
+        break;
+
+        case CaptureIdent_SetResource:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            auto& resource = ReadObjectRef<Resource>();
+            const auto slot = ReadValue<std::uint32_t>();
+            const auto bindFlags = ReadFlags();
+            const auto stageFlags = ReadFlags();
+            cmdBuffer.SetResource(resource, slot, bindFlags, stageFlags);
+        }
+        break;
+
+        case CaptureIdent_ResetResourceSlots:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            const auto resourceType = ReadValue<ResourceType>();
+            const auto firstSlot = ReadValue<std::uint32_t>();
+            const auto numSlots = ReadValue<std::uint32_t>();
+            const auto bindFlags = ReadFlags();
+            const auto stageFlags = ReadFlags();
+            cmdBuffer.ResetResourceSlots(resourceType, firstSlot, numSlots, bindFlags, stageFlags);
+        }
+        break;
+
+        case CaptureIdent_BeginRenderPass:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            auto& renderTarget = ReadObjectRef<RenderTarget>();
+            auto renderPass = ReadObject<RenderPass>();
+            clearValues_.resize(ReadCount(sizeof(ClearValue)));
+            for (auto& clearValue : clearValues_)
+                clearValue = ReadValue<ClearValue>();
+            cmdBuffer.BeginRenderPass(renderTarget, renderPass, static_cast<std::uint32_t>(clearValues_.size()), clearValues_.data());
+        }
+        break;
+
+        case CaptureIdent_EndRenderPass:
+        {
+            ReadObjectRef<CommandBuffer>().EndRenderPass();
+        }
+        break;
+
+        case CaptureIdent_SetPipelineState:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            cmdBuffer.SetPipelineState(ReadObjectRef<PipelineState>());
+        }
+        break;
+
+        case CaptureIdent_SetBlendFactor:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            cmdBuffer.SetBlendFactor(ReadValue<ColorRGBAf>());
+        }
+        break;
+
+        case CaptureIdent_SetStencilReference:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            const auto reference = ReadValue<std::uint32_t>();
+            const auto stencilFace = ReadValue<StencilFace>();
+            cmdBuffer.SetStencilReference(reference, stencilFace);
+        }
+        break;
+
+        case CaptureIdent_SetUniform:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            const auto location = ReadValue<UniformLocation>();
+            std::uint64_t dataSize = 0;
+            auto data = ReadData(dataSize);
+            cmdBuffer.SetUniform(location, data, static_cast<std::uint32_t>(dataSize));
+        }
+        break;
+
+        case CaptureIdent_SetUniforms:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            const auto location = ReadValue<UniformLocation>();
+            const auto count = ReadValue<std::uint32_t>();
+            std::uint64_t dataSize = 0;
+            auto data = ReadData(dataSize);
+            cmdBuffer.SetUniforms(location, count, data, static_cast<std::uint32_t>(dataSize));
+        }
+        break;
+
+        case CaptureIdent_BeginQuery:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            auto& queryHeap = ReadObjectRef<QueryHeap>();
+            cmdBuffer.BeginQuery(queryHeap, ReadValue<std::uint32_t>());
+        }
+        break;
+
+        case CaptureIdent_EndQuery:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            auto& queryHeap = ReadObjectRef<QueryHeap>();
+            cmdBuffer.EndQuery(queryHeap, ReadValue<std::uint32_t>());
+        }
+        break;
+
+        case CaptureIdent_BeginRenderCondition:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            auto& queryHeap = ReadObjectRef<QueryHeap>();
+            const auto query = ReadValue<std::uint32_t>();
+            const auto mode = ReadValue<RenderConditionMode>();
+            cmdBuffer.BeginRenderCondition(queryHeap, query, mode);
+        }
+        break;
+
+        case CaptureIdent_EndRenderCondition:
+        {
+            ReadObjectRef<CommandBuffer>().EndRenderCondition();
+        }
+        break;
+
+        case CaptureIdent_BeginStreamOutput:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            bufferRefs_.resize(ReadCount(sizeof(std::uint32_t)));
+            for (auto& buffer : bufferRefs_)
+                buffer = ReadObject<Buffer>();
+            cmdBuffer.BeginStreamOutput(static_cast<std::uint32_t>(bufferRefs_.size()), bufferRefs_.data());
+        }
+        break;
+
+        case CaptureIdent_EndStreamOutput:
+        {
+            ReadObjectRef<CommandBuffer>().EndStreamOutput();
+        }
+        break;
+
+        case CaptureIdent_Draw:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            const auto numVertices = ReadValue<std::uint32_t>();
+            const auto firstVertex = ReadValue<std::uint32_t>();
+            cmdBuffer.Draw(numVertices, firstVertex);
+        }
+        break;
+
+        case CaptureIdent_DrawIndexed:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            const auto numIndices = ReadValue<std::uint32_t>();
+            const auto firstIndex = ReadValue<std::uint32_t>();
+            cmdBuffer.DrawIndexed(numIndices, firstIndex);
+        }
+        break;
+
+        case CaptureIdent_DrawIndexedOffset:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            const auto numIndices = ReadValue<std::uint32_t>();
+            const auto firstIndex = ReadValue<std::uint32_t>();
+            const auto vertexOffset = ReadValue<std::int32_t>();
+            cmdBuffer.DrawIndexed(numIndices, firstIndex, vertexOffset);
+        }
+        break;
+
+        case CaptureIdent_DrawInstanced:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            const auto numVertices = ReadValue<std::uint32_t>();
+            const auto firstVertex = ReadValue<std::uint32_t>();
+            const auto numInstances = ReadValue<std::uint32_t>();
+            cmdBuffer.DrawInstanced(numVertices, firstVertex, numInstances);
+        }
+        break;
+
+        case CaptureIdent_DrawInstancedOffset:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            const auto numVertices = ReadValue<std::uint32_t>();
+            const auto firstVertex = ReadValue<std::uint32_t>();
+            const auto numInstances = ReadValue<std::uint32_t>();
+            const auto firstInstance = ReadValue<std::uint32_t>();
+            cmdBuffer.DrawInstanced(numVertices, firstVertex, numInstances, firstInstance);
+        }
+        break;
+
+        case CaptureIdent_DrawIndexedInstanced:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            const auto numIndices = ReadValue<std::uint32_t>();
+            const auto numInstances = ReadValue<std::uint32_t>();
+            const auto firstIndex = ReadValue<std::uint32_t>();
+            cmdBuffer.DrawIndexedInstanced(numIndices, numInstances, firstIndex);
+        }
+        break;
+
+        case CaptureIdent_DrawIndexedInstancedOffset:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            const auto numIndices = ReadValue<std::uint32_t>();
+            const auto numInstances = ReadValue<std::uint32_t>();
+            const auto firstIndex = ReadValue<std::uint32_t>();
+            const auto vertexOffset = ReadValue<std::int32_t>();
+            cmdBuffer.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset);
+        }
+        break;
+
+        case CaptureIdent_DrawIndexedInstancedFirst:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            const auto numIndices = ReadValue<std::uint32_t>();
+            const auto numInstances = ReadValue<std::uint32_t>();
+            const auto firstIndex = ReadValue<std::uint32_t>();
+            const auto vertexOffset = ReadValue<std::int32_t>();
+            const auto firstInstance = ReadValue<std::uint32_t>();
+            cmdBuffer.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
+        }
+        break;
+
+        case CaptureIdent_DrawIndirect:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            auto& buffer = ReadObjectRef<Buffer>();
+            cmdBuffer.DrawIndirect(buffer, ReadValue<std::uint64_t>());
+        }
+        break;
+
+        case CaptureIdent_DrawIndirectMulti:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            auto& buffer = ReadObjectRef<Buffer>();
+            const auto offset = ReadValue<std::uint64_t>();
+            const auto numCommands = ReadValue<std::uint32_t>();
+            const auto stride = ReadValue<std::uint32_t>();
+            cmdBuffer.DrawIndirect(buffer, offset, numCommands, stride);
+        }
+        break;
+
+        case CaptureIdent_DrawIndexedIndirect:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            auto& buffer = ReadObjectRef<Buffer>();
+            cmdBuffer.DrawIndexedIndirect(buffer, ReadValue<std::uint64_t>());
+        }
+        break;
+
+        case CaptureIdent_DrawIndexedIndirectMulti:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            auto& buffer = ReadObjectRef<Buffer>();
+            const auto offset = ReadValue<std::uint64_t>();
+            const auto numCommands = ReadValue<std::uint32_t>();
+            const auto stride = ReadValue<std::uint32_t>();
+            cmdBuffer.DrawIndexedIndirect(buffer, offset, numCommands, stride);
+        }
+        break;
+
+        case CaptureIdent_Dispatch:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            const auto numWorkGroupsX = ReadValue<std::uint32_t>();
+            const auto numWorkGroupsY = ReadValue<std::uint32_t>();
+            const auto numWorkGroupsZ = ReadValue<std::uint32_t>();
+            cmdBuffer.Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
+        }
+        break;
+
+        case CaptureIdent_DispatchIndirect:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            auto& buffer = ReadObjectRef<Buffer>();
+            cmdBuffer.DispatchIndirect(buffer, ReadValue<std::uint64_t>());
+        }
+        break;
+
+        case CaptureIdent_PushDebugGroup:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            cmdBuffer.PushDebugGroup(reader_.ReadCString());
+        }
+        break;
+
+        case CaptureIdent_PopDebugGroup:
+        {
+            ReadObjectRef<CommandBuffer>().PopDebugGroup();
+        }
+        break;
+
+        case CaptureIdent_SetGraphicsAPIDependentState:
+        {
+            auto& cmdBuffer = ReadObjectRef<CommandBuffer>();
+            std::uint64_t dataSize = 0;
+            auto data = ReadData(dataSize);
+            cmdBuffer.SetGraphicsAPIDependentState(data, static_cast<std::size_t>(dataSize));
+        }
+        break;
+
+        default:
+        {
+            throw std::runtime_error("unknown segment identifier in command capture: 0x" + ToHex(static_cast<std::uint16_t>(ident)));
+        }
+        break;
+    }
+}
+
+void CaptureReplayer::ReplayCreateRenderContext()
+{
+    const auto id = ReadValue<std::uint32_t>();
+    const auto desc = ReadValue<RenderContextDescriptor>();
+
+    const auto& videoMode = desc.videoMode;
+
+    /* Create color texture with the resolution of the render context */
+    TextureDescriptor colorTextureDesc;
+    {
+        colorTextureDesc.type       = TextureType::Texture2D;
+        colorTextureDesc.bindFlags  = BindFlags::ColorAttachment;
+        colorTextureDesc.format     = Format::RGBA8UNorm;
+        colorTextureDesc.extent     = { videoMode.resolution.width, videoMode.resolution.height, 1u };
+        colorTextureDesc.mipLevels  = 1;
+    }
+    auto colorTexture = renderSystem_.CreateTexture(colorTextureDesc);
+
+    /* Create render target as substitute for the render context */
+    RenderTargetDescriptor renderTargetDesc;
+    {
+        renderTargetDesc.resolution             = videoMode.resolution;
+        renderTargetDesc.samples                = desc.samples;
+        renderTargetDesc.transientAttachments   = desc.transientAttachments;
+        renderTargetDesc.attachments.push_back({ AttachmentType::Color, colorTexture });
+
+        if (videoMode.depthBits > 0 && videoMode.stencilBits > 0)
+            renderTargetDesc.attachments.push_back({ AttachmentType::DepthStencil });
+        else if (videoMode.depthBits > 0)
+            renderTargetDesc.attachments.push_back({ AttachmentType::Depth });
+        else if (videoMode.stencilBits > 0)
+            renderTargetDesc.attachments.push_back({ AttachmentType::Stencil });
+    }
+    auto renderTarget = renderSystem_.CreateRenderTarget(renderTargetDesc);
+
+    StoreObject(id, ObjectType::RenderTarget, renderTarget, colorTexture);
+}
+
+void CaptureReplayer::ReplayCreateRenderTarget()
+{
+    const auto id = ReadValue<std::uint32_t>();
+
+    RenderTargetDescriptor desc;
+    {
+        desc.renderPass             = ReadObject<RenderPass>();
+        desc.resolution             = ReadValue<Extent2D>();
+        desc.samples                = ReadValue<std::uint32_t>();
+        desc.transientAttachments   = ReadValue<bool>();
+        desc.customMultiSampling    = ReadValue<bool>();
+        desc.attachments.resize(ReadCount(sizeof(AttachmentType) + sizeof(std::uint32_t) * 3));
+        for (auto& attachment : desc.attachments)
+        {
+            attachment.type         = ReadValue<AttachmentType>();
+            attachment.texture      = ReadObject<Texture>();
+            attachment.mipLevel     = ReadValue<std::uint32_t>();
+            attachment.arrayLayer   = ReadValue<std::uint32_t>();
+        }
+    }
+    auto renderTarget = renderSystem_.CreateRenderTarget(desc);
+
+    StoreObject(id, ObjectType::RenderTarget, renderTarget);
+}
+
+void CaptureReplayer::ReplayRelease()
+{
+    const auto id = ReadValue<std::uint32_t>();
+    if (id == 0 || id >= objects_.size() || objects_[id].object == nullptr)
+        throw std::runtime_error("cannot release unknown object in command capture: ID " + std::to_string(id));
+    ReleaseObject(objects_[id]);
+}
+
+void CaptureReplayer::StoreObject(std::uint32_t id, ObjectType type, RenderSystemChild* object, Texture* colorTexture)
+{
+    /* Object IDs are assigned in sequential order, starting with 1 (see CaptureWriter::WriteNewObject) */
+    if (objects_.empty())
+        objects_.push_back({ ObjectType::Undefined, nullptr, nullptr });
+    ObjectEntry entry{ type, object, colorTexture };
+    if (id != objects_.size())
+    {
+        ReleaseObject(entry);
+        throw std::runtime_error("object ID out of sequence in command capture: ID " + std::to_string(id));
+    }
+    objects_.push_back(entry);
+}
+
+template <typename T>
+T* CaptureReplayer::ReadObject()
+{
+    const auto id = ReadValue<std::uint32_t>();
+    if (id == 0)
+        return nullptr;
+
+    if (id >= objects_.size() || objects_[id].object == nullptr)
+        throw std::runtime_error("reference to unknown object in command capture: ID " + std::to_string(id));
+
+    const auto& entry = objects_[id];
+    if (!CaptureObjectType<T>::Matches(entry.type))
+        throw std::runtime_error("reference to object of mismatching type in command capture: ID " + std::to_string(id));
+
+    return static_cast<T*>(entry.object);
+}
+
+template <typename T>
+T& CaptureReplayer::ReadObjectRef()
+{
+    if (auto object = ReadObject<T>())
+        return *object;
+    throw std::runtime_error("null reference in command capture");
+}
+
+IdentType CaptureReplayer::BeginSegment()
+{
+    try
+    {
+        return reader_.Begin().ident;
+    }
+    catch (const std::out_of_range& e)
+    {
+        throw std::runtime_error(std::string(e.what()) + " (command capture is truncated)");
+    }
+}
+
+const void* CaptureReplayer::ReadData(std::uint64_t& size)
+{
+    return CaptureReadData(reader_, size);
+}
+
+std::uint32_t CaptureReplayer::ReadCount(std::size_t minElementSize)
+{
+    return CaptureReadCount(reader_, minElementSize);
+}
+
+long CaptureReplayer::ReadFlags()
+{
+    return CaptureReadFlags(reader_);
+}
+
+template <typename T>
+T CaptureReplayer::ReadValue()
+{
+    if (reader_.GetRemainingSize() < sizeof(T))
+        throw std::runtime_error("unexpected end of segment in command capture");
+    T value;
+    reader_.ReadTyped(value);
+    return value;
+}
+
+void CaptureReplayer::ReleaseObject(ObjectEntry& entry)
+{
+    if (auto object = entry.object)
+    {
+        switch (entry.type)
+        {
+            case ObjectType::Undefined:
+            case ObjectType::OwnedRenderPass:
+                break;
+            case ObjectType::RenderTarget:
+                renderSystem_.Release(*static_cast<RenderTarget*>(object));
+                if (entry.colorTexture != nullptr)
+                    renderSystem_.Release(*entry.colorTexture);
+                break;
+            case ObjectType::CommandBuffer:
+                renderSystem_.Release(*static_cast<CommandBuffer*>(object));
+                break;
+            case ObjectType::Buffer:
+                renderSystem_.Release(*static_cast<Buffer*>(object));
+                break;
+            case ObjectType::BufferArray:
+                renderSystem_.Release(*static_cast<BufferArray*>(object));
+                break;
+            case ObjectType::Texture:
+                renderSystem_.Release(*static_cast<Texture*>(object));
+                break;
+            case ObjectType::Sampler:
+                renderSystem_.Release(*static_cast<Sampler*>(object));
+                break;
+            case ObjectType::ResourceHeap:
+                renderSystem_.Release(*static_cast<ResourceHeap*>(object));
+                break;
+            case ObjectType::RenderPass:
+                renderSystem_.Release(*static_cast<RenderPass*>(object));
+                break;
+            case ObjectType::Shader:
+                renderSystem_.Release(*static_cast<Shader*>(object));
+                break;
+            case ObjectType::ShaderProgram:
+                renderSystem_.Release(*static_cast<ShaderProgram*>(object));
+                break;
+            case ObjectType::PipelineLayout:
+                renderSystem_.Release(*static_cast<PipelineLayout*>(object));
+                break;
+            case ObjectType::PipelineState:
+                renderSystem_.Release(*static_cast<PipelineState*>(object));
+                break;
+            case ObjectType::QueryHeap:
+                renderSystem_.Release(*static_cast<QueryHeap*>(object));
+                break;
+            case ObjectType::Fence:
+                renderSystem_.Release(*static_cast<Fence*>(object));
+                break;
+        }
+    }
+    entry = { ObjectType::Undefined, nullptr, nullptr };
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
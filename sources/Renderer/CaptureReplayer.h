@@ -0,0 +1,139 @@
+/*
+ * CaptureReplayer.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_CAPTURE_REPLAYER_H
+#define LLGL_CAPTURE_REPLAYER_H
+
+
+#include "CaptureSerialization.h"
+#include <LLGL/RenderSystem.h>
+#include <LLGL/RenderingCapture.h>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Replays a command capture (see CaptureSerialization.h) with an arbitrary render system.
+Render contexts are replaced by render targets with the same resolution, so no window is required for replay.
+*/
+class CaptureReplayer
+{
+
+    public:
+
+        CaptureReplayer(RenderSystem& renderSystem, const Blob& capture);
+        ~CaptureReplayer();
+
+        // Replays all function calls of the capture and returns the statistics.
+        CaptureReplayStatistics Replay();
+
+    private:
+
+        enum class ObjectType
+        {
+            Undefined,
+            RenderTarget,
+            CommandBuffer,
+            Buffer,
+            BufferArray,
+            Texture,
+            Sampler,
+            ResourceHeap,
+            RenderPass,
+            OwnedRenderPass, // Render pass that is owned by a render context or render target
+            Shader,
+            ShaderProgram,
+            PipelineLayout,
+            PipelineState,
+            QueryHeap,
+            Fence,
+        };
+
+        struct ObjectEntry
+        {
+            ObjectType          type;
+            RenderSystemChild*  object;
+            Texture*            colorTexture; // Color attachment of a render target that replaces a render context
+        };
+
+        struct MappedBuffer
+        {
+            void*               data    = nullptr;
+            std::uint64_t       size    = 0;
+        };
+
+    private:
+
+        void ReadHeader();
+
+        // Reads the next segment header and returns its identifier. Throws an exception if the capture is truncated.
+        Serialization::IdentType BeginSegment();
+
+        // Replays the function call of the current segment.
+        void ReplayCommand(Serialization::CaptureIdent ident);
+
+        void ReplayCreateRenderContext();
+        void ReplayCreateRenderTarget();
+        void ReplayRelease();
+
+        // Stores the specified object with the ID it was assigned during capture.
+        void StoreObject(std::uint32_t id, ObjectType type, RenderSystemChild* object, Texture* colorTexture = nullptr);
+
+        // Reads an object ID and returns the respective object, or null if the ID is zero. Throws an exception if the object type does not match.
+        template <typename T>
+        T* ReadObject();
+
+        // Reads an object ID and returns the respective object. Throws an exception if the ID is zero or the object type does not match.
+        template <typename T>
+        T& ReadObjectRef();
+
+        const void* ReadData(std::uint64_t& size);
+        long ReadFlags();
+
+        // Reads the number of elements of an array (see CaptureReadCount).
+        std::uint32_t ReadCount(std::size_t minElementSize);
+
+        // Reads a value of the specified type. Throws an exception if the current segment is too small.
+        template <typename T>
+        T ReadValue();
+
+        // Releases the specified object entry and resets it.
+        void ReleaseObject(ObjectEntry& entry);
+
+    private:
+
+        RenderSystem&                               renderSystem_;
+        CommandQueue*                               commandQueue_   = nullptr;
+        Serialization::Deserializer                 reader_;
+
+        std::vector<ObjectEntry>                    objects_;
+        std::unordered_map<Buffer*, MappedBuffer>   mappedBuffers_;
+
+        /* Containers that are reused between replayed function calls to avoid frequent memory allocations */
+        std::vector<char>                           scratchBuffer_;
+        std::vector<Buffer*>                        bufferRefs_;
+        std::vector<Viewport>                       viewports_;
+        std::vector<Scissor>                        scissors_;
+        std::vector<AttachmentClear>                attachmentClears_;
+        std::vector<ClearValue>                     clearValues_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
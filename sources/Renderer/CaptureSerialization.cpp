@@ -0,0 +1,377 @@
+/*
+ * CaptureSerialization.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "CaptureSerialization.h"
+#include "../Core/Helper.h"
+#include <stdexcept>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+namespace Serialization
+{
+
+
+/* ----- Internal functions ----- */
+
+template <typename T>
+static void CaptureWriteArray(Serializer& writer, const T* data, std::size_t count)
+{
+    writer.WriteTyped(static_cast<std::uint32_t>(count));
+    if (count > 0)
+        writer.Write(data, sizeof(T) * count);
+}
+
+template <typename T>
+static void CaptureReadArray(Deserializer& reader, std::vector<T>& container)
+{
+    const auto count = CaptureReadCount(reader, sizeof(T));
+    container.resize(count);
+    if (count > 0)
+        reader.Read(container.data(), sizeof(T) * count);
+}
+
+static void CaptureWriteVertexAttributes(Serializer& writer, const std::vector<VertexAttribute>& attribs)
+{
+    writer.WriteTyped(static_cast<std::uint32_t>(attribs.size()));
+    for (const auto& attr : attribs)
+    {
+        writer.WriteCString(attr.name.c_str());
+        writer.WriteTyped(attr.format);
+        writer.WriteTyped(attr.location);
+        writer.WriteTyped(attr.semanticIndex);
+        writer.WriteTyped(attr.systemValue);
+        writer.WriteTyped(attr.slot);
+        writer.WriteTyped(attr.offset);
+        writer.WriteTyped(attr.stride);
+        writer.WriteTyped(attr.instanceDivisor);
+    }
+}
+
+static void CaptureReadVertexAttributes(Deserializer& reader, std::vector<VertexAttribute>& attribs)
+{
+    /* Each attribute starts with a name, i.e. at least a null terminator */
+    const auto count = CaptureReadCount(reader, 1);
+    attribs.resize(count);
+    for (auto& attr : attribs)
+    {
+        attr.name = reader.ReadCString();
+        reader.ReadTyped(attr.format);
+        reader.ReadTyped(attr.location);
+        reader.ReadTyped(attr.semanticIndex);
+        reader.ReadTyped(attr.systemValue);
+        reader.ReadTyped(attr.slot);
+        reader.ReadTyped(attr.offset);
+        reader.ReadTyped(attr.stride);
+        reader.ReadTyped(attr.instanceDivisor);
+    }
+}
+
+
+/* ----- Functions ----- */
+
+void CaptureWriteFlags(Serializer& writer, long flags)
+{
+    writer.WriteTyped(static_cast<std::int64_t>(flags));
+}
+
+long CaptureReadFlags(Deserializer& reader)
+{
+    std::int64_t flags = 0;
+    reader.ReadTyped(flags);
+    return static_cast<long>(flags);
+}
+
+std::uint32_t CaptureReadCount(Deserializer& reader, std::size_t minElementSize)
+{
+    std::uint32_t count = 0;
+    reader.ReadTyped(count);
+    if (minElementSize > 0 && count > reader.GetRemainingSize() / minElementSize)
+        throw std::out_of_range("number of elements out of bounds in command capture segment");
+    return count;
+}
+
+void CaptureWriteData(Serializer& writer, const void* data, std::uint64_t size)
+{
+    writer.WriteTyped(size);
+    if (size > 0)
+        writer.Write(data, static_cast<std::size_t>(size));
+}
+
+const void* CaptureReadData(Deserializer& reader, std::uint64_t& size)
+{
+    reader.ReadTyped(size);
+    if (size > reader.GetRemainingSize())
+        throw std::out_of_range("data size out of bounds in command capture segment");
+    return (size > 0 ? reader.ReadView(static_cast<std::size_t>(size)) : nullptr);
+}
+
+void CaptureWriteString(Serializer& writer, const char* str)
+{
+    writer.WriteCString(str != nullptr ? str : "");
+}
+
+void CaptureWriteBufferDesc(Serializer& writer, const BufferDescriptor& desc)
+{
+    writer.WriteTyped(desc.size);
+    writer.WriteTyped(desc.stride);
+    writer.WriteTyped(desc.format);
+    CaptureWriteFlags(writer, desc.bindFlags);
+    CaptureWriteFlags(writer, desc.cpuAccessFlags);
+    CaptureWriteFlags(writer, desc.miscFlags);
+    CaptureWriteVertexAttributes(writer, desc.vertexAttribs);
+}
+
+void CaptureReadBufferDesc(Deserializer& reader, BufferDescriptor& desc)
+{
+    reader.ReadTyped(desc.size);
+    reader.ReadTyped(desc.stride);
+    reader.ReadTyped(desc.format);
+    desc.bindFlags      = CaptureReadFlags(reader);
+    desc.cpuAccessFlags = CaptureReadFlags(reader);
+    desc.miscFlags      = CaptureReadFlags(reader);
+    CaptureReadVertexAttributes(reader, desc.vertexAttribs);
+}
+
+void CaptureWriteTextureDesc(Serializer& writer, const TextureDescriptor& desc)
+{
+    writer.WriteTyped(desc.type);
+    CaptureWriteFlags(writer, desc.bindFlags);
+    CaptureWriteFlags(writer, desc.miscFlags);
+    writer.WriteTyped(desc.format);
+    writer.WriteTyped(desc.extent);
+    writer.WriteTyped(desc.arrayLayers);
+    writer.WriteTyped(desc.mipLevels);
+    writer.WriteTyped(desc.samples);
+    writer.WriteTyped(desc.clearValue);
+}
+
+void CaptureReadTextureDesc(Deserializer& reader, TextureDescriptor& desc)
+{
+    reader.ReadTyped(desc.type);
+    desc.bindFlags = CaptureReadFlags(reader);
+    desc.miscFlags = CaptureReadFlags(reader);
+    reader.ReadTyped(desc.format);
+    reader.ReadTyped(desc.extent);
+    reader.ReadTyped(desc.arrayLayers);
+    reader.ReadTyped(desc.mipLevels);
+    reader.ReadTyped(desc.samples);
+    reader.ReadTyped(desc.clearValue);
+}
+
+void CaptureWriteRenderPassDesc(Serializer& writer, const RenderPassDescriptor& desc)
+{
+    CaptureWriteArray(writer, desc.colorAttachments.data(), desc.colorAttachments.size());
+    writer.WriteTyped(desc.depthAttachment);
+    writer.WriteTyped(desc.stencilAttachment);
+    writer.WriteTyped(desc.samples);
+}
+
+void CaptureReadRenderPassDesc(Deserializer& reader, RenderPassDescriptor& desc)
+{
+    CaptureReadArray(reader, desc.colorAttachments);
+    reader.ReadTyped(desc.depthAttachment);
+    reader.ReadTyped(desc.stencilAttachment);
+    reader.ReadTyped(desc.samples);
+}
+
+void CaptureWriteBindingDesc(Serializer& writer, const BindingDescriptor& desc)
+{
+    writer.WriteCString(desc.name.c_str());
+    writer.WriteTyped(desc.type);
+    CaptureWriteFlags(writer, desc.bindFlags);
+    CaptureWriteFlags(writer, desc.stageFlags);
+    writer.WriteTyped(desc.slot);
+    writer.WriteTyped(desc.arraySize);
+}
+
+void CaptureReadBindingDesc(Deserializer& reader, BindingDescriptor& desc)
+{
+    desc.name = reader.ReadCString();
+    reader.ReadTyped(desc.type);
+    desc.bindFlags  = CaptureReadFlags(reader);
+    desc.stageFlags = CaptureReadFlags(reader);
+    reader.ReadTyped(desc.slot);
+    reader.ReadTyped(desc.arraySize);
+}
+
+void CaptureWriteShaderDesc(Serializer& writer, const ShaderDescriptor& desc)
+{
+    writer.WriteTyped(desc.type);
+
+    /* Write shader source; sources from files are stored in the capture, so it can be replayed without the files */
+    switch (desc.sourceType)
+    {
+        case ShaderSourceType::CodeString:
+        {
+            const auto sourceSize = (desc.sourceSize > 0 ? desc.sourceSize : std::strlen(desc.source));
+            writer.WriteTyped(ShaderSourceType::CodeString);
+            CaptureWriteData(writer, desc.source, sourceSize);
+            writer.WriteTyped('\0');
+        }
+        break;
+
+        case ShaderSourceType::CodeFile:
+        {
+            const auto source = ReadFileString(desc.source);
+            writer.WriteTyped(ShaderSourceType::CodeString);
+            CaptureWriteData(writer, source.c_str(), source.size());
+            writer.WriteTyped('\0');
+        }
+        break;
+
+        case ShaderSourceType::BinaryBuffer:
+        {
+            writer.WriteTyped(ShaderSourceType::BinaryBuffer);
+            CaptureWriteData(writer, desc.source, desc.sourceSize);
+        }
+        break;
+
+        case ShaderSourceType::BinaryFile:
+        {
+            const auto source = ReadFileBuffer(desc.source);
+            writer.WriteTyped(ShaderSourceType::BinaryBuffer);
+            CaptureWriteData(writer, source.data(), source.size());
+        }
+        break;
+    }
+
+    CaptureWriteString(writer, desc.entryPoint);
+    CaptureWriteString(writer, desc.profile);
+
+    /* Write macro definitions */
+    std::uint32_t numDefines = 0;
+    if (desc.defines != nullptr)
+    {
+        while (desc.defines[numDefines].name != nullptr)
+            ++numDefines;
+    }
+
+    writer.WriteTyped(numDefines);
+    for (std::uint32_t i = 0; i < numDefines; ++i)
+    {
+        writer.WriteCString(desc.defines[i].name);
+        CaptureWriteString(writer, desc.defines[i].definition);
+    }
+
+    CaptureWriteFlags(writer, desc.flags);
+
+    /* Write shader attributes */
+    CaptureWriteVertexAttributes(writer, desc.vertex.inputAttribs);
+    CaptureWriteVertexAttributes(writer, desc.vertex.outputAttribs);
+
+    writer.WriteTyped(static_cast<std::uint32_t>(desc.fragment.outputAttribs.size()));
+    for (const auto& attr : desc.fragment.outputAttribs)
+    {
+        writer.WriteCString(attr.name.c_str());
+        writer.WriteTyped(attr.format);
+        writer.WriteTyped(attr.location);
+        writer.WriteTyped(attr.systemValue);
+    }
+
+    writer.WriteTyped(desc.compute.workGroupSize);
+}
+
+void CaptureReadShaderDesc(Deserializer& reader, ShaderDescriptor& desc, std::vector<ShaderMacro>& defines)
+{
+    reader.ReadTyped(desc.type);
+
+    /* Read shader source (code strings are followed by a null terminator) */
+    std::uint64_t sourceSize = 0;
+    reader.ReadTyped(desc.sourceType);
+    desc.source     = reinterpret_cast<const char*>(CaptureReadData(reader, sourceSize));
+    desc.sourceSize = static_cast<std::size_t>(sourceSize);
+
+    if (desc.sourceType == ShaderSourceType::CodeString)
+    {
+        auto terminator = reinterpret_cast<const char*>(reader.ReadView(1));
+        if (desc.source == nullptr)
+            desc.source = terminator;
+    }
+
+    desc.entryPoint = reader.ReadCString();
+    desc.profile    = reader.ReadCString();
+
+    /* Read macro definitions into null terminated array (each definition consists of at least two null terminators) */
+    const auto numDefines = CaptureReadCount(reader, 2);
+
+    defines.resize(numDefines + 1);
+    for (std::uint32_t i = 0; i < numDefines; ++i)
+    {
+        defines[i].name         = reader.ReadCString();
+        defines[i].definition   = reader.ReadCString();
+    }
+    defines[numDefines] = ShaderMacro{};
+
+    desc.defines = (numDefines > 0 ? defines.data() : nullptr);
+    desc.flags   = CaptureReadFlags(reader);
+
+    /* Read shader attributes */
+    CaptureReadVertexAttributes(reader, desc.vertex.inputAttribs);
+    CaptureReadVertexAttributes(reader, desc.vertex.outputAttribs);
+
+    const auto numFragmentAttribs = CaptureReadCount(reader, 1);
+    desc.fragment.outputAttribs.resize(numFragmentAttribs);
+    for (auto& attr : desc.fragment.outputAttribs)
+    {
+        attr.name = reader.ReadCString();
+        reader.ReadTyped(attr.format);
+        reader.ReadTyped(attr.location);
+        reader.ReadTyped(attr.systemValue);
+    }
+
+    reader.ReadTyped(desc.compute.workGroupSize);
+}
+
+void CaptureWriteGraphicsPipelineStates(Serializer& writer, const GraphicsPipelineDescriptor& desc)
+{
+    writer.WriteTyped(desc.primitiveTopology);
+    CaptureWriteArray(writer, desc.viewports.data(), desc.viewports.size());
+    CaptureWriteArray(writer, desc.scissors.data(), desc.scissors.size());
+    writer.WriteTyped(desc.depth);
+    writer.WriteTyped(desc.stencil);
+    writer.WriteTyped(desc.rasterizer);
+    writer.WriteTyped(desc.blend);
+    writer.WriteTyped(desc.tessellation);
+}
+
+void CaptureReadGraphicsPipelineStates(Deserializer& reader, GraphicsPipelineDescriptor& desc)
+{
+    reader.ReadTyped(desc.primitiveTopology);
+    CaptureReadArray(reader, desc.viewports);
+    CaptureReadArray(reader, desc.scissors);
+    reader.ReadTyped(desc.depth);
+    reader.ReadTyped(desc.stencil);
+    reader.ReadTyped(desc.rasterizer);
+    reader.ReadTyped(desc.blend);
+    reader.ReadTyped(desc.tessellation);
+}
+
+void CaptureWriteAttachmentClear(Serializer& writer, const AttachmentClear& attachment)
+{
+    CaptureWriteFlags(writer, attachment.flags);
+    writer.WriteTyped(attachment.colorAttachment);
+    writer.WriteTyped(attachment.clearValue);
+}
+
+void CaptureReadAttachmentClear(Deserializer& reader, AttachmentClear& attachment)
+{
+    attachment.flags = CaptureReadFlags(reader);
+    reader.ReadTyped(attachment.colorAttachment);
+    reader.ReadTyped(attachment.clearValue);
+}
+
+
+} // /namespace Serialization
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,207 @@
+/*
+ * CaptureSerialization.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_CAPTURE_SERIALIZATION_H
+#define LLGL_CAPTURE_SERIALIZATION_H
+
+
+#include "Serialization.h"
+#include <LLGL/RenderSystemFlags.h>
+#include <LLGL/BufferFlags.h>
+#include <LLGL/TextureFlags.h>
+#include <LLGL/ShaderFlags.h>
+#include <LLGL/RenderPassFlags.h>
+#include <LLGL/PipelineLayoutFlags.h>
+#include <LLGL/PipelineStateFlags.h>
+#include <LLGL/CommandBufferFlags.h>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+namespace Serialization
+{
+
+
+/* ----- Constants ----- */
+
+// Magic number ("LLCT") and version number of the command capture format (see CaptureIdent_Header).
+static const std::uint32_t g_captureMagic   = 0x54434C4C;
+static const std::uint32_t g_captureVersion = 2;
+
+
+/* ----- Enumerations ----- */
+
+/*
+Segment identifiers for command captures. Each segment is one captured function call.
+Objects are referred to by a 32-bit ID that is assigned in the order of their creation (ID 0 denotes a null pointer),
+'long' values are stored as 64-bit integers, and sizes are stored as 64-bit unsigned integers.
+The first argument of all command buffer segments (CaptureIdent_Begin and following) is the ID of the command buffer.
+*/
+enum CaptureIdent : IdentType
+{
+    CaptureIdent_ReservedCapture = (RendererID::Undefined << 8),
+    CaptureIdent_Header,                        // magic; version
+
+    /* RenderSystem */
+    CaptureIdent_CreateRenderContext,           // ID; RenderContextDescriptor
+    CaptureIdent_CreateCommandBuffer,           // ID; flags; numNativeBuffers; ID(renderPass)
+    CaptureIdent_CreateBuffer,                  // ID; BufferDescriptor; size; data[size] (size is zero without initial data)
+    CaptureIdent_CreateBufferArray,             // ID; n; ID(buffers)[n]
+    CaptureIdent_WriteBuffer,                   // ID; offset; size; data[size]
+    CaptureIdent_MapBuffer,                     // ID; CPUAccess
+    CaptureIdent_UnmapBuffer,                   // ID; size; data[size] (size is zero if the buffer was not mapped with write access)
+    CaptureIdent_CreateTexture,                 // ID; TextureDescriptor; ImageFormat; DataType; size; data[size] (size is zero without initial image)
+    CaptureIdent_WriteTexture,                  // ID; TextureRegion; ImageFormat; DataType; size; data[size]
+    CaptureIdent_ReadTexture,                   // ID; TextureRegion; ImageFormat; DataType; size
+    CaptureIdent_CreateSampler,                 // ID; SamplerDescriptor
+    CaptureIdent_CreateResourceHeap,            // ID; ID(pipelineLayout); bindless; n; { ID(resource); TextureViewDescriptor; BufferViewDescriptor }[n]
+    CaptureIdent_CreateRenderPass,              // ID; RenderPassDescriptor
+    CaptureIdent_CreateRenderTarget,            // ID; ID(renderPass); resolution; samples; customMultiSampling; n; { type; ID(texture); mipLevel; arrayLayer }[n]
+    CaptureIdent_GetRenderPass,                 // ID(renderPass); ID(renderTarget)
+    CaptureIdent_CreateShader,                  // ID; ShaderDescriptor (file sources are stored as code or binary buffers)
+    CaptureIdent_CreateShaderProgram,           // ID; ID(vertex, tessControl, tessEvaluation, geometry, fragment, compute)
+    CaptureIdent_CreatePipelineLayout,          // ID; n; BindingDescriptor[n]
+    CaptureIdent_CreateGraphicsPipeline,        // ID; GraphicsPipelineDescriptor
+    CaptureIdent_CreateComputePipeline,         // ID; ID(pipelineLayout); ID(shaderProgram)
+    CaptureIdent_CreateQueryHeap,               // ID; QueryHeapDescriptor
+    CaptureIdent_CreateFence,                   // ID
+    CaptureIdent_Release,                       // ID
+
+    /* RenderContext */
+    CaptureIdent_Present,                       // ID(renderContext)
+
+    /* CommandQueue */
+    CaptureIdent_Submit,                        // ID(commandBuffer)
+    CaptureIdent_SubmitFence,                   // ID(fence)
+    CaptureIdent_WaitFence,                     // ID(fence); timeout
+    CaptureIdent_WaitIdle,                      // -
+    CaptureIdent_QueryResult,                   // ID(queryHeap); firstQuery; numQueries; dataSize
+
+    /* CommandBuffer */
+    CaptureIdent_Begin,                         // -
+    CaptureIdent_End,                           // -
+    CaptureIdent_Execute,                       // ID(deferredCommandBuffer)
+    CaptureIdent_UpdateBuffer,                  // ID(dstBuffer); dstOffset; dataSize; data[dataSize]
+    CaptureIdent_CopyBuffer,                    // ID(dstBuffer); dstOffset; ID(srcBuffer); srcOffset; size
+    CaptureIdent_CopyBufferFromTexture,         // ID(dstBuffer); dstOffset; ID(srcTexture); TextureRegion; rowStride; layerStride
+    CaptureIdent_FillBuffer,                    // ID(dstBuffer); dstOffset; value; fillSize
+    CaptureIdent_CopyTexture,                   // ID(dstTexture); TextureLocation; ID(srcTexture); TextureLocation; Extent3D
+    CaptureIdent_CopyTextureFromBuffer,         // ID(dstTexture); TextureRegion; ID(srcBuffer); srcOffset; rowStride; layerStride
+    CaptureIdent_GenerateMips,                  // ID(texture)
+    CaptureIdent_GenerateMipsRange,             // ID(texture); TextureSubresource
+    CaptureIdent_SetViewport,                   // Viewport
+    CaptureIdent_SetViewports,                  // n; Viewport[n]
+    CaptureIdent_SetScissor,                    // Scissor
+    CaptureIdent_SetScissors,                   // n; Scissor[n]
+    CaptureIdent_SetClearColor,                 // ColorRGBAf
+    CaptureIdent_SetClearDepth,                 // depth
+    CaptureIdent_SetClearStencil,               // stencil
+    CaptureIdent_Clear,                         // flags
+    CaptureIdent_ClearAttachments,              // n; AttachmentClear[n]
+    CaptureIdent_SetVertexBuffer,               // ID(buffer)
+    CaptureIdent_SetVertexBufferArray,          // ID(bufferArray)
+    CaptureIdent_SetIndexBuffer,                // ID(buffer)
+    CaptureIdent_SetIndexBufferFormat,          // ID(buffer); Format; offset
+    CaptureIdent_SetResourceHeap,               // ID(resourceHeap); firstSet; PipelineBindPoint
+    CaptureIdent_SetResource,                   // ID(resource); slot; bindFlags; stageFlags
+    CaptureIdent_ResetResourceSlots,            // ResourceType; firstSlot; numSlots; bindFlags; stageFlags
+    CaptureIdent_BeginRenderPass,               // ID(renderTarget); ID(renderPass); n; ClearValue[n]
+    CaptureIdent_EndRenderPass,                 // -
+    CaptureIdent_SetPipelineState,              // ID(pipelineState)
+    CaptureIdent_SetBlendFactor,                // ColorRGBAf
+    CaptureIdent_SetStencilReference,           // reference; StencilFace
+    CaptureIdent_SetUniform,                    // location; dataSize; data[dataSize]
+    CaptureIdent_SetUniforms,                   // location; count; dataSize; data[dataSize]
+    CaptureIdent_BeginQuery,                    // ID(queryHeap); query
+    CaptureIdent_EndQuery,                      // ID(queryHeap); query
+    CaptureIdent_BeginRenderCondition,          // ID(queryHeap); query; RenderConditionMode
+    CaptureIdent_EndRenderCondition,            // -
+    CaptureIdent_BeginStreamOutput,             // n; ID(buffers)[n]
+    CaptureIdent_EndStreamOutput,               // -
+    CaptureIdent_Draw,                          // numVertices; firstVertex
+    CaptureIdent_DrawIndexed,                   // numIndices; firstIndex
+    CaptureIdent_DrawIndexedOffset,             // numIndices; firstIndex; vertexOffset
+    CaptureIdent_DrawInstanced,                 // numVertices; firstVertex; numInstances
+    CaptureIdent_DrawInstancedOffset,           // numVertices; firstVertex; numInstances; firstInstance
+    CaptureIdent_DrawIndexedInstanced,          // numIndices; numInstances; firstIndex
+    CaptureIdent_DrawIndexedInstancedOffset,    // numIndices; numInstances; firstIndex; vertexOffset
+    CaptureIdent_DrawIndexedInstancedFirst,     // numIndices; numInstances; firstIndex; vertexOffset; firstInstance
+    CaptureIdent_DrawIndirect,                  // ID(buffer); offset
+    CaptureIdent_DrawIndirectMulti,             // ID(buffer); offset; numCommands; stride
+    CaptureIdent_DrawIndexedIndirect,           // ID(buffer); offset
+    CaptureIdent_DrawIndexedIndirectMulti,      // ID(buffer); offset; numCommands; stride
+    CaptureIdent_Dispatch,                      // numWorkGroupsX; numWorkGroupsY; numWorkGroupsZ
+    CaptureIdent_DispatchIndirect,              // ID(buffer); offset
+    CaptureIdent_PushDebugGroup,                // name
+    CaptureIdent_PopDebugGroup,                 // -
+    CaptureIdent_SetGraphicsAPIDependentState,  // size; data[size]
+};
+
+
+
+/* ----- Functions ----- */
+
+// Writes the specified flags as 64-bit integer, since the size of 'long' differs between platforms.
+void CaptureWriteFlags(Serializer& writer, long flags);
+
+// Reads flags that were written with CaptureWriteFlags.
+long CaptureReadFlags(Deserializer& reader);
+
+/*
+Reads the number of elements of an array and throws std::out_of_range if the remaining segment
+cannot hold that many elements of the specified minimal serialized size. This avoids huge allocations for corrupted captures.
+*/
+std::uint32_t CaptureReadCount(Deserializer& reader, std::size_t minElementSize);
+
+// Writes the size of the specified data followed by the data itself.
+void CaptureWriteData(Serializer& writer, const void* data, std::uint64_t size);
+
+// Reads data that was written with CaptureWriteData without copying it. The returned pointer refers to the serialized data.
+const void* CaptureReadData(Deserializer& reader, std::uint64_t& size);
+
+// Writes the specified null terminated string, or an empty string if the pointer is null.
+void CaptureWriteString(Serializer& writer, const char* str);
+
+void CaptureWriteBufferDesc(Serializer& writer, const BufferDescriptor& desc);
+void CaptureReadBufferDesc(Deserializer& reader, BufferDescriptor& desc);
+
+void CaptureWriteTextureDesc(Serializer& writer, const TextureDescriptor& desc);
+void CaptureReadTextureDesc(Deserializer& reader, TextureDescriptor& desc);
+
+void CaptureWriteRenderPassDesc(Serializer& writer, const RenderPassDescriptor& desc);
+void CaptureReadRenderPassDesc(Deserializer& reader, RenderPassDescriptor& desc);
+
+void CaptureWriteBindingDesc(Serializer& writer, const BindingDescriptor& desc);
+void CaptureReadBindingDesc(Deserializer& reader, BindingDescriptor& desc);
+
+// Writes the specified shader descriptor. Shader sources from files are read and stored as code string or binary buffer.
+void CaptureWriteShaderDesc(Serializer& writer, const ShaderDescriptor& desc);
+
+// Reads a shader descriptor. All strings refer to the serialized data, and the macro definitions are stored in the specified container.
+void CaptureReadShaderDesc(Deserializer& reader, ShaderDescriptor& desc, std::vector<ShaderMacro>& defines);
+
+// Writes all states of the specified graphics pipeline descriptor, i.e. everything except the object references.
+void CaptureWriteGraphicsPipelineStates(Serializer& writer, const GraphicsPipelineDescriptor& desc);
+void CaptureReadGraphicsPipelineStates(Deserializer& reader, GraphicsPipelineDescriptor& desc);
+
+void CaptureWriteAttachmentClear(Serializer& writer, const AttachmentClear& attachment);
+void CaptureReadAttachmentClear(Deserializer& reader, AttachmentClear& attachment);
+
+
+} // /namespace Serialization
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,1090 @@
+/*
+ * CaptureWriter.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "CaptureWriter.h"
+
+
+namespace LLGL
+{
+
+
+using namespace Serialization;
+
+CaptureWriter::CaptureWriter()
+{
+    writer_.Begin(CaptureIdent_Header);
+    {
+        writer_.WriteTyped(g_captureMagic);
+        writer_.WriteTyped(g_captureVersion);
+    }
+    writer_.End();
+}
+
+std::unique_ptr<Blob> CaptureWriter::Finalize()
+{
+    if (finalized_)
+        return nullptr;
+
+    /* Terminate list of segments with an empty segment, so the last segment can be read even if it is empty */
+    writer_.Begin(CaptureIdent_ReservedCapture);
+    writer_.End();
+
+    /* Release all object references; no more calls are recorded after this point */
+    objectIDs_.clear();
+    mappedBuffers_.clear();
+    finalized_ = true;
+
+    return writer_.Finalize();
+}
+
+/* ----- RenderSystem ----- */
+
+void CaptureWriter::CreateRenderContext(const RenderContext& renderContext, const RenderContextDescriptor& desc)
+{
+    writer_.Begin(CaptureIdent_CreateRenderContext);
+    {
+        WriteNewObject(renderContext);
+        writer_.WriteTyped(desc);
+    }
+    writer_.End();
+    WriteOwnedRenderPass(renderContext);
+}
+
+void CaptureWriter::CreateCommandBuffer(const CommandBuffer& commandBuffer, const CommandBufferDescriptor& desc)
+{
+    writer_.Begin(CaptureIdent_CreateCommandBuffer);
+    {
+        WriteNewObject(commandBuffer);
+        WriteFlags(desc.flags);
+        writer_.WriteTyped(desc.numNativeBuffers);
+        WriteObject(desc.renderPass);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::CreateBuffer(const Buffer& buffer, const BufferDescriptor& desc, const void* initialData)
+{
+    writer_.Begin(CaptureIdent_CreateBuffer);
+    {
+        WriteNewObject(buffer);
+        CaptureWriteBufferDesc(writer_, desc);
+        WriteData(initialData, (initialData != nullptr ? desc.size : 0));
+    }
+    writer_.End();
+}
+
+void CaptureWriter::CreateBufferArray(const BufferArray& bufferArray, std::uint32_t numBuffers, Buffer* const * bufferArrayRefs)
+{
+    writer_.Begin(CaptureIdent_CreateBufferArray);
+    {
+        WriteNewObject(bufferArray);
+        writer_.WriteTyped(numBuffers);
+        for (std::uint32_t i = 0; i < numBuffers; ++i)
+            WriteObject(bufferArrayRefs[i]);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::WriteBuffer(const Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint64_t dataSize)
+{
+    writer_.Begin(CaptureIdent_WriteBuffer);
+    {
+        WriteObject(dstBuffer);
+        writer_.WriteTyped(dstOffset);
+        WriteData(data, dataSize);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::MapBuffer(const Buffer& buffer, std::uint64_t bufferSize, const CPUAccess access, const void* mappedData)
+{
+    writer_.Begin(CaptureIdent_MapBuffer);
+    {
+        WriteObject(buffer);
+        writer_.WriteTyped(access);
+    }
+    writer_.End();
+
+    /* Remember mapped memory, so its content can be captured when the buffer is unmapped */
+    if (mappedData != nullptr && access != CPUAccess::ReadOnly)
+        mappedBuffers_[&buffer] = { bufferSize, mappedData };
+}
+
+void CaptureWriter::UnmapBuffer(const Buffer& buffer)
+{
+    writer_.Begin(CaptureIdent_UnmapBuffer);
+    {
+        WriteObject(buffer);
+
+        /* Write content of mapped memory, since it might have been modified by the client programmer */
+        auto it = mappedBuffers_.find(&buffer);
+        if (it != mappedBuffers_.end())
+        {
+            WriteData(it->second.data, it->second.size);
+            mappedBuffers_.erase(it);
+        }
+        else
+            WriteData(nullptr, 0);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::CreateTexture(const Texture& texture, const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc)
+{
+    writer_.Begin(CaptureIdent_CreateTexture);
+    {
+        WriteNewObject(texture);
+        CaptureWriteTextureDesc(writer_, textureDesc);
+        if (imageDesc != nullptr && imageDesc->data != nullptr)
+        {
+            writer_.WriteTyped(imageDesc->format);
+            writer_.WriteTyped(imageDesc->dataType);
+            WriteData(imageDesc->data, imageDesc->dataSize);
+        }
+        else
+        {
+            writer_.WriteTyped(ImageFormat::RGBA);
+            writer_.WriteTyped(DataType::UInt8);
+            WriteData(nullptr, 0);
+        }
+    }
+    writer_.End();
+}
+
+void CaptureWriter::WriteTexture(const Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc)
+{
+    writer_.Begin(CaptureIdent_WriteTexture);
+    {
+        WriteObject(texture);
+        writer_.WriteTyped(textureRegion);
+        writer_.WriteTyped(imageDesc.format);
+        writer_.WriteTyped(imageDesc.dataType);
+        WriteData(imageDesc.data, imageDesc.dataSize);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::ReadTexture(const Texture& texture, const TextureRegion& textureRegion, const DstImageDescriptor& imageDesc)
+{
+    writer_.Begin(CaptureIdent_ReadTexture);
+    {
+        WriteObject(texture);
+        writer_.WriteTyped(textureRegion);
+        writer_.WriteTyped(imageDesc.format);
+        writer_.WriteTyped(imageDesc.dataType);
+        writer_.WriteTyped(static_cast<std::uint64_t>(imageDesc.dataSize));
+    }
+    writer_.End();
+}
+
+void CaptureWriter::CreateSampler(const Sampler& sampler, const SamplerDescriptor& desc)
+{
+    writer_.Begin(CaptureIdent_CreateSampler);
+    {
+        WriteNewObject(sampler);
+        writer_.WriteTyped(desc);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::CreateResourceHeap(const ResourceHeap& resourceHeap, const ResourceHeapDescriptor& desc)
+{
+    writer_.Begin(CaptureIdent_CreateResourceHeap);
+    {
+        WriteNewObject(resourceHeap);
+        WriteObject(desc.pipelineLayout);
+        writer_.WriteTyped(desc.bindless);
+        writer_.WriteTyped(static_cast<std::uint32_t>(desc.resourceViews.size()));
+        for (const auto& resourceView : desc.resourceViews)
+        {
+            WriteObject(resourceView.resource);
+            writer_.WriteTyped(resourceView.textureView);
+            writer_.WriteTyped(resourceView.bufferView);
+        }
+    }
+    writer_.End();
+}
+
+void CaptureWriter::CreateRenderPass(const RenderPass& renderPass, const RenderPassDescriptor& desc)
+{
+    writer_.Begin(CaptureIdent_CreateRenderPass);
+    {
+        WriteNewObject(renderPass);
+        CaptureWriteRenderPassDesc(writer_, desc);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::CreateRenderTarget(const RenderTarget& renderTarget, const RenderTargetDescriptor& desc)
+{
+    writer_.Begin(CaptureIdent_CreateRenderTarget);
+    {
+        WriteNewObject(renderTarget);
+        WriteObject(desc.renderPass);
+        writer_.WriteTyped(desc.resolution);
+        writer_.WriteTyped(desc.samples);
+        writer_.WriteTyped(desc.transientAttachments);
+        writer_.WriteTyped(desc.customMultiSampling);
+        writer_.WriteTyped(static_cast<std::uint32_t>(desc.attachments.size()));
+        for (const auto& attachment : desc.attachments)
+        {
+            writer_.WriteTyped(attachment.type);
+            WriteObject(attachment.texture);
+            writer_.WriteTyped(attachment.mipLevel);
+            writer_.WriteTyped(attachment.arrayLayer);
+        }
+    }
+    writer_.End();
+
+    /* Only register render pass if it is not the one specified by the client programmer */
+    if (desc.renderPass == nullptr)
+        WriteOwnedRenderPass(renderTarget);
+}
+
+void CaptureWriter::CreateShader(const Shader& shader, const ShaderDescriptor& desc)
+{
+    writer_.Begin(CaptureIdent_CreateShader);
+    {
+        WriteNewObject(shader);
+        CaptureWriteShaderDesc(writer_, desc);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::CreateShaderProgram(const ShaderProgram& shaderProgram, const ShaderProgramDescriptor& desc)
+{
+    writer_.Begin(CaptureIdent_CreateShaderProgram);
+    {
+        WriteNewObject(shaderProgram);
+        WriteObject(desc.vertexShader);
+        WriteObject(desc.tessControlShader);
+        WriteObject(desc.tessEvaluationShader);
+        WriteObject(desc.geometryShader);
+        WriteObject(desc.fragmentShader);
+        WriteObject(desc.computeShader);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::CreatePipelineLayout(const PipelineLayout& pipelineLayout, const PipelineLayoutDescriptor& desc)
+{
+    writer_.Begin(CaptureIdent_CreatePipelineLayout);
+    {
+        WriteNewObject(pipelineLayout);
+        writer_.WriteTyped(static_cast<std::uint32_t>(desc.bindings.size()));
+        for (const auto& binding : desc.bindings)
+            CaptureWriteBindingDesc(writer_, binding);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::CreatePipelineState(const PipelineState& pipelineState, const GraphicsPipelineDescriptor& desc)
+{
+    writer_.Begin(CaptureIdent_CreateGraphicsPipeline);
+    {
+        WriteNewObject(pipelineState);
+        WriteObject(desc.pipelineLayout);
+        WriteObject(desc.shaderProgram);
+        WriteObject(desc.renderPass);
+        CaptureWriteGraphicsPipelineStates(writer_, desc);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::CreatePipelineState(const PipelineState& pipelineState, const ComputePipelineDescriptor& desc)
+{
+    writer_.Begin(CaptureIdent_CreateComputePipeline);
+    {
+        WriteNewObject(pipelineState);
+        WriteObject(desc.pipelineLayout);
+        WriteObject(desc.shaderProgram);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::CreateQueryHeap(const QueryHeap& queryHeap, const QueryHeapDescriptor& desc)
+{
+    writer_.Begin(CaptureIdent_CreateQueryHeap);
+    {
+        WriteNewObject(queryHeap);
+        writer_.WriteTyped(desc);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::CreateFence(const Fence& fence)
+{
+    writer_.Begin(CaptureIdent_CreateFence);
+    {
+        WriteNewObject(fence);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::Release(const RenderSystemChild& object)
+{
+    auto it = objectIDs_.find(&object);
+    if (it != objectIDs_.end())
+    {
+        writer_.Begin(CaptureIdent_Release);
+        {
+            writer_.WriteTyped(it->second.id);
+        }
+        writer_.End();
+
+        /* Remove object and its render pass, since their addresses can be reused by new objects */
+        if (auto renderPass = it->second.renderPass)
+            objectIDs_.erase(renderPass);
+        objectIDs_.erase(it);
+    }
+}
+
+/* ----- RenderContext ----- */
+
+void CaptureWriter::Present(const RenderContext& renderContext)
+{
+    writer_.Begin(CaptureIdent_Present);
+    {
+        WriteObject(renderContext);
+    }
+    writer_.End();
+    ++numFrames_;
+}
+
+/* ----- CommandQueue ----- */
+
+void CaptureWriter::Submit(const CommandBuffer& commandBuffer)
+{
+    writer_.Begin(CaptureIdent_Submit);
+    {
+        WriteObject(commandBuffer);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::Submit(const Fence& fence)
+{
+    writer_.Begin(CaptureIdent_SubmitFence);
+    {
+        WriteObject(fence);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::WaitFence(const Fence& fence, std::uint64_t timeout)
+{
+    writer_.Begin(CaptureIdent_WaitFence);
+    {
+        WriteObject(fence);
+        writer_.WriteTyped(timeout);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::WaitIdle()
+{
+    writer_.Begin(CaptureIdent_WaitIdle);
+    writer_.End();
+}
+
+void CaptureWriter::QueryResult(const QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, std::size_t dataSize)
+{
+    writer_.Begin(CaptureIdent_QueryResult);
+    {
+        WriteObject(queryHeap);
+        writer_.WriteTyped(firstQuery);
+        writer_.WriteTyped(numQueries);
+        writer_.WriteTyped(static_cast<std::uint64_t>(dataSize));
+    }
+    writer_.End();
+}
+
+/* ----- CommandBuffer ----- */
+
+void CaptureWriter::Begin(const CommandBuffer& cmdBuffer)
+{
+    BeginCommand(CaptureIdent_Begin, cmdBuffer);
+    writer_.End();
+}
+
+void CaptureWriter::End(const CommandBuffer& cmdBuffer)
+{
+    BeginCommand(CaptureIdent_End, cmdBuffer);
+    writer_.End();
+}
+
+void CaptureWriter::Execute(const CommandBuffer& cmdBuffer, const CommandBuffer& deferredCommandBuffer)
+{
+    BeginCommand(CaptureIdent_Execute, cmdBuffer);
+    {
+        WriteObject(deferredCommandBuffer);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::UpdateBuffer(const CommandBuffer& cmdBuffer, const Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint16_t dataSize)
+{
+    BeginCommand(CaptureIdent_UpdateBuffer, cmdBuffer);
+    {
+        WriteObject(dstBuffer);
+        writer_.WriteTyped(dstOffset);
+        WriteData(data, dataSize);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::CopyBuffer(const CommandBuffer& cmdBuffer, const Buffer& dstBuffer, std::uint64_t dstOffset, const Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size)
+{
+    BeginCommand(CaptureIdent_CopyBuffer, cmdBuffer);
+    {
+        WriteObject(dstBuffer);
+        writer_.WriteTyped(dstOffset);
+        WriteObject(srcBuffer);
+        writer_.WriteTyped(srcOffset);
+        writer_.WriteTyped(size);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::CopyBufferFromTexture(
+    const CommandBuffer&    cmdBuffer,
+    const Buffer&           dstBuffer,
+    std::uint64_t           dstOffset,
+    const Texture&          srcTexture,
+    const TextureRegion&    srcRegion,
+    std::uint32_t           rowStride,
+    std::uint32_t           layerStride)
+{
+    BeginCommand(CaptureIdent_CopyBufferFromTexture, cmdBuffer);
+    {
+        WriteObject(dstBuffer);
+        writer_.WriteTyped(dstOffset);
+        WriteObject(srcTexture);
+        writer_.WriteTyped(srcRegion);
+        writer_.WriteTyped(rowStride);
+        writer_.WriteTyped(layerStride);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::FillBuffer(const CommandBuffer& cmdBuffer, const Buffer& dstBuffer, std::uint64_t dstOffset, std::uint32_t value, std::uint64_t fillSize)
+{
+    BeginCommand(CaptureIdent_FillBuffer, cmdBuffer);
+    {
+        WriteObject(dstBuffer);
+        writer_.WriteTyped(dstOffset);
+        writer_.WriteTyped(value);
+        writer_.WriteTyped(fillSize);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::CopyTexture(
+    const CommandBuffer&    cmdBuffer,
+    const Texture&          dstTexture,
+    const TextureLocation&  dstLocation,
+    const Texture&          srcTexture,
+    const TextureLocation&  srcLocation,
+    const Extent3D&         extent)
+{
+    BeginCommand(CaptureIdent_CopyTexture, cmdBuffer);
+    {
+        WriteObject(dstTexture);
+        writer_.WriteTyped(dstLocation);
+        WriteObject(srcTexture);
+        writer_.WriteTyped(srcLocation);
+        writer_.WriteTyped(extent);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::CopyTextureFromBuffer(
+    const CommandBuffer&    cmdBuffer,
+    const Texture&          dstTexture,
+    const TextureRegion&    dstRegion,
+    const Buffer&           srcBuffer,
+    std::uint64_t           srcOffset,
+    std::uint32_t           rowStride,
+    std::uint32_t           layerStride)
+{
+    BeginCommand(CaptureIdent_CopyTextureFromBuffer, cmdBuffer);
+    {
+        WriteObject(dstTexture);
+        writer_.WriteTyped(dstRegion);
+        WriteObject(srcBuffer);
+        writer_.WriteTyped(srcOffset);
+        writer_.WriteTyped(rowStride);
+        writer_.WriteTyped(layerStride);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::GenerateMips(const CommandBuffer& cmdBuffer, const Texture& texture)
+{
+    BeginCommand(CaptureIdent_GenerateMips, cmdBuffer);
+    {
+        WriteObject(texture);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::GenerateMips(const CommandBuffer& cmdBuffer, const Texture& texture, const TextureSubresource& subresource)
+{
+    BeginCommand(CaptureIdent_GenerateMipsRange, cmdBuffer);
+    {
+        WriteObject(texture);
+        writer_.WriteTyped(subresource);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::SetViewport(const CommandBuffer& cmdBuffer, const Viewport& viewport)
+{
+    BeginCommand(CaptureIdent_SetViewport, cmdBuffer);
+    {
+        writer_.WriteTyped(viewport);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::SetViewports(const CommandBuffer& cmdBuffer, std::uint32_t numViewports, const Viewport* viewports)
+{
+    BeginCommand(CaptureIdent_SetViewports, cmdBuffer);
+    {
+        writer_.WriteTyped(numViewports);
+        for (std::uint32_t i = 0; i < numViewports; ++i)
+            writer_.WriteTyped(viewports[i]);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::SetScissor(const CommandBuffer& cmdBuffer, const Scissor& scissor)
+{
+    BeginCommand(CaptureIdent_SetScissor, cmdBuffer);
+    {
+        writer_.WriteTyped(scissor);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::SetScissors(const CommandBuffer& cmdBuffer, std::uint32_t numScissors, const Scissor* scissors)
+{
+    BeginCommand(CaptureIdent_SetScissors, cmdBuffer);
+    {
+        writer_.WriteTyped(numScissors);
+        for (std::uint32_t i = 0; i < numScissors; ++i)
+            writer_.WriteTyped(scissors[i]);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::SetClearColor(const CommandBuffer& cmdBuffer, const ColorRGBAf& color)
+{
+    BeginCommand(CaptureIdent_SetClearColor, cmdBuffer);
+    {
+        writer_.WriteTyped(color);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::SetClearDepth(const CommandBuffer& cmdBuffer, float depth)
+{
+    BeginCommand(CaptureIdent_SetClearDepth, cmdBuffer);
+    {
+        writer_.WriteTyped(depth);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::SetClearStencil(const CommandBuffer& cmdBuffer, std::uint32_t stencil)
+{
+    BeginCommand(CaptureIdent_SetClearStencil, cmdBuffer);
+    {
+        writer_.WriteTyped(stencil);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::Clear(const CommandBuffer& cmdBuffer, long flags)
+{
+    BeginCommand(CaptureIdent_Clear, cmdBuffer);
+    {
+        WriteFlags(flags);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::ClearAttachments(const CommandBuffer& cmdBuffer, std::uint32_t numAttachments, const AttachmentClear* attachments)
+{
+    BeginCommand(CaptureIdent_ClearAttachments, cmdBuffer);
+    {
+        writer_.WriteTyped(numAttachments);
+        for (std::uint32_t i = 0; i < numAttachments; ++i)
+            CaptureWriteAttachmentClear(writer_, attachments[i]);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::SetVertexBuffer(const CommandBuffer& cmdBuffer, const Buffer& buffer)
+{
+    BeginCommand(CaptureIdent_SetVertexBuffer, cmdBuffer);
+    {
+        WriteObject(buffer);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::SetVertexBufferArray(const CommandBuffer& cmdBuffer, const BufferArray& bufferArray)
+{
+    BeginCommand(CaptureIdent_SetVertexBufferArray, cmdBuffer);
+    {
+        WriteObject(bufferArray);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::SetIndexBuffer(const CommandBuffer& cmdBuffer, const Buffer& buffer)
+{
+    BeginCommand(CaptureIdent_SetIndexBuffer, cmdBuffer);
+    {
+        WriteObject(buffer);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::SetIndexBuffer(const CommandBuffer& cmdBuffer, const Buffer& buffer, const Format format, std::uint64_t offset)
+{
+    BeginCommand(CaptureIdent_SetIndexBufferFormat, cmdBuffer);
+    {
+        WriteObject(buffer);
+        writer_.WriteTyped(format);
+        writer_.WriteTyped(offset);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::SetResourceHeap(const CommandBuffer& cmdBuffer, const ResourceHeap& resourceHeap, std::uint32_t firstSet, const PipelineBindPoint bindPoint)
+{
+    BeginCommand(CaptureIdent_SetResourceHeap, cmdBuffer);
+    {
+        WriteObject(resourceHeap);
+        writer_.WriteTyped(firstSet);
+        writer_.WriteTyped(bindPoint);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::SetResource(const CommandBuffer& cmdBuffer, const Resource& resource, std::uint32_t slot, long bindFlags, long stageFlags)
+{
+    BeginCommand(CaptureIdent_SetResource, cmdBuffer);
+    {
+        WriteObject(resource);
+        writer_.WriteTyped(slot);
+        WriteFlags(bindFlags);
+        WriteFlags(stageFlags);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::ResetResourceSlots(
+    const CommandBuffer&    cmdBuffer,
+    const ResourceType      resourceType,
+    std::uint32_t           firstSlot,
+    std::uint32_t           numSlots,
+    long                    bindFlags,
+    long                    stageFlags)
+{
+    BeginCommand(CaptureIdent_ResetResourceSlots, cmdBuffer);
+    {
+        writer_.WriteTyped(resourceType);
+        writer_.WriteTyped(firstSlot);
+        writer_.WriteTyped(numSlots);
+        WriteFlags(bindFlags);
+        WriteFlags(stageFlags);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::BeginRenderPass(
+    const CommandBuffer&    cmdBuffer,
+    const RenderTarget&     renderTarget,
+    const RenderPass*       renderPass,
+    std::uint32_t           numClearValues,
+    const ClearValue*       clearValues)
+{
+    BeginCommand(CaptureIdent_BeginRenderPass, cmdBuffer);
+    {
+        WriteObject(renderTarget);
+        WriteObject(renderPass);
+        writer_.WriteTyped(numClearValues);
+        for (std::uint32_t i = 0; i < numClearValues; ++i)
+            writer_.WriteTyped(clearValues[i]);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::EndRenderPass(const CommandBuffer& cmdBuffer)
+{
+    BeginCommand(CaptureIdent_EndRenderPass, cmdBuffer);
+    writer_.End();
+}
+
+void CaptureWriter::SetPipelineState(const CommandBuffer& cmdBuffer, const PipelineState& pipelineState)
+{
+    BeginCommand(CaptureIdent_SetPipelineState, cmdBuffer);
+    {
+        WriteObject(pipelineState);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::SetBlendFactor(const CommandBuffer& cmdBuffer, const ColorRGBAf& color)
+{
+    BeginCommand(CaptureIdent_SetBlendFactor, cmdBuffer);
+    {
+        writer_.WriteTyped(color);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::SetStencilReference(const CommandBuffer& cmdBuffer, std::uint32_t reference, const StencilFace stencilFace)
+{
+    BeginCommand(CaptureIdent_SetStencilReference, cmdBuffer);
+    {
+        writer_.WriteTyped(reference);
+        writer_.WriteTyped(stencilFace);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::SetUniform(const CommandBuffer& cmdBuffer, UniformLocation location, const void* data, std::uint32_t dataSize)
+{
+    BeginCommand(CaptureIdent_SetUniform, cmdBuffer);
+    {
+        writer_.WriteTyped(location);
+        WriteData(data, dataSize);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::SetUniforms(const CommandBuffer& cmdBuffer, UniformLocation location, std::uint32_t count, const void* data, std::uint32_t dataSize)
+{
+    BeginCommand(CaptureIdent_SetUniforms, cmdBuffer);
+    {
+        writer_.WriteTyped(location);
+        writer_.WriteTyped(count);
+        WriteData(data, dataSize);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::BeginQuery(const CommandBuffer& cmdBuffer, const QueryHeap& queryHeap, std::uint32_t query)
+{
+    BeginCommand(CaptureIdent_BeginQuery, cmdBuffer);
+    {
+        WriteObject(queryHeap);
+        writer_.WriteTyped(query);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::EndQuery(const CommandBuffer& cmdBuffer, const QueryHeap& queryHeap, std::uint32_t query)
+{
+    BeginCommand(CaptureIdent_EndQuery, cmdBuffer);
+    {
+        WriteObject(queryHeap);
+        writer_.WriteTyped(query);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::BeginRenderCondition(const CommandBuffer& cmdBuffer, const QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
+{
+    BeginCommand(CaptureIdent_BeginRenderCondition, cmdBuffer);
+    {
+        WriteObject(queryHeap);
+        writer_.WriteTyped(query);
+        writer_.WriteTyped(mode);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::EndRenderCondition(const CommandBuffer& cmdBuffer)
+{
+    BeginCommand(CaptureIdent_EndRenderCondition, cmdBuffer);
+    writer_.End();
+}
+
+void CaptureWriter::BeginStreamOutput(const CommandBuffer& cmdBuffer, std::uint32_t numBuffers, Buffer* const * buffers)
+{
+    BeginCommand(CaptureIdent_BeginStreamOutput, cmdBuffer);
+    {
+        writer_.WriteTyped(numBuffers);
+        for (std::uint32_t i = 0; i < numBuffers; ++i)
+            WriteObject(buffers[i]);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::EndStreamOutput(const CommandBuffer& cmdBuffer)
+{
+    BeginCommand(CaptureIdent_EndStreamOutput, cmdBuffer);
+    writer_.End();
+}
+
+void CaptureWriter::Draw(const CommandBuffer& cmdBuffer, std::uint32_t numVertices, std::uint32_t firstVertex)
+{
+    BeginCommand(CaptureIdent_Draw, cmdBuffer);
+    {
+        writer_.WriteTyped(numVertices);
+        writer_.WriteTyped(firstVertex);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::DrawIndexed(const CommandBuffer& cmdBuffer, std::uint32_t numIndices, std::uint32_t firstIndex)
+{
+    BeginCommand(CaptureIdent_DrawIndexed, cmdBuffer);
+    {
+        writer_.WriteTyped(numIndices);
+        writer_.WriteTyped(firstIndex);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::DrawIndexed(const CommandBuffer& cmdBuffer, std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
+{
+    BeginCommand(CaptureIdent_DrawIndexedOffset, cmdBuffer);
+    {
+        writer_.WriteTyped(numIndices);
+        writer_.WriteTyped(firstIndex);
+        writer_.WriteTyped(vertexOffset);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::DrawInstanced(const CommandBuffer& cmdBuffer, std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
+{
+    BeginCommand(CaptureIdent_DrawInstanced, cmdBuffer);
+    {
+        writer_.WriteTyped(numVertices);
+        writer_.WriteTyped(firstVertex);
+        writer_.WriteTyped(numInstances);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::DrawInstanced(const CommandBuffer& cmdBuffer, std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
+{
+    BeginCommand(CaptureIdent_DrawInstancedOffset, cmdBuffer);
+    {
+        writer_.WriteTyped(numVertices);
+        writer_.WriteTyped(firstVertex);
+        writer_.WriteTyped(numInstances);
+        writer_.WriteTyped(firstInstance);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::DrawIndexedInstanced(const CommandBuffer& cmdBuffer, std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
+{
+    BeginCommand(CaptureIdent_DrawIndexedInstanced, cmdBuffer);
+    {
+        writer_.WriteTyped(numIndices);
+        writer_.WriteTyped(numInstances);
+        writer_.WriteTyped(firstIndex);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::DrawIndexedInstanced(const CommandBuffer& cmdBuffer, std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
+{
+    BeginCommand(CaptureIdent_DrawIndexedInstancedOffset, cmdBuffer);
+    {
+        writer_.WriteTyped(numIndices);
+        writer_.WriteTyped(numInstances);
+        writer_.WriteTyped(firstIndex);
+        writer_.WriteTyped(vertexOffset);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::DrawIndexedInstanced(
+    const CommandBuffer&    cmdBuffer,
+    std::uint32_t           numIndices,
+    std::uint32_t           numInstances,
+    std::uint32_t           firstIndex,
+    std::int32_t            vertexOffset,
+    std::uint32_t           firstInstance)
+{
+    BeginCommand(CaptureIdent_DrawIndexedInstancedFirst, cmdBuffer);
+    {
+        writer_.WriteTyped(numIndices);
+        writer_.WriteTyped(numInstances);
+        writer_.WriteTyped(firstIndex);
+        writer_.WriteTyped(vertexOffset);
+        writer_.WriteTyped(firstInstance);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::DrawIndirect(const CommandBuffer& cmdBuffer, const Buffer& buffer, std::uint64_t offset)
+{
+    BeginCommand(CaptureIdent_DrawIndirect, cmdBuffer);
+    {
+        WriteObject(buffer);
+        writer_.WriteTyped(offset);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::DrawIndirect(const CommandBuffer& cmdBuffer, const Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    BeginCommand(CaptureIdent_DrawIndirectMulti, cmdBuffer);
+    {
+        WriteObject(buffer);
+        writer_.WriteTyped(offset);
+        writer_.WriteTyped(numCommands);
+        writer_.WriteTyped(stride);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::DrawIndexedIndirect(const CommandBuffer& cmdBuffer, const Buffer& buffer, std::uint64_t offset)
+{
+    BeginCommand(CaptureIdent_DrawIndexedIndirect, cmdBuffer);
+    {
+        WriteObject(buffer);
+        writer_.WriteTyped(offset);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::DrawIndexedIndirect(const CommandBuffer& cmdBuffer, const Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    BeginCommand(CaptureIdent_DrawIndexedIndirectMulti, cmdBuffer);
+    {
+        WriteObject(buffer);
+        writer_.WriteTyped(offset);
+        writer_.WriteTyped(numCommands);
+        writer_.WriteTyped(stride);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::Dispatch(const CommandBuffer& cmdBuffer, std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
+{
+    BeginCommand(CaptureIdent_Dispatch, cmdBuffer);
+    {
+        writer_.WriteTyped(numWorkGroupsX);
+        writer_.WriteTyped(numWorkGroupsY);
+        writer_.WriteTyped(numWorkGroupsZ);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::DispatchIndirect(const CommandBuffer& cmdBuffer, const Buffer& buffer, std::uint64_t offset)
+{
+    BeginCommand(CaptureIdent_DispatchIndirect, cmdBuffer);
+    {
+        WriteObject(buffer);
+        writer_.WriteTyped(offset);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::PushDebugGroup(const CommandBuffer& cmdBuffer, const char* name)
+{
+    BeginCommand(CaptureIdent_PushDebugGroup, cmdBuffer);
+    {
+        CaptureWriteString(writer_, name);
+    }
+    writer_.End();
+}
+
+void CaptureWriter::PopDebugGroup(const CommandBuffer& cmdBuffer)
+{
+    BeginCommand(CaptureIdent_PopDebugGroup, cmdBuffer);
+    writer_.End();
+}
+
+void CaptureWriter::SetGraphicsAPIDependentState(const CommandBuffer& cmdBuffer, const void* stateDesc, std::size_t stateDescSize)
+{
+    BeginCommand(CaptureIdent_SetGraphicsAPIDependentState, cmdBuffer);
+    {
+        WriteData(stateDesc, stateDescSize);
+    }
+    writer_.End();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void CaptureWriter::WriteNewObject(const RenderSystemChild& object)
+{
+    const auto id = nextObjectID_++;
+    objectIDs_[&object] = { id, nullptr };
+    writer_.WriteTyped(id);
+}
+
+void CaptureWriter::WriteObject(const RenderSystemChild* object)
+{
+    std::uint32_t id = 0;
+    if (object != nullptr)
+    {
+        auto it = objectIDs_.find(object);
+        if (it != objectIDs_.end())
+            id = it->second.id;
+    }
+    writer_.WriteTyped(id);
+}
+
+void CaptureWriter::WriteObject(const RenderSystemChild& object)
+{
+    WriteObject(&object);
+}
+
+void CaptureWriter::WriteData(const void* data, std::uint64_t size)
+{
+    CaptureWriteData(writer_, data, (data != nullptr ? size : 0));
+}
+
+void CaptureWriter::WriteFlags(long flags)
+{
+    CaptureWriteFlags(writer_, flags);
+}
+
+void CaptureWriter::BeginCommand(CaptureIdent ident, const CommandBuffer& cmdBuffer)
+{
+    writer_.Begin(ident);
+    WriteObject(cmdBuffer);
+}
+
+void CaptureWriter::WriteOwnedRenderPass(const RenderTarget& renderTarget)
+{
+    /* Render passes can be shared between render contexts, so only register them once */
+    auto renderPass = renderTarget.GetRenderPass();
+    if (renderPass != nullptr && objectIDs_.find(renderPass) == objectIDs_.end())
+    {
+        writer_.Begin(CaptureIdent_GetRenderPass);
+        {
+            WriteNewObject(*renderPass);
+            WriteObject(renderTarget);
+        }
+        writer_.End();
+        objectIDs_[&renderTarget].renderPass = renderPass;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,201 @@
+/*
+ * CaptureWriter.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_CAPTURE_WRITER_H
+#define LLGL_CAPTURE_WRITER_H
+
+
+#include "CaptureSerialization.h"
+#include <LLGL/RenderSystem.h>
+#include <unordered_map>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Serializes render system calls into a command capture (see CaptureSerialization.h).
+All objects are referred to by the pointers the client programmer sees, i.e. the debug layer objects.
+Render passes that are owned by render contexts and render targets are registered with their owner, so they can be restored during replay.
+*/
+class CaptureWriter
+{
+
+    public:
+
+        CaptureWriter();
+
+        // Ends the capture and returns the serialized trace, or null if the capture has already been finalized.
+        std::unique_ptr<Blob> Finalize();
+
+        // Returns the number of frames recorded so far.
+        inline std::uint32_t GetNumFrames() const
+        {
+            return numFrames_;
+        }
+
+        // Returns true if the capture has been finalized.
+        inline bool IsFinalized() const
+        {
+            return finalized_;
+        }
+
+    public:
+
+        /* ----- RenderSystem ----- */
+
+        void CreateRenderContext(const RenderContext& renderContext, const RenderContextDescriptor& desc);
+        void CreateCommandBuffer(const CommandBuffer& commandBuffer, const CommandBufferDescriptor& desc);
+        void CreateBuffer(const Buffer& buffer, const BufferDescriptor& desc, const void* initialData);
+        void CreateBufferArray(const BufferArray& bufferArray, std::uint32_t numBuffers, Buffer* const * bufferArrayRefs);
+        void WriteBuffer(const Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint64_t dataSize);
+        void MapBuffer(const Buffer& buffer, std::uint64_t bufferSize, const CPUAccess access, const void* mappedData);
+        void UnmapBuffer(const Buffer& buffer);
+        void CreateTexture(const Texture& texture, const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc);
+        void WriteTexture(const Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc);
+        void ReadTexture(const Texture& texture, const TextureRegion& textureRegion, const DstImageDescriptor& imageDesc);
+        void CreateSampler(const Sampler& sampler, const SamplerDescriptor& desc);
+        void CreateResourceHeap(const ResourceHeap& resourceHeap, const ResourceHeapDescriptor& desc);
+        void CreateRenderPass(const RenderPass& renderPass, const RenderPassDescriptor& desc);
+        void CreateRenderTarget(const RenderTarget& renderTarget, const RenderTargetDescriptor& desc);
+        void CreateShader(const Shader& shader, const ShaderDescriptor& desc);
+        void CreateShaderProgram(const ShaderProgram& shaderProgram, const ShaderProgramDescriptor& desc);
+        void CreatePipelineLayout(const PipelineLayout& pipelineLayout, const PipelineLayoutDescriptor& desc);
+        void CreatePipelineState(const PipelineState& pipelineState, const GraphicsPipelineDescriptor& desc);
+        void CreatePipelineState(const PipelineState& pipelineState, const ComputePipelineDescriptor& desc);
+        void CreateQueryHeap(const QueryHeap& queryHeap, const QueryHeapDescriptor& desc);
+        void CreateFence(const Fence& fence);
+        void Release(const RenderSystemChild& object);
+
+        /* ----- RenderContext ----- */
+
+        void Present(const RenderContext& renderContext);
+
+        /* ----- CommandQueue ----- */
+
+        void Submit(const CommandBuffer& commandBuffer);
+        void Submit(const Fence& fence);
+        void WaitFence(const Fence& fence, std::uint64_t timeout);
+        void WaitIdle();
+        void QueryResult(const QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, std::size_t dataSize);
+
+        /* ----- CommandBuffer ----- */
+
+        void Begin(const CommandBuffer& cmdBuffer);
+        void End(const CommandBuffer& cmdBuffer);
+        void Execute(const CommandBuffer& cmdBuffer, const CommandBuffer& deferredCommandBuffer);
+        void UpdateBuffer(const CommandBuffer& cmdBuffer, const Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint16_t dataSize);
+        void CopyBuffer(const CommandBuffer& cmdBuffer, const Buffer& dstBuffer, std::uint64_t dstOffset, const Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size);
+        void CopyBufferFromTexture(const CommandBuffer& cmdBuffer, const Buffer& dstBuffer, std::uint64_t dstOffset, const Texture& srcTexture, const TextureRegion& srcRegion, std::uint32_t rowStride, std::uint32_t layerStride);
+        void FillBuffer(const CommandBuffer& cmdBuffer, const Buffer& dstBuffer, std::uint64_t dstOffset, std::uint32_t value, std::uint64_t fillSize);
+        void CopyTexture(const CommandBuffer& cmdBuffer, const Texture& dstTexture, const TextureLocation& dstLocation, const Texture& srcTexture, const TextureLocation& srcLocation, const Extent3D& extent);
+        void CopyTextureFromBuffer(const CommandBuffer& cmdBuffer, const Texture& dstTexture, const TextureRegion& dstRegion, const Buffer& srcBuffer, std::uint64_t srcOffset, std::uint32_t rowStride, std::uint32_t layerStride);
+        void GenerateMips(const CommandBuffer& cmdBuffer, const Texture& texture);
+        void GenerateMips(const CommandBuffer& cmdBuffer, const Texture& texture, const TextureSubresource& subresource);
+        void SetViewport(const CommandBuffer& cmdBuffer, const Viewport& viewport);
+        void SetViewports(const CommandBuffer& cmdBuffer, std::uint32_t numViewports, const Viewport* viewports);
+        void SetScissor(const CommandBuffer& cmdBuffer, const Scissor& scissor);
+        void SetScissors(const CommandBuffer& cmdBuffer, std::uint32_t numScissors, const Scissor* scissors);
+        void SetClearColor(const CommandBuffer& cmdBuffer, const ColorRGBAf& color);
+        void SetClearDepth(const CommandBuffer& cmdBuffer, float depth);
+        void SetClearStencil(const CommandBuffer& cmdBuffer, std::uint32_t stencil);
+        void Clear(const CommandBuffer& cmdBuffer, long flags);
+        void ClearAttachments(const CommandBuffer& cmdBuffer, std::uint32_t numAttachments, const AttachmentClear* attachments);
+        void SetVertexBuffer(const CommandBuffer& cmdBuffer, const Buffer& buffer);
+        void SetVertexBufferArray(const CommandBuffer& cmdBuffer, const BufferArray& bufferArray);
+        void SetIndexBuffer(const CommandBuffer& cmdBuffer, const Buffer& buffer);
+        void SetIndexBuffer(const CommandBuffer& cmdBuffer, const Buffer& buffer, const Format format, std::uint64_t offset);
+        void SetResourceHeap(const CommandBuffer& cmdBuffer, const ResourceHeap& resourceHeap, std::uint32_t firstSet, const PipelineBindPoint bindPoint);
+        void SetResource(const CommandBuffer& cmdBuffer, const Resource& resource, std::uint32_t slot, long bindFlags, long stageFlags);
+        void ResetResourceSlots(const CommandBuffer& cmdBuffer, const ResourceType resourceType, std::uint32_t firstSlot, std::uint32_t numSlots, long bindFlags, long stageFlags);
+        void BeginRenderPass(const CommandBuffer& cmdBuffer, const RenderTarget& renderTarget, const RenderPass* renderPass, std::uint32_t numClearValues, const ClearValue* clearValues);
+        void EndRenderPass(const CommandBuffer& cmdBuffer);
+        void SetPipelineState(const CommandBuffer& cmdBuffer, const PipelineState& pipelineState);
+        void SetBlendFactor(const CommandBuffer& cmdBuffer, const ColorRGBAf& color);
+        void SetStencilReference(const CommandBuffer& cmdBuffer, std::uint32_t reference, const StencilFace stencilFace);
+        void SetUniform(const CommandBuffer& cmdBuffer, UniformLocation location, const void* data, std::uint32_t dataSize);
+        void SetUniforms(const CommandBuffer& cmdBuffer, UniformLocation location, std::uint32_t count, const void* data, std::uint32_t dataSize);
+        void BeginQuery(const CommandBuffer& cmdBuffer, const QueryHeap& queryHeap, std::uint32_t query);
+        void EndQuery(const CommandBuffer& cmdBuffer, const QueryHeap& queryHeap, std::uint32_t query);
+        void BeginRenderCondition(const CommandBuffer& cmdBuffer, const QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode);
+        void EndRenderCondition(const CommandBuffer& cmdBuffer);
+        void BeginStreamOutput(const CommandBuffer& cmdBuffer, std::uint32_t numBuffers, Buffer* const * buffers);
+        void EndStreamOutput(const CommandBuffer& cmdBuffer);
+        void Draw(const CommandBuffer& cmdBuffer, std::uint32_t numVertices, std::uint32_t firstVertex);
+        void DrawIndexed(const CommandBuffer& cmdBuffer, std::uint32_t numIndices, std::uint32_t firstIndex);
+        void DrawIndexed(const CommandBuffer& cmdBuffer, std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset);
+        void DrawInstanced(const CommandBuffer& cmdBuffer, std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances);
+        void DrawInstanced(const CommandBuffer& cmdBuffer, std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance);
+        void DrawIndexedInstanced(const CommandBuffer& cmdBuffer, std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex);
+        void DrawIndexedInstanced(const CommandBuffer& cmdBuffer, std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset);
+        void DrawIndexedInstanced(const CommandBuffer& cmdBuffer, std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance);
+        void DrawIndirect(const CommandBuffer& cmdBuffer, const Buffer& buffer, std::uint64_t offset);
+        void DrawIndirect(const CommandBuffer& cmdBuffer, const Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride);
+        void DrawIndexedIndirect(const CommandBuffer& cmdBuffer, const Buffer& buffer, std::uint64_t offset);
+        void DrawIndexedIndirect(const CommandBuffer& cmdBuffer, const Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride);
+        void Dispatch(const CommandBuffer& cmdBuffer, std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ);
+        void DispatchIndirect(const CommandBuffer& cmdBuffer, const Buffer& buffer, std::uint64_t offset);
+        void PushDebugGroup(const CommandBuffer& cmdBuffer, const char* name);
+        void PopDebugGroup(const CommandBuffer& cmdBuffer);
+        void SetGraphicsAPIDependentState(const CommandBuffer& cmdBuffer, const void* stateDesc, std::size_t stateDescSize);
+
+    private:
+
+        struct ObjectEntry
+        {
+            std::uint32_t           id;
+            const RenderPass*       renderPass; // Render pass that is owned by this object
+        };
+
+        struct MappedBuffer
+        {
+            std::uint64_t           size;
+            const void*             data;
+        };
+
+    private:
+
+        // Assigns a new ID to the specified object and writes it into the current segment.
+        void WriteNewObject(const RenderSystemChild& object);
+
+        // Writes the ID of the specified object into the current segment, or 0 if the object is null or unknown.
+        void WriteObject(const RenderSystemChild* object);
+
+        void WriteObject(const RenderSystemChild& object);
+
+        void WriteData(const void* data, std::uint64_t size);
+        void WriteFlags(long flags);
+
+        void BeginCommand(Serialization::CaptureIdent ident, const CommandBuffer& cmdBuffer);
+
+        // Writes a separate segment for the render pass that is owned by the specified render context or render target.
+        void WriteOwnedRenderPass(const RenderTarget& renderTarget);
+
+    private:
+
+        Serialization::Serializer                                           writer_;
+
+        std::unordered_map<const RenderSystemChild*, ObjectEntry>           objectIDs_;
+        std::unordered_map<const Buffer*, MappedBuffer>                     mappedBuffers_;
+        std::uint32_t                                                       nextObjectID_   = 1;
+
+        std::uint32_t                                                       numFrames_      = 0;
+        bool                                                                finalized_      = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -9,8 +9,11 @@
 #define LLGL_CONTAINER_TYPES_H
 
 
-#include <set>
+#include "../Core/ContainerUtils.h"
+#include <vector>
+#include <unordered_map>
 #include <memory>
+#include <mutex>
 
 
 namespace LLGL
@@ -20,8 +23,257 @@ namespace LLGL
 template <typename T>
 using HWObjectInstance = std::unique_ptr<T>;
 
+/*
+Container for the hardware objects of a render system.
+The objects are stored in a dense array and their array indices are tracked by address,
+so objects are added and removed in constant time (removal moves the last object into the free slot).
+Adding and removing objects is guarded by a mutex per container, so objects can be created and released from multiple threads,
+and threads only contend with each other when they create or release objects of the same type.
+Iterating over the container is not synchronized and must not run concurrently with any modification.
+*/
 template <typename T>
-using HWObjectContainer = std::set<HWObjectInstance<T>>;
+class HWObjectContainer
+{
+
+    public:
+
+        using container_type    = std::vector<HWObjectInstance<T>>;
+        using iterator          = typename container_type::iterator;
+        using const_iterator    = typename container_type::const_iterator;
+
+    public:
+
+        HWObjectContainer() = default;
+
+        HWObjectContainer(const HWObjectContainer&) = delete;
+        HWObjectContainer& operator = (const HWObjectContainer&) = delete;
+
+        // Takes ownership of the specified object and returns its raw pointer.
+        template <typename TSub>
+        TSub* emplace(std::unique_ptr<TSub>&& object)
+        {
+            auto ref = object.get();
+            if (ref != nullptr)
+            {
+                std::lock_guard<std::mutex> guard{ mutex_ };
+                indices_[ref] = objects_.size();
+                objects_.emplace_back(std::move(object));
+            }
+            return ref;
+        }
+
+        // Removes and destroys the specified object. The object is destroyed after the lock is released, so its destructor may release other objects.
+        void erase(const T* object)
+        {
+            HWObjectInstance<T> instance;
+            {
+                std::lock_guard<std::mutex> guard{ mutex_ };
+
+                auto it = indices_.find(object);
+                if (it == indices_.end())
+                    return;
+
+                const auto index = it->second;
+                indices_.erase(it);
+
+                /* Take out object and move last object into the free slot */
+                instance = std::move(objects_[index]);
+                if (index + 1 < objects_.size())
+                {
+                    objects_[index] = std::move(objects_.back());
+                    indices_[objects_[index].get()] = index;
+                }
+                objects_.pop_back();
+            }
+        }
+
+        // Removes and destroys all objects.
+        void clear()
+        {
+            container_type objects;
+            {
+                std::lock_guard<std::mutex> guard{ mutex_ };
+                objects.swap(objects_);
+                indices_.clear();
+            }
+        }
+
+        bool empty() const
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            return objects_.empty();
+        }
+
+        std::size_t size() const
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            return objects_.size();
+        }
+
+        iterator begin()
+        {
+            return objects_.begin();
+        }
+
+        iterator end()
+        {
+            return objects_.end();
+        }
+
+        const_iterator begin() const
+        {
+            return objects_.begin();
+        }
+
+        const_iterator end() const
+        {
+            return objects_.end();
+        }
+
+    private:
+
+        container_type                              objects_;
+        std::unordered_map<const T*, std::size_t>   indices_;
+        mutable std::mutex                          mutex_;
+
+};
+
+/*
+Container for hardware objects that are shared between equal descriptors (e.g. samplers).
+The entries are sorted by their descriptors with the function "int CompareSWO(const TDesc&, const TDesc&)",
+so an object with an equal descriptor is found in O(log n). Each object is reference counted,
+i.e. it is only destroyed once it has been released as often as it has been acquired.
+Acquiring and releasing objects is guarded by a mutex per container, like for <HWObjectContainer>.
+*/
+template <typename T, typename TDesc>
+class HWObjectCache
+{
+
+    public:
+
+        HWObjectCache() = default;
+
+        HWObjectCache(const HWObjectCache&) = delete;
+        HWObjectCache& operator = (const HWObjectCache&) = delete;
+
+        // Returns the object for the specified descriptor and increments its reference counter. If there is none, it is created with the specified factory.
+        template <typename TFactory>
+        T* acquire(const TDesc& desc, TFactory factory)
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+
+            /* Share object with equal descriptor */
+            std::size_t index = 0;
+            if (auto entry = find(desc, index))
+            {
+                (*entry)->refCount++;
+                return (*entry)->object.get();
+            }
+
+            /* Create new object and insert it with insertion sort */
+            std::unique_ptr<Entry> newEntry{ new Entry{ desc, factory(), 1 } };
+            auto ref = newEntry->object.get();
+            entriesByObject_[ref] = newEntry.get();
+            entries_.insert(entries_.begin() + index, std::move(newEntry));
+
+            return ref;
+        }
+
+        // Decrements the reference counter of the specified object and destroys it if it is no longer referenced. Returns false if the object is not part of this container.
+        bool release(const T* object)
+        {
+            std::unique_ptr<Entry> releasedEntry;
+            {
+                std::lock_guard<std::mutex> guard{ mutex_ };
+
+                auto it = entriesByObject_.find(object);
+                if (it == entriesByObject_.end())
+                    return false;
+
+                if (--(it->second->refCount) > 0)
+                    return true;
+
+                /* Take out entry and destroy it after the lock is released */
+                std::size_t index = 0;
+                if (find(it->second->desc, index) != nullptr)
+                {
+                    releasedEntry = std::move(entries_[index]);
+                    entries_.erase(entries_.begin() + index);
+                }
+                entriesByObject_.erase(it);
+            }
+            return true;
+        }
+
+        // Destroys all objects regardless of their reference counters.
+        void clear()
+        {
+            std::vector<std::unique_ptr<Entry>> entries;
+            {
+                std::lock_guard<std::mutex> guard{ mutex_ };
+                entries.swap(entries_);
+                entriesByObject_.clear();
+            }
+        }
+
+        // Returns the number of unique objects.
+        std::size_t size() const
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            return entries_.size();
+        }
+
+    private:
+
+        struct Entry
+        {
+            TDesc               desc;
+            HWObjectInstance<T> object;
+            std::size_t         refCount;
+        };
+
+    private:
+
+        std::unique_ptr<Entry>* find(const TDesc& desc, std::size_t& index)
+        {
+            return Utils::FindInSortedArray<std::unique_ptr<Entry>>(
+                entries_.data(),
+                entries_.size(),
+                [&desc](const std::unique_ptr<Entry>& rhs) -> int
+                {
+                    return CompareSWO(desc, rhs->desc);
+                },
+                &index
+            );
+        }
+
+    private:
+
+        std::vector<std::unique_ptr<Entry>>         entries_;
+        std::unordered_map<const T*, Entry*>        entriesByObject_;
+        mutable std::mutex                          mutex_;
+
+};
+
+template <typename BaseType, typename SubType>
+SubType* TakeOwnership(HWObjectContainer<BaseType>& objectSet, std::unique_ptr<SubType>&& object)
+{
+    return objectSet.emplace(std::forward<std::unique_ptr<SubType>>(object));
+}
+
+template <typename T, typename TBase>
+void RemoveFromUniqueSet(HWObjectContainer<T>& cont, const TBase* entry)
+{
+    if (entry)
+        cont.erase(static_cast<const T*>(entry));
+}
+
+template <typename T, typename TDesc, typename TBase>
+void RemoveFromUniqueSet(HWObjectCache<T, TDesc>& cont, const TBase* entry)
+{
+    if (entry)
+        cont.release(static_cast<const T*>(entry));
+}
 
 
 } // /namespace LLGL
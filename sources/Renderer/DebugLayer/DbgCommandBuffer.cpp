@@ -8,6 +8,7 @@
 #include "DbgCommandBuffer.h"
 #include "DbgCore.h"
 #include "../CheckedCast.h"
+#include "../CaptureWriter.h"
 #include "../../Core/Helper.h"
 
 #include "DbgRenderContext.h"
@@ -56,6 +57,7 @@ DbgCommandBuffer::DbgCommandBuffer(
     CommandBuffer&                  commandBufferInstance,
     RenderingDebugger*              debugger,
     RenderingProfiler*              profiler,
+    CaptureWriter*                  capture,
     const CommandBufferDescriptor&  desc,
     const RenderingCapabilities&    caps)
 :
@@ -63,6 +65,7 @@ DbgCommandBuffer::DbgCommandBuffer(
     desc       { desc                                                              },
     debugger_  { debugger                                                          },
     profiler_  { profiler                                                          },
+    capture_   { capture                                                           },
     features_  { caps.features                                                     },
     limits_    { caps.limits                                                       },
     timerMngr_ { renderSystemInstance, commandQueueInstance, commandBufferInstance }
@@ -73,6 +76,8 @@ DbgCommandBuffer::DbgCommandBuffer(
 
 void DbgCommandBuffer::Begin()
 {
+    LLGL_DBG_CAPTURE(Begin(*this));
+
     /* Reset previous states */
     ResetFrameProfile();
     ResetBindings();
@@ -94,6 +99,8 @@ void DbgCommandBuffer::Begin()
 
 void DbgCommandBuffer::End()
 {
+    LLGL_DBG_CAPTURE(End(*this));
+
     /* End with command recording */
     if (debugger_)
         EnableRecording(false);
@@ -106,6 +113,8 @@ void DbgCommandBuffer::End()
 
 void DbgCommandBuffer::Execute(CommandBuffer& deferredCommandBuffer)
 {
+    LLGL_DBG_CAPTURE(Execute(*this, deferredCommandBuffer));
+
     auto& commandBufferDbg = LLGL_CAST(DbgCommandBuffer&, deferredCommandBuffer);
 
     if (debugger_)
@@ -134,6 +143,8 @@ void DbgCommandBuffer::UpdateBuffer(
     const void*     data,
     std::uint16_t   dataSize)
 {
+    LLGL_DBG_CAPTURE(UpdateBuffer(*this, dstBuffer, dstOffset, data, dataSize));
+
     auto& dstBufferDbg = LLGL_CAST(DbgBuffer&, dstBuffer);
 
     if (debugger_)
@@ -155,6 +166,8 @@ void DbgCommandBuffer::CopyBuffer(
     std::uint64_t   srcOffset,
     std::uint64_t   size)
 {
+    LLGL_DBG_CAPTURE(CopyBuffer(*this, dstBuffer, dstOffset, srcBuffer, srcOffset, size));
+
     auto& dstBufferDbg = LLGL_CAST(DbgBuffer&, dstBuffer);
     auto& srcBufferDbg = LLGL_CAST(DbgBuffer&, srcBuffer);
 
@@ -182,6 +195,8 @@ void DbgCommandBuffer::CopyBufferFromTexture(
     std::uint32_t           rowStride,
     std::uint32_t           layerStride)
 {
+    LLGL_DBG_CAPTURE(CopyBufferFromTexture(*this, dstBuffer, dstOffset, srcTexture, srcRegion, rowStride, layerStride));
+
     auto& dstBufferDbg = LLGL_CAST(DbgBuffer&, dstBuffer);
     auto& srcTextureDbg = LLGL_CAST(DbgTexture&, srcTexture);
 
@@ -207,6 +222,8 @@ void DbgCommandBuffer::FillBuffer(
     std::uint32_t   value,
     std::uint64_t   fillSize)
 {
+    LLGL_DBG_CAPTURE(FillBuffer(*this, dstBuffer, dstOffset, value, fillSize));
+
     auto& dstBufferDbg = LLGL_CAST(DbgBuffer&, dstBuffer);
 
     if (debugger_)
@@ -240,6 +257,8 @@ void DbgCommandBuffer::CopyTexture(
     const TextureLocation&  srcLocation,
     const Extent3D&         extent)
 {
+    LLGL_DBG_CAPTURE(CopyTexture(*this, dstTexture, dstLocation, srcTexture, srcLocation, extent));
+
     auto& dstTextureDbg = LLGL_CAST(DbgTexture&, dstTexture);
     auto& srcTextureDbg = LLGL_CAST(DbgTexture&, srcTexture);
 
@@ -265,6 +284,8 @@ void DbgCommandBuffer::CopyTextureFromBuffer(
     std::uint32_t           rowStride,
     std::uint32_t           layerStride)
 {
+    LLGL_DBG_CAPTURE(CopyTextureFromBuffer(*this, dstTexture, dstRegion, srcBuffer, srcOffset, rowStride, layerStride));
+
     auto& dstTextureDbg = LLGL_CAST(DbgTexture&, dstTexture);
     auto& srcBufferDbg = LLGL_CAST(DbgBuffer&, srcBuffer);
 
@@ -286,6 +307,8 @@ void DbgCommandBuffer::CopyTextureFromBuffer(
 
 void DbgCommandBuffer::GenerateMips(Texture& texture)
 {
+    LLGL_DBG_CAPTURE(GenerateMips(*this, texture));
+
     auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
 
     if (debugger_)
@@ -302,6 +325,8 @@ void DbgCommandBuffer::GenerateMips(Texture& texture)
 
 void DbgCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource& subresource)
 {
+    LLGL_DBG_CAPTURE(GenerateMips(*this, texture, subresource));
+
     auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
 
     if (debugger_)
@@ -320,6 +345,8 @@ void DbgCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource&
 
 void DbgCommandBuffer::SetViewport(const Viewport& viewport)
 {
+    LLGL_DBG_CAPTURE(SetViewport(*this, viewport));
+
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
@@ -332,6 +359,8 @@ void DbgCommandBuffer::SetViewport(const Viewport& viewport)
 
 void DbgCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport* viewports)
 {
+    LLGL_DBG_CAPTURE(SetViewports(*this, numViewports, viewports));
+
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
@@ -364,6 +393,8 @@ void DbgCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport*
 
 void DbgCommandBuffer::SetScissor(const Scissor& scissor)
 {
+    LLGL_DBG_CAPTURE(SetScissor(*this, scissor));
+
     LLGL_DBG_SOURCE;
     AssertRecording();
     LLGL_DBG_COMMAND( "SetScissor", instance.SetScissor(scissor) );
@@ -371,6 +402,8 @@ void DbgCommandBuffer::SetScissor(const Scissor& scissor)
 
 void DbgCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scissors)
 {
+    LLGL_DBG_CAPTURE(SetScissors(*this, numScissors, scissors));
+
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
@@ -387,21 +420,29 @@ void DbgCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* sci
 
 void DbgCommandBuffer::SetClearColor(const ColorRGBAf& color)
 {
+    LLGL_DBG_CAPTURE(SetClearColor(*this, color));
+
     LLGL_DBG_COMMAND( "SetClearColor", instance.SetClearColor(color) );
 }
 
 void DbgCommandBuffer::SetClearDepth(float depth)
 {
+    LLGL_DBG_CAPTURE(SetClearDepth(*this, depth));
+
     LLGL_DBG_COMMAND( "SetClearDepth", instance.SetClearDepth(depth) );
 }
 
 void DbgCommandBuffer::SetClearStencil(std::uint32_t stencil)
 {
+    LLGL_DBG_CAPTURE(SetClearStencil(*this, stencil));
+
     LLGL_DBG_COMMAND( "SetClearStencil", instance.SetClearStencil(stencil) );
 }
 
 void DbgCommandBuffer::Clear(long flags)
 {
+    LLGL_DBG_CAPTURE(Clear(*this, flags));
+
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
@@ -416,6 +457,8 @@ void DbgCommandBuffer::Clear(long flags)
 
 void DbgCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments)
 {
+    LLGL_DBG_CAPTURE(ClearAttachments(*this, numAttachments, attachments));
+
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
@@ -434,6 +477,8 @@ void DbgCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const Atta
 
 void DbgCommandBuffer::SetVertexBuffer(Buffer& buffer)
 {
+    LLGL_DBG_CAPTURE(SetVertexBuffer(*this, buffer));
+
     auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
 
     if (debugger_)
@@ -455,6 +500,8 @@ void DbgCommandBuffer::SetVertexBuffer(Buffer& buffer)
 
 void DbgCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 {
+    LLGL_DBG_CAPTURE(SetVertexBufferArray(*this, bufferArray));
+
     auto& bufferArrayDbg = LLGL_CAST(DbgBufferArray&, bufferArray);
 
     if (debugger_)
@@ -485,6 +532,8 @@ void DbgCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 
 void DbgCommandBuffer::SetIndexBuffer(Buffer& buffer)
 {
+    LLGL_DBG_CAPTURE(SetIndexBuffer(*this, buffer));
+
     auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
 
     if (debugger_)
@@ -508,6 +557,8 @@ void DbgCommandBuffer::SetIndexBuffer(Buffer& buffer)
 //TODO: validation of <offset> param
 void DbgCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset)
 {
+    LLGL_DBG_CAPTURE(SetIndexBuffer(*this, buffer, format, offset));
+
     auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
 
     if (debugger_)
@@ -545,6 +596,8 @@ void DbgCommandBuffer::SetResourceHeap(
     std::uint32_t           firstSet,
     const PipelineBindPoint bindPoint)
 {
+    LLGL_DBG_CAPTURE(SetResourceHeap(*this, resourceHeap, firstSet, bindPoint));
+
     auto& resourceHeapDbg = LLGL_CAST(DbgResourceHeap&, resourceHeap);
 
     if (debugger_)
@@ -565,6 +618,8 @@ void DbgCommandBuffer::SetResource(
     long            bindFlags,
     long            stageFlags)
 {
+    LLGL_DBG_CAPTURE(SetResource(*this, resource, slot, bindFlags, stageFlags));
+
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
@@ -656,6 +711,8 @@ void DbgCommandBuffer::ResetResourceSlots(
     long                bindFlags,
     long                stageFlags)
 {
+    LLGL_DBG_CAPTURE(ResetResourceSlots(*this, resourceType, firstSlot, numSlots, bindFlags, stageFlags));
+
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
@@ -675,6 +732,8 @@ void DbgCommandBuffer::BeginRenderPass(
     std::uint32_t       numClearValues,
     const ClearValue*   clearValues)
 {
+    LLGL_DBG_CAPTURE(BeginRenderPass(*this, renderTarget, renderPass, numClearValues, clearValues));
+
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
@@ -709,6 +768,8 @@ void DbgCommandBuffer::BeginRenderPass(
 
 void DbgCommandBuffer::EndRenderPass()
 {
+    LLGL_DBG_CAPTURE(EndRenderPass(*this));
+
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
@@ -725,6 +786,8 @@ void DbgCommandBuffer::EndRenderPass()
 
 void DbgCommandBuffer::SetPipelineState(PipelineState& pipelineState)
 {
+    LLGL_DBG_CAPTURE(SetPipelineState(*this, pipelineState));
+
     auto& pipelineStateDbg = LLGL_CAST(DbgPipelineState&, pipelineState);
 
     if (debugger_)
@@ -772,6 +835,8 @@ void DbgCommandBuffer::SetPipelineState(PipelineState& pipelineState)
 //TODO: add check of opposite state to Draw* commands
 void DbgCommandBuffer::SetBlendFactor(const ColorRGBAf& color)
 {
+    LLGL_DBG_CAPTURE(SetBlendFactor(*this, color));
+
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
@@ -788,6 +853,8 @@ void DbgCommandBuffer::SetBlendFactor(const ColorRGBAf& color)
 //TODO: add check of opposite state to Draw* commands
 void DbgCommandBuffer::SetStencilReference(std::uint32_t reference, const StencilFace stencilFace)
 {
+    LLGL_DBG_CAPTURE(SetStencilReference(*this, reference, stencilFace));
+
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
@@ -806,6 +873,8 @@ void DbgCommandBuffer::SetUniform(
     const void*     data,
     std::uint32_t   dataSize)
 {
+    LLGL_DBG_CAPTURE(SetUniform(*this, location, data, dataSize));
+
     LLGL_DBG_COMMAND( "SetUniform", instance.SetUniform(location, data, dataSize) );
 }
 
@@ -815,6 +884,8 @@ void DbgCommandBuffer::SetUniforms(
     const void*     data,
     std::uint32_t   dataSize)
 {
+    LLGL_DBG_CAPTURE(SetUniforms(*this, location, count, data, dataSize));
+
     LLGL_DBG_COMMAND( "SetUniforms", instance.SetUniforms(location, count, data, dataSize) );
 }
 
@@ -822,6 +893,8 @@ void DbgCommandBuffer::SetUniforms(
 
 void DbgCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
+    LLGL_DBG_CAPTURE(BeginQuery(*this, queryHeap, query));
+
     auto& queryHeapDbg = LLGL_CAST(DbgQueryHeap&, queryHeap);
 
     if (debugger_)
@@ -843,6 +916,8 @@ void DbgCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
 
 void DbgCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
+    LLGL_DBG_CAPTURE(EndQuery(*this, queryHeap, query));
+
     auto& queryHeapDbg = LLGL_CAST(DbgQueryHeap&, queryHeap);
 
     if (debugger_)
@@ -862,6 +937,8 @@ void DbgCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
 
 void DbgCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
 {
+    LLGL_DBG_CAPTURE(BeginRenderCondition(*this, queryHeap, query, mode));
+
     auto& queryHeapDbg = LLGL_CAST(DbgQueryHeap&, queryHeap);
 
     if (debugger_)
@@ -878,6 +955,8 @@ void DbgCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t
 
 void DbgCommandBuffer::EndRenderCondition()
 {
+    LLGL_DBG_CAPTURE(EndRenderCondition(*this));
+
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
@@ -890,6 +969,8 @@ void DbgCommandBuffer::EndRenderCondition()
 
 void DbgCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const * buffers)
 {
+    LLGL_DBG_CAPTURE(BeginStreamOutput(*this, numBuffers, buffers));
+
     Buffer* bufferInstances[LLGL_MAX_NUM_SO_BUFFERS];
     bool validationFailed = false;
 
@@ -950,6 +1031,8 @@ void DbgCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const
 
 void DbgCommandBuffer::EndStreamOutput()
 {
+    LLGL_DBG_CAPTURE(EndStreamOutput(*this));
+
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
@@ -970,6 +1053,8 @@ void DbgCommandBuffer::EndStreamOutput()
 
 void DbgCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
 {
+    LLGL_DBG_CAPTURE(Draw(*this, numVertices, firstVertex));
+
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
@@ -983,6 +1068,8 @@ void DbgCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex
 
 void DbgCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
 {
+    LLGL_DBG_CAPTURE(DrawIndexed(*this, numIndices, firstIndex));
+
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
@@ -996,6 +1083,8 @@ void DbgCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t first
 
 void DbgCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
+    LLGL_DBG_CAPTURE(DrawIndexed(*this, numIndices, firstIndex, vertexOffset));
+
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
@@ -1009,6 +1098,8 @@ void DbgCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t first
 
 void DbgCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
 {
+    LLGL_DBG_CAPTURE(DrawInstanced(*this, numVertices, firstVertex, numInstances));
+
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
@@ -1023,6 +1114,8 @@ void DbgCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t fi
 
 void DbgCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
 {
+    LLGL_DBG_CAPTURE(DrawInstanced(*this, numVertices, firstVertex, numInstances, firstInstance));
+
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
@@ -1038,6 +1131,8 @@ void DbgCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t fi
 
 void DbgCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
 {
+    LLGL_DBG_CAPTURE(DrawIndexedInstanced(*this, numIndices, numInstances, firstIndex));
+
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
@@ -1052,6 +1147,8 @@ void DbgCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint3
 
 void DbgCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
+    LLGL_DBG_CAPTURE(DrawIndexedInstanced(*this, numIndices, numInstances, firstIndex, vertexOffset));
+
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
@@ -1066,6 +1163,8 @@ void DbgCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint3
 
 void DbgCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
 {
+    LLGL_DBG_CAPTURE(DrawIndexedInstanced(*this, numIndices, numInstances, firstIndex, vertexOffset, firstInstance));
+
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
@@ -1081,6 +1180,8 @@ void DbgCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint3
 
 void DbgCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 {
+    LLGL_DBG_CAPTURE(DrawIndirect(*this, buffer, offset));
+
     auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
 
     if (debugger_)
@@ -1099,6 +1200,8 @@ void DbgCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 
 void DbgCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
+    LLGL_DBG_CAPTURE(DrawIndirect(*this, buffer, offset, numCommands, stride));
+
     auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
 
     if (debugger_)
@@ -1118,6 +1221,8 @@ void DbgCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::u
 
 void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
+    LLGL_DBG_CAPTURE(DrawIndexedIndirect(*this, buffer, offset));
+
     auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
 
     if (debugger_)
@@ -1136,6 +1241,8 @@ void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 
 void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
+    LLGL_DBG_CAPTURE(DrawIndexedIndirect(*this, buffer, offset, numCommands, stride));
+
     auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
 
     if (debugger_)
@@ -1157,6 +1264,8 @@ void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset,
 
 void DbgCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
 {
+    LLGL_DBG_CAPTURE(Dispatch(*this, numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ));
+
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
@@ -1177,6 +1286,8 @@ void DbgCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numW
 
 void DbgCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
+    LLGL_DBG_CAPTURE(DispatchIndirect(*this, buffer, offset));
+
     auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
 
     if (debugger_)
@@ -1196,6 +1307,8 @@ void DbgCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 
 void DbgCommandBuffer::PushDebugGroup(const char* name)
 {
+    LLGL_DBG_CAPTURE(PushDebugGroup(*this, name));
+
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
@@ -1212,6 +1325,8 @@ void DbgCommandBuffer::PushDebugGroup(const char* name)
 
 void DbgCommandBuffer::PopDebugGroup()
 {
+    LLGL_DBG_CAPTURE(PopDebugGroup(*this));
+
     instance.PopDebugGroup();
     debugGroups_.pop();
 
@@ -1228,6 +1343,8 @@ void DbgCommandBuffer::PopDebugGroup()
 
 void DbgCommandBuffer::SetGraphicsAPIDependentState(const void* stateDesc, std::size_t stateDescSize)
 {
+    LLGL_DBG_CAPTURE(SetGraphicsAPIDependentState(*this, stateDesc, stateDescSize));
+
     LLGL_DBG_COMMAND( "SetGraphicsAPIDependentState", instance.SetGraphicsAPIDependentState(stateDesc, stateDescSize) );
 }
 
@@ -31,6 +31,7 @@ class DbgPipelineState;
 class DbgShaderProgram;
 class RenderingDebugger;
 class RenderingProfiler;
+class CaptureWriter;
 
 class DbgCommandBuffer final : public CommandBuffer
 {
@@ -45,6 +46,7 @@ class DbgCommandBuffer final : public CommandBuffer
             CommandBuffer&                  commandBufferInstance,
             RenderingDebugger*              debugger,
             RenderingProfiler*              profiler,
+            CaptureWriter*                  capture,
             const CommandBufferDescriptor&  desc,
             const RenderingCapabilities&    caps
         );
@@ -318,6 +320,7 @@ class DbgCommandBuffer final : public CommandBuffer
 
         RenderingDebugger*          debugger_                               = nullptr;
         RenderingProfiler*          profiler_                               = nullptr;
+        CaptureWriter*              capture_                                = nullptr;
 
         const RenderingFeatures&    features_;
         const RenderingLimits&      limits_;
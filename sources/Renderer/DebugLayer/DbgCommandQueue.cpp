@@ -9,6 +9,7 @@
 #include "DbgCommandBuffer.h"
 #include "DbgCore.h"
 #include "../CheckedCast.h"
+#include "../CaptureWriter.h"
 #include <LLGL/RenderingProfiler.h>
 #include <LLGL/RenderingDebugger.h>
 
@@ -17,10 +18,16 @@ namespace LLGL
 {
 
 
-DbgCommandQueue::DbgCommandQueue(CommandQueue& instance, RenderingProfiler* profiler, RenderingDebugger* debugger) :
+DbgCommandQueue::DbgCommandQueue(
+    CommandQueue&       instance,
+    RenderingProfiler*  profiler,
+    RenderingDebugger*  debugger,
+    CaptureWriter*      capture)
+:
     instance  { instance },
     profiler_ { profiler },
-    debugger_ { debugger }
+    debugger_ { debugger },
+    capture_  { capture  }
 {
 }
 
@@ -30,6 +37,8 @@ void DbgCommandQueue::Submit(CommandBuffer& commandBuffer)
 {
     auto& commandBufferDbg = LLGL_CAST(DbgCommandBuffer&, commandBuffer);
 
+    LLGL_DBG_CAPTURE(Submit(commandBuffer));
+
     instance.Submit(commandBufferDbg.instance);
 
     if (profiler_)
@@ -55,6 +64,8 @@ bool DbgCommandQueue::QueryResult(QueryHeap& queryHeap, std::uint32_t firstQuery
         ValidateQueryResult(queryHeapDbg, firstQuery, numQueries, data, dataSize);
     }
 
+    LLGL_DBG_CAPTURE(QueryResult(queryHeap, firstQuery, numQueries, dataSize));
+
     return instance.QueryResult(queryHeapDbg.instance, firstQuery, numQueries, data, dataSize);
 }
 
@@ -62,6 +73,7 @@ bool DbgCommandQueue::QueryResult(QueryHeap& queryHeap, std::uint32_t firstQuery
 
 void DbgCommandQueue::Submit(Fence& fence)
 {
+    LLGL_DBG_CAPTURE(Submit(fence));
     instance.Submit(fence);
     if (profiler_)
         profiler_->frameProfile.fenceSubmissions++;
@@ -69,11 +81,13 @@ void DbgCommandQueue::Submit(Fence& fence)
 
 bool DbgCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 {
+    LLGL_DBG_CAPTURE(WaitFence(fence, timeout));
     return instance.WaitFence(fence, timeout);
 }
 
 void DbgCommandQueue::WaitIdle()
 {
+    LLGL_DBG_CAPTURE(WaitIdle());
     instance.WaitIdle();
 }
 
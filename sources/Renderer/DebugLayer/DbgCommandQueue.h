@@ -18,6 +18,7 @@ namespace LLGL
 
 class RenderingProfiler;
 class RenderingDebugger;
+class CaptureWriter;
 class DbgQueryHeap;
 
 class DbgCommandQueue final : public CommandQueue
@@ -30,7 +31,8 @@ class DbgCommandQueue final : public CommandQueue
         DbgCommandQueue(
             CommandQueue&       instance,
             RenderingProfiler*  profiler,
-            RenderingDebugger*  debugger
+            RenderingDebugger*  debugger,
+            CaptureWriter*      capture
         );
 
         /* ----- Command Buffers ----- */
@@ -74,6 +76,7 @@ class DbgCommandQueue final : public CommandQueue
 
         RenderingProfiler* profiler_ = nullptr;
         RenderingDebugger* debugger_ = nullptr;
+        CaptureWriter*     capture_  = nullptr;
 
 };
 
@@ -29,6 +29,10 @@ namespace LLGL
 #define LLGL_DBG_ERROR_NOT_SUPPORTED(FEATURE) \
     LLGL_DBG_ERROR(ErrorType::UnsupportedFeature, std::string(FEATURE) + " not supported")
 
+#define LLGL_DBG_CAPTURE(CALL)                              \
+    if (capture_ != nullptr && !capture_->IsFinalized())    \
+        capture_->CALL
+
 
 inline void DbgSetSource(RenderingDebugger* debugger, const char* source)
 {
@@ -37,6 +37,11 @@ void DbgPipelineState::SetName(const char* name)
     DbgSetObjectName(*this, name);
 }
 
+bool DbgPipelineState::IsReady() const
+{
+    return instance.IsReady();
+}
+
 
 } // /namespace LLGL
 
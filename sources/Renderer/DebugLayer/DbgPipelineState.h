@@ -24,6 +24,7 @@ class DbgPipelineState final : public PipelineState
     public:
 
         void SetName(const char* name) override;
+        bool IsReady() const override;
 
     public:
 
@@ -6,20 +6,24 @@
  */
 
 #include "DbgRenderContext.h"
+#include "DbgCore.h"
+#include "../CaptureWriter.h"
 
 
 namespace LLGL
 {
 
 
-DbgRenderContext::DbgRenderContext(RenderContext& instance) :
-    instance { instance }
+DbgRenderContext::DbgRenderContext(RenderContext& instance, CaptureWriter* capture) :
+    instance { instance },
+    capture_ { capture  }
 {
     ShareSurfaceAndConfig(instance);
 }
 
 void DbgRenderContext::Present()
 {
+    LLGL_DBG_CAPTURE(Present(*this));
     instance.Present();
 }
 
@@ -17,6 +17,7 @@ namespace LLGL
 
 
 class DbgBuffer;
+class CaptureWriter;
 
 class DbgRenderContext final : public RenderContext
 {
@@ -34,7 +35,7 @@ class DbgRenderContext final : public RenderContext
 
     public:
 
-        DbgRenderContext(RenderContext& instance);
+        DbgRenderContext(RenderContext& instance, CaptureWriter* capture);
 
     public:
 
@@ -45,6 +46,10 @@ class DbgRenderContext final : public RenderContext
         bool OnSetVideoMode(const VideoModeDescriptor& videoModeDesc) override;
         bool OnSetVsync(const VsyncDescriptor& vsyncDesc) override;
 
+    private:
+
+        CaptureWriter* capture_ = nullptr;
+
 };
 
 
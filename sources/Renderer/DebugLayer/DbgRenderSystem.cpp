@@ -10,6 +10,8 @@
 #include "../BufferUtils.h"
 #include "../TextureUtils.h"
 #include "../CheckedCast.h"
+#include "../ResourceBindingIterator.h"
+#include "../CaptureWriter.h"
 #include "../../Core/Helper.h"
 #include <LLGL/Strings.h>
 #include <LLGL/ImageFlags.h>
@@ -32,7 +34,8 @@ All the actual render system objects are stored in the members named "instance",
 DbgRenderSystem::DbgRenderSystem(
     const std::shared_ptr<RenderSystem>&    instance,
     RenderingProfiler*                      profiler,
-    RenderingDebugger*                      debugger)
+    RenderingDebugger*                      debugger,
+    RenderingCapture*                       capture)
 :
     instance_ { instance           },
     profiler_ { profiler           },
@@ -41,6 +44,8 @@ DbgRenderSystem::DbgRenderSystem(
     features_ { caps_.features     },
     limits_   { caps_.limits       }
 {
+    if (capture != nullptr)
+        capture_ = &(capture->GetWriter());
 }
 
 void DbgRenderSystem::SetConfiguration(const RenderSystemConfiguration& config)
@@ -49,6 +54,16 @@ void DbgRenderSystem::SetConfiguration(const RenderSystemConfiguration& config)
     instance_->SetConfiguration(config);
 }
 
+bool DbgRenderSystem::QueryMemoryStatistics(MemoryStatistics& stats)
+{
+    return instance_->QueryMemoryStatistics(stats);
+}
+
+bool DbgRenderSystem::QueryShaderCacheStatistics(ShaderCacheStatistics& stats)
+{
+    return instance_->QueryShaderCacheStatistics(stats);
+}
+
 /* ----- Render Context ----- */
 
 RenderContext* DbgRenderSystem::CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface)
@@ -56,21 +71,17 @@ RenderContext* DbgRenderSystem::CreateRenderContext(const RenderContextDescripto
     /* Create primary render context */
     auto renderContextInstance = instance_->CreateRenderContext(desc, surface);
 
-    if (!commandQueue_)
-    {
-        /* Store meta data about render system */
-        SetRendererInfo(instance_->GetRendererInfo());
-        SetRenderingCaps(instance_->GetRenderingCaps());
+    InitializeCommandQueue();
 
-        /* Instantiate command queue */
-        commandQueue_ = MakeUnique<DbgCommandQueue>(*(instance_->GetCommandQueue()), profiler_, debugger_);
-    }
+    auto renderContextDbg = TakeOwnership(renderContexts_, MakeUnique<DbgRenderContext>(*renderContextInstance, capture_));
+    LLGL_DBG_CAPTURE(CreateRenderContext(*renderContextDbg, desc));
 
-    return TakeOwnership(renderContexts_, MakeUnique<DbgRenderContext>(*renderContextInstance));
+    return renderContextDbg;
 }
 
 void DbgRenderSystem::Release(RenderContext& renderContext)
 {
+    LLGL_DBG_CAPTURE(Release(renderContext));
     ReleaseDbg(renderContexts_, renderContext);
 }
 
@@ -78,6 +89,7 @@ void DbgRenderSystem::Release(RenderContext& renderContext)
 
 CommandQueue* DbgRenderSystem::GetCommandQueue()
 {
+    InitializeCommandQueue();
     return commandQueue_.get();
 }
 
@@ -85,7 +97,9 @@ CommandQueue* DbgRenderSystem::GetCommandQueue()
 
 CommandBuffer* DbgRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& desc)
 {
-    return TakeOwnership(
+    InitializeCommandQueue();
+
+    auto commandBufferDbg = TakeOwnership(
         commandBuffers_,
         MakeUnique<DbgCommandBuffer>(
             *instance_,
@@ -93,14 +107,19 @@ CommandBuffer* DbgRenderSystem::CreateCommandBuffer(const CommandBufferDescripto
             *instance_->CreateCommandBuffer(desc),
             debugger_,
             profiler_,
+            capture_,
             desc,
             GetRenderingCaps()
         )
     );
+    LLGL_DBG_CAPTURE(CreateCommandBuffer(*commandBufferDbg, desc));
+
+    return commandBufferDbg;
 }
 
 void DbgRenderSystem::Release(CommandBuffer& commandBuffer)
 {
+    LLGL_DBG_CAPTURE(Release(commandBuffer));
     ReleaseDbg(commandBuffers_, commandBuffer);
 }
 
@@ -124,6 +143,8 @@ Buffer* DbgRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void*
     bufferDbg->elements     = (formatSize > 0 ? desc.size / formatSize : 0);
     bufferDbg->initialized  = (initialData != nullptr);
 
+    LLGL_DBG_CAPTURE(CreateBuffer(*bufferDbg, desc, initialData));
+
     return TakeOwnership(buffers_, std::move(bufferDbg));
 }
 
@@ -139,7 +160,7 @@ BufferArray* DbgRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer
 
     for (std::uint32_t i = 0; i < numBuffers; ++i)
     {
-        auto bufferDbg          = LLGL_CAST(DbgBuffer*, (*(bufferArray++)));
+        auto bufferDbg          = LLGL_CAST(DbgBuffer*, bufferArray[i]);
         bufferInstanceArray[i]  = &(bufferDbg->instance);
         bufferDbgArray[i]       = bufferDbg;
     }
@@ -148,16 +169,20 @@ BufferArray* DbgRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer
     auto bufferArrayInstance    = instance_->CreateBufferArray(numBuffers, bufferInstanceArray.data());
     auto bufferArrayDbg         = MakeUnique<DbgBufferArray>(*bufferArrayInstance, bindFlags, std::move(bufferDbgArray));
 
+    LLGL_DBG_CAPTURE(CreateBufferArray(*bufferArrayDbg, numBuffers, bufferArray));
+
     return TakeOwnership(bufferArrays_, std::move(bufferArrayDbg));
 }
 
 void DbgRenderSystem::Release(Buffer& buffer)
 {
+    LLGL_DBG_CAPTURE(Release(buffer));
     ReleaseDbg(buffers_, buffer);
 }
 
 void DbgRenderSystem::Release(BufferArray& bufferArray)
 {
+    LLGL_DBG_CAPTURE(Release(bufferArray));
     ReleaseDbg(bufferArrays_, bufferArray);
 }
 
@@ -182,6 +207,8 @@ void DbgRenderSystem::WriteBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, co
             LLGL_DBG_ERROR(ErrorType::InvalidArgument, "illegal null pointer argument for 'data' parameter");
     }
 
+    LLGL_DBG_CAPTURE(WriteBuffer(dstBuffer, dstOffset, data, dataSize));
+
     instance_->WriteBuffer(dstBufferDbg.instance, dstOffset, data, dataSize);
 
     if (profiler_)
@@ -204,6 +231,8 @@ void* DbgRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
     if (result != nullptr)
         bufferDbg.mapped = true;
 
+    LLGL_DBG_CAPTURE(MapBuffer(buffer, bufferDbg.desc.size, access, result));
+
     if (profiler_)
         profiler_->frameProfile.bufferMappings++;
 
@@ -220,6 +249,8 @@ void DbgRenderSystem::UnmapBuffer(Buffer& buffer)
         ValidateBufferMapping(bufferDbg, false);
     }
 
+    LLGL_DBG_CAPTURE(UnmapBuffer(buffer));
+
     instance_->UnmapBuffer(bufferDbg.instance);
 
     bufferDbg.mapped = false;
@@ -234,11 +265,16 @@ Texture* DbgRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, co
         LLGL_DBG_SOURCE;
         ValidateTextureDesc(textureDesc, imageDesc);
     }
-    return TakeOwnership(textures_, MakeUnique<DbgTexture>(*instance_->CreateTexture(textureDesc, imageDesc), textureDesc));
+
+    auto textureDbg = TakeOwnership(textures_, MakeUnique<DbgTexture>(*instance_->CreateTexture(textureDesc, imageDesc), textureDesc));
+    LLGL_DBG_CAPTURE(CreateTexture(*textureDbg, textureDesc, imageDesc));
+
+    return textureDbg;
 }
 
 void DbgRenderSystem::Release(Texture& texture)
 {
+    LLGL_DBG_CAPTURE(Release(texture));
     ReleaseDbg(textures_, texture);
 }
 
@@ -253,6 +289,8 @@ void DbgRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textur
         ValidateImageDataSize(textureDbg, textureRegion, imageDesc.format, imageDesc.dataType, imageDesc.dataSize);
     }
 
+    LLGL_DBG_CAPTURE(WriteTexture(texture, textureRegion, imageDesc));
+
     instance_->WriteTexture(textureDbg.instance, textureRegion, imageDesc);
 
     if (profiler_)
@@ -270,6 +308,8 @@ void DbgRenderSystem::ReadTexture(Texture& texture, const TextureRegion& texture
         ValidateImageDataSize(textureDbg, textureRegion, imageDesc.format, imageDesc.dataType, imageDesc.dataSize);
     }
 
+    LLGL_DBG_CAPTURE(ReadTexture(texture, textureRegion, imageDesc));
+
     instance_->ReadTexture(textureDbg.instance, textureRegion, imageDesc);
 
     if (profiler_)
@@ -280,12 +320,15 @@ void DbgRenderSystem::ReadTexture(Texture& texture, const TextureRegion& texture
 
 Sampler* DbgRenderSystem::CreateSampler(const SamplerDescriptor& desc)
 {
-    return instance_->CreateSampler(desc);
+    auto sampler = instance_->CreateSampler(desc);
+    LLGL_DBG_CAPTURE(CreateSampler(*sampler, desc));
+    return sampler;
     //return TakeOwnership(samplers_, MakeUnique<DbgSampler>());
 }
 
 void DbgRenderSystem::Release(Sampler& sampler)
 {
+    LLGL_DBG_CAPTURE(Release(sampler));
     instance_->Release(sampler);
     //ReleaseDbg(samplers_, sampler);
 }
@@ -329,26 +372,33 @@ ResourceHeap* DbgRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor&
                 LLGL_DBG_ERROR(ErrorType::InvalidArgument, "null pointer passed to <ResourceViewDescriptor>");
         }
     }
-    return TakeOwnership(
+    auto resourceHeapDbg = TakeOwnership(
         resourceHeaps_,
         MakeUnique<DbgResourceHeap>(*instance_->CreateResourceHeap(instanceDesc), desc)
     );
+    LLGL_DBG_CAPTURE(CreateResourceHeap(*resourceHeapDbg, desc));
+
+    return resourceHeapDbg;
 }
 
-void DbgRenderSystem::Release(ResourceHeap& resourceViewHeap)
+void DbgRenderSystem::Release(ResourceHeap& resourceHeap)
 {
-    return instance_->Release(resourceViewHeap);
+    LLGL_DBG_CAPTURE(Release(resourceHeap));
+    ReleaseDbg(resourceHeaps_, resourceHeap);
 }
 
 /* ----- Render Passes ----- */
 
 RenderPass* DbgRenderSystem::CreateRenderPass(const RenderPassDescriptor& desc)
 {
-    return instance_->CreateRenderPass(desc);
+    auto renderPass = instance_->CreateRenderPass(desc);
+    LLGL_DBG_CAPTURE(CreateRenderPass(*renderPass, desc));
+    return renderPass;
 }
 
 void DbgRenderSystem::Release(RenderPass& renderPass)
 {
+    LLGL_DBG_CAPTURE(Release(renderPass));
     instance_->Release(renderPass);
 }
 
@@ -371,14 +421,18 @@ RenderTarget* DbgRenderSystem::CreateRenderTarget(const RenderTargetDescriptor&
         }
     }
 
-    return TakeOwnership(
+    auto renderTargetDbg = TakeOwnership(
         renderTargets_,
         MakeUnique<DbgRenderTarget>(*instance_->CreateRenderTarget(instanceDesc), debugger_, desc)
     );
+    LLGL_DBG_CAPTURE(CreateRenderTarget(*renderTargetDbg, desc));
+
+    return renderTargetDbg;
 }
 
 void DbgRenderSystem::Release(RenderTarget& renderTarget)
 {
+    LLGL_DBG_CAPTURE(Release(renderTarget));
     ReleaseDbg(renderTargets_, renderTarget);
 }
 
@@ -386,7 +440,9 @@ void DbgRenderSystem::Release(RenderTarget& renderTarget)
 
 Shader* DbgRenderSystem::CreateShader(const ShaderDescriptor& desc)
 {
-    return TakeOwnership(shaders_, MakeUnique<DbgShader>(*instance_->CreateShader(desc), desc));
+    auto shaderDbg = TakeOwnership(shaders_, MakeUnique<DbgShader>(*instance_->CreateShader(desc), desc));
+    LLGL_DBG_CAPTURE(CreateShader(*shaderDbg, desc));
+    return shaderDbg;
 }
 
 static Shader* GetInstanceShader(Shader* shader)
@@ -410,16 +466,22 @@ ShaderProgram* DbgRenderSystem::CreateShaderProgram(const ShaderProgramDescripto
         instanceDesc.fragmentShader         = GetInstanceShader(desc.fragmentShader);
         instanceDesc.computeShader          = GetInstanceShader(desc.computeShader);
     }
-    return TakeOwnership(shaderPrograms_, MakeUnique<DbgShaderProgram>(*instance_->CreateShaderProgram(instanceDesc), debugger_, desc));
+
+    auto shaderProgramDbg = TakeOwnership(shaderPrograms_, MakeUnique<DbgShaderProgram>(*instance_->CreateShaderProgram(instanceDesc), debugger_, desc));
+    LLGL_DBG_CAPTURE(CreateShaderProgram(*shaderProgramDbg, desc));
+
+    return shaderProgramDbg;
 }
 
 void DbgRenderSystem::Release(Shader& shader)
 {
+    LLGL_DBG_CAPTURE(Release(shader));
     ReleaseDbg(shaders_, shader);
 }
 
 void DbgRenderSystem::Release(ShaderProgram& shaderProgram)
 {
+    LLGL_DBG_CAPTURE(Release(shaderProgram));
     ReleaseDbg(shaderPrograms_, shaderProgram);
 }
 
@@ -427,11 +489,14 @@ void DbgRenderSystem::Release(ShaderProgram& shaderProgram)
 
 PipelineLayout* DbgRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& desc)
 {
-    return TakeOwnership(pipelineLayouts_, MakeUnique<DbgPipelineLayout>(*instance_->CreatePipelineLayout(desc), desc));
+    auto pipelineLayoutDbg = TakeOwnership(pipelineLayouts_, MakeUnique<DbgPipelineLayout>(*instance_->CreatePipelineLayout(desc), desc));
+    LLGL_DBG_CAPTURE(CreatePipelineLayout(*pipelineLayoutDbg, desc));
+    return pipelineLayoutDbg;
 }
 
 void DbgRenderSystem::Release(PipelineLayout& pipelineLayout)
 {
+    LLGL_DBG_CAPTURE(Release(pipelineLayout));
     ReleaseDbg(pipelineLayouts_, pipelineLayout);
 }
 
@@ -457,7 +522,9 @@ PipelineState* DbgRenderSystem::CreatePipelineState(const GraphicsPipelineDescri
             if (desc.pipelineLayout != nullptr)
                 instanceDesc.pipelineLayout = &(LLGL_CAST(const DbgPipelineLayout*, desc.pipelineLayout)->instance);
         }
-        return TakeOwnership(pipelineStates_, MakeUnique<DbgPipelineState>(*instance_->CreatePipelineState(instanceDesc, serializedCache), desc));
+        auto pipelineStateDbg = TakeOwnership(pipelineStates_, MakeUnique<DbgPipelineState>(*instance_->CreatePipelineState(instanceDesc, serializedCache), desc));
+        LLGL_DBG_CAPTURE(CreatePipelineState(*pipelineStateDbg, desc));
+        return pipelineStateDbg;
     }
     else
         LLGL_DBG_ERROR(ErrorType::InvalidArgument, "shader program must not be null");
@@ -477,7 +544,9 @@ PipelineState* DbgRenderSystem::CreatePipelineState(const ComputePipelineDescrip
             if (desc.pipelineLayout != nullptr)
                 instanceDesc.pipelineLayout = &(LLGL_CAST(const DbgPipelineLayout*, desc.pipelineLayout)->instance);
         }
-        return TakeOwnership(pipelineStates_, MakeUnique<DbgPipelineState>(*instance_->CreatePipelineState(instanceDesc, serializedCache), desc));
+        auto pipelineStateDbg = TakeOwnership(pipelineStates_, MakeUnique<DbgPipelineState>(*instance_->CreatePipelineState(instanceDesc, serializedCache), desc));
+        LLGL_DBG_CAPTURE(CreatePipelineState(*pipelineStateDbg, desc));
+        return pipelineStateDbg;
     }
     else
         LLGL_DBG_ERROR(ErrorType::InvalidArgument, "shader program must not be null");
@@ -487,6 +556,7 @@ PipelineState* DbgRenderSystem::CreatePipelineState(const ComputePipelineDescrip
 
 void DbgRenderSystem::Release(PipelineState& pipelineState)
 {
+    LLGL_DBG_CAPTURE(Release(pipelineState));
     ReleaseDbg(pipelineStates_, pipelineState);
 }
 
@@ -494,11 +564,14 @@ void DbgRenderSystem::Release(PipelineState& pipelineState)
 
 QueryHeap* DbgRenderSystem::CreateQueryHeap(const QueryHeapDescriptor& desc)
 {
-    return TakeOwnership(queryHeaps_, MakeUnique<DbgQueryHeap>(*instance_->CreateQueryHeap(desc), desc));
+    auto queryHeapDbg = TakeOwnership(queryHeaps_, MakeUnique<DbgQueryHeap>(*instance_->CreateQueryHeap(desc), desc));
+    LLGL_DBG_CAPTURE(CreateQueryHeap(*queryHeapDbg, desc));
+    return queryHeapDbg;
 }
 
 void DbgRenderSystem::Release(QueryHeap& queryHeap)
 {
+    LLGL_DBG_CAPTURE(Release(queryHeap));
     ReleaseDbg(queryHeaps_, queryHeap);
 }
 
@@ -506,12 +579,15 @@ void DbgRenderSystem::Release(QueryHeap& queryHeap)
 
 Fence* DbgRenderSystem::CreateFence()
 {
-    return instance_->CreateFence();
+    auto fence = instance_->CreateFence();
+    LLGL_DBG_CAPTURE(CreateFence(*fence));
+    return fence;
 }
 
 void DbgRenderSystem::Release(Fence& fence)
 {
-    return instance_->Release(fence);
+    LLGL_DBG_CAPTURE(Release(fence));
+    instance_->Release(fence);
 }
 
 
@@ -519,6 +595,20 @@ void DbgRenderSystem::Release(Fence& fence)
  * ======= Private: =======
  */
 
+void DbgRenderSystem::InitializeCommandQueue()
+{
+    /* Render systems without render context (e.g. headless OpenGL) can still provide a command queue */
+    if (!commandQueue_)
+    {
+        /* Store meta data about render system */
+        SetRendererInfo(instance_->GetRendererInfo());
+        SetRenderingCaps(instance_->GetRenderingCaps());
+
+        /* Instantiate command queue */
+        commandQueue_ = MakeUnique<DbgCommandQueue>(*(instance_->GetCommandQueue()), profiler_, debugger_, capture_);
+    }
+}
+
 void DbgRenderSystem::ValidateBindFlags(long flags)
 {
     const long bufferOnlyFlags =
@@ -801,7 +891,33 @@ void DbgRenderSystem::ValidateTextureDesc(const TextureDescriptor& desc, const S
     ValidateTextureDescMipLevels(desc);
     ValidateArrayTextureLayers(desc.type, desc.arrayLayers);
     ValidateBindFlags(desc.bindFlags);
-    ValidateMiscFlags(desc.miscFlags, (MiscFlags::DynamicUsage | MiscFlags::FixedSamples | MiscFlags::GenerateMips | MiscFlags::NoInitialData), "texture");
+    ValidateMiscFlags(desc.miscFlags, (MiscFlags::DynamicUsage | MiscFlags::FixedSamples | MiscFlags::GenerateMips | MiscFlags::NoInitialData | MiscFlags::Transient), "texture");
+
+    /* Check if transient texture is only used as attachment */
+    if ((desc.miscFlags & MiscFlags::Transient) != 0)
+    {
+        if ((desc.bindFlags & (BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment)) == 0)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "cannot create transient texture without attachment binding: 'LLGL::MiscFlags::Transient' specified but neither 'LLGL::BindFlags::ColorAttachment' nor 'LLGL::BindFlags::DepthStencilAttachment'"
+            );
+        }
+        if ((desc.bindFlags & ~(BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment)) != 0)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "cannot create transient texture with binding flags other than 'LLGL::BindFlags::ColorAttachment' or 'LLGL::BindFlags::DepthStencilAttachment'"
+            );
+        }
+        if (imageDesc != nullptr)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "cannot create transient texture with initial image data: 'LLGL::MiscFlags::Transient' specified but also initial image data"
+            );
+        }
+    }
 
     /* Check if MIP-map generation is requested  */
     if ((desc.miscFlags & MiscFlags::GenerateMips) != 0)
@@ -1036,6 +1152,15 @@ void DbgRenderSystem::ValidateTextureArrayRangeWithEnd(std::uint32_t baseArrayLa
 
 void DbgRenderSystem::ValidateTextureRegion(const DbgTexture& textureDbg, const TextureRegion& textureRegion)
 {
+    /* Validate texture is not transient, i.e. its content is accessible */
+    if ((textureDbg.desc.miscFlags & MiscFlags::Transient) != 0)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidState,
+            "cannot access texture region of transient texture"
+        );
+    }
+
     /* Validate MIP-map level range */
     ValidateMipLevelLimit(
         textureRegion.subresource.baseMipLevel,
@@ -1210,13 +1335,16 @@ void DbgRenderSystem::ValidateAttachmentDesc(const AttachmentDescriptor& desc)
 
 void DbgRenderSystem::ValidateResourceHeapDesc(const ResourceHeapDescriptor& desc)
 {
+    if (desc.bindless && !features_.hasBindlessResources)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("bindless resources");
+
     if (desc.pipelineLayout)
     {
         auto pipelineLayoutDbg = LLGL_CAST(DbgPipelineLayout*, desc.pipelineLayout);
         const auto& bindings = pipelineLayoutDbg->desc.bindings;
 
         const auto numResourceViews = desc.resourceViews.size();
-        const auto numBindings      = bindings.size();
+        const auto numBindings      = GetNumResourceViewsPerSet(bindings, desc.bindless);
 
         if (numBindings == 0)
             LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create resource heap with empty pipeline layout");
@@ -1239,8 +1367,15 @@ void DbgRenderSystem::ValidateResourceHeapDesc(const ResourceHeapDescriptor& des
         else
         {
             /* Validate all resource view descriptors against their respective binding descriptor */
-            for (std::size_t i = 0, n = desc.resourceViews.size(), m = bindings.size(); i < n; ++i)
-                ValidateResourceViewForBinding(desc.resourceViews[i], bindings[i % m]);
+            for (std::size_t i = 0; i < numResourceViews;)
+            {
+                for (const auto& binding : bindings)
+                {
+                    const auto numTableEntries = (desc.bindless && IsBindlessTableBinding(binding) ? std::max(1u, binding.arraySize) : 1u);
+                    for (std::uint32_t j = 0; j < numTableEntries; ++j)
+                        ValidateResourceViewForBinding(desc.resourceViews[i++], binding);
+                }
+            }
         }
     }
     else
@@ -1439,7 +1574,7 @@ void DbgRenderSystem::AssertMultiSampleTextures()
 }
 
 template <typename T, typename TBase>
-void DbgRenderSystem::ReleaseDbg(std::set<std::unique_ptr<T>>& cont, TBase& entry)
+void DbgRenderSystem::ReleaseDbg(HWObjectContainer<T>& cont, TBase& entry)
 {
     auto& entryDbg = LLGL_CAST(T&, entry);
     instance_->Release(entryDbg.instance);
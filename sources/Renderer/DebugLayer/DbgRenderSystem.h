@@ -10,6 +10,7 @@
 
 
 #include <LLGL/RenderSystem.h>
+#include <LLGL/RenderingCapture.h>
 #include "DbgRenderContext.h"
 #include "DbgCommandBuffer.h"
 #include "DbgCommandQueue.h"
@@ -40,10 +41,18 @@ class DbgRenderSystem final : public RenderSystem
 
         /* ----- Common ----- */
 
-        DbgRenderSystem(const std::shared_ptr<RenderSystem>& instance, RenderingProfiler* profiler, RenderingDebugger* debugger);
+        DbgRenderSystem(
+            const std::shared_ptr<RenderSystem>&    instance,
+            RenderingProfiler*                      profiler,
+            RenderingDebugger*                      debugger,
+            RenderingCapture*                       capture
+        );
 
         void SetConfiguration(const RenderSystemConfiguration& config) override;
 
+        bool QueryMemoryStatistics(MemoryStatistics& stats) override;
+        bool QueryShaderCacheStatistics(ShaderCacheStatistics& stats) override;
+
         /* ----- Render Context ------ */
 
         RenderContext* CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface = nullptr) override;
@@ -143,6 +152,9 @@ class DbgRenderSystem final : public RenderSystem
 
     private:
 
+        // Creates the debug layer command queue and queries the renderer info if not done yet.
+        void InitializeCommandQueue();
+
         void ValidateBindFlags(long flags);
         void ValidateCPUAccessFlags(long flags, long validFlags, const char* contextDesc = nullptr);
         void ValidateMiscFlags(long flags, long validFlags, const char* contextDesc = nullptr);
@@ -192,7 +204,7 @@ class DbgRenderSystem final : public RenderSystem
         void AssertMultiSampleTextures();
 
         template <typename T, typename TBase>
-        void ReleaseDbg(std::set<std::unique_ptr<T>>& cont, TBase& entry);
+        void ReleaseDbg(HWObjectContainer<T>& cont, TBase& entry);
 
     private:
 
@@ -202,6 +214,7 @@ class DbgRenderSystem final : public RenderSystem
 
         RenderingProfiler*                      profiler_   = nullptr;
         RenderingDebugger*                      debugger_   = nullptr;
+        CaptureWriter*                          capture_    = nullptr;
 
         const RenderingCapabilities&            caps_;
         const RenderingFeatures&                features_;
@@ -31,10 +31,10 @@ LLGL_EXPORT std::uint8_t FillClearColorAttachmentIndices(
     /* Check which color attachment must be cleared */
     std::size_t i = 0;
 
-    for (std::uint8_t bufferIndex = 0; i < numColorAttachments && i < renderPassDesc.colorAttachments.size(); ++bufferIndex)
+    for (std::size_t bufferIndex = 0; i < numColorAttachments && bufferIndex < renderPassDesc.colorAttachments.size(); ++bufferIndex)
     {
         if (renderPassDesc.colorAttachments[bufferIndex].loadOp == AttachmentLoadOp::Clear)
-            colorAttachmentsIndices[i++] = bufferIndex;
+            colorAttachmentsIndices[i++] = static_cast<std::uint8_t>(bufferIndex);
     }
 
     /* Initialize remaining attachment indices */
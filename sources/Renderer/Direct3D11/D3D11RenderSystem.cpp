@@ -318,7 +318,7 @@ void D3D11RenderSystem::ReadTexture(Texture& texture, const TextureRegion& textu
 
 Sampler* D3D11RenderSystem::CreateSampler(const SamplerDescriptor& desc)
 {
-    return TakeOwnership(samplers_, MakeUnique<D3D11Sampler>(device_.Get(), desc));
+    return samplers_.acquire(desc, [&]() { return MakeUnique<D3D11Sampler>(device_.Get(), desc); });
 }
 
 void D3D11RenderSystem::Release(Sampler& sampler)
@@ -35,6 +35,7 @@
 #include "Texture/D3D11RenderTarget.h"
 
 #include "../ContainerTypes.h"
+#include "../SamplerUtils.h"
 #include "../DXCommon/ComPtr.h"
 
 #include <dxgi.h>
@@ -256,7 +257,7 @@ class D3D11RenderSystem final : public RenderSystem
         HWObjectContainer<D3D11Buffer>          buffers_;
         HWObjectContainer<D3D11BufferArray>     bufferArrays_;
         HWObjectContainer<D3D11Texture>         textures_;
-        HWObjectContainer<D3D11Sampler>         samplers_;
+        HWSamplerCache<D3D11Sampler>            samplers_;
         HWObjectContainer<D3D11RenderPass>      renderPasses_;
         HWObjectContainer<D3D11RenderTarget>    renderTargets_;
         HWObjectContainer<D3D11Shader>          shaders_;
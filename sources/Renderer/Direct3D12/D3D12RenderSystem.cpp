@@ -332,7 +332,7 @@ void D3D12RenderSystem::ReadTexture(Texture& texture, const TextureRegion& textu
 
 Sampler* D3D12RenderSystem::CreateSampler(const SamplerDescriptor& desc)
 {
-    return TakeOwnership(samplers_, MakeUnique<D3D12Sampler>(desc));
+    return samplers_.acquire(desc, [&]() { return MakeUnique<D3D12Sampler>(desc); });
 }
 
 void D3D12RenderSystem::Release(Sampler& sampler)
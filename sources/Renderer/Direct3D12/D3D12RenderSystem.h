@@ -37,6 +37,7 @@
 #include "Shader/D3D12ShaderProgram.h"
 
 #include "../ContainerTypes.h"
+#include "../SamplerUtils.h"
 #include "../DXCommon/ComPtr.h"
 #include <d3d12.h>
 #include <dxgi1_4.h>
@@ -244,7 +245,7 @@ class D3D12RenderSystem final : public RenderSystem
         HWObjectContainer<D3D12Buffer>          buffers_;
         HWObjectContainer<BufferArray>          bufferArrays_;
         HWObjectContainer<D3D12Texture>         textures_;
-        HWObjectContainer<D3D12Sampler>         samplers_;
+        HWSamplerCache<D3D12Sampler>            samplers_;
         HWObjectContainer<D3D12RenderPass>      renderPasses_;
         HWObjectContainer<D3D12RenderTarget>    renderTargets_;
         HWObjectContainer<D3D12Shader>          shaders_;
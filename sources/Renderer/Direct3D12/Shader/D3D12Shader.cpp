@@ -268,8 +268,9 @@ bool D3D12Shader::LoadBinary(const ShaderDescriptor& shaderDesc)
 {
     if (shaderDesc.sourceType == ShaderSourceType::BinaryFile)
     {
-        /* Load binary code from file */
-        byteCode_ = DXCreateBlob(ReadFileBuffer(shaderDesc.source));
+        /* Load binary code from mapped file */
+        auto fileContent = MapFileBuffer(shaderDesc.source);
+        byteCode_ = DXCreateBlob(fileContent->GetData(), fileContent->GetSize());
     }
     else
     {
@@ -0,0 +1,559 @@
+/*
+ * FrameGraph.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/FrameGraph.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/Texture.h>
+#include <LLGL/RenderTarget.h>
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+// Returns true if a texture that was created with the first descriptor can be used for a resource with the second descriptor.
+static bool IsTextureDescCompatible(const TextureDescriptor& lhs, const TextureDescriptor& rhs)
+{
+    return
+    (
+        lhs.type            == rhs.type             &&
+        lhs.bindFlags       == rhs.bindFlags        &&
+        lhs.miscFlags       == rhs.miscFlags        &&
+        lhs.format          == rhs.format           &&
+        lhs.extent.width    == rhs.extent.width     &&
+        lhs.extent.height   == rhs.extent.height    &&
+        lhs.extent.depth    == rhs.extent.depth     &&
+        lhs.arrayLayers     == rhs.arrayLayers      &&
+        lhs.mipLevels       == rhs.mipLevels        &&
+        lhs.samples         == rhs.samples
+    );
+}
+
+static std::uint64_t GetTextureMemoryFootprint(const TextureDescriptor& textureDesc)
+{
+    const auto numTexels = static_cast<std::uint64_t>(NumMipTexels(textureDesc));
+    const auto texelSize = static_cast<std::uint64_t>(GetMemoryFootprint(textureDesc.format, 1));
+    return numTexels * texelSize * std::max(1u, textureDesc.samples);
+}
+
+static AttachmentType GetAttachmentTypeForFormat(const Format format)
+{
+    if (IsDepthFormat(format))
+        return (IsStencilFormat(format) ? AttachmentType::DepthStencil : AttachmentType::Depth);
+    else if (IsStencilFormat(format))
+        return AttachmentType::Stencil;
+    else
+        return AttachmentType::Color;
+}
+
+FrameGraph::FrameGraph(RenderSystem& renderSystem) :
+    renderSystem_ { renderSystem }
+{
+}
+
+FrameGraph::~FrameGraph()
+{
+    ReleasePassRenderTargets();
+    for (auto& physicalTexture : physicalTextures_)
+    {
+        if (physicalTexture.texture != nullptr)
+            renderSystem_.Release(*physicalTexture.texture);
+    }
+}
+
+FrameGraphResource FrameGraph::CreateTexture(const char* name, const TextureDescriptor& textureDesc)
+{
+    auto resource = AddResource(name, ResourceType::Transient);
+    auto& entry = resources_[resource];
+    {
+        /* Transient textures never have initial data, since their content is always written by a pass first */
+        entry.textureDesc = textureDesc;
+        entry.textureDesc.miscFlags |= MiscFlags::NoInitialData;
+    }
+    return resource;
+}
+
+FrameGraphResource FrameGraph::ImportTexture(const char* name, Texture& texture)
+{
+    auto resource = AddResource(name, ResourceType::ImportedTexture);
+    resources_[resource].texture = &texture;
+    return resource;
+}
+
+FrameGraphResource FrameGraph::ImportRenderTarget(const char* name, RenderTarget& renderTarget, const RenderPass* renderPass)
+{
+    auto resource = AddResource(name, ResourceType::ImportedRenderTarget);
+    auto& entry = resources_[resource];
+    {
+        entry.renderTarget  = &renderTarget;
+        entry.renderPass    = renderPass;
+    }
+    return resource;
+}
+
+void FrameGraph::AddPass(const FrameGraphPassDescriptor& passDesc)
+{
+    if (!passDesc.execute)
+        throw std::invalid_argument("cannot add frame graph pass '" + passDesc.name + "' without execute function");
+
+    const auto passIndex = static_cast<std::uint32_t>(passes_.size());
+
+    PassEntry pass;
+    pass.desc = passDesc;
+
+    /* Validate attachments and determine whether the pass writes imported resources */
+    const bool hasDepthStencil = (passDesc.depthStencilAttachment.resource != Constants::invalidFrameGraphResource);
+    const auto numAttachments = passDesc.colorAttachments.size() + (hasDepthStencil ? 1 : 0);
+
+    auto ValidateAttachment = [&](const FrameGraphAttachment& attachment)
+    {
+        const auto& entry = GetResource(attachment.resource);
+        if (entry.type == ResourceType::ImportedRenderTarget && (numAttachments > 1 || &attachment == &passDesc.depthStencilAttachment))
+            throw std::invalid_argument("imported render target '" + entry.name + "' must be the only color attachment of frame graph pass '" + passDesc.name + "'");
+        if (std::find(passDesc.inputs.begin(), passDesc.inputs.end(), attachment.resource) != passDesc.inputs.end())
+            throw std::invalid_argument("frame graph pass '" + passDesc.name + "' cannot read resource '" + entry.name + "' while it is an attachment");
+        if (entry.type != ResourceType::Transient)
+            pass.sideEffects = true;
+    };
+
+    for (const auto& attachment : passDesc.colorAttachments)
+        ValidateAttachment(attachment);
+    if (hasDepthStencil)
+        ValidateAttachment(passDesc.depthStencilAttachment);
+
+    for (auto resource : passDesc.outputs)
+    {
+        const auto& entry = GetResource(resource);
+        if (entry.type == ResourceType::ImportedRenderTarget)
+            throw std::invalid_argument("imported render target '" + entry.name + "' can only be written as color attachment of frame graph pass '" + passDesc.name + "'");
+        if (entry.type != ResourceType::Transient)
+            pass.sideEffects = true;
+    }
+
+    if (passDesc.sideEffects)
+        pass.sideEffects = true;
+
+    /* Resolve dependencies to the latest previous passes that wrote the resources this pass reads */
+    for (auto resource : passDesc.inputs)
+    {
+        const auto& entry = GetResource(resource);
+        if (entry.type == ResourceType::ImportedRenderTarget)
+            throw std::invalid_argument("imported render target '" + entry.name + "' cannot be read by frame graph pass '" + passDesc.name + "'");
+        AddDependency(pass, resource);
+    }
+
+    for (const auto& attachment : passDesc.colorAttachments)
+    {
+        if (attachment.loadOp == AttachmentLoadOp::Load)
+            AddDependency(pass, attachment.resource);
+    }
+
+    if (hasDepthStencil && passDesc.depthStencilAttachment.loadOp == AttachmentLoadOp::Load)
+        AddDependency(pass, passDesc.depthStencilAttachment.resource);
+
+    passes_.push_back(std::move(pass));
+
+    /* Make this pass the latest writer of all its attachments and outputs */
+    for (const auto& attachment : passDesc.colorAttachments)
+        AddWrite(passIndex, attachment.resource);
+    if (hasDepthStencil)
+        AddWrite(passIndex, passDesc.depthStencilAttachment.resource);
+    for (auto resource : passDesc.outputs)
+        AddWrite(passIndex, resource);
+
+    compiled_ = false;
+}
+
+void FrameGraph::Compile()
+{
+    /* Release render targets of previous compilation first, since they refer to the physical textures */
+    ReleasePassRenderTargets();
+
+    CullPasses();
+    DetermineLifetimes();
+    AssignPhysicalTextures();
+
+    for (auto passIndex : executionOrder_)
+        CreatePassRenderTarget(passes_[passIndex]);
+
+    compiled_ = true;
+}
+
+void FrameGraph::Execute(CommandBuffer& commandBuffer)
+{
+    if (!compiled_)
+        throw std::runtime_error("cannot execute frame graph that has been modified since it was compiled");
+
+    for (auto passIndex : executionOrder_)
+    {
+        const auto& pass = passes_[passIndex];
+
+        if (!pass.desc.name.empty())
+            commandBuffer.PushDebugGroup(pass.desc.name.c_str());
+
+        if (pass.renderTarget != nullptr)
+        {
+            commandBuffer.BeginRenderPass(
+                *(pass.renderTarget),
+                pass.renderPass,
+                static_cast<std::uint32_t>(pass.clearValues.size()),
+                (pass.clearValues.empty() ? nullptr : pass.clearValues.data())
+            );
+            {
+                pass.desc.execute(commandBuffer);
+            }
+            commandBuffer.EndRenderPass();
+        }
+        else
+            pass.desc.execute(commandBuffer);
+
+        if (!pass.desc.name.empty())
+            commandBuffer.PopDebugGroup();
+    }
+}
+
+void FrameGraph::Reset()
+{
+    ReleasePassRenderTargets();
+    passes_.clear();
+    resources_.clear();
+    executionOrder_.clear();
+    compiled_ = false;
+}
+
+Texture* FrameGraph::GetTexture(FrameGraphResource resource) const
+{
+    return GetResource(resource).texture;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+FrameGraphResource FrameGraph::AddResource(const char* name, ResourceType type)
+{
+    if (name == nullptr)
+        throw std::invalid_argument("cannot declare frame graph resource with null pointer as name");
+
+    ResourceEntry entry;
+    {
+        entry.name = name;
+        entry.type = type;
+    }
+    resources_.push_back(std::move(entry));
+
+    compiled_ = false;
+
+    return static_cast<FrameGraphResource>(resources_.size() - 1);
+}
+
+const FrameGraph::ResourceEntry& FrameGraph::GetResource(FrameGraphResource resource) const
+{
+    if (resource >= resources_.size())
+        throw std::invalid_argument("invalid frame graph resource: " + std::to_string(resource));
+    return resources_[resource];
+}
+
+void FrameGraph::AddDependency(PassEntry& pass, FrameGraphResource resource)
+{
+    const auto& entry = GetResource(resource);
+    if (entry.lastWriter != ~0u)
+        pass.dependencies.push_back({ entry.lastWriter, resource });
+    else if (entry.type == ResourceType::Transient)
+        throw std::invalid_argument("frame graph pass '" + pass.desc.name + "' reads transient texture '" + entry.name + "' before any pass writes it");
+}
+
+void FrameGraph::AddWrite(std::uint32_t passIndex, FrameGraphResource resource)
+{
+    resources_[resource].lastWriter = passIndex;
+}
+
+void FrameGraph::CullPasses()
+{
+    for (auto& pass : passes_)
+    {
+        pass.culled             = true;
+        pass.storeColor.assign(pass.desc.colorAttachments.size(), false);
+        pass.storeDepthStencil  = false;
+    }
+
+    /*
+    Dependencies always refer to passes that were added before, so a single iteration in reverse order
+    determines all passes that contribute to a pass with side effects, and which of their attachments must be stored.
+    */
+    for (auto i = passes_.size(); i-- > 0;)
+    {
+        auto& pass = passes_[i];
+
+        if (pass.sideEffects)
+            pass.culled = false;
+
+        if (pass.culled)
+            continue;
+
+        for (const auto& dep : pass.dependencies)
+        {
+            auto& producer = passes_[dep.pass];
+            producer.culled = false;
+
+            const auto& colorAttachments = producer.desc.colorAttachments;
+            for (std::size_t j = 0; j < colorAttachments.size(); ++j)
+            {
+                if (colorAttachments[j].resource == dep.resource)
+                    producer.storeColor[j] = true;
+            }
+            if (producer.desc.depthStencilAttachment.resource == dep.resource)
+                producer.storeDepthStencil = true;
+        }
+    }
+
+    /* Keep declaration order for all remaining passes, which satisfies all dependencies by construction */
+    executionOrder_.clear();
+    for (std::size_t i = 0; i < passes_.size(); ++i)
+    {
+        if (!passes_[i].culled)
+            executionOrder_.push_back(static_cast<std::uint32_t>(i));
+    }
+
+    stats_.numPasses        = static_cast<std::uint32_t>(executionOrder_.size());
+    stats_.numCulledPasses  = static_cast<std::uint32_t>(passes_.size() - executionOrder_.size());
+}
+
+void FrameGraph::DetermineLifetimes()
+{
+    for (auto& entry : resources_)
+    {
+        if (entry.type == ResourceType::Transient)
+        {
+            entry.texture           = nullptr;
+            entry.firstUse          = ~0u;
+            entry.lastUse           = 0;
+            entry.physicalTexture   = ~0u;
+        }
+    }
+
+    auto UseResource = [this](FrameGraphResource resource, std::uint32_t position)
+    {
+        auto& entry = resources_[resource];
+        entry.firstUse  = std::min(entry.firstUse, position);
+        entry.lastUse   = std::max(entry.lastUse, position);
+    };
+
+    for (std::uint32_t position = 0; position < executionOrder_.size(); ++position)
+    {
+        const auto& desc = passes_[executionOrder_[position]].desc;
+
+        for (auto resource : desc.inputs)
+            UseResource(resource, position);
+        for (auto resource : desc.outputs)
+            UseResource(resource, position);
+        for (const auto& attachment : desc.colorAttachments)
+            UseResource(attachment.resource, position);
+        if (desc.depthStencilAttachment.resource != Constants::invalidFrameGraphResource)
+            UseResource(desc.depthStencilAttachment.resource, position);
+    }
+}
+
+void FrameGraph::AssignPhysicalTextures()
+{
+    /* Mark all textures of the previous compilation as unused */
+    for (auto& physicalTexture : physicalTextures_)
+        physicalTexture.lastUse = ~0u;
+
+    /* Gather all used transient textures in the order of their first use */
+    std::vector<FrameGraphResource> transients;
+    for (std::size_t i = 0; i < resources_.size(); ++i)
+    {
+        const auto& entry = resources_[i];
+        if (entry.type == ResourceType::Transient && entry.firstUse != ~0u)
+            transients.push_back(static_cast<FrameGraphResource>(i));
+    }
+
+    std::stable_sort(
+        transients.begin(),
+        transients.end(),
+        [this](FrameGraphResource lhs, FrameGraphResource rhs)
+        {
+            return (resources_[lhs].firstUse < resources_[rhs].firstUse);
+        }
+    );
+
+    /* Assign each transient texture to a compatible texture whose previous lifetime ended before, or allocate a new one */
+    stats_.numTransientTextures = static_cast<std::uint32_t>(transients.size());
+    stats_.transientMemory      = 0;
+
+    for (auto resource : transients)
+    {
+        auto& entry = resources_[resource];
+
+        std::uint32_t physicalIndex = ~0u;
+        for (std::size_t i = 0; i < physicalTextures_.size(); ++i)
+        {
+            const auto& physicalTexture = physicalTextures_[i];
+            if ( ( physicalTexture.lastUse == ~0u || physicalTexture.lastUse < entry.firstUse ) &&
+                 IsTextureDescCompatible(physicalTexture.textureDesc, entry.textureDesc) )
+            {
+                physicalIndex = static_cast<std::uint32_t>(i);
+                break;
+            }
+        }
+
+        if (physicalIndex == ~0u)
+        {
+            PhysicalTexture physicalTexture;
+            physicalTexture.textureDesc = entry.textureDesc;
+            physicalTextures_.push_back(physicalTexture);
+            physicalIndex = static_cast<std::uint32_t>(physicalTextures_.size() - 1);
+        }
+
+        physicalTextures_[physicalIndex].lastUse = entry.lastUse;
+        entry.physicalTexture = physicalIndex;
+
+        stats_.transientMemory += GetTextureMemoryFootprint(entry.textureDesc);
+    }
+
+    /* Release textures that are no longer used and compact the list */
+    std::vector<std::uint32_t> remappedIndices(physicalTextures_.size(), ~0u);
+    std::size_t numPhysicalTextures = 0;
+
+    for (std::size_t i = 0; i < physicalTextures_.size(); ++i)
+    {
+        auto& physicalTexture = physicalTextures_[i];
+        if (physicalTexture.lastUse == ~0u)
+        {
+            if (physicalTexture.texture != nullptr)
+                renderSystem_.Release(*physicalTexture.texture);
+        }
+        else
+        {
+            remappedIndices[i] = static_cast<std::uint32_t>(numPhysicalTextures);
+            physicalTextures_[numPhysicalTextures++] = physicalTexture;
+        }
+    }
+
+    physicalTextures_.resize(numPhysicalTextures);
+
+    /* Create all new textures */
+    stats_.numPhysicalTextures  = static_cast<std::uint32_t>(numPhysicalTextures);
+    stats_.physicalMemory       = 0;
+
+    for (auto& physicalTexture : physicalTextures_)
+    {
+        if (physicalTexture.texture == nullptr)
+            physicalTexture.texture = renderSystem_.CreateTexture(physicalTexture.textureDesc);
+        stats_.physicalMemory += GetTextureMemoryFootprint(physicalTexture.textureDesc);
+    }
+
+    for (auto resource : transients)
+    {
+        auto& entry = resources_[resource];
+        entry.physicalTexture   = remappedIndices[entry.physicalTexture];
+        entry.texture           = physicalTextures_[entry.physicalTexture].texture;
+    }
+}
+
+void FrameGraph::CreatePassRenderTarget(PassEntry& pass)
+{
+    const auto& desc = pass.desc;
+    const bool hasDepthStencil = (desc.depthStencilAttachment.resource != Constants::invalidFrameGraphResource);
+
+    pass.clearValues.clear();
+
+    if (desc.colorAttachments.empty() && !hasDepthStencil)
+        return;
+
+    /* Use imported render target as is */
+    const auto& firstEntry = resources_[hasDepthStencil && desc.colorAttachments.empty() ? desc.depthStencilAttachment.resource : desc.colorAttachments.front().resource];
+    if (firstEntry.type == ResourceType::ImportedRenderTarget)
+    {
+        const auto& attachment = desc.colorAttachments.front();
+        pass.renderTarget   = firstEntry.renderTarget;
+        pass.renderPass     = firstEntry.renderPass;
+
+        /* Clear value is used for the color and the combined depth-stencil attachments */
+        if (attachment.loadOp == AttachmentLoadOp::Clear)
+            pass.clearValues = { attachment.clearValue, attachment.clearValue };
+
+        return;
+    }
+
+    /* Create render pass with load and store operations of this pass and render target with all its attachments */
+    const auto textureDesc = firstEntry.texture->GetDesc();
+    const auto extent = firstEntry.texture->GetMipExtent(0);
+
+    RenderPassDescriptor renderPassDesc;
+    RenderTargetDescriptor renderTargetDesc;
+    {
+        renderPassDesc.samples                  = std::max(1u, textureDesc.samples);
+        renderTargetDesc.resolution             = { extent.width, extent.height };
+        renderTargetDesc.samples                = renderPassDesc.samples;
+        renderTargetDesc.customMultiSampling    = IsMultiSampleTexture(textureDesc.type);
+    }
+
+    auto GetStoreOp = [this](FrameGraphResource resource, bool store)
+    {
+        return (store || resources_[resource].type != ResourceType::Transient ? AttachmentStoreOp::Store : AttachmentStoreOp::Undefined);
+    };
+
+    for (std::size_t i = 0; i < desc.colorAttachments.size(); ++i)
+    {
+        const auto& attachment = desc.colorAttachments[i];
+        auto texture = resources_[attachment.resource].texture;
+        renderPassDesc.colorAttachments.push_back(
+            AttachmentFormatDescriptor{ texture->GetFormat(), attachment.loadOp, GetStoreOp(attachment.resource, pass.storeColor[i]) }
+        );
+        renderTargetDesc.attachments.push_back(AttachmentDescriptor{ AttachmentType::Color, texture });
+        if (attachment.loadOp == AttachmentLoadOp::Clear)
+            pass.clearValues.push_back(attachment.clearValue);
+    }
+
+    if (hasDepthStencil)
+    {
+        const auto& attachment = desc.depthStencilAttachment;
+        auto texture = resources_[attachment.resource].texture;
+        const auto format = texture->GetFormat();
+        const AttachmentFormatDescriptor formatDesc{ format, attachment.loadOp, GetStoreOp(attachment.resource, pass.storeDepthStencil) };
+        if (IsDepthFormat(format))
+            renderPassDesc.depthAttachment = formatDesc;
+        if (IsStencilFormat(format))
+            renderPassDesc.stencilAttachment = formatDesc;
+        renderTargetDesc.attachments.push_back(AttachmentDescriptor{ GetAttachmentTypeForFormat(format), texture });
+        if (attachment.loadOp == AttachmentLoadOp::Clear)
+            pass.clearValues.push_back(attachment.clearValue);
+    }
+
+    pass.ownRenderPass              = renderSystem_.CreateRenderPass(renderPassDesc);
+    pass.renderPass                 = pass.ownRenderPass;
+    renderTargetDesc.renderPass     = pass.ownRenderPass;
+    pass.renderTarget               = renderSystem_.CreateRenderTarget(renderTargetDesc);
+}
+
+void FrameGraph::ReleasePassRenderTargets()
+{
+    for (auto& pass : passes_)
+    {
+        if (pass.ownRenderPass != nullptr)
+        {
+            renderSystem_.Release(*pass.renderTarget);
+            renderSystem_.Release(*pass.ownRenderPass);
+            pass.ownRenderPass = nullptr;
+        }
+        pass.renderTarget   = nullptr;
+        pass.renderPass     = nullptr;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,169 @@
+/*
+ * GPUProfiler.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/GPUProfiler.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandQueue.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/QueryHeap.h>
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+GPUProfiler::GPUProfiler(RenderSystem& renderSystem, CommandQueue& commandQueue, const GPUProfilerDescriptor& desc) :
+    renderSystem_ { renderSystem },
+    commandQueue_ { commandQueue },
+    desc_         { desc         }
+{
+    if (desc.numFramesInFlight < 2)
+        throw std::invalid_argument("GPU profiler requires at least two frames in flight");
+    if (desc.maxScopesPerFrame == 0)
+        throw std::invalid_argument("GPU profiler requires at least one scope per frame");
+
+    /* Create one timer query heap for each frame in flight */
+    QueryHeapDescriptor queryHeapDesc;
+    {
+        queryHeapDesc.type          = QueryType::TimeElapsed;
+        queryHeapDesc.numQueries    = desc.maxScopesPerFrame;
+    }
+    frames_.resize(desc.numFramesInFlight);
+    for (auto& frame : frames_)
+    {
+        frame.queryHeap = renderSystem_.CreateQueryHeap(queryHeapDesc);
+        frame.scopes.reserve(desc.maxScopesPerFrame);
+    }
+
+    results_.resize(desc.maxScopesPerFrame);
+}
+
+GPUProfiler::~GPUProfiler()
+{
+    for (auto& frame : frames_)
+        renderSystem_.Release(*frame.queryHeap);
+}
+
+void GPUProfiler::BeginFrame()
+{
+    if (insideFrame_)
+        throw std::runtime_error("cannot begin GPU profiler frame before previous frame has ended");
+
+    /* Collect results of all pending frames from oldest to newest, so the latest frame profile is always the newest one available */
+    const auto numFrames = frames_.size();
+    for (std::size_t i = 1; i <= numFrames; ++i)
+    {
+        auto& frame = frames_[(currentFrame_ + i) % numFrames];
+        if (frame.pending && !ResolveFrame(frame))
+            break;
+    }
+
+    /* Move to next frame in the ring and drop its results if they are still not available, instead of waiting for the GPU */
+    currentFrame_ = (currentFrame_ + 1) % numFrames;
+
+    auto& frame = frames_[currentFrame_];
+    if (frame.pending)
+    {
+        frame.pending = false;
+        ++numDroppedFrames_;
+    }
+
+    frame.frameIndex    = frameCounter_++;
+    frame.numQueries    = 0;
+    frame.scopes.clear();
+
+    insideFrame_ = true;
+}
+
+void GPUProfiler::EndFrame()
+{
+    if (!insideFrame_)
+        throw std::runtime_error("cannot end GPU profiler frame before it has begun");
+    if (!scopeStack_.empty())
+        throw std::runtime_error("cannot end GPU profiler frame with " + std::to_string(scopeStack_.size()) + " scope(s) still open");
+
+    auto& frame = frames_[currentFrame_];
+    frame.pending = !frame.scopes.empty();
+
+    insideFrame_ = false;
+}
+
+void GPUProfiler::PushScope(CommandBuffer& commandBuffer, const char* name)
+{
+    if (!insideFrame_)
+        throw std::runtime_error("cannot push GPU profiler scope outside of a frame");
+
+    if (desc_.debugGroups)
+        commandBuffer.PushDebugGroup(name);
+
+    auto& frame = frames_[currentFrame_];
+    if (frame.numQueries < desc_.maxScopesPerFrame)
+    {
+        /* Record scope with next query of the current frame */
+        const auto query = frame.numQueries++;
+        frame.scopes.push_back({ name, static_cast<std::uint32_t>(scopeStack_.size()), query });
+        scopeStack_.push_back(query);
+        commandBuffer.BeginQuery(*frame.queryHeap, query);
+    }
+    else
+    {
+        /* Scope limit is exceeded for this frame, so this scope is not measured */
+        scopeStack_.push_back(~0u);
+    }
+}
+
+void GPUProfiler::PopScope(CommandBuffer& commandBuffer)
+{
+    if (scopeStack_.empty())
+        throw std::runtime_error("cannot pop GPU profiler scope, because there is no open scope");
+
+    const auto query = scopeStack_.back();
+    scopeStack_.pop_back();
+
+    if (query != ~0u)
+        commandBuffer.EndQuery(*frames_[currentFrame_].queryHeap, query);
+
+    if (desc_.debugGroups)
+        commandBuffer.PopDebugGroup();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool GPUProfiler::ResolveFrame(FrameRecord& frame)
+{
+    /* Query all results of this frame at once; this does not block if they are not available yet */
+    if (!commandQueue_.QueryResult(*frame.queryHeap, 0, frame.numQueries, results_.data(), frame.numQueries * sizeof(std::uint64_t)))
+        return false;
+
+    /* Store results in latest frame profile */
+    latestFrame_.frameIndex = frame.frameIndex;
+    latestFrame_.scopes.resize(frame.scopes.size());
+
+    for (std::size_t i = 0; i < frame.scopes.size(); ++i)
+    {
+        auto& dst = latestFrame_.scopes[i];
+        const auto& src = frame.scopes[i];
+        dst.name        = src.name;
+        dst.depth       = src.depth;
+        dst.elapsedTime = results_[src.query];
+    }
+
+    frame.pending = false;
+
+    return true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
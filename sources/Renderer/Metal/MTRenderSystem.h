@@ -13,6 +13,7 @@
 
 #include <LLGL/RenderSystem.h>
 #include "../ContainerTypes.h"
+#include "../SamplerUtils.h"
 
 #include "MTCommandQueue.h"
 #include "MTCommandBuffer.h"
@@ -170,7 +171,7 @@ class MTRenderSystem final : public RenderSystem
         HWObjectContainer<MTBuffer>         buffers_;
         HWObjectContainer<MTBufferArray>    bufferArrays_;
         HWObjectContainer<MTTexture>        textures_;
-        HWObjectContainer<MTSampler>        samplers_;
+        HWSamplerCache<MTSampler>           samplers_;
         HWObjectContainer<MTRenderPass>     renderPasses_;
         HWObjectContainer<MTRenderTarget>   renderTargets_;
         HWObjectContainer<MTShader>         shaders_;
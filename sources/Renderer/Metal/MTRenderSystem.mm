@@ -165,7 +165,7 @@ void MTRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureR
 
 Sampler* MTRenderSystem::CreateSampler(const SamplerDescriptor& desc)
 {
-    return TakeOwnership(samplers_, MakeUnique<MTSampler>(device_, desc));
+    return samplers_.acquire(desc, [&]() { return MakeUnique<MTSampler>(device_, desc); });
 }
 
 void MTRenderSystem::Release(Sampler& sampler)
@@ -58,7 +58,7 @@ GLBuffer::GLBuffer(long bindFlags) :
 GLBuffer::~GLBuffer()
 {
     glDeleteBuffers(1, &id_);
-    GLStateManager::Get().NotifyBufferRelease(*this);
+    GLStateManager::NotifyBufferRelease(*this);
 }
 
 void GLBuffer::SetName(const char* name)
@@ -101,6 +101,8 @@ BufferDescriptor GLBuffer::GetDesc() const
 
 void GLBuffer::BufferStorage(GLsizeiptr size, const void* data, GLbitfield flags, GLenum usage)
 {
+    size_ = size;
+
     #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
     if (HasExtension(GLExt::ARB_direct_state_access))
     {
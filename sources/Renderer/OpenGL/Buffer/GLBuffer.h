@@ -54,6 +54,12 @@ class GLBuffer : public Buffer
             return id_;
         }
 
+        // Returns the size (in bytes) of the buffer storage.
+        inline GLsizeiptr GetSize() const
+        {
+            return size_;
+        }
+
         // Returns the primary buffer target. In case the buffer was created with multiple binding flags, other targets can be used, too.
         inline GLBufferTarget GetTarget() const
         {
@@ -78,6 +84,7 @@ class GLBuffer : public Buffer
     private:
 
         GLuint          id_                 = 0;
+        GLsizeiptr      size_               = 0;
         GLBufferTarget  target_             = GLBufferTarget::ARRAY_BUFFER;
         bool            indexType16Bits_    = false;
 
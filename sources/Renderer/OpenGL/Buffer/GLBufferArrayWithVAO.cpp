@@ -24,9 +24,8 @@ GLBufferArrayWithVAO::GLBufferArrayWithVAO(long bindFlags) :
 
 void GLBufferArrayWithVAO::SetName(const char* name)
 {
-    #ifdef LLGL_GL_ENABLE_OPENGL2X
-    if (HasNativeVAO())
-    #endif
+    /* Shared VAOs are not labeled, since they belong to multiple buffer arrays */
+    if (vao_.GetID() != 0)
     {
         /* Set label for VAO */
         GLSetObjectLabel(GL_VERTEX_ARRAY, vao_.GetID(), name);
@@ -43,6 +42,12 @@ void GLBufferArrayWithVAO::BuildVertexArray(std::uint32_t numBuffers, Buffer* co
     }
     else
     #endif // /LLGL_GL_ENABLE_OPENGL2X
+    if (HasExtension(GLExt::ARB_vertex_attrib_binding))
+    {
+        /* Build vertex array with a VAO that is shared between all buffer arrays with the same vertex format */
+        BuildVertexArrayWithSharedVAO(numBuffers, bufferArray);
+    }
+    else
     {
         /* Build vertex array with native VAO */
         BuildVertexArrayWithVAO(numBuffers, bufferArray);
@@ -65,6 +70,7 @@ static void ThrowNoVertexBufferErr()
 void GLBufferArrayWithVAO::BuildVertexArrayWithVAO(std::uint32_t numBuffers, Buffer* const * bufferArray)
 {
     /* Bind VAO */
+    vao_.Create();
     GLStateManager::Get().BindVertexArray(GetVaoID());
     {
         while (numBuffers-- > 0)
@@ -87,6 +93,25 @@ void GLBufferArrayWithVAO::BuildVertexArrayWithVAO(std::uint32_t numBuffers, Buf
     GLStateManager::Get().BindVertexArray(0);
 }
 
+void GLBufferArrayWithVAO::BuildVertexArrayWithSharedVAO(std::uint32_t numBuffers, Buffer* const * bufferArray)
+{
+    while (numBuffers-- > 0)
+    {
+        if (((*bufferArray)->GetBindFlags() & BindFlags::VertexBuffer) != 0)
+        {
+            auto vertexBufferGL = LLGL_CAST(GLBufferWithVAO*, (*bufferArray++));
+
+            /* Build each vertex attribute */
+            const auto& vertexAttribs = vertexBufferGL->GetVertexAttribs();
+            for (const auto& attrib : vertexAttribs)
+                sharedVertexArray_.BuildVertexAttribute(vertexBufferGL->GetID(), attrib);
+        }
+        else
+            ThrowNoVertexBufferErr();
+    }
+    sharedVertexArray_.Finalize();
+}
+
 #ifdef LLGL_GL_ENABLE_OPENGL2X
 
 void GLBufferArrayWithVAO::BuildVertexArrayWithEmulator(std::uint32_t numBuffers, Buffer* const * bufferArray)
@@ -11,6 +11,7 @@
 
 #include "GLBufferArray.h"
 #include "GLVertexArrayObject.h"
+#include "GLSharedVertexArray.h"
 #include "GL2XVertexArray.h"
 
 
@@ -31,12 +32,18 @@ class GLBufferArrayWithVAO final : public GLBufferArray
 
         void BuildVertexArray(std::uint32_t numBuffers, Buffer* const * bufferArray);
 
-        // Returns the ID of the vertex-array-object (VAO)
+        // Returns the ID of the vertex-array-object (VAO) that is owned by this buffer array; only used without GL_ARB_vertex_attrib_binding.
         inline GLuint GetVaoID() const
         {
             return vao_.GetID();
         }
 
+        // Returns the vertex array that shares its VAO with all buffer arrays of the same vertex format; only used with GL_ARB_vertex_attrib_binding.
+        inline const GLSharedVertexArray& GetSharedVertexArray() const
+        {
+            return sharedVertexArray_;
+        }
+
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         // Returns the GL 2.x compatible vertex-array emulator.
         inline const GL2XVertexArray& GetVertexArrayGL2X() const
@@ -48,6 +55,7 @@ class GLBufferArrayWithVAO final : public GLBufferArray
     private:
 
         void BuildVertexArrayWithVAO(std::uint32_t numBuffers, Buffer* const * bufferArray);
+        void BuildVertexArrayWithSharedVAO(std::uint32_t numBuffers, Buffer* const * bufferArray);
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         void BuildVertexArrayWithEmulator(std::uint32_t numBuffers, Buffer* const * bufferArray);
         #endif
@@ -55,6 +63,7 @@ class GLBufferArrayWithVAO final : public GLBufferArray
     private:
 
         GLVertexArrayObject vao_;
+        GLSharedVertexArray sharedVertexArray_;
 
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         GL2XVertexArray     vertexArrayGL2X_;
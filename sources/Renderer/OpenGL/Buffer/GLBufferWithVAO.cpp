@@ -19,14 +19,17 @@ GLBufferWithVAO::GLBufferWithVAO(long bindFlags) :
 {
 }
 
-void GLBufferWithVAO::BuildVertexArray(std::size_t numVertexAttribs, const VertexAttribute* vertexAttribs)
+void GLBufferWithVAO::SetVertexAttribs(std::size_t numVertexAttribs, const VertexAttribute* vertexAttribs)
 {
     /* Store vertex format (required if this buffer is used in a buffer array) */
     if (numVertexAttribs > 0)
         vertexAttribs_ = std::vector<VertexAttribute>(vertexAttribs, vertexAttribs + numVertexAttribs);
     else
         vertexAttribs_.clear();
+}
 
+void GLBufferWithVAO::BuildVertexArray()
+{
     #ifdef LLGL_GL_ENABLE_OPENGL2X
     if (!HasNativeVAO())
     {
@@ -35,6 +38,12 @@ void GLBufferWithVAO::BuildVertexArray(std::size_t numVertexAttribs, const Verte
     }
     else
     #endif // /LLGL_GL_ENABLE_OPENGL2X
+    if (HasExtension(GLExt::ARB_vertex_attrib_binding))
+    {
+        /* Build vertex array with a VAO that is shared between all buffers with the same vertex format */
+        BuildVertexArrayWithSharedVAO();
+    }
+    else
     {
         /* Build vertex array with native VAO */
         BuildVertexArrayWithVAO();
@@ -49,6 +58,7 @@ void GLBufferWithVAO::BuildVertexArray(std::size_t numVertexAttribs, const Verte
 void GLBufferWithVAO::BuildVertexArrayWithVAO()
 {
     /* Bind VAO */
+    vao_.Create();
     GLStateManager::Get().BindVertexArray(GetVaoID());
     {
         /* Bind VBO */
@@ -61,6 +71,14 @@ void GLBufferWithVAO::BuildVertexArrayWithVAO()
     GLStateManager::Get().BindVertexArray(0);
 }
 
+void GLBufferWithVAO::BuildVertexArrayWithSharedVAO()
+{
+    /* Build each vertex attribute */
+    for (const auto& attrib : vertexAttribs_)
+        sharedVertexArray_.BuildVertexAttribute(GetID(), attrib);
+    sharedVertexArray_.Finalize();
+}
+
 #ifdef LLGL_GL_ENABLE_OPENGL2X
 
 void GLBufferWithVAO::BuildVertexArrayWithEmulator()
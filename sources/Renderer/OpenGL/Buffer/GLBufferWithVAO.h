@@ -11,6 +11,7 @@
 
 #include "GLBuffer.h"
 #include "GLVertexArrayObject.h"
+#include "GLSharedVertexArray.h"
 #include "GL2XVertexArray.h"
 
 
@@ -25,14 +26,24 @@ class GLBufferWithVAO final : public GLBuffer
 
         GLBufferWithVAO(long bindFlags);
 
-        void BuildVertexArray(std::size_t numVertexAttribs, const VertexAttribute* vertexAttribs);
+        // Stores the vertex format of this buffer. This does not require a GL context and can be called on any thread.
+        void SetVertexAttribs(std::size_t numVertexAttribs, const VertexAttribute* vertexAttribs);
 
-        // Returns the ID of the vertex-array-object (VAO)
+        // Builds the vertex array from the stored vertex format. VAOs are not shared between GL contexts, so this must be called on the render thread.
+        void BuildVertexArray();
+
+        // Returns the ID of the vertex-array-object (VAO) that is owned by this buffer; only used without GL_ARB_vertex_attrib_binding.
         inline GLuint GetVaoID() const
         {
             return vao_.GetID();
         }
 
+        // Returns the vertex array that shares its VAO with all buffers of the same vertex format; only used with GL_ARB_vertex_attrib_binding.
+        inline const GLSharedVertexArray& GetSharedVertexArray() const
+        {
+            return sharedVertexArray_;
+        }
+
         // Returns the list of vertex attributes.
         inline const std::vector<VertexAttribute>& GetVertexAttribs() const
         {
@@ -50,6 +61,7 @@ class GLBufferWithVAO final : public GLBuffer
     private:
 
         void BuildVertexArrayWithVAO();
+        void BuildVertexArrayWithSharedVAO();
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         void BuildVertexArrayWithEmulator();
         #endif
@@ -57,6 +69,7 @@ class GLBufferWithVAO final : public GLBuffer
     private:
 
         GLVertexArrayObject             vao_;
+        GLSharedVertexArray             sharedVertexArray_;
         std::vector<VertexAttribute>    vertexAttribs_;
 
         #ifdef LLGL_GL_ENABLE_OPENGL2X
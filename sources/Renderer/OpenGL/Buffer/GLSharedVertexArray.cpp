@@ -0,0 +1,105 @@
+/*
+ * GLSharedVertexArray.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLSharedVertexArray.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionRegistry.h"
+#include "../RenderState/GLStateManager.h"
+#include "../RenderState/GLStatePool.h"
+#include <LLGL/VertexAttribute.h>
+
+
+namespace LLGL
+{
+
+
+// Minimum of GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET that is guaranteed by the GL specification
+static const std::uint32_t g_maxVertexAttribRelativeOffset = 2047;
+
+GLSharedVertexArray::~GLSharedVertexArray()
+{
+    /* Only finalized vertex arrays refer to the state pool, which must not be accessed from the upload context */
+    if (format_)
+        GLStatePool::Get().ReleaseVertexArrayFormat(std::move(format_));
+}
+
+void GLSharedVertexArray::BuildVertexAttribute(GLuint bufferID, const VertexAttribute& attribute)
+{
+    /* Attributes with an offset beyond the guaranteed relative offset limit read from their own binding point (e.g. for non-interleaved vertex buffers) */
+    const auto relativeOffset   = (attribute.offset <= g_maxVertexAttribRelativeOffset ? attribute.offset : 0u);
+    const auto bindingOffset    = static_cast<GLintptr>(attribute.offset - relativeOffset);
+    const auto stride           = static_cast<GLsizei>(attribute.stride);
+
+    /* Find binding point with the same buffer, offset, stride, and instance divisor */
+    GLuint bindingIndex = 0;
+    for (auto n = static_cast<GLuint>(buffers_.size()); bindingIndex < n; ++bindingIndex)
+    {
+        if (buffers_[bindingIndex]          == bufferID         &&
+            offsets_[bindingIndex]          == bindingOffset    &&
+            strides_[bindingIndex]          == stride           &&
+            bindingDivisors_[bindingIndex]  == attribute.instanceDivisor)
+        {
+            break;
+        }
+    }
+
+    if (bindingIndex == buffers_.size())
+    {
+        /* Append new binding point */
+        buffers_.push_back(bufferID);
+        offsets_.push_back(bindingOffset);
+        strides_.push_back(stride);
+        bindingDivisors_.push_back(attribute.instanceDivisor);
+    }
+
+    /* Append vertex attribute format */
+    attribFormats_.push_back({ attribute.location, bindingIndex, attribute.format, relativeOffset });
+}
+
+void GLSharedVertexArray::Finalize()
+{
+    /* Acquire shared VAO for this vertex format; the format itself is no longer required afterwards */
+    format_ = GLStatePool::Get().CreateVertexArrayFormat(attribFormats_, bindingDivisors_);
+    attribFormats_.clear();
+    attribFormats_.shrink_to_fit();
+    bindingDivisors_.clear();
+    bindingDivisors_.shrink_to_fit();
+}
+
+void GLSharedVertexArray::Bind(GLStateManager& stateMngr) const
+{
+    /* Vertex array must have been finalized; a buffer without vertex format (e.g. bound before its attributes were built) has no VAO */
+    if (!format_)
+        return;
+
+    /* Bind shared VAO; this is a no-op if the previous vertex array had the same vertex format */
+    stateMngr.BindVertexArray(format_->GetID());
+
+    #ifdef GL_ARB_vertex_attrib_binding
+
+    /* Attach vertex buffers to the binding points of the VAO */
+    #ifdef GL_ARB_multi_bind
+    if (HasExtension(GLExt::ARB_multi_bind))
+    {
+        glBindVertexBuffers(0, static_cast<GLsizei>(buffers_.size()), buffers_.data(), offsets_.data(), strides_.data());
+    }
+    else
+    #endif // /GL_ARB_multi_bind
+    {
+        for (std::size_t i = 0, n = buffers_.size(); i < n; ++i)
+            glBindVertexBuffer(static_cast<GLuint>(i), buffers_[i], offsets_[i], strides_[i]);
+    }
+
+    #endif // /GL_ARB_vertex_attrib_binding
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,69 @@
+/*
+ * GLSharedVertexArray.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_SHARED_VERTEX_ARRAY_H
+#define LLGL_GL_SHARED_VERTEX_ARRAY_H
+
+
+#include "GLVertexArrayFormat.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+struct VertexAttribute;
+class GLStateManager;
+
+/*
+Vertex array that shares its VAO with all other vertex arrays of the same vertex format (GL_ARB_vertex_attrib_binding).
+Only the vertex buffers of this array are attached to the shared VAO when it is bound,
+so switching between vertex arrays of the same format does not switch the VAO.
+*/
+class GLSharedVertexArray
+{
+
+    public:
+
+        GLSharedVertexArray() = default;
+        ~GLSharedVertexArray();
+
+        GLSharedVertexArray(const GLSharedVertexArray&) = delete;
+        GLSharedVertexArray& operator = (const GLSharedVertexArray&) = delete;
+
+        // Builds the specified attribute that is read from the specified vertex buffer.
+        void BuildVertexAttribute(GLuint bufferID, const VertexAttribute& attribute);
+
+        // Finalizes building vertex attributes and acquires the shared VAO for this vertex format.
+        void Finalize();
+
+        // Binds the shared VAO and attaches the vertex buffers of this array. Does nothing if this vertex array has not been finalized yet.
+        void Bind(GLStateManager& stateMngr) const;
+
+    private:
+
+        std::vector<GLVertexAttribFormat>   attribFormats_;
+        std::vector<GLuint>                 bindingDivisors_;
+
+        std::vector<GLuint>                 buffers_;
+        std::vector<GLintptr>               offsets_;
+        std::vector<GLsizei>                strides_;
+
+        GLVertexArrayFormatSPtr             format_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
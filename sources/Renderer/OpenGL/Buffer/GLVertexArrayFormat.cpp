@@ -0,0 +1,117 @@
+/*
+ * GLVertexArrayFormat.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLVertexArrayFormat.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionRegistry.h"
+#include "../RenderState/GLStateManager.h"
+#include "../GLTypes.h"
+#include "../GLCore.h"
+#include "../../../Core/Exception.h"
+#include "../../../Core/HelperMacros.h"
+
+
+namespace LLGL
+{
+
+
+GLVertexArrayFormat::GLVertexArrayFormat(const std::vector<GLVertexAttribFormat>& attribFormats, const std::vector<GLuint>& bindingDivisors) :
+    attribFormats_   { attribFormats   },
+    bindingDivisors_ { bindingDivisors }
+{
+}
+
+GLVertexArrayFormat::GLVertexArrayFormat(const GLVertexArrayFormat& rhs) :
+    attribFormats_   { rhs.attribFormats_   },
+    bindingDivisors_ { rhs.bindingDivisors_ }
+{
+}
+
+GLVertexArrayFormat::~GLVertexArrayFormat()
+{
+    if (id_ != 0)
+    {
+        glDeleteVertexArrays(1, &id_);
+        GLStateManager::Get().NotifyVertexArrayRelease(id_);
+    }
+}
+
+void GLVertexArrayFormat::BuildVertexArray()
+{
+    if (id_ != 0)
+        return;
+
+    #ifdef GL_ARB_vertex_attrib_binding
+
+    if (!HasExtension(GLExt::ARB_vertex_attrib_binding))
+        ThrowNotSupportedExcept(__FUNCTION__, "OpenGL extension 'GL_ARB_vertex_attrib_binding'");
+
+    glGenVertexArrays(1, &id_);
+
+    GLStateManager::Get().BindVertexArray(id_);
+    {
+        /* Specify format of each vertex attribute and the binding point it reads from */
+        for (const auto& attrib : attribFormats_)
+        {
+            const auto& formatAttribs = GetFormatAttribs(attrib.format);
+            if ((formatAttribs.flags & FormatFlags::SupportsVertex) == 0)
+                ThrowNotSupportedExcept(__FUNCTION__, "specified vertex attribute");
+
+            auto dataType   = GLTypes::Map(formatAttribs.dataType);
+            auto components = static_cast<GLint>(formatAttribs.components);
+
+            glEnableVertexAttribArray(attrib.location);
+
+            if ((formatAttribs.flags & FormatFlags::IsNormalized) == 0 && !IsFloatFormat(attrib.format))
+                glVertexAttribIFormat(attrib.location, components, dataType, attrib.relativeOffset);
+            else
+                glVertexAttribFormat(attrib.location, components, dataType, GLBoolean((formatAttribs.flags & FormatFlags::IsNormalized) != 0), attrib.relativeOffset);
+
+            glVertexAttribBinding(attrib.location, attrib.bindingIndex);
+        }
+
+        /* Set instance divisor of each binding point */
+        for (std::size_t i = 0; i < bindingDivisors_.size(); ++i)
+            glVertexBindingDivisor(static_cast<GLuint>(i), bindingDivisors_[i]);
+    }
+    GLStateManager::Get().BindVertexArray(0);
+
+    #else
+
+    ThrowNotSupportedExcept(__FUNCTION__, "OpenGL extension 'GL_ARB_vertex_attrib_binding'");
+
+    #endif // /GL_ARB_vertex_attrib_binding
+}
+
+int GLVertexArrayFormat::CompareSWO(const GLVertexArrayFormat& lhs, const GLVertexArrayFormat& rhs)
+{
+    /* Compare number of attributes and bindings first; if equal we can use one of the arrays only */
+    LLGL_COMPARE_MEMBER_SWO( attribFormats_.size() );
+    LLGL_COMPARE_MEMBER_SWO( bindingDivisors_.size() );
+
+    for (std::size_t i = 0, n = lhs.attribFormats_.size(); i < n; ++i)
+    {
+        LLGL_COMPARE_MEMBER_SWO( attribFormats_[i].location       );
+        LLGL_COMPARE_MEMBER_SWO( attribFormats_[i].bindingIndex   );
+        LLGL_COMPARE_MEMBER_SWO( attribFormats_[i].format         );
+        LLGL_COMPARE_MEMBER_SWO( attribFormats_[i].relativeOffset );
+    }
+
+    for (std::size_t i = 0, n = lhs.bindingDivisors_.size(); i < n; ++i)
+    {
+        LLGL_COMPARE_MEMBER_SWO( bindingDivisors_[i] );
+    }
+
+    return 0;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,83 @@
+/*
+ * GLVertexArrayFormat.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_VERTEX_ARRAY_FORMAT_H
+#define LLGL_GL_VERTEX_ARRAY_FORMAT_H
+
+
+#include <LLGL/Format.h>
+#include "../OpenGL.h"
+#include <vector>
+#include <memory>
+
+
+namespace LLGL
+{
+
+
+class GLVertexArrayFormat;
+
+using GLVertexArrayFormatSPtr = std::shared_ptr<GLVertexArrayFormat>;
+
+// Format of a single vertex attribute within a vertex array format.
+struct GLVertexAttribFormat
+{
+    GLuint  location;
+    GLuint  bindingIndex;
+    Format  format;
+    GLuint  relativeOffset;
+};
+
+/*
+Vertex-array-object (VAO) that only stores the vertex attribute formats and the instance divisors of its vertex buffer binding points (GL_ARB_vertex_attrib_binding).
+The vertex buffers are attached separately, so a VAO is shared between all vertex buffers with the same vertex format (see GLStatePool).
+The VAO is not created before 'BuildVertexArray' is called, so temporary instances to compare vertex formats don't allocate any GL objects.
+*/
+class GLVertexArrayFormat
+{
+
+    public:
+
+        GLVertexArrayFormat(const std::vector<GLVertexAttribFormat>& attribFormats, const std::vector<GLuint>& bindingDivisors);
+
+        // Copies only the vertex format but not the VAO.
+        GLVertexArrayFormat(const GLVertexArrayFormat& rhs);
+        GLVertexArrayFormat& operator = (const GLVertexArrayFormat&) = delete;
+
+        ~GLVertexArrayFormat();
+
+        // Creates the VAO and specifies its vertex format, unless this has already been done.
+        void BuildVertexArray();
+
+        // Returns the ID of the VAO.
+        inline GLuint GetID() const
+        {
+            return id_;
+        }
+
+    public:
+
+        // Returns a signed integer of the strict-weak-order (SWO) comparison, and 0 on equality.
+        static int CompareSWO(const GLVertexArrayFormat& lhs, const GLVertexArrayFormat& rhs);
+
+    private:
+
+        std::vector<GLVertexAttribFormat>   attribFormats_;
+        std::vector<GLuint>                 bindingDivisors_;
+        GLuint                              id_                 = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
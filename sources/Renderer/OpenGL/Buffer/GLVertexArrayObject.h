@@ -24,9 +24,15 @@ class GLVertexArrayObject
 
     public:
 
-        GLVertexArrayObject();
+        GLVertexArrayObject() = default;
         ~GLVertexArrayObject();
 
+        GLVertexArrayObject(const GLVertexArrayObject&) = delete;
+        GLVertexArrayObject& operator = (const GLVertexArrayObject&) = delete;
+
+        // Creates the hardware VAO if it has not been created yet.
+        void Create();
+
         // Builds the specified attribute using a 'glVertexAttrib*Pointer' function.
         void BuildVertexAttribute(const VertexAttribute& attribute);
 
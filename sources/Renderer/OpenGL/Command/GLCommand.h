@@ -13,6 +13,7 @@
 #include <LLGL/TextureFlags.h>
 #include <LLGL/Types.h>
 #include "../RenderState/GLState.h"
+#include "../Shader/GLShaderUniform.h"
 #include "../GLProfile.h"
 #include <cstdint>
 
@@ -32,6 +33,7 @@ class GLRenderTarget;
 class GLRenderPass;
 class GLDeferredCommandBuffer;
 class GL2XVertexArray;
+class GLSharedVertexArray;
 class GL2XSampler;
 
 
@@ -175,6 +177,11 @@ struct GLCmdBindGL2XVertexArray
     const GL2XVertexArray* vertexArrayGL2X;
 };
 
+struct GLCmdBindSharedVertexArray
+{
+    const GLSharedVertexArray* vertexArray;
+};
+
 struct GLCmdBindElementArrayBufferToVAO
 {
     GLuint id;
@@ -243,11 +250,11 @@ struct GLCmdSetStencilRef
 
 struct GLCmdSetUniforms
 {
-    GLuint      program;
-    GLint       location;
-    GLsizei     count;
-    GLsizeiptr  size;
-//  GLuint      buffer[size];
+    GLUniformSetter setter;
+    GLint           location;
+    GLsizei         count;
+    GLsizeiptr      size;
+//  GLuint          buffer[size];
 };
 
 struct GLCmdBeginQuery
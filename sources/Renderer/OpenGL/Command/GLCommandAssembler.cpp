@@ -37,18 +37,145 @@
 #include "../RenderState/GLRenderPass.h"
 #include "../RenderState/GLQueryHeap.h"
 
+#include "../GLProfile.h"
+
 #include <LLGL/StaticLimits.h>
 #include <algorithm>
+#include <string.h>
 
 
 namespace LLGL
 {
 
 
-static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITCompiler& compiler)
+// Declare index of variadic argument of entry point
+static const JITVarArg g_stateMngrArg{ 0 };
+
+// Binding of a GL object that is known at assembly time.
+struct GLKnownBinding
+{
+    bool    known   = false;
+    GLuint  id      = 0;
+};
+
+/*
+GL states that are known at the current position of the assembled command stream.
+Nothing is known at the beginning of a JIT program, since it can be executed with any previous GL state.
+The state pointers refer to the respective command data, which lives as long as the command buffer.
+*/
+struct GLAssemblerState
+{
+    const GLViewport*           viewport                = nullptr;
+    const GLDepthRange*         depthRange              = nullptr;
+    const GLScissor*            scissor                 = nullptr;
+    const GLCmdSetStencilRef*   stencilRef              = nullptr;
+    const GLfloat*              blendColor              = nullptr;
+    GLKnownBinding              vertexArray;
+    GLKnownBinding              drawIndirectBuffer;
+    GLKnownBinding              dispatchIndirectBuffer;
+    long                        dirtyFlags              = 0; // States that have been set with direct GL calls, but the state manager has not been notified about yet (see GLStateManager::DirectStateFlags).
+};
+
+// Returns true if the specified command can change any of the known states, or read any of the states the state manager has not been notified about yet.
+static bool IsStateBarrierGLOpcode(const GLOpcode opcode)
 {
-    /* Declare index of variadic argument of entry point */
-    static const JITVarArg g_stateMngrArg{ 0 };
+    switch (opcode)
+    {
+        /* Commands whose states are tracked by the assembler */
+        case GLOpcodeViewport:
+        case GLOpcodeViewportArray:
+        case GLOpcodeScissor:
+        case GLOpcodeScissorArray:
+        case GLOpcodeBindVertexArray:
+        case GLOpcodeSetBlendColor:
+        case GLOpcodeSetStencilRef:
+        case GLOpcodeDrawArraysIndirect:
+        case GLOpcodeDrawElementsIndirect:
+        case GLOpcodeMultiDrawArraysIndirect:
+        case GLOpcodeMultiDrawElementsIndirect:
+        case GLOpcodeDispatchComputeIndirect:
+
+        /* Commands that only bind resources to indexed slots */
+        case GLOpcodeBindElementArrayBufferToVAO:
+        case GLOpcodeBindBufferBase:
+        case GLOpcodeBindBuffersBase:
+        case GLOpcodeBindResourceHeap:
+        case GLOpcodeBindTexture:
+        case GLOpcodeBindImageTexture:
+        case GLOpcodeBindSampler:
+        case GLOpcodeBindGL2XSampler:
+        case GLOpcodeUnbindResources:
+
+        /* Commands that don't go through the state manager */
+        case GLOpcodeClearColor:
+        case GLOpcodeClearDepth:
+        case GLOpcodeClearStencil:
+        case GLOpcodeBeginTransformFeedback:
+        case GLOpcodeBeginTransformFeedbackNV:
+        case GLOpcodeEndTransformFeedback:
+        case GLOpcodeEndTransformFeedbackNV:
+        case GLOpcodeSetUniforms:
+        case GLOpcodeBeginQuery:
+        case GLOpcodeEndQuery:
+        case GLOpcodeBeginConditionalRender:
+        case GLOpcodeEndConditionalRender:
+        case GLOpcodeDrawArrays:
+        case GLOpcodeDrawArraysInstanced:
+        case GLOpcodeDrawArraysInstancedBaseInstance:
+        case GLOpcodeDrawElements:
+        case GLOpcodeDrawElementsBaseVertex:
+        case GLOpcodeDrawElementsInstanced:
+        case GLOpcodeDrawElementsInstancedBaseVertex:
+        case GLOpcodeDrawElementsInstancedBaseVertexBaseInstance:
+        case GLOpcodeDispatchCompute:
+        case GLOpcodePushDebugGroup:
+        case GLOpcodePopDebugGroup:
+            return false;
+
+        default:
+            return true;
+    }
+}
+
+// Notifies the state manager about all states that have been set with direct GL calls since the last notification.
+static void AssembleDirectStateChanges(GLAssemblerState& state, JITCompiler& compiler)
+{
+    if (state.dirtyFlags != 0)
+    {
+        compiler.CallMember(
+            &GLStateManager::NotifyDirectStateChanges,
+            g_stateMngrArg,
+            state.dirtyFlags,
+            state.drawIndirectBuffer.id,
+            state.dispatchIndirectBuffer.id,
+            state.blendColor
+        );
+        state.dirtyFlags = 0;
+    }
+}
+
+// Binds the specified indirect argument buffer with a direct GL call, unless it is known to be bound already.
+static void AssembleBindIndirectBuffer(GLBufferTarget target, GLuint buffer, GLAssemblerState& state, JITCompiler& compiler)
+{
+    const bool isDrawIndirect = (target == GLBufferTarget::DRAW_INDIRECT_BUFFER);
+    auto& binding = (isDrawIndirect ? state.drawIndirectBuffer : state.dispatchIndirectBuffer);
+    if (!binding.known || binding.id != buffer)
+    {
+        compiler.Call(glBindBuffer, GLStateManager::ToGLBufferTarget(target), buffer);
+        binding.known   = true;
+        binding.id      = buffer;
+        state.dirtyFlags |= (isDrawIndirect ? GLStateManager::DirectStateFlags::DrawIndirectBuffer : GLStateManager::DirectStateFlags::DispatchIndirectBuffer);
+    }
+}
+
+static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, GLAssemblerState& state, JITCompiler& compiler)
+{
+    /* Notify state manager before commands that might access it, and forget all known states since they might be changed */
+    if (IsStateBarrierGLOpcode(opcode))
+    {
+        AssembleDirectStateChanges(state, compiler);
+        state = GLAssemblerState{};
+    }
 
     /* Generate native CPU opcodes for emulated GLOpcode */
     switch (opcode)
@@ -122,11 +249,17 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
         case GLOpcodeViewport:
         {
             auto cmd = reinterpret_cast<const GLCmdViewport*>(pc);
+            if (state.viewport == nullptr || ::memcmp(state.viewport, &(cmd->viewport), sizeof(GLViewport)) != 0)
             {
+                /* Viewport must go through the state manager, since it might be adjusted to the render target at runtime */
                 compiler.Call(::memcpy, JITStackPtr{ 0 }, &(cmd->viewport), sizeof(GLViewport));
                 compiler.CallMember(&GLStateManager::SetViewport, g_stateMngrArg, JITStackPtr{ 0 });
-                compiler.Call(::memcpy, JITStackPtr{ 0 }, &(cmd->depthRange), sizeof(GLDepthRange));
-                compiler.CallMember(&GLStateManager::SetDepthRange, g_stateMngrArg, JITStackPtr{ 0 });
+                state.viewport = &(cmd->viewport);
+            }
+            if (state.depthRange == nullptr || ::memcmp(state.depthRange, &(cmd->depthRange), sizeof(GLDepthRange)) != 0)
+            {
+                compiler.Call(GLProfile::DepthRange, cmd->depthRange.minDepth, cmd->depthRange.maxDepth);
+                state.depthRange = &(cmd->depthRange);
             }
             return sizeof(*cmd);
         }
@@ -140,14 +273,18 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
                 compiler.Call(::memcpy, JITStackPtr{ 0 }, cmdData + sizeof(GLViewport)*cmd->count, sizeof(GLDepthRange));
                 compiler.CallMember(&GLStateManager::SetDepthRangeArray, g_stateMngrArg, cmd->first, cmd->count, JITStackPtr{ 0 });
             }
+            state.viewport      = nullptr;
+            state.depthRange    = nullptr;
             return (sizeof(*cmd) + sizeof(GLViewport)*cmd->count + sizeof(GLDepthRange)*cmd->count);
         }
         case GLOpcodeScissor:
         {
             auto cmd = reinterpret_cast<const GLCmdScissor*>(pc);
+            if (state.scissor == nullptr || ::memcmp(state.scissor, &(cmd->scissor), sizeof(GLScissor)) != 0)
             {
                 compiler.Call(::memcpy, JITStackPtr{ 0 }, &(cmd->scissor), sizeof(GLScissor));
                 compiler.CallMember(&GLStateManager::SetScissor, g_stateMngrArg, JITStackPtr{ 0 });
+                state.scissor = &(cmd->scissor);
             }
             return sizeof(*cmd);
         }
@@ -159,6 +296,7 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
                 compiler.Call(::memcpy, JITStackPtr{ 0 }, cmdData, sizeof(GLScissor)*cmd->count);
                 compiler.CallMember(&GLStateManager::SetScissorArray, g_stateMngrArg, cmd->first, cmd->count, JITStackPtr{ 0 });
             }
+            state.scissor = nullptr;
             return (sizeof(*cmd) + sizeof(GLScissor)*cmd->count);
         }
         case GLOpcodeClearColor:
@@ -194,7 +332,12 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
         case GLOpcodeBindVertexArray:
         {
             auto cmd = reinterpret_cast<const GLCmdBindVertexArray*>(pc);
-            compiler.CallMember(&GLStateManager::BindVertexArray, g_stateMngrArg, cmd->vao);
+            if (!state.vertexArray.known || state.vertexArray.id != cmd->vao)
+            {
+                compiler.CallMember(&GLStateManager::BindVertexArray, g_stateMngrArg, cmd->vao);
+                state.vertexArray.known = true;
+                state.vertexArray.id    = cmd->vao;
+            }
             return sizeof(*cmd);
         }
         case GLOpcodeBindGL2XVertexArray:
@@ -203,6 +346,12 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
             compiler.CallMember(&GL2XVertexArray::Bind, cmd->vertexArrayGL2X, g_stateMngrArg);
             return sizeof(*cmd);
         }
+        case GLOpcodeBindSharedVertexArray:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBindSharedVertexArray*>(pc);
+            compiler.CallMember(&GLSharedVertexArray::Bind, cmd->vertexArray, g_stateMngrArg);
+            return sizeof(*cmd);
+        }
         case GLOpcodeBindElementArrayBufferToVAO:
         {
             auto cmd = reinterpret_cast<const GLCmdBindElementArrayBufferToVAO*>(pc);
@@ -271,19 +420,28 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
         case GLOpcodeSetBlendColor:
         {
             auto cmd = reinterpret_cast<const GLCmdSetBlendColor*>(pc);
-            compiler.CallMember(&GLStateManager::SetBlendColor, g_stateMngrArg, cmd->color);
+            if (state.blendColor == nullptr || ::memcmp(state.blendColor, cmd->color, sizeof(cmd->color)) != 0)
+            {
+                compiler.Call(glBlendColor, cmd->color[0], cmd->color[1], cmd->color[2], cmd->color[3]);
+                state.blendColor = cmd->color;
+                state.dirtyFlags |= GLStateManager::DirectStateFlags::BlendColor;
+            }
             return sizeof(*cmd);
         }
         case GLOpcodeSetStencilRef:
         {
             auto cmd = reinterpret_cast<const GLCmdSetStencilRef*>(pc);
-            compiler.CallMember(&GLStateManager::SetStencilRef, g_stateMngrArg, cmd->ref, cmd->face);
+            if (state.stencilRef == nullptr || state.stencilRef->ref != cmd->ref || state.stencilRef->face != cmd->face)
+            {
+                compiler.CallMember(&GLStateManager::SetStencilRef, g_stateMngrArg, cmd->ref, cmd->face);
+                state.stencilRef = cmd;
+            }
             return sizeof(*cmd);
         }
         case GLOpcodeSetUniforms:
         {
             auto cmd = reinterpret_cast<const GLCmdSetUniforms*>(pc);
-            compiler.Call(GLSetUniformsByLocation, cmd->program, cmd->location, cmd->count, (cmd + 1));
+            compiler.Call(cmd->setter, cmd->location, cmd->count, (cmd + 1));
             return (sizeof(*cmd) + cmd->size);
         }
         case GLOpcodeBeginQuery:
@@ -333,7 +491,7 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
         {
             //TODO: generate loop in ASM
             auto cmd = reinterpret_cast<const GLCmdDrawArraysIndirect*>(pc);
-            compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::DRAW_INDIRECT_BUFFER, cmd->id);
+            AssembleBindIndirectBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, cmd->id, state, compiler);
             GLintptr offset = cmd->indirect;
             for (std::uint32_t i = 0; i < cmd->numCommands; ++i)
             {
@@ -379,7 +537,7 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
             auto cmd = reinterpret_cast<const GLCmdDrawElementsIndirect*>(pc);
             {
                 //TODO: generate loop in ASM
-                compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::DRAW_INDIRECT_BUFFER, cmd->id);
+                AssembleBindIndirectBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, cmd->id, state, compiler);
                 GLintptr offset = cmd->indirect;
                 for (std::uint32_t i = 0; i < cmd->numCommands; ++i)
                 {
@@ -393,14 +551,14 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
         case GLOpcodeMultiDrawArraysIndirect:
         {
             auto cmd = reinterpret_cast<const GLCmdMultiDrawArraysIndirect*>(pc);
-            compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::DRAW_INDIRECT_BUFFER, cmd->id);
+            AssembleBindIndirectBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, cmd->id, state, compiler);
             compiler.Call(glMultiDrawArraysIndirect, cmd->mode, cmd->indirect, cmd->drawcount, cmd->stride);
             return sizeof(*cmd);
         }
         case GLOpcodeMultiDrawElementsIndirect:
         {
             auto cmd = reinterpret_cast<const GLCmdMultiDrawElementsIndirect*>(pc);
-            compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::DRAW_INDIRECT_BUFFER, cmd->id);
+            AssembleBindIndirectBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, cmd->id, state, compiler);
             compiler.Call(glMultiDrawElementsIndirect, cmd->mode, cmd->type, cmd->indirect, cmd->drawcount, cmd->stride);
             return sizeof(*cmd);
         }
@@ -415,7 +573,7 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
         case GLOpcodeDispatchComputeIndirect:
         {
             auto cmd = reinterpret_cast<const GLCmdDispatchComputeIndirect*>(pc);
-            compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::DISPATCH_INDIRECT_BUFFER, cmd->id);
+            AssembleBindIndirectBuffer(GLBufferTarget::DISPATCH_INDIRECT_BUFFER, cmd->id, state, compiler);
             compiler.Call(glDispatchComputeIndirect, cmd->indirect);
             return sizeof(*cmd);
         }
@@ -514,6 +672,8 @@ std::unique_ptr<JITProgram> AssembleGLDeferredCommandBuffer(const GLDeferredComm
             compiler->StackAlloc(stackSize);
 
         /* Assemble GL commands into JIT program */
+        GLAssemblerState state;
+
         compiler->Begin();
 
         while (pc < pcEnd)
@@ -523,9 +683,12 @@ std::unique_ptr<JITProgram> AssembleGLDeferredCommandBuffer(const GLDeferredComm
             pc += sizeof(GLOpcode);
 
             /* Execute command and increment program counter */
-            pc += AssembleGLCommand(opcode, pc, *compiler);
+            pc += AssembleGLCommand(opcode, pc, state, *compiler);
         }
 
+        /* Update states in the state manager that have been set with direct GL calls */
+        AssembleDirectStateChanges(state, *compiler);
+
         compiler->End();
 
         /* Build final program */
@@ -210,6 +210,12 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
             cmd->vertexArrayGL2X->Bind(stateMngr);
             return sizeof(*cmd);
         }
+        case GLOpcodeBindSharedVertexArray:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBindSharedVertexArray*>(pc);
+            cmd->vertexArray->Bind(stateMngr);
+            return sizeof(*cmd);
+        }
         case GLOpcodeBindElementArrayBufferToVAO:
         {
             auto cmd = reinterpret_cast<const GLCmdBindElementArrayBufferToVAO*>(pc);
@@ -287,7 +293,7 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
         case GLOpcodeSetUniforms:
         {
             auto cmd = reinterpret_cast<const GLCmdSetUniforms*>(pc);
-            GLSetUniformsByLocation(cmd->program, cmd->location, cmd->count, (cmd + 1));
+            cmd->setter(cmd->location, cmd->count, (cmd + 1));
             return (sizeof(*cmd) + cmd->size);
         }
         case GLOpcodeBeginQuery:
@@ -505,6 +511,7 @@ static void ExecuteGLCommandsEmulated(const std::vector<std::uint8_t>& rawBuffer
     auto pcEnd  = rawBuffer.data() + rawBuffer.size();
 
     GLOpcode opcode;
+    GLStateManager* activeStateMngr = &stateMngr;
 
     while (pc < pcEnd)
     {
@@ -513,7 +520,11 @@ static void ExecuteGLCommandsEmulated(const std::vector<std::uint8_t>& rawBuffer
         pc += sizeof(GLOpcode);
 
         /* Execute command and increment program counter */
-        pc += ExecuteGLCommand(opcode, pc, stateMngr);
+        pc += ExecuteGLCommand(opcode, pc, *activeStateMngr);
+
+        /* Binding a render context makes its GL context current, which has its own state manager */
+        if (opcode == GLOpcodeBindRenderPass)
+            activeStateMngr = &GLStateManager::Get();
     }
 }
 
@@ -530,7 +541,19 @@ static void ExecuteGLCommandsNatively(const JITProgram& exec, GLStateManager& st
 void ExecuteGLDeferredCommandBuffer(const GLDeferredCommandBuffer& cmdBuffer, GLStateManager& stateMngr)
 {
     #ifdef LLGL_ENABLE_JIT_COMPILER
-    if (auto exec = cmdBuffer.GetExecutable().get())
+    auto exec = cmdBuffer.GetExecutable().get();
+
+    /* Native code cannot switch state managers, so only use it if the render context of this command buffer is already current */
+    if (exec != nullptr)
+    {
+        if (auto renderContext = cmdBuffer.GetRenderContext())
+        {
+            if (renderContext->GetGLContext() != GLContext::Active())
+                exec = nullptr;
+        }
+    }
+
+    if (exec != nullptr)
     {
         /* Execute GL commands with native executable */
         ExecuteGLCommandsNatively(*exec, stateMngr);
@@ -40,6 +40,7 @@ enum GLOpcode : std::uint8_t
     GLOpcodeClearBuffers,
     GLOpcodeBindVertexArray,
     GLOpcodeBindGL2XVertexArray,
+    GLOpcodeBindSharedVertexArray,
     GLOpcodeBindElementArrayBufferToVAO,
     GLOpcodeBindBufferBase,
     GLOpcodeBindBuffersBase,
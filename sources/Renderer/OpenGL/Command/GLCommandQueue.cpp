@@ -8,6 +8,7 @@
 #include "GLCommandQueue.h"
 #include "GLDeferredCommandBuffer.h"
 #include "GLCommandExecutor.h"
+#include "../GLUploadContext.h"
 #include "../Ext/GLExtensions.h"
 #include "../RenderState/GLFence.h"
 #include "../RenderState/GLQueryHeap.h"
@@ -15,17 +16,13 @@
 #include "../../CheckedCast.h"
 #include "../Ext/GLExtensionRegistry.h"
 #include <algorithm>
+#include <vector>
 
 
 namespace LLGL
 {
 
 
-GLCommandQueue::GLCommandQueue(const std::shared_ptr<GLStateManager>& stateManager) :
-    stateMngr_ { stateManager }
-{
-}
-
 /* ----- Command Buffers ----- */
 
 void GLCommandQueue::Submit(CommandBuffer& commandBuffer)
@@ -37,8 +34,12 @@ void GLCommandQueue::Submit(CommandBuffer& commandBuffer)
     auto& cmdBufferGL = LLGL_CAST(const GLCommandBuffer&, commandBuffer);
     if (!cmdBufferGL.IsImmediateCmdBuffer())
     {
+        /* Wait for resources that have been uploaded from other threads since the command buffer was recorded */
+        if (auto uploadContext = GLUploadContext::Get())
+            uploadContext->Synchronize();
+
         auto& deferredCmdBufferGL = LLGL_CAST(const GLDeferredCommandBuffer&, cmdBufferGL);
-        ExecuteGLDeferredCommandBuffer(deferredCmdBufferGL, *stateMngr_);
+        ExecuteGLDeferredCommandBuffer(deferredCmdBufferGL, GLStateManager::Get());
     }
 }
 
@@ -151,6 +152,21 @@ static void QueryResultPipelineStatistics(GLQueryHeap& queryHeapGL, std::uint32_
     #endif // /GL_ARB_pipeline_statistics_query
 }
 
+static void QueryResultTimestamps(GLQueryHeap& queryHeapGL, std::uint32_t firstQuery, std::uint32_t numQueries, std::uint64_t* data)
+{
+    #ifdef GL_ARB_timer_query
+    /* Get elapsed time values from difference between start and end timestamps (in nanoseconds) */
+    const auto& idList = queryHeapGL.GetIDs();
+    for (std::uint32_t i = 0; i < numQueries; i += 2, ++data)
+    {
+        GLuint64 timestamps[2] = { 0, 0 };
+        glGetQueryObjectui64v(idList[firstQuery + i    ], GL_QUERY_RESULT, &timestamps[0]);
+        glGetQueryObjectui64v(idList[firstQuery + i + 1], GL_QUERY_RESULT, &timestamps[1]);
+        *data = (timestamps[1] - timestamps[0]);
+    }
+    #endif // /GL_ARB_timer_query
+}
+
 bool GLCommandQueue::QueryResult(
     QueryHeap&      queryHeap,
     std::uint32_t   firstQuery,
@@ -166,7 +182,24 @@ bool GLCommandQueue::QueryResult(
 
     if (AreQueryResultsAvailable(queryHeapGL, firstQuery, numQueries))
     {
-        if (dataSize == numQueries * sizeof(std::uint32_t))
+        if (queryHeapGL.HasTimestamps())
+        {
+            /* Each pair of timestamps is resolved into a single elapsed time value */
+            const auto numResults = numQueries / queryHeapGL.GetGroupSize();
+            if (dataSize == numResults * sizeof(std::uint64_t))
+                QueryResultTimestamps(queryHeapGL, firstQuery, numQueries, reinterpret_cast<std::uint64_t*>(data));
+            else if (dataSize == numResults * sizeof(std::uint32_t))
+            {
+                std::vector<std::uint64_t> results(numResults);
+                QueryResultTimestamps(queryHeapGL, firstQuery, numQueries, results.data());
+                auto dst = reinterpret_cast<std::uint32_t*>(data);
+                for (std::uint32_t i = 0; i < numResults; ++i)
+                    dst[i] = static_cast<std::uint32_t>(results[i]);
+            }
+            else
+                return false;
+        }
+        else if (dataSize == numQueries * sizeof(std::uint32_t))
             QueryResultUInt32(queryHeapGL, firstQuery, numQueries, reinterpret_cast<std::uint32_t*>(data));
         else if (dataSize == numQueries * sizeof(std::uint64_t))
             QueryResultUInt64(queryHeapGL, firstQuery, numQueries, reinterpret_cast<std::uint64_t*>(data));
@@ -17,15 +17,11 @@ namespace LLGL
 {
 
 
-class GLStateManager;
-
 class GLCommandQueue final : public CommandQueue
 {
 
     public:
 
-        GLCommandQueue(const std::shared_ptr<GLStateManager>& stateManager);
-
         /* ----- Command Buffers ----- */
 
         void Submit(CommandBuffer& commandBuffer) override;
@@ -47,10 +43,6 @@ class GLCommandQueue final : public CommandQueue
         bool WaitFence(Fence& fence, std::uint64_t timeout) override;
         void WaitIdle() override;
 
-    private:
-
-        std::shared_ptr<GLStateManager> stateMngr_;
-
 };
 
 
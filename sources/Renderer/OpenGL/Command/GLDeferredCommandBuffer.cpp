@@ -11,6 +11,7 @@
 
 #include "../../TextureUtils.h"
 #include "../GLRenderContext.h"
+#include "../GLUploadContext.h"
 #include "../GLTypes.h"
 #include "../GLCore.h"
 #include "../Ext/GLExtensions.h"
@@ -59,7 +60,11 @@ void GLDeferredCommandBuffer::Begin()
 {
     /* Reset internal command buffer */
     buffer_.clear();
-    boundShaderProgram_ = 0;
+    boundShaderProgram_ = nullptr;
+
+    /* Build pending vertex arrays of buffers that have been created on other threads, since their VAOs are recorded */
+    if (auto uploadContext = GLUploadContext::Get())
+        uploadContext->Synchronize();
 
     #ifdef LLGL_ENABLE_JIT_COMPILER
 
@@ -67,6 +72,8 @@ void GLDeferredCommandBuffer::Begin()
     executable_.reset();
     maxNumViewports_ = 0;
     maxNumScissors_  = 0;
+    renderContext_   = nullptr;
+    multiContext_    = false;
 
     #endif // /LLGL_ENABLE_JIT_COMPILER
 }
@@ -75,8 +82,11 @@ void GLDeferredCommandBuffer::End()
 {
     #ifdef LLGL_ENABLE_JIT_COMPILER
 
-    /* Generate native assembly only if command buffer will be submitted multiple times */
-    if ((GetFlags() & CommandBufferFlags::MultiSubmit) != 0)
+    /*
+    Generate native assembly only if command buffer will be submitted multiple times.
+    Native code is bound to a single state manager, so command buffers that switch between GL contexts are always emulated.
+    */
+    if ((GetFlags() & CommandBufferFlags::MultiSubmit) != 0 && !multiContext_)
         executable_ = AssembleGLDeferredCommandBuffer(*this);
 
     #endif // /LLGL_ENABLE_JIT_COMPILER
@@ -383,6 +393,10 @@ void GLDeferredCommandBuffer::ClearAttachments(std::uint32_t numAttachments, con
 
 void GLDeferredCommandBuffer::SetVertexBuffer(Buffer& buffer)
 {
+    /* Vertex arrays of buffers that have been created on other threads are built on the next synchronization */
+    if (auto uploadContext = GLUploadContext::Get())
+        uploadContext->Synchronize();
+
     if ((buffer.GetBindFlags() & BindFlags::VertexBuffer) != 0)
     {
         auto& bufferWithVAO = LLGL_CAST(const GLBufferWithVAO&, buffer);
@@ -394,6 +408,12 @@ void GLDeferredCommandBuffer::SetVertexBuffer(Buffer& buffer)
         }
         else
         #endif // /LLGL_GL_ENABLE_OPENGL2X
+        if (HasExtension(GLExt::ARB_vertex_attrib_binding))
+        {
+            auto cmd = AllocCommand<GLCmdBindSharedVertexArray>(GLOpcodeBindSharedVertexArray);
+            cmd->vertexArray = &(bufferWithVAO.GetSharedVertexArray());
+        }
+        else
         {
             auto cmd = AllocCommand<GLCmdBindVertexArray>(GLOpcodeBindVertexArray);
             cmd->vao = bufferWithVAO.GetVaoID();
@@ -403,6 +423,10 @@ void GLDeferredCommandBuffer::SetVertexBuffer(Buffer& buffer)
 
 void GLDeferredCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 {
+    /* Vertex arrays of buffers that have been created on other threads are built on the next synchronization */
+    if (auto uploadContext = GLUploadContext::Get())
+        uploadContext->Synchronize();
+
     if ((bufferArray.GetBindFlags() & BindFlags::VertexBuffer) != 0)
     {
         auto& bufferArrayWithVAO = LLGL_CAST(const GLBufferArrayWithVAO&, bufferArray);
@@ -414,6 +438,12 @@ void GLDeferredCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
         }
         else
         #endif
+        if (HasExtension(GLExt::ARB_vertex_attrib_binding))
+        {
+            auto cmd = AllocCommand<GLCmdBindSharedVertexArray>(GLOpcodeBindSharedVertexArray);
+            cmd->vertexArray = &(bufferArrayWithVAO.GetSharedVertexArray());
+        }
+        else
         {
             auto cmd = AllocCommand<GLCmdBindVertexArray>(GLOpcodeBindVertexArray);
             cmd->vao = bufferArrayWithVAO.GetVaoID();
@@ -573,6 +603,20 @@ void GLDeferredCommandBuffer::BeginRenderPass(
         cmd->defaultClearValue  = clearValue_;
         ::memcpy(cmd + 1, clearValues, sizeof(ClearValue)*numClearValues);
     }
+
+    #ifdef LLGL_ENABLE_JIT_COMPILER
+
+    /* Track render contexts, since each of them has its own GL context and state manager */
+    if (renderTarget.IsRenderContext())
+    {
+        auto renderContextGL = LLGL_CAST(GLRenderContext*, &renderTarget);
+        if (renderContext_ == nullptr)
+            renderContext_ = renderContextGL;
+        else if (renderContext_ != renderContextGL)
+            multiContext_ = true;
+    }
+
+    #endif // /LLGL_ENABLE_JIT_COMPILER
 }
 
 void GLDeferredCommandBuffer::EndRenderPass()
@@ -588,7 +632,7 @@ void GLDeferredCommandBuffer::SetPipelineState(PipelineState& pipelineState)
     cmd->pipelineState = LLGL_CAST(GLPipelineState*, &pipelineState);
 
     /* Store draw mode, primitive mode, and shader program */
-    boundShaderProgram_ = cmd->pipelineState->GetShaderProgram()->GetID();
+    boundShaderProgram_ = cmd->pipelineState->GetShaderProgram();
 
     if (cmd->pipelineState->IsGraphicsPSO())
     {
@@ -636,10 +680,18 @@ void GLDeferredCommandBuffer::SetUniforms(
     if (dataSize == 0 || dataSize % 4 != 0)
         return;
 
+    /* Resolve uniform setter with the bound shader program, so no program introspection is required when the command is executed */
+    if (boundShaderProgram_ == nullptr)
+        return;
+
+    auto setter = boundShaderProgram_->GetUniformSetter(static_cast<GLint>(location));
+    if (setter == nullptr)
+        return;
+
     /* Allocate GL command and copy data buffer */
     auto cmd = AllocCommand<GLCmdSetUniforms>(GLOpcodeSetUniforms, dataSize);
     {
-        cmd->program    = boundShaderProgram_;
+        cmd->setter     = setter;
         cmd->location   = static_cast<GLint>(location);
         cmd->count      = static_cast<GLsizei>(count);
         cmd->size       = static_cast<GLsizeiptr>(dataSize);
@@ -34,6 +34,7 @@ class GLRenderContext;
 class GLStateManager;
 class GLRenderPass;
 class GL2XSampler;
+class GLShaderProgram;
 
 class GLDeferredCommandBuffer final : public GLCommandBuffer
 {
@@ -258,6 +259,12 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
             return maxNumViewports_;
         }
 
+        // Returns the render context this command buffer renders into, or null if there is none.
+        inline GLRenderContext* GetRenderContext() const
+        {
+            return renderContext_;
+        }
+
         // Returns the maximum number of scissors that are set in this command buffer.
         inline std::uint32_t GetMaxNumScissors() const
         {
@@ -286,7 +293,7 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
 
         GLRenderState               renderState_;
         GLClearValue                clearValue_;
-        GLuint                      boundShaderProgram_ = 0;
+        const GLShaderProgram*      boundShaderProgram_ = nullptr;
 
         long                        flags_              = 0;
         std::vector<std::uint8_t>   buffer_;
@@ -295,6 +302,8 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
         std::unique_ptr<JITProgram> executable_;
         std::uint32_t               maxNumViewports_    = 0;
         std::uint32_t               maxNumScissors_     = 0;
+        GLRenderContext*            renderContext_      = nullptr;  // Render context of the first render pass
+        bool                        multiContext_       = false;    // Command buffer renders into more than one render context
         #endif // /LLGL_ENABLE_JIT_COMPILER
 
 };
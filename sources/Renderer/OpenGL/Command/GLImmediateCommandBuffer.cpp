@@ -12,6 +12,7 @@
 
 #include "../../TextureUtils.h"
 #include "../GLRenderContext.h"
+#include "../GLUploadContext.h"
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionLoader.h"
 #include "../GLProfile.h"
@@ -53,7 +54,13 @@ GLImmediateCommandBuffer::GLImmediateCommandBuffer(const std::shared_ptr<GLState
 
 void GLImmediateCommandBuffer::Begin()
 {
-    // dummy
+    /* Continue with the state manager of the current GL context, since each context has its own state manager */
+    if (auto context = GLContext::Active())
+        stateMngr_ = context->GetStateManager();
+
+    /* Wait for resources that have been uploaded from other threads */
+    if (auto uploadContext = GLUploadContext::Get())
+        uploadContext->Synchronize();
 }
 
 void GLImmediateCommandBuffer::End()
@@ -299,6 +306,10 @@ void GLImmediateCommandBuffer::ClearAttachments(std::uint32_t numAttachments, co
 
 void GLImmediateCommandBuffer::SetVertexBuffer(Buffer& buffer)
 {
+    /* Vertex arrays of buffers that have been created on other threads are built on the next synchronization */
+    if (auto uploadContext = GLUploadContext::Get())
+        uploadContext->Synchronize();
+
     if ((buffer.GetBindFlags() & BindFlags::VertexBuffer) != 0)
     {
         /* Bind vertex buffer */
@@ -312,6 +323,12 @@ void GLImmediateCommandBuffer::SetVertexBuffer(Buffer& buffer)
         }
         else
         #endif // /LLGL_GL_ENABLE_OPENGL2X
+        if (HasExtension(GLExt::ARB_vertex_attrib_binding))
+        {
+            /* Bind shared VAO of the vertex format and attach vertex buffers */
+            vertexBufferGL.GetSharedVertexArray().Bind(*stateMngr_);
+        }
+        else
         {
             /* Bind vertex array with native VAO */
             stateMngr_->BindVertexArray(vertexBufferGL.GetVaoID());
@@ -321,6 +338,10 @@ void GLImmediateCommandBuffer::SetVertexBuffer(Buffer& buffer)
 
 void GLImmediateCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 {
+    /* Vertex arrays of buffers that have been created on other threads are built on the next synchronization */
+    if (auto uploadContext = GLUploadContext::Get())
+        uploadContext->Synchronize();
+
     if ((bufferArray.GetBindFlags() & BindFlags::VertexBuffer) != 0)
     {
         /* Bind vertex buffer */
@@ -334,6 +355,12 @@ void GLImmediateCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
         }
         else
         #endif // /LLGL_GL_ENABLE_OPENGL2X
+        if (HasExtension(GLExt::ARB_vertex_attrib_binding))
+        {
+            /* Bind shared VAO of the vertex format and attach vertex buffers */
+            vertexBufferArrayGL.GetSharedVertexArray().Bind(*stateMngr_);
+        }
+        else
         {
             /* Bind vertex array with native VAO */
             stateMngr_->BindVertexArray(vertexBufferArrayGL.GetVaoID());
@@ -480,6 +507,10 @@ void GLImmediateCommandBuffer::BeginRenderPass(
     const ClearValue*   clearValues)
 {
     stateMngr_->BindRenderPass(renderTarget, renderPass, numClearValues, clearValues, clearValue_);
+
+    /* Binding a render context makes its GL context current, which has its own state manager */
+    if (renderTarget.IsRenderContext())
+        stateMngr_ = LLGL_CAST(GLRenderContext&, renderTarget).GetStateManager();
 }
 
 void GLImmediateCommandBuffer::EndRenderPass()
@@ -494,6 +525,7 @@ void GLImmediateCommandBuffer::SetPipelineState(PipelineState& pipelineState)
     /* Bind graphics pipeline render states */
     auto& pipelineStateGL = LLGL_CAST(GLPipelineState&, pipelineState);
     pipelineStateGL.Bind(*stateMngr_);
+    boundShaderProgram_ = pipelineStateGL.GetShaderProgram();
 
     /* Store draw and primitive mode */
     if (pipelineStateGL.IsGraphicsPSO())
@@ -532,12 +564,12 @@ void GLImmediateCommandBuffer::SetUniforms(
     if (dataSize == 0 || dataSize % 4 != 0)
         return;
 
-    GLSetUniformsByLocation(
-        stateMngr_->GetBoundShaderProgram(),
-        static_cast<GLint>(location),
-        static_cast<GLsizei>(count),
-        data
-    );
+    /* Submit data with the setter that was resolved for this uniform location when the shader program was linked */
+    if (boundShaderProgram_ != nullptr)
+    {
+        if (auto setter = boundShaderProgram_->GetUniformSetter(static_cast<GLint>(location)))
+            setter(static_cast<GLint>(location), static_cast<GLsizei>(count), data);
+    }
 }
 
 /* ----- Queries ----- */
@@ -23,6 +23,7 @@ class GLRenderTarget;
 class GLRenderContext;
 class GLStateManager;
 class GLRenderPass;
+class GLShaderProgram;
 
 class GLImmediateCommandBuffer final : public GLCommandBuffer
 {
@@ -225,6 +226,7 @@ class GLImmediateCommandBuffer final : public GLCommandBuffer
         std::shared_ptr<GLStateManager> stateMngr_;
         GLRenderState                   renderState_;
         GLClearValue                    clearValue_;
+        const GLShaderProgram*          boundShaderProgram_ = nullptr;
 
 };
 
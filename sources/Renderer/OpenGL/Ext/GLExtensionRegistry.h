@@ -18,6 +18,7 @@ enum class GLExt
 {
     /* OpenGL core extensions (ARB) */
     ARB_base_instance = 0,              // GL 4.1
+    ARB_bindless_texture,
     ARB_clear_buffer_object,
     ARB_clear_texture,
     ARB_clip_control,
@@ -67,6 +68,7 @@ enum class GLExt
     ARB_transform_feedback3,
     ARB_uniform_buffer_object,
     ARB_vertex_array_object,
+    ARB_vertex_attrib_binding,          // GL 4.3
     ARB_vertex_buffer_object,
     ARB_vertex_shader,
     ARB_viewport_array,
@@ -75,6 +77,7 @@ enum class GLExt
 
     /* Khronos group extensions (KHR) */
     KHR_debug,
+    KHR_parallel_shader_compile,
 
     /* Multi-vendor extensions (EXT) */
     EXT_blend_color,
@@ -96,6 +99,10 @@ enum class GLExt
     NV_conditional_render,              //TODO: part of GL 3.0 core profile
     NV_conservative_raster,             // no procedures
     NV_transform_feedback,
+    NVX_gpu_memory_info,                // no procedures
+
+    /* AMD specific extensions (ATI) */
+    ATI_meminfo,                        // no procedures
 
     /* Intel sepcific extensions (INTEL) */
     INTEL_conservative_rasterization,   // no procedures
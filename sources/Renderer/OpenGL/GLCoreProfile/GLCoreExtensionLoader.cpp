@@ -28,6 +28,12 @@ bool LoadGLProc(T& procAddr, const char* procName)
     #if defined(_WIN32)
     procAddr = reinterpret_cast<T>(wglGetProcAddress(procName));
     #elif defined(__linux__)
+    #   ifdef LLGL_GL_ENABLE_EGL
+    /* Load procedures with EGL if a headless context is current */
+    if (eglGetCurrentContext() != EGL_NO_CONTEXT)
+        procAddr = reinterpret_cast<T>(eglGetProcAddress(procName));
+    else
+    #   endif
     procAddr = reinterpret_cast<T>(glXGetProcAddress(reinterpret_cast<const GLubyte*>(procName)));
     #else
     Log::PostReport(Log::ReportType::Error, "OS not supported for loading OpenGL extensions");
@@ -166,6 +172,7 @@ static bool Load_GL_ARB_framebuffer_object(bool usePlaceholder)
     LOAD_GLPROC( glBindRenderbuffer                    );
     LOAD_GLPROC( glRenderbufferStorage                 );
     LOAD_GLPROC( glRenderbufferStorageMultisample      );
+    LOAD_GLPROC( glGetRenderbufferParameteriv          );
     LOAD_GLPROC( glGenFramebuffers                     );
     LOAD_GLPROC( glDeleteFramebuffers                  );
     LOAD_GLPROC( glBindFramebuffer                     );
@@ -428,6 +435,14 @@ static bool Load_GL_ARB_sampler_objects(bool usePlaceholder)
     return true;
 }
 
+static bool Load_GL_ARB_bindless_texture(bool usePlaceholder)
+{
+    LOAD_GLPROC( glGetTextureHandleARB             );
+    LOAD_GLPROC( glMakeTextureHandleResidentARB    );
+    LOAD_GLPROC( glMakeTextureHandleNonResidentARB );
+    return true;
+}
+
 /* --- Other extensions --- */
 
 static bool Load_GL_ARB_occlusion_query(bool usePlaceholder)
@@ -533,6 +548,12 @@ static bool Load_GL_KHR_debug(bool usePlaceholder)
     return true;
 }
 
+static bool Load_GL_KHR_parallel_shader_compile(bool usePlaceholder)
+{
+    LOAD_GLPROC( glMaxShaderCompilerThreadsKHR );
+    return true;
+}
+
 static bool Load_GL_ARB_clip_control(bool usePlaceholder)
 {
     LOAD_GLPROC( glClipControl );
@@ -691,6 +712,16 @@ static bool Load_GL_ARB_multi_draw_indirect(bool usePlaceholder)
     return true;
 }
 
+static bool Load_GL_ARB_vertex_attrib_binding(bool usePlaceholder)
+{
+    LOAD_GLPROC( glBindVertexBuffer     );
+    LOAD_GLPROC( glVertexAttribFormat   );
+    LOAD_GLPROC( glVertexAttribIFormat  );
+    LOAD_GLPROC( glVertexAttribBinding  );
+    LOAD_GLPROC( glVertexBindingDivisor );
+    return true;
+}
+
 static bool Load_GL_ARB_get_texture_sub_image(bool usePlaceholder)
 {
     LOAD_GLPROC( glGetTextureSubImage           );
@@ -992,6 +1023,7 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
             "GL_ARB_vertex_shader",
             "GL_EXT_texture3D",
             "GL_EXT_copy_texture",
+            "GL_ARB_occlusion_query",
         };
         for (const auto& ext : coreProfileDefaultExtenions)
             extensions[ext] = false;
@@ -1004,6 +1036,7 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     /* Load hardware buffer extensions */
     LOAD_GLEXT( ARB_vertex_buffer_object         );
     LOAD_GLEXT( ARB_vertex_array_object          );
+    LOAD_GLEXT( ARB_vertex_attrib_binding        );
     LOAD_GLEXT( ARB_vertex_shader                );
     LOAD_GLEXT( ARB_framebuffer_object           );
     LOAD_GLEXT( ARB_uniform_buffer_object        );
@@ -1024,6 +1057,7 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     LOAD_GLEXT( ARB_compute_shader               );
     LOAD_GLEXT( ARB_get_program_binary           );
     LOAD_GLEXT( ARB_program_interface_query      );
+    LOAD_GLEXT( KHR_parallel_shader_compile      );
     LOAD_GLEXT( EXT_gpu_shader4                  );
 
     /* Load texture extensions */
@@ -1035,6 +1069,7 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     LOAD_GLEXT( ARB_texture_multisample          );
     LOAD_GLEXT( ARB_texture_view                 );
     LOAD_GLEXT( ARB_sampler_objects              );
+    LOAD_GLEXT( ARB_bindless_texture             );
 
     /* Load blending extensions */
     LOAD_GLEXT( EXT_blend_minmax                 );
@@ -1088,6 +1123,8 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     ENABLE_GLEXT( NV_conservative_raster           );
     ENABLE_GLEXT( INTEL_conservative_rasterization );
     ENABLE_GLEXT( ARB_pipeline_statistics_query    );
+    ENABLE_GLEXT( NVX_gpu_memory_info              );
+    ENABLE_GLEXT( ATI_meminfo                      );
 
     #undef LOAD_GLEXT
     #undef ENABLE_GLEXT
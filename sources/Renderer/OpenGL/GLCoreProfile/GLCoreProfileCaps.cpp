@@ -205,6 +205,7 @@ static void GLGetSupportedFeatures(RenderingFeatures& features)
     features.hasLogicOp                     = true;
     features.hasPipelineStatistics          = HasExtension(GLExt::ARB_pipeline_statistics_query);
     features.hasRenderCondition             = true;
+    features.hasBindlessResources           = (HasExtension(GLExt::ARB_bindless_texture) && HasExtension(GLExt::ARB_shader_storage_buffer_object));
 }
 
 static void GLGetFeatureLimits(const RenderingFeatures& features, RenderingLimits& limits)
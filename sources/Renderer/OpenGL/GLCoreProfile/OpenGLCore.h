@@ -21,6 +21,9 @@
 #   include <GL/gl.h>
 #   include <GL/glext.h>
 #   include <GL/glx.h>
+#   ifdef LLGL_GL_ENABLE_EGL
+#       include <EGL/egl.h>
+#   endif
 #elif defined LLGL_OS_MACOS
 #   include <OpenGL/gl3.h>
 #   include <OpenGL/glext.h>
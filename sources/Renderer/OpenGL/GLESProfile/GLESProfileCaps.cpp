@@ -161,6 +161,7 @@ static void GLGetSupportedFeatures(RenderingFeatures& features, GLint version)
     features.hasLogicOp                     = false;
     features.hasPipelineStatistics          = false;
     features.hasRenderCondition             = false;
+    features.hasBindlessResources           = false;
 }
 
 static void GLGetFeatureLimits(RenderingLimits& limits, GLint version)
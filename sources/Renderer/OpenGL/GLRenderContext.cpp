@@ -45,13 +45,15 @@ GLRenderContext::GLRenderContext(
     /* Setup swap interval (for v-sync) */
     OnSetVsync(desc.vsync);
 
+    /* Keep track of the new context, since the platform dependent creation already made it current */
+    GLContext::MakeCurrent(context_.get());
+
     /* Get state manager and notify about the current render context */
     stateMngr_ = context_->GetStateManager();
     stateMngr_->NotifyRenderTargetHeight(contextHeight_);
 
-    /* Initialize render states for the first time */
-    if (!sharedRenderContext)
-        InitRenderStates();
+    /* Initialize render states for the first time; each GL context has its own states */
+    InitRenderStates(*stateMngr_);
 }
 
 void GLRenderContext::Present()
@@ -94,6 +96,32 @@ bool GLRenderContext::GLMakeCurrent(GLRenderContext* renderContext)
         return GLContext::MakeCurrent(nullptr);
 }
 
+void GLRenderContext::InitRenderStates(GLStateManager& stateMngr)
+{
+    /* Initialize state manager */
+    stateMngr.Reset();
+
+    /* D3D11, Vulkan, and Metal always use a fixed restart index for strip topologies */
+    #ifdef LLGL_PRIMITIVE_RESTART_FIXED_INDEX
+    stateMngr.Enable(GLState::PRIMITIVE_RESTART_FIXED_INDEX);
+    #endif
+
+    #ifdef LLGL_OPENGL
+    /* D3D10+ has this per default */
+    stateMngr.Enable(GLState::TEXTURE_CUBE_MAP_SEAMLESS);
+    #endif
+
+    /* D3D10+ uses clock-wise vertex winding per default */
+    stateMngr.SetFrontFace(GL_CW);
+
+    /*
+    Set pixel storage to byte-alignment (default is word-alignment).
+    This is required so that texture formats like RGB (which is not word-aligned) can be used.
+    */
+    stateMngr.SetPixelStorePack(0, 0, 1);
+    stateMngr.SetPixelStoreUnpack(0, 0, 1);
+}
+
 
 /*
  * ======= Private: =======
@@ -121,32 +149,6 @@ bool GLRenderContext::OnSetVsync(const VsyncDescriptor& vsyncDesc)
     return context_->SetSwapInterval(swapInterval);
 }
 
-void GLRenderContext::InitRenderStates()
-{
-    /* Initialize state manager */
-    stateMngr_->Reset();
-
-    /* D3D11, Vulkan, and Metal always use a fixed restart index for strip topologies */
-    #ifdef LLGL_PRIMITIVE_RESTART_FIXED_INDEX
-    stateMngr_->Enable(GLState::PRIMITIVE_RESTART_FIXED_INDEX);
-    #endif
-
-    #ifdef LLGL_OPENGL
-    /* D3D10+ has this per default */
-    stateMngr_->Enable(GLState::TEXTURE_CUBE_MAP_SEAMLESS);
-    #endif
-
-    /* D3D10+ uses clock-wise vertex winding per default */
-    stateMngr_->SetFrontFace(GL_CW);
-
-    /*
-    Set pixel storage to byte-alignment (default is word-alignment).
-    This is required so that texture formats like RGB (which is not word-aligned) can be used.
-    */
-    stateMngr_->SetPixelStorePack(0, 0, 1);
-    stateMngr_->SetPixelStoreUnpack(0, 0, 1);
-}
-
 
 } // /namespace LLGL
 
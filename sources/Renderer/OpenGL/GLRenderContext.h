@@ -57,11 +57,20 @@ class GLRenderContext final : public RenderContext
 
         static bool GLMakeCurrent(GLRenderContext* renderContext);
 
+        // Initializes the render states of the specified state manager for the first GL context.
+        static void InitRenderStates(GLStateManager& stateMngr);
+
         inline const std::shared_ptr<GLStateManager>& GetStateManager() const
         {
             return stateMngr_;
         }
 
+        // Returns the GL context of this render context.
+        inline GLContext* GetGLContext() const
+        {
+            return context_.get();
+        }
+
     private:
 
         struct RenderState
@@ -76,8 +85,6 @@ class GLRenderContext final : public RenderContext
         bool OnSetVideoMode(const VideoModeDescriptor& videoModeDesc) override;
         bool OnSetVsync(const VsyncDescriptor& vsyncDesc) override;
 
-        void InitRenderStates();
-
         #ifdef __linux__
         void GetNativeContextHandle(
             NativeContextHandle&        windowContext,
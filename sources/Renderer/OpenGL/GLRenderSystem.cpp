@@ -44,16 +44,62 @@ GLRenderSystem::GLRenderSystem(const RenderSystemDescriptor& renderSystemDesc)
     /* Extract optional renderer configuartion */
     if (auto rendererConfigGL = GetRendererConfiguration<RendererConfigurationOpenGL>(renderSystemDesc))
         config_ = *rendererConfigGL;
+
+    /* Create persistent shader cache if a cache directory is specified */
+    if (!config_.shaderCache.path.empty())
+        shaderCache_ = MakeUnique<ShaderCache>(config_.shaderCache);
+
+    /* Create headless context if the render system is used without render contexts */
+    if (config_.headless)
+        CreateHeadlessContext();
 }
 
 GLRenderSystem::~GLRenderSystem()
 {
+    /* Stop background upload thread before any objects are deleted */
+    uploadContext_.reset();
+
     /* Clear all render state containers first, the rest will be deleted automatically */
     GLTextureViewPool::Get().Clear();
     GLMipGenerator::Get().Clear();
     GLStatePool::Get().Clear();
 }
 
+bool GLRenderSystem::QueryMemoryStatistics(MemoryStatistics& stats)
+{
+    const auto numBuffers   = static_cast<std::uint32_t>(buffers_.size());
+    const auto numTextures  = numTextureStorages_.load();
+
+    /* GL does not expose memory heaps, so report all resources as a single device local heap */
+    stats.heaps.resize(1);
+    auto& heap = stats.heaps.front();
+    {
+        heap                    = MemoryHeapStatistics{};
+        heap.allocatedBytes     = bufferMemory_.load() + textureMemory_.load();
+        heap.usedBytes          = heap.allocatedBytes;
+        heap.usage              = heap.allocatedBytes;
+        heap.numAllocations     = numBuffers + numTextures;
+        heap.numBlocks          = heap.numAllocations;
+        heap.deviceLocal        = true;
+    }
+    stats.numBuffers    = numBuffers;
+    stats.numTextures   = numTextures;
+
+    /* Query size and budget from the driver; this requires the GL context of the render thread */
+    if (!IsOffRenderThread())
+        QueryDriverMemoryInfo(heap);
+
+    return true;
+}
+
+bool GLRenderSystem::QueryShaderCacheStatistics(ShaderCacheStatistics& stats)
+{
+    if (!shaderCache_)
+        return RenderSystem::QueryShaderCacheStatistics(stats);
+    stats = shaderCache_->GetStatistics();
+    return true;
+}
+
 /* ----- Render Context ----- */
 
 // private
@@ -62,8 +108,20 @@ GLRenderContext* GLRenderSystem::GetSharedRenderContext() const
     return (!renderContexts_.empty() ? renderContexts_.begin()->get() : nullptr);
 }
 
+// private
+std::shared_ptr<GLStateManager> GLRenderSystem::GetSharedStateManager() const
+{
+    if (headlessContext_)
+        return headlessContext_->GetStateManager();
+    if (auto sharedContext = GetSharedRenderContext())
+        return sharedContext->GetStateManager();
+    return nullptr;
+}
+
 RenderContext* GLRenderSystem::CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface)
 {
+    if (headlessContext_)
+        throw std::runtime_error("cannot create OpenGL render context for headless render system");
     return AddRenderContext(MakeUnique<GLRenderContext>(desc, config_, surface, GetSharedRenderContext()));
 }
 
@@ -83,8 +141,8 @@ CommandQueue* GLRenderSystem::GetCommandQueue()
 
 CommandBuffer* GLRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& desc)
 {
-    /* Get state manager from shared render context */
-    if (auto sharedContext = GetSharedRenderContext())
+    /* Get state manager from shared render context or headless context */
+    if (auto sharedStateMngr = GetSharedStateManager())
     {
         if ((desc.flags & (CommandBufferFlags::DeferredSubmit | CommandBufferFlags::MultiSubmit)) != 0)
         {
@@ -99,7 +157,7 @@ CommandBuffer* GLRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor
             /* Create immediate command buffer */
             return TakeOwnership(
                 commandBuffers_,
-                MakeUnique<GLImmediateCommandBuffer>(sharedContext->GetStateManager())
+                MakeUnique<GLImmediateCommandBuffer>(sharedStateMngr)
             );
         }
     }
@@ -154,6 +212,14 @@ static void GLBufferStorage(GLBuffer& bufferGL, const BufferDescriptor& desc, co
 
 Buffer* GLRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* initialData)
 {
+    if (IsOffRenderThread())
+    {
+        /* Create buffer on the worker thread of the upload context */
+        Buffer* buffer = nullptr;
+        uploadContext_->Execute([&]() { buffer = CreateBuffer(desc, initialData); });
+        return buffer;
+    }
+
     AssertCreateBuffer(desc, static_cast<std::uint64_t>(std::numeric_limits<GLsizeiptr>::max()));
 
     auto bufferGL = CreateGLBuffer(desc, initialData);
@@ -162,6 +228,9 @@ Buffer* GLRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* i
     if ((desc.bindFlags & BindFlags::IndexBuffer) != 0 && desc.format != Format::Undefined)
         bufferGL->SetIndexType(desc.format);
 
+    /* Track memory for statistics */
+    bufferMemory_ += static_cast<std::uint64_t>(bufferGL->GetSize());
+
     return bufferGL;
 }
 
@@ -175,7 +244,18 @@ GLBuffer* GLRenderSystem::CreateGLBuffer(const BufferDescriptor& desc, const voi
         auto bufferGL = MakeUnique<GLBufferWithVAO>(desc.bindFlags);
         {
             GLBufferStorage(*bufferGL, desc, initialData);
-            bufferGL->BuildVertexArray(desc.vertexAttribs.size(), desc.vertexAttribs.data());
+
+            /* Store vertex format immediately, so the buffer can be used in a buffer array before its VAO is built */
+            bufferGL->SetVertexAttribs(desc.vertexAttribs.size(), desc.vertexAttribs.data());
+
+            if (uploadContext_ != nullptr && uploadContext_->IsWorkerThread())
+            {
+                /* VAOs are not shared between GL contexts, so build vertex array on the render thread */
+                auto bufferGLRef = bufferGL.get();
+                uploadContext_->Defer([bufferGLRef]() { bufferGLRef->BuildVertexArray(); });
+            }
+            else
+                bufferGL->BuildVertexArray();
         }
         return TakeOwnership(buffers_, std::move(bufferGL));
     }
@@ -197,9 +277,26 @@ BufferArray* GLRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer*
     auto refBindFlags = bufferArray[0]->GetBindFlags();
     if ((refBindFlags & BindFlags::VertexBuffer) != 0)
     {
-        /* Create vertex buffer array and build VAO */
         auto vertexBufferArray = MakeUnique<GLBufferArrayWithVAO>(refBindFlags);
-        vertexBufferArray->BuildVertexArray(numBuffers, bufferArray);
+        if (IsOffRenderThread())
+        {
+            /* VAOs are not shared between GL contexts, so build vertex array on the render thread */
+            auto vertexBufferArrayRef   = vertexBufferArray.get();
+            auto buffers                = std::vector<Buffer*>(bufferArray, bufferArray + numBuffers);
+            uploadContext_->Defer(
+                [vertexBufferArrayRef, buffers]()
+                {
+                    vertexBufferArrayRef->BuildVertexArray(static_cast<std::uint32_t>(buffers.size()), buffers.data());
+                }
+            );
+        }
+        else
+        {
+            /* Wait for buffers that have been uploaded from other threads, then build VAO */
+            if (uploadContext_)
+                uploadContext_->Synchronize();
+            vertexBufferArray->BuildVertexArray(numBuffers, bufferArray);
+        }
         return TakeOwnership(bufferArrays_, std::move(vertexBufferArray));
     }
 
@@ -208,22 +305,58 @@ BufferArray* GLRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer*
 
 void GLRenderSystem::Release(Buffer& buffer)
 {
+    /* Untrack memory for statistics */
+    auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+    bufferMemory_ -= static_cast<std::uint64_t>(bufferGL.GetSize());
+
+    if (IsOffRenderThread())
+    {
+        /* Release buffer on the render thread, since it might be bound or referenced by a VAO of the render context */
+        uploadContext_->Defer([this, &buffer]() { RemoveFromUniqueSet(buffers_, &buffer); });
+        return;
+    }
+
+    /* Run pending tasks first, which might still refer to this buffer */
+    if (uploadContext_)
+        uploadContext_->Synchronize();
+
     RemoveFromUniqueSet(buffers_, &buffer);
 }
 
 void GLRenderSystem::Release(BufferArray& bufferArray)
 {
+    if (IsOffRenderThread())
+    {
+        /* Release buffer array on the render thread, since its VAO belongs to the render context */
+        uploadContext_->Defer([this, &bufferArray]() { RemoveFromUniqueSet(bufferArrays_, &bufferArray); });
+        return;
+    }
+
+    /* Run pending tasks first, which might still refer to this buffer array */
+    if (uploadContext_)
+        uploadContext_->Synchronize();
+
     RemoveFromUniqueSet(bufferArrays_, &bufferArray);
 }
 
 void GLRenderSystem::WriteBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint64_t dataSize)
 {
+    if (IsOffRenderThread())
+    {
+        uploadContext_->Execute([&]() { WriteBuffer(dstBuffer, dstOffset, data, dataSize); });
+        return;
+    }
+
     auto& dstBufferGL = LLGL_CAST(GLBuffer&, dstBuffer);
     dstBufferGL.BufferSubData(static_cast<GLintptr>(dstOffset), static_cast<GLsizeiptr>(dataSize), data);
 }
 
 void* GLRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
 {
+    /* Wait for buffers that have been uploaded from other threads */
+    if (uploadContext_)
+        uploadContext_->Synchronize();
+
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     return bufferGL.MapBuffer(GLTypes::Map(access));
 }
@@ -276,6 +409,14 @@ void GLRenderSystem::ValidateGLTextureType(const TextureType type)
 
 Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc)
 {
+    if (IsOffRenderThread())
+    {
+        /* Create texture on the worker thread of the upload context */
+        Texture* texture = nullptr;
+        uploadContext_->Execute([&]() { texture = CreateTexture(textureDesc, imageDesc); });
+        return texture;
+    }
+
     ValidateGLTextureType(textureDesc.type);
 
     /* Create <GLTexture> object; will result in a GL renderbuffer or texture instance */
@@ -284,6 +425,10 @@ Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
     /* Initialize either renderbuffer or texture image storage */
     texture->BindAndAllocStorage(textureDesc, imageDesc);
 
+    /* Track memory for statistics */
+    textureMemory_ += texture->GetStorageSize();
+    ++numTextureStorages_;
+
     return TakeOwnership(textures_, std::move(texture));
 }
 
@@ -319,11 +464,36 @@ Texture* GLRenderSystem::CreateTextureView(Texture& sharedTexture, const Texture
 
 void GLRenderSystem::Release(Texture& texture)
 {
+    /* Untrack memory for statistics; texture views do not own any storage */
+    auto& textureGL = LLGL_CAST(GLTexture&, texture);
+    if (textureGL.HasStorage())
+    {
+        textureMemory_ -= textureGL.GetStorageSize();
+        --numTextureStorages_;
+    }
+
+    if (IsOffRenderThread())
+    {
+        /* Release texture on the render thread, since it might be bound or cached in texture views of the render context */
+        uploadContext_->Defer([this, &texture]() { RemoveFromUniqueSet(textures_, &texture); });
+        return;
+    }
+
+    /* Run pending tasks first, which might still refer to this texture */
+    if (uploadContext_)
+        uploadContext_->Synchronize();
+
     RemoveFromUniqueSet(textures_, &texture);
 }
 
 void GLRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc)
 {
+    if (IsOffRenderThread())
+    {
+        uploadContext_->Execute([&]() { WriteTexture(texture, textureRegion, imageDesc); });
+        return;
+    }
+
     /* Bind texture and write texture sub data */
     auto& textureGL = LLGL_CAST(GLTexture&, texture);
     textureGL.TextureSubImage(textureRegion, imageDesc, false);
@@ -331,6 +501,10 @@ void GLRenderSystem::WriteTexture(Texture& texture, const TextureRegion& texture
 
 void GLRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureRegion, const DstImageDescriptor& imageDesc)
 {
+    /* Wait for textures that have been uploaded from other threads */
+    if (uploadContext_)
+        uploadContext_->Synchronize();
+
     /* Bind texture and write texture sub data */
     LLGL_ASSERT_PTR(imageDesc.data);
     auto& textureGL = LLGL_CAST(GLTexture&, texture);
@@ -345,17 +519,29 @@ Sampler* GLRenderSystem::CreateSampler(const SamplerDescriptor& desc)
     /* If GL_ARB_sampler_objects is not supported, use emulated sampler states */
     if (!HasNativeSamplers())
     {
-        auto samplerGL2X = MakeUnique<GL2XSampler>();
-        samplerGL2X->SetDesc(desc);
-        return TakeOwnership(samplersGL2X_, std::move(samplerGL2X));
+        return samplersGL2X_.acquire(
+            desc,
+            [&desc]()
+            {
+                auto samplerGL2X = MakeUnique<GL2XSampler>();
+                samplerGL2X->SetDesc(desc);
+                return samplerGL2X;
+            }
+        );
     }
     #endif
 
-    /* Create native GL sampler state */
+    /* Create native GL sampler state or share the one with an equal descriptor */
     LLGL_ASSERT_FEATURE_SUPPORT(hasSamplers);
-    auto sampler = MakeUnique<GLSampler>();
-    sampler->SetDesc(desc);
-    return TakeOwnership(samplers_, std::move(sampler));
+    return samplers_.acquire(
+        desc,
+        [&desc]()
+        {
+            auto sampler = MakeUnique<GLSampler>();
+            sampler->SetDesc(desc);
+            return sampler;
+        }
+    );
 }
 
 void GLRenderSystem::Release(Sampler& sampler)
@@ -434,13 +620,13 @@ Shader* GLRenderSystem::CreateShader(const ShaderDescriptor& desc)
     }
 
     /* Make and return shader object */
-    return TakeOwnership(shaders_, MakeUnique<GLShader>(desc));
+    return TakeOwnership(shaders_, MakeUnique<GLShader>(desc, shaderCache_.get()));
 }
 
 ShaderProgram* GLRenderSystem::CreateShaderProgram(const ShaderProgramDescriptor& desc)
 {
     AssertCreateShaderProgram(desc);
-    return TakeOwnership(shaderPrograms_, MakeUnique<GLShaderProgram>(desc));
+    return TakeOwnership(shaderPrograms_, MakeUnique<GLShaderProgram>(desc, shaderCache_.get()));
 }
 
 void GLRenderSystem::Release(Shader& shader)
@@ -519,15 +705,16 @@ void GLRenderSystem::Release(Fence& fence)
 RenderContext* GLRenderSystem::AddRenderContext(std::unique_ptr<GLRenderContext>&& renderContext)
 {
     /* Create devices that require an active GL context */
-    if (renderContexts_.empty())
-        CreateGLContextDependentDevices(*renderContext);
+    const bool isFirstContext = renderContexts_.empty();
+    if (isFirstContext)
+        CreateGLContextDependentDevices();
 
     /* Use uniform clipping space */
-    GLStateManager::Get().DetermineExtensionsAndLimits();
-    
-    #ifdef LLGL_OPENGL
-    GLStateManager::Get().SetClipControl(GL_UPPER_LEFT, GL_ZERO_TO_ONE);
-    #endif
+    InitClippingSpace();
+
+    /* Create background upload context that shares its GL objects with the first render context */
+    if (isFirstContext)
+        CreateUploadContext(*renderContext->GetGLContext());
 
     /* Take ownership and return raw pointer */
     return TakeOwnership(renderContexts_, std::move(renderContext));
@@ -538,19 +725,68 @@ RenderContext* GLRenderSystem::AddRenderContext(std::unique_ptr<GLRenderContext>
  * ======= Private: =======
  */
 
-void GLRenderSystem::CreateGLContextDependentDevices(GLRenderContext& renderContext)
+void GLRenderSystem::CreateHeadlessContext()
+{
+    /* Create GL context without surface and make it current */
+    headlessContext_ = GLContext::CreateHeadless(config_);
+    if (!headlessContext_)
+        throw std::runtime_error("headless OpenGL context is not supported on this platform (requires LLGL_GL_ENABLE_EGL on Linux)");
+
+    GLContext::MakeCurrent(headlessContext_.get());
+
+    /* Initialize render states and create devices that require an active GL context */
+    GLRenderContext::InitRenderStates(*headlessContext_->GetStateManager());
+    CreateGLContextDependentDevices();
+    InitClippingSpace();
+    CreateUploadContext(*headlessContext_);
+}
+
+void GLRenderSystem::CreateUploadContext(GLContext& sharedContext)
+{
+    if (config_.uploadContext && !uploadContext_)
+    {
+        /* Create offscreen context that shares all GL objects with the specified context, which must be current */
+        auto context = sharedContext.CreateSharedUploadContext(config_);
+        if (!context)
+            throw std::runtime_error("background OpenGL upload context is not supported on this platform");
+        uploadContext_ = MakeUnique<GLUploadContext>(std::move(context));
+    }
+}
+
+// Returns true if the calling thread has no GL context and its GL calls must be executed by the upload context.
+bool GLRenderSystem::IsOffRenderThread() const
+{
+    return (uploadContext_ != nullptr && GLContext::Active() == nullptr);
+}
+
+void GLRenderSystem::InitClippingSpace()
+{
+    GLStateManager::Get().DetermineExtensionsAndLimits();
+
+    #ifdef LLGL_OPENGL
+    GLStateManager::Get().SetClipControl(GL_UPPER_LEFT, GL_ZERO_TO_ONE);
+    #endif
+}
+
+void GLRenderSystem::CreateGLContextDependentDevices()
 {
     const bool hasGLCoreProfile = (config_.contextProfile == OpenGLContextProfile::CoreProfile);
 
     /* Load all OpenGL extensions */
     LoadGLExtensions(hasGLCoreProfile);
 
+    #ifdef GL_KHR_parallel_shader_compile
+    /* Let the driver compile and link shaders with as many threads as it supports */
+    if (HasExtension(GLExt::KHR_parallel_shader_compile))
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+    #endif
+
     /* Enable debug callback function */
     if (debugCallback_)
         SetDebugCallback(debugCallback_);
 
     /* Create command queue instance */
-    commandQueue_ = MakeUnique<GLCommandQueue>(renderContext.GetStateManager());
+    commandQueue_ = MakeUnique<GLCommandQueue>();
 }
 
 void GLRenderSystem::LoadGLExtensions(bool hasGLCoreProfile)
@@ -561,11 +797,11 @@ void GLRenderSystem::LoadGLExtensions(bool hasGLCoreProfile)
         /* Query extensions and load all of them */
         auto extensions = QueryExtensions(hasGLCoreProfile);
         LoadAllExtensions(extensions, hasGLCoreProfile);
-
-        /* Query and store all renderer information and capabilities */
-        QueryRendererInfo();
-        QueryRenderingCaps();
     }
+
+    /* Query and store all renderer information and capabilities (extensions are shared by all render systems, but these are per instance) */
+    QueryRendererInfo();
+    QueryRenderingCaps();
 }
 
 #ifdef GL_KHR_debug
@@ -636,6 +872,33 @@ void GLRenderSystem::QueryRenderingCaps()
     SetRenderingCaps(caps);
 }
 
+void GLRenderSystem::QueryDriverMemoryInfo(MemoryHeapStatistics& heap)
+{
+    #ifdef GL_NVX_gpu_memory_info
+    if (HasExtension(GLExt::NVX_gpu_memory_info))
+    {
+        /* Query total and currently available video memory (in KB) */
+        GLint totalMemory = 0, availableMemory = 0;
+        glGetIntegerv(GL_GPU_MEMORY_INFO_TOTAL_AVAILABLE_MEMORY_NVX, &totalMemory);
+        glGetIntegerv(GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX, &availableMemory);
+        heap.size   = static_cast<std::uint64_t>(totalMemory) * 1024;
+        heap.budget = heap.size;
+        heap.usage  = static_cast<std::uint64_t>(std::max(0, totalMemory - availableMemory)) * 1024;
+        return;
+    }
+    #endif // /GL_NVX_gpu_memory_info
+
+    #ifdef GL_ATI_meminfo
+    if (HasExtension(GLExt::ATI_meminfo))
+    {
+        /* Query free texture memory (in KB); only the first of the four values (total free memory in the pool) is used */
+        GLint freeMemory[4] = { 0, 0, 0, 0 };
+        glGetIntegerv(GL_TEXTURE_FREE_MEMORY_ATI, freeMemory);
+        heap.budget = heap.usage + static_cast<std::uint64_t>(freeMemory[0]) * 1024;
+    }
+    #endif // /GL_ATI_meminfo
+}
+
 
 } // /namespace LLGL
 
@@ -12,10 +12,12 @@
 #include <LLGL/RenderSystem.h>
 #include "Ext/GLExtensionLoader.h"
 #include "../ContainerTypes.h"
+#include "../SamplerUtils.h"
 
 #include "Command/GLCommandQueue.h"
 #include "Command/GLCommandBuffer.h"
 #include "GLRenderContext.h"
+#include "GLUploadContext.h"
 
 #include "Buffer/GLBuffer.h"
 #include "Buffer/GLBufferArray.h"
@@ -41,6 +43,7 @@
 #include <memory>
 #include <vector>
 #include <set>
+#include <atomic>
 
 
 namespace LLGL
@@ -57,6 +60,9 @@ class GLRenderSystem final : public RenderSystem
         GLRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
         ~GLRenderSystem();
 
+        bool QueryMemoryStatistics(MemoryStatistics& stats) override;
+        bool QueryShaderCacheStatistics(ShaderCacheStatistics& stats) override;
+
         /* ----- Render Context ----- */
 
         RenderContext* CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface = nullptr) override;
@@ -159,7 +165,11 @@ class GLRenderSystem final : public RenderSystem
 
     private:
 
-        void CreateGLContextDependentDevices(GLRenderContext& renderContext);
+        void CreateHeadlessContext();
+        void CreateUploadContext(GLContext& sharedContext);
+        bool IsOffRenderThread() const;
+        void InitClippingSpace();
+        void CreateGLContextDependentDevices();
 
         void LoadGLExtensions(bool hasGLCoreProfile);
         void SetDebugCallback(const DebugCallback& debugCallback);
@@ -168,24 +178,28 @@ class GLRenderSystem final : public RenderSystem
         void QueryRenderingCaps();
 
         GLRenderContext* GetSharedRenderContext() const;
+        std::shared_ptr<GLStateManager> GetSharedStateManager() const;
 
         GLBuffer* CreateGLBuffer(const BufferDescriptor& desc, const void* initialData);
 
         void ValidateGLTextureType(const TextureType type);
 
+        void QueryDriverMemoryInfo(MemoryHeapStatistics& heap);
+
     private:
 
         /* ----- Hardware object containers ----- */
 
+        std::unique_ptr<GLContext>              headlessContext_;   // Must be declared first, so it is destroyed after all other hardware objects
         HWObjectContainer<GLRenderContext>      renderContexts_;
         HWObjectInstance<GLCommandQueue>        commandQueue_;
         HWObjectContainer<GLCommandBuffer>      commandBuffers_;
         HWObjectContainer<GLBuffer>             buffers_;
         HWObjectContainer<GLBufferArray>        bufferArrays_;
         HWObjectContainer<GLTexture>            textures_;
-        HWObjectContainer<GLSampler>            samplers_;
+        HWSamplerCache<GLSampler>               samplers_;
         #ifdef LLGL_GL_ENABLE_OPENGL2X
-        HWObjectContainer<GL2XSampler>          samplersGL2X_;
+        HWSamplerCache<GL2XSampler>             samplersGL2X_;
         #endif
         HWObjectContainer<GLRenderPass>         renderPasses_;
         HWObjectContainer<GLRenderTarget>       renderTargets_;
@@ -197,9 +211,18 @@ class GLRenderSystem final : public RenderSystem
         HWObjectContainer<GLQueryHeap>          queryHeaps_;
         HWObjectContainer<GLFence>              fences_;
 
+        std::unique_ptr<GLUploadContext>        uploadContext_;     // Must be declared after all hardware objects, so its worker thread is stopped first
+
         RendererConfigurationOpenGL             config_;
         DebugCallback                           debugCallback_;
 
+        std::unique_ptr<ShaderCache>            shaderCache_;
+
+        /* Memory accounting; buffers and textures can be created on the worker thread of the upload context */
+        std::atomic<std::uint64_t>              bufferMemory_       { 0 };
+        std::atomic<std::uint64_t>              textureMemory_      { 0 };
+        std::atomic<std::uint32_t>              numTextureStorages_ { 0 };  // Number of textures with their own storage, i.e. excluding texture views
+
 };
 
 
@@ -0,0 +1,187 @@
+/*
+ * GLUploadContext.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLUploadContext.h"
+#include "GLRenderContext.h"
+#include "Ext/GLExtensions.h"
+#include "Ext/GLExtensionRegistry.h"
+#include "../../Core/Helper.h"
+#include <future>
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+static GLUploadContext* g_uploadContext = nullptr;
+
+GLUploadContext::GLUploadContext(std::unique_ptr<GLContext>&& context) :
+    context_ { std::move(context) }
+{
+    thread_ = std::thread(&GLUploadContext::WorkerThreadMain, this);
+
+    try
+    {
+        /* Make context current on worker thread and initialize its state manager like the one of the render thread */
+        Execute(
+            [this]()
+            {
+                if (!GLContext::MakeCurrent(context_.get()))
+                    throw std::runtime_error("failed to make OpenGL upload context current on worker thread");
+                GLRenderContext::InitRenderStates(*context_->GetStateManager());
+                context_->GetStateManager()->DetermineExtensionsAndLimits();
+            }
+        );
+    }
+    catch (...)
+    {
+        {
+            std::lock_guard<std::mutex> guard{ taskMutex_ };
+            quit_ = true;
+        }
+        taskSignal_.notify_one();
+        thread_.join();
+        throw;
+    }
+
+    g_uploadContext = this;
+}
+
+GLUploadContext::~GLUploadContext()
+{
+    if (g_uploadContext == this)
+        g_uploadContext = nullptr;
+
+    /* Let worker thread finish all pending tasks, then wait for it */
+    {
+        std::lock_guard<std::mutex> guard{ taskMutex_ };
+        quit_ = true;
+    }
+    taskSignal_.notify_one();
+    thread_.join();
+}
+
+GLUploadContext* GLUploadContext::Get()
+{
+    return g_uploadContext;
+}
+
+void GLUploadContext::Execute(const std::function<void()>& task)
+{
+    /* Submit fence within the task, so it is queued before the calling thread can use the new resources */
+    std::packaged_task<void()> packagedTask(
+        [this, &task]()
+        {
+            /* Objects are released on the render thread without notifying this context, so don't rely on previous bindings (the context is not current before the first task) */
+            if (GLContext::Active() != nullptr)
+                GLStateManager::Get().InvalidateBoundObjects();
+
+            task();
+
+            if (HasExtension(GLExt::ARB_sync))
+            {
+                auto fence = MakeUnique<GLFence>();
+                fence->Submit();
+                glFlush();
+
+                std::lock_guard<std::mutex> guard{ syncMutex_ };
+                fences_.push_back(std::move(fence));
+                hasPending_ = true;
+            }
+            else
+            {
+                /* Without sync objects, uploads must be finished before they are visible to other contexts */
+                glFinish();
+            }
+        }
+    );
+
+    auto result = packagedTask.get_future();
+    {
+        std::lock_guard<std::mutex> guard{ taskMutex_ };
+        tasks_.push_back([&packagedTask]() { packagedTask(); });
+    }
+    taskSignal_.notify_one();
+
+    /* Wait for task and rethrow its exception (if any) */
+    result.get();
+}
+
+void GLUploadContext::Defer(std::function<void()>&& task)
+{
+    std::lock_guard<std::mutex> guard{ syncMutex_ };
+    deferredTasks_.push_back(std::move(task));
+    hasPending_ = true;
+}
+
+void GLUploadContext::Synchronize()
+{
+    /* Early exit without locking the mutex if nothing has been uploaded since the last synchronization */
+    if (!hasPending_)
+        return;
+
+    /* Only synchronize on a thread with a render context (e.g. not when deferred command buffers are recorded on another thread) */
+    auto activeContext = GLContext::Active();
+    if (activeContext == nullptr || activeContext == context_.get())
+        return;
+
+    std::vector<std::unique_ptr<GLFence>> fences;
+    std::vector<std::function<void()>> deferredTasks;
+    {
+        std::lock_guard<std::mutex> guard{ syncMutex_ };
+        fences.swap(fences_);
+        deferredTasks.swap(deferredTasks_);
+        hasPending_ = false;
+    }
+
+    /* Let the GPU wait for the uploads of the worker thread; this does not block the render thread */
+    for (const auto& fence : fences)
+        fence->ServerWait();
+
+    /* Run tasks that must be executed on the render thread (e.g. to build VAOs or release objects) */
+    for (const auto& task : deferredTasks)
+        task();
+}
+
+bool GLUploadContext::IsWorkerThread() const
+{
+    return (std::this_thread::get_id() == thread_.get_id());
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLUploadContext::WorkerThreadMain()
+{
+    for (;;)
+    {
+        /* Wait for next task */
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock{ taskMutex_ };
+            taskSignal_.wait(lock, [this]() { return (quit_ || !tasks_.empty()); });
+            if (tasks_.empty())
+                break;
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        task();
+    }
+
+    /* Release context before the thread ends, so it can be deleted on the render thread */
+    GLContext::MakeCurrent(nullptr);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
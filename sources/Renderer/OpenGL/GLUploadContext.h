@@ -0,0 +1,91 @@
+/*
+ * GLUploadContext.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_UPLOAD_CONTEXT_H
+#define LLGL_GL_UPLOAD_CONTEXT_H
+
+
+#include "Platform/GLContext.h"
+#include "RenderState/GLFence.h"
+#include <memory>
+#include <functional>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+
+namespace LLGL
+{
+
+
+/*
+Background upload context for resource creation off the render thread.
+All tasks are executed on a worker thread that owns a GL context which shares all GL objects with the render thread.
+After each task, a fence is submitted on the worker thread which the render thread waits for (on the GPU) before it uses the new resources.
+Objects that are not shared between GL contexts (e.g. VAOs) must be created on the render thread, so such tasks are deferred.
+The same applies to the GL state pool, which is not thread-safe and must only be accessed on the render thread.
+*/
+class GLUploadContext
+{
+
+    public:
+
+        // Takes ownership of the specified context and starts the worker thread. The context must share its GL objects with the render thread.
+        GLUploadContext(std::unique_ptr<GLContext>&& context);
+        ~GLUploadContext();
+
+        GLUploadContext(const GLUploadContext&) = delete;
+        GLUploadContext& operator = (const GLUploadContext&) = delete;
+
+        // Returns the upload context of the active render system, or null if there is none.
+        static GLUploadContext* Get();
+
+        // Executes the specified task on the worker thread and blocks the calling thread until it is done. Exceptions are rethrown on the calling thread.
+        void Execute(const std::function<void()>& task);
+
+        // Defers the specified task until the next synchronization on the render thread.
+        void Defer(std::function<void()>&& task);
+
+        // Makes the current GL context wait for all completed uploads and runs all deferred tasks. Does nothing if the calling thread has no render context.
+        void Synchronize();
+
+        // Returns true if the calling thread is the worker thread of this upload context.
+        bool IsWorkerThread() const;
+
+    private:
+
+        void WorkerThreadMain();
+
+    private:
+
+        std::unique_ptr<GLContext>                  context_;
+
+        std::thread                                 thread_;
+        std::mutex                                  taskMutex_;
+        std::condition_variable                     taskSignal_;
+        std::deque<std::function<void()>>           tasks_;
+        bool                                        quit_       = false;
+
+        std::mutex                                  syncMutex_;
+        std::vector<std::unique_ptr<GLFence>>       fences_;
+        std::vector<std::function<void()>>          deferredTasks_;
+        std::atomic<bool>                           hasPending_ { false };
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
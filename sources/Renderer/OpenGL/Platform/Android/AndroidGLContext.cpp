@@ -30,6 +30,12 @@ std::unique_ptr<GLContext> GLContext::Create(
     return MakeUnique<AndroidGLContext>(desc, config, surface, sharedContextEGL);
 }
 
+std::unique_ptr<GLContext> GLContext::CreateHeadless(const RendererConfigurationOpenGL& /*config*/)
+{
+    /* Headless contexts are not supported on this platform */
+    return nullptr;
+}
+
 
 /*
  * LinuxGLContext class
@@ -41,8 +47,7 @@ AndroidGLContext::AndroidGLContext(
     Surface&                            surface,
     AndroidGLContext*                   sharedContext)
 :
-    display_  { eglGetDisplay(EGL_DEFAULT_DISPLAY) },
-    GLContext { sharedContext                      }
+    display_ { eglGetDisplay(EGL_DEFAULT_DISPLAY) }
 {
     /*NativeHandle nativeHandle = {};
     surface.GetNativeHandle(&nativeHandle, sizeof(nativeHandle));
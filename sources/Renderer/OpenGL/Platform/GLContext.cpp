@@ -12,14 +12,12 @@ namespace LLGL
 {
 
 
-static GLContext* g_activeGLContext = nullptr;
+// Each thread has its own current GL context
+thread_local static GLContext* g_activeGLContext = nullptr;
 
-GLContext::GLContext(GLContext* sharedContext)
+GLContext::GLContext() :
+    stateMngr_ { std::make_shared<GLStateManager>() }
 {
-    if (sharedContext)
-        stateMngr_ = sharedContext->stateMngr_;
-    else
-        stateMngr_ = std::make_shared<GLStateManager>();
 }
 
 GLContext::~GLContext()
@@ -27,6 +25,12 @@ GLContext::~GLContext()
     // dummy
 }
 
+std::unique_ptr<GLContext> GLContext::CreateSharedUploadContext(const RendererConfigurationOpenGL& /*config*/)
+{
+    /* Shared upload contexts are not supported by default */
+    return nullptr;
+}
+
 bool GLContext::MakeCurrent(GLContext* context)
 {
     bool result = true;
@@ -36,13 +40,13 @@ bool GLContext::MakeCurrent(GLContext* context)
         if (context)
         {
             /* Activate new GL context: MakeCurrent(context) */
-            GLStateManager::active_ = context->stateMngr_.get();
+            GLStateManager::SetActive(context->stateMngr_.get());
             result = context->Activate(true);
         }
         else if (g_activeGLContext)
         {
             /* Deactivate previous GL context: MakeCurrent(null) */
-            GLStateManager::active_ = nullptr;
+            GLStateManager::SetActive(nullptr);
             result = g_activeGLContext->Activate(false);
         }
 
@@ -37,6 +37,12 @@ class GLContext
         // Returns the number of samples for this GL context. Must be in range [1, 64].
         virtual std::uint32_t GetSamples() const = 0;
 
+        /*
+        Creates an offscreen context that shares all GL objects with this context but has its own state manager,
+        or returns null if not supported. The new context is not made current. This is used for a background upload thread.
+        */
+        virtual std::unique_ptr<GLContext> CreateSharedUploadContext(const RendererConfigurationOpenGL& config);
+
     public:
 
         virtual ~GLContext();
@@ -49,10 +55,13 @@ class GLContext
             GLContext*                          sharedContext
         );
 
-        // Makes the specified GLContext current. If null, the current context will be deactivated.
+        // Creates a platform specific GLContext instance that does not require a surface, or returns null if headless contexts are not supported.
+        static std::unique_ptr<GLContext> CreateHeadless(const RendererConfigurationOpenGL& config);
+
+        // Makes the specified GLContext current on the calling thread. If null, the current context will be deactivated.
         static bool MakeCurrent(GLContext* context);
 
-        // Returns the active GLContext instance.
+        // Returns the GLContext instance that is active on the calling thread.
         static GLContext* Active();
 
         // Returns the state manager that is associated with this context.
@@ -63,7 +72,8 @@ class GLContext
 
     protected:
 
-        GLContext(GLContext* sharedContext);
+        // Creates the context base with its own state manager. Each GL context has its own state, even if it shares GL objects with other contexts.
+        GLContext();
 
         // Activates or deactivates this GLContext (Win32: wglMakeCurrent, X11: glXMakeCurrent).
         virtual bool Activate(bool activate) = 0;
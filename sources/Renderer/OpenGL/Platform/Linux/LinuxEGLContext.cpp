@@ -0,0 +1,249 @@
+/*
+ * LinuxEGLContext.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifdef LLGL_GL_ENABLE_EGL
+
+
+#include "LinuxEGLContext.h"
+#include "../../../../Core/Helper.h"
+#include <LLGL/Log.h>
+#include <EGL/eglext.h>
+#include <string.h>
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+// Returns true if the specified extension is contained in the space separated list of EGL extensions.
+static bool HasEGLExtension(const char* extensions, const char* name)
+{
+    if (extensions != nullptr)
+    {
+        const auto nameLen = ::strlen(name);
+        for (auto s = ::strstr(extensions, name); s != nullptr; s = ::strstr(s + nameLen, name))
+        {
+            if ((s == extensions || s[-1] == ' ') && (s[nameLen] == ' ' || s[nameLen] == '\0'))
+                return true;
+        }
+    }
+    return false;
+}
+
+LinuxEGLContext::LinuxEGLContext(const RendererConfigurationOpenGL& config)
+{
+    InitializeDisplay();
+    ChooseConfig();
+    CreateContext(config, EGL_NO_CONTEXT);
+    CreateSurface();
+
+    /* Make context current */
+    if (eglMakeCurrent(display_, surface_, surface_, context_) != EGL_TRUE)
+        throw std::runtime_error("eglMakeCurrent failed on headless OpenGL context");
+}
+
+LinuxEGLContext::LinuxEGLContext(const RendererConfigurationOpenGL& config, LinuxEGLContext& sharedContext) :
+    display_     { sharedContext.display_     },
+    config_      { sharedContext.config_      },
+    surfaceless_ { sharedContext.surfaceless_ }
+{
+    /* Share display connection and configuration with primary context, but don't make the new context current */
+    CreateContext(config, sharedContext.context_);
+    CreateSurface();
+}
+
+LinuxEGLContext::~LinuxEGLContext()
+{
+    DeleteContext();
+}
+
+bool LinuxEGLContext::SetSwapInterval(int interval)
+{
+    /* Headless context has no swap chain */
+    return false;
+}
+
+bool LinuxEGLContext::SwapBuffers()
+{
+    /* Headless context has no swap chain */
+    return false;
+}
+
+void LinuxEGLContext::Resize(const Extent2D& resolution)
+{
+    // dummy
+}
+
+std::uint32_t LinuxEGLContext::GetSamples() const
+{
+    return 1;
+}
+
+std::unique_ptr<GLContext> LinuxEGLContext::CreateSharedUploadContext(const RendererConfigurationOpenGL& config)
+{
+    return MakeUnique<LinuxEGLContext>(config, *this);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool LinuxEGLContext::Activate(bool activate)
+{
+    if (activate)
+    {
+        /* Bind OpenGL API first, since the current rendering API is a per-thread state in EGL */
+        eglBindAPI(EGL_OPENGL_API);
+        return (eglMakeCurrent(display_, surface_, surface_, context_) == EGL_TRUE);
+    }
+    else
+        return (eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT) == EGL_TRUE);
+}
+
+void LinuxEGLContext::InitializeDisplay()
+{
+    /* Prefer a display that does not require any window system */
+    const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+
+    auto eglGetPlatformDisplayEXT = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+    if (eglGetPlatformDisplayEXT != nullptr)
+    {
+        if (HasEGLExtension(clientExtensions, "EGL_MESA_platform_surfaceless"))
+        {
+            /* Use surfaceless platform of Mesa (render nodes and software rasterizer) */
+            display_ = eglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+        }
+        else if (HasEGLExtension(clientExtensions, "EGL_EXT_platform_device"))
+        {
+            /* Use first device that is enumerated by the driver */
+            auto eglQueryDevicesEXT = reinterpret_cast<PFNEGLQUERYDEVICESEXTPROC>(eglGetProcAddress("eglQueryDevicesEXT"));
+            EGLDeviceEXT device = nullptr;
+            EGLint numDevices = 0;
+            if (eglQueryDevicesEXT != nullptr && eglQueryDevicesEXT(1, &device, &numDevices) == EGL_TRUE && numDevices > 0)
+                display_ = eglGetPlatformDisplayEXT(EGL_PLATFORM_DEVICE_EXT, device, nullptr);
+        }
+    }
+
+    /* Fall back to default display */
+    if (display_ == EGL_NO_DISPLAY)
+        display_ = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+    if (display_ == EGL_NO_DISPLAY)
+        throw std::runtime_error("failed to get EGL display for headless OpenGL context");
+
+    /* Initialize EGL display connection (ignore major/minor output parameters) */
+    if (eglInitialize(display_, nullptr, nullptr) != EGL_TRUE)
+        throw std::runtime_error("failed to initialize EGL display for headless OpenGL context");
+
+    ownDisplay_ = true;
+
+    if (eglBindAPI(EGL_OPENGL_API) != EGL_TRUE)
+        throw std::runtime_error("failed to bind OpenGL API for EGL display");
+
+    surfaceless_ = HasEGLExtension(eglQueryString(display_, EGL_EXTENSIONS), "EGL_KHR_surfaceless_context");
+}
+
+void LinuxEGLContext::ChooseConfig()
+{
+    /* Choose configuration that supports pbuffers, in case surfaceless contexts are not available */
+    const EGLint attribs[] =
+    {
+        EGL_SURFACE_TYPE,       (surfaceless_ ? 0 : EGL_PBUFFER_BIT),
+        EGL_RENDERABLE_TYPE,    EGL_OPENGL_BIT,
+        EGL_RED_SIZE,           8,
+        EGL_GREEN_SIZE,         8,
+        EGL_BLUE_SIZE,          8,
+        EGL_ALPHA_SIZE,         8,
+        EGL_NONE
+    };
+
+    EGLint numConfigs = 0;
+    if (eglChooseConfig(display_, attribs, &config_, 1, &numConfigs) != EGL_TRUE || numConfigs < 1)
+        throw std::runtime_error("failed to choose EGL configuration for headless OpenGL context");
+}
+
+void LinuxEGLContext::CreateContext(const RendererConfigurationOpenGL& config, EGLContext sharedContext)
+{
+    if (config.contextProfile == OpenGLContextProfile::CoreProfile)
+    {
+        /* Request core profile; drivers return the highest version that is compatible with the requested one (at least GL 3.2) */
+        EGLint major = 3, minor = 2;
+
+        if (!(config.majorVersion == 0 && config.minorVersion == 0))
+        {
+            major = config.majorVersion;
+            minor = config.minorVersion;
+        }
+
+        const EGLint contextAttribs[] =
+        {
+            EGL_CONTEXT_MAJOR_VERSION,          major,
+            EGL_CONTEXT_MINOR_VERSION,          minor,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK,    EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+            #ifdef LLGL_DEBUG
+            EGL_CONTEXT_OPENGL_DEBUG,           EGL_TRUE,
+            #endif
+            EGL_NONE
+        };
+
+        context_ = eglCreateContext(display_, config_, sharedContext, contextAttribs);
+
+        if (context_ == EGL_NO_CONTEXT)
+            Log::PostReport(Log::ReportType::Error, "failed to create OpenGL core profile with EGL");
+    }
+
+    if (context_ == EGL_NO_CONTEXT)
+    {
+        /* Create compatibility profile */
+        context_ = eglCreateContext(display_, config_, sharedContext, nullptr);
+        if (context_ == EGL_NO_CONTEXT)
+            throw std::runtime_error("failed to create headless OpenGL context with EGL");
+    }
+}
+
+void LinuxEGLContext::CreateSurface()
+{
+    /* Activate context without any surface if supported, otherwise use minimal pbuffer surface */
+    if (!surfaceless_)
+    {
+        const EGLint surfaceAttribs[] =
+        {
+            EGL_WIDTH,  1,
+            EGL_HEIGHT, 1,
+            EGL_NONE
+        };
+
+        surface_ = eglCreatePbufferSurface(display_, config_, surfaceAttribs);
+        if (surface_ == EGL_NO_SURFACE)
+            throw std::runtime_error("failed to create EGL pbuffer surface for headless OpenGL context");
+    }
+}
+
+void LinuxEGLContext::DeleteContext()
+{
+    /* Only release this context if it is current, since another context on the same display might be current on this thread */
+    if (eglGetCurrentContext() == context_)
+        eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (surface_ != EGL_NO_SURFACE)
+        eglDestroySurface(display_, surface_);
+    if (context_ != EGL_NO_CONTEXT)
+        eglDestroyContext(display_, context_);
+    if (ownDisplay_)
+        eglTerminate(display_);
+}
+
+
+} // /namespace LLGL
+
+
+#endif // /LLGL_GL_ENABLE_EGL
+
+
+
+// ================================================================================
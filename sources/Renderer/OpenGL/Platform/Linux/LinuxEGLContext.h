@@ -0,0 +1,81 @@
+/*
+ * LinuxEGLContext.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_LINUX_EGL_CONTEXT_H
+#define LLGL_LINUX_EGL_CONTEXT_H
+
+
+#ifdef LLGL_GL_ENABLE_EGL
+
+
+#include "../GLContext.h"
+#include "../../OpenGL.h"
+#include <LLGL/RendererConfiguration.h>
+#include <EGL/egl.h>
+
+
+namespace LLGL
+{
+
+
+/*
+Implementation of the <GLContext> interface for GNU/Linux and wrapper for a headless EGL context.
+This context does not require a window or an X server, so it can be used with render nodes only (e.g. on a server or in a CI environment).
+It uses EGL_KHR_surfaceless_context if available, and a 1x1 pbuffer surface otherwise.
+*/
+class LinuxEGLContext : public GLContext
+{
+
+    public:
+
+        LinuxEGLContext(const RendererConfigurationOpenGL& config);
+
+        // Creates another headless context on the same EGL display that shares all GL objects with the specified context.
+        LinuxEGLContext(const RendererConfigurationOpenGL& config, LinuxEGLContext& sharedContext);
+
+        ~LinuxEGLContext();
+
+        bool SetSwapInterval(int interval) override;
+        bool SwapBuffers() override;
+        void Resize(const Extent2D& resolution) override;
+        std::uint32_t GetSamples() const override;
+
+        std::unique_ptr<GLContext> CreateSharedUploadContext(const RendererConfigurationOpenGL& config) override;
+
+    private:
+
+        bool Activate(bool activate) override;
+
+        void InitializeDisplay();
+        void ChooseConfig();
+        void CreateContext(const RendererConfigurationOpenGL& config, EGLContext sharedContext);
+        void CreateSurface();
+        void DeleteContext();
+
+    private:
+
+        EGLDisplay  display_        = EGL_NO_DISPLAY;
+        EGLConfig   config_         = nullptr;
+        EGLContext  context_        = EGL_NO_CONTEXT;
+        EGLSurface  surface_        = EGL_NO_SURFACE;
+        bool        surfaceless_    = false;
+        bool        ownDisplay_     = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif // /LLGL_GL_ENABLE_EGL
+
+
+#endif
+
+
+
+// ================================================================================
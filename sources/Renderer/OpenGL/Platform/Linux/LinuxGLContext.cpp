@@ -6,6 +6,7 @@
  */
 
 #include "LinuxGLContext.h"
+#include "LinuxEGLContext.h"
 #include "../../Ext/GLExtensions.h"
 #include "../../Ext/GLExtensionLoader.h"
 #include "../../GLCore.h"
@@ -44,6 +45,15 @@ std::unique_ptr<GLContext> GLContext::Create(
     return MakeUnique<LinuxGLContext>(desc, config, surface, sharedContextGLX);
 }
 
+std::unique_ptr<GLContext> GLContext::CreateHeadless(const RendererConfigurationOpenGL& config)
+{
+    #ifdef LLGL_GL_ENABLE_EGL
+    return MakeUnique<LinuxEGLContext>(config);
+    #else
+    return nullptr;
+    #endif
+}
+
 
 /*
  * LinuxGLContext class
@@ -54,14 +64,19 @@ LinuxGLContext::LinuxGLContext(
     const RendererConfigurationOpenGL&  config,
     Surface&                            surface,
     LinuxGLContext*                     sharedContext)
-:
-    GLContext { sharedContext }
 {
     NativeHandle nativeHandle = {};
     surface.GetNativeHandle(&nativeHandle, sizeof(nativeHandle));
     CreateContext(desc, config, nativeHandle, sharedContext);
 }
 
+LinuxGLContext::LinuxGLContext(
+    const RendererConfigurationOpenGL&  config,
+    LinuxGLContext&                     sharedContext)
+{
+    CreateOffscreenContext(config, sharedContext);
+}
+
 LinuxGLContext::~LinuxGLContext()
 {
     DeleteContext();
@@ -92,6 +107,11 @@ std::uint32_t LinuxGLContext::GetSamples() const
     return samples_;
 }
 
+std::unique_ptr<GLContext> LinuxGLContext::CreateSharedUploadContext(const RendererConfigurationOpenGL& config)
+{
+    return MakeUnique<LinuxGLContext>(config, *this);
+}
+
 
 /*
  * ======= Private: =======
@@ -100,9 +120,9 @@ std::uint32_t LinuxGLContext::GetSamples() const
 bool LinuxGLContext::Activate(bool activate)
 {
     if (activate)
-        return glXMakeCurrent(display_, wnd_, glc_);
+        return glXMakeCurrent(display_, (pbuffer_ != 0 ? pbuffer_ : wnd_), glc_);
     else
-        return glXMakeCurrent(nullptr, 0, 0);
+        return glXMakeCurrent(display_, None, nullptr);
 }
 
 void LinuxGLContext::CreateContext(
@@ -150,9 +170,88 @@ void LinuxGLContext::CreateContext(
     }
 }
 
+void LinuxGLContext::CreateOffscreenContext(const RendererConfigurationOpenGL& config, LinuxGLContext& sharedContext)
+{
+    /* Open separate X11 display connection, so this context can be used on another thread without XInitThreads */
+    display_ = XOpenDisplay(DisplayString(sharedContext.display_));
+    if (!display_)
+        throw std::runtime_error("failed to open X11 display for offscreen OpenGL context");
+
+    ownDisplay_ = true;
+
+    /* Choose framebuffer configuration that supports pbuffers */
+    const int fbAttribs[] =
+    {
+        GLX_DRAWABLE_TYPE,  GLX_PBUFFER_BIT,
+        GLX_RENDER_TYPE,    GLX_RGBA_BIT,
+        GLX_RED_SIZE,       8,
+        GLX_GREEN_SIZE,     8,
+        GLX_BLUE_SIZE,      8,
+        GLX_ALPHA_SIZE,     8,
+        None
+    };
+
+    int fbCount = 0;
+    GLXFBConfig* fbcList = glXChooseFBConfig(display_, DefaultScreen(display_), fbAttribs, &fbCount);
+    if (fbcList == nullptr || fbCount < 1)
+        throw std::runtime_error("failed to choose GLX framebuffer configuration for offscreen OpenGL context");
+
+    if (config.contextProfile == OpenGLContextProfile::CoreProfile)
+    {
+        /* Use same GL version as the shared context, which must be current on the calling thread */
+        int major = config.majorVersion, minor = config.minorVersion;
+        if (major == 0 && minor == 0)
+        {
+            glGetIntegerv(GL_MAJOR_VERSION, &major);
+            glGetIntegerv(GL_MINOR_VERSION, &minor);
+        }
+
+        auto glXCreateContextAttribsARB = (GXLCREATECONTEXTATTRIBARBPROC)glXGetProcAddressARB(reinterpret_cast<const GLubyte*>("glXCreateContextAttribsARB"));
+        if (glXCreateContextAttribsARB != nullptr && major >= 3)
+        {
+            const int contextAttribs[] =
+            {
+                GLX_CONTEXT_MAJOR_VERSION_ARB, major,
+                GLX_CONTEXT_MINOR_VERSION_ARB, minor,
+                GLX_CONTEXT_PROFILE_MASK_ARB,  GLX_CONTEXT_CORE_PROFILE_BIT_ARB,
+                None
+            };
+            glc_ = glXCreateContextAttribsARB(display_, fbcList[0], sharedContext.glc_, True, contextAttribs);
+        }
+    }
+
+    /* Fall back to compatibility profile */
+    if (!glc_)
+        glc_ = glXCreateNewContext(display_, fbcList[0], GLX_RGBA_TYPE, sharedContext.glc_, True);
+
+    /* Create minimal pbuffer, since not all GLX implementations allow to make a context current without drawable */
+    if (glc_)
+    {
+        const int pbufferAttribs[] =
+        {
+            GLX_PBUFFER_WIDTH,  1,
+            GLX_PBUFFER_HEIGHT, 1,
+            None
+        };
+        pbuffer_ = glXCreatePbuffer(display_, fbcList[0], pbufferAttribs);
+    }
+
+    XFree(fbcList);
+
+    if (!glc_)
+        throw std::runtime_error("failed to create offscreen OpenGL context with GLX");
+    if (!pbuffer_)
+        throw std::runtime_error("failed to create GLX pbuffer for offscreen OpenGL context");
+}
+
 void LinuxGLContext::DeleteContext()
 {
-    glXDestroyContext(display_, glc_);
+    if (pbuffer_)
+        glXDestroyPbuffer(display_, pbuffer_);
+    if (glc_)
+        glXDestroyContext(display_, glc_);
+    if (ownDisplay_)
+        XCloseDisplay(display_);
 }
 
 GLXContext LinuxGLContext::CreateContextCoreProfile(GLXContext glcShared, int major, int minor)
@@ -217,7 +316,7 @@ GLXContext LinuxGLContext::CreateContextCoreProfile(GLXContext glcShared, int ma
                 None
             };
 
-            auto glc = glXCreateContextAttribsARB(display_, fbcList[0], nullptr, True, contextAttribs);
+            auto glc = glXCreateContextAttribsARB(display_, fbcList[0], glcShared, True, contextAttribs);
 
             XFree(fbcList);
 
@@ -32,6 +32,13 @@ class LinuxGLContext : public GLContext
             Surface&                            surface,
             LinuxGLContext*                     sharedContext
         );
+
+        // Creates an offscreen context with a 1x1 pbuffer on its own X11 display connection that shares all GL objects with the specified context.
+        LinuxGLContext(
+            const RendererConfigurationOpenGL&  config,
+            LinuxGLContext&                     sharedContext
+        );
+
         ~LinuxGLContext();
 
         bool SetSwapInterval(int interval) override;
@@ -39,6 +46,8 @@ class LinuxGLContext : public GLContext
         void Resize(const Extent2D& resolution) override;
         std::uint32_t GetSamples() const override;
 
+        std::unique_ptr<GLContext> CreateSharedUploadContext(const RendererConfigurationOpenGL& config) override;
+
     private:
 
         bool Activate(bool activate) override;
@@ -49,6 +58,7 @@ class LinuxGLContext : public GLContext
             const NativeHandle&                 nativeHandle,
             LinuxGLContext*                     sharedContext
         );
+        void CreateOffscreenContext(const RendererConfigurationOpenGL& config, LinuxGLContext& sharedContext);
         void DeleteContext();
 
         GLXContext CreateContextCoreProfile(GLXContext glcShared, int major, int minor);
@@ -60,6 +70,8 @@ class LinuxGLContext : public GLContext
         ::Window        wnd_        = 0;
         XVisualInfo*    visual_     = nullptr;
         GLXContext      glc_        = nullptr;
+        GLXPbuffer      pbuffer_    = 0;
+        bool            ownDisplay_ = false;
         std::uint32_t   samples_    = 1;
 
 };
@@ -28,13 +28,17 @@ std::unique_ptr<GLContext> GLContext::Create(
     return MakeUnique<MacOSGLContext>(desc, config, surface, sharedContextGLNS);
 }
 
+std::unique_ptr<GLContext> GLContext::CreateHeadless(const RendererConfigurationOpenGL& /*config*/)
+{
+    /* Headless contexts are not supported on this platform */
+    return nullptr;
+}
+
 MacOSGLContext::MacOSGLContext(
     const RenderContextDescriptor&      desc,
     const RendererConfigurationOpenGL&  config,
     Surface&                            surface,
     MacOSGLContext*                     sharedContext)
-:
-    LLGL::GLContext { sharedContext }
 {
     if (!CreatePixelFormat(desc, config))
         throw std::runtime_error("failed to find suitable OpenGL pixel format");
@@ -34,6 +34,12 @@ std::unique_ptr<GLContext> GLContext::Create(
     return MakeUnique<Win32GLContext>(desc, config, surface, sharedContextWGL);
 }
 
+std::unique_ptr<GLContext> GLContext::CreateHeadless(const RendererConfigurationOpenGL& /*config*/)
+{
+    /* Headless contexts are not supported on this platform */
+    return nullptr;
+}
+
 
 /*
  * Win32GLContext class
@@ -45,9 +51,8 @@ Win32GLContext::Win32GLContext(
     Surface&                            surface,
     Win32GLContext*                     sharedContext)
 :
-    GLContext { sharedContext                                     },
-    samples_  { static_cast<int>(GetClampedSamples(desc.samples)) },
-    surface_  { surface                                           }
+    samples_ { static_cast<int>(GetClampedSamples(desc.samples)) },
+    surface_ { surface                                           }
 {
     /* Initialize context parameters */
     WGLContextParams contextParams;
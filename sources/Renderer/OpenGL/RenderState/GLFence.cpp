@@ -65,6 +65,12 @@ bool GLFence::Wait(GLuint64 timeout)
     }
 }
 
+void GLFence::ServerWait()
+{
+    if (HasExtension(GLExt::ARB_sync) && sync_ != 0)
+        glWaitSync(sync_, 0, GL_TIMEOUT_IGNORED);
+}
+
 
 } // /namespace LLGL
 
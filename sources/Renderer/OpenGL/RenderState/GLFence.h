@@ -32,6 +32,9 @@ class GLFence final : public Fence
         void Submit();
         bool Wait(GLuint64 timeout);
 
+        // Makes the GL server of the current context wait for this fence without blocking the calling thread (e.g. for a fence of another shared context).
+        void ServerWait();
+
     private:
 
         GLsync          sync_ = 0;
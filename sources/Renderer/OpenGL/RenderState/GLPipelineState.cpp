@@ -58,8 +58,16 @@ GLPipelineState::~GLPipelineState()
     GLStatePool::Get().ReleaseShaderBindingLayout(std::move(shaderBindingLayout_));
 }
 
+bool GLPipelineState::IsReady() const
+{
+    return shaderProgram_->IsLinkComplete();
+}
+
 void GLPipelineState::Bind(GLStateManager& stateMngr)
 {
+    /* Wait until the shader program has been linked, since it is about to be used */
+    shaderProgram_->WaitForLink();
+
     /* Bind shader program and discard rasterizer if there is no fragment shader */
     stateMngr.BindShaderProgram(shaderProgram_->GetID());
 
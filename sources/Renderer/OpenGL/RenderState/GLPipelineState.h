@@ -37,6 +37,10 @@ class GLPipelineState : public PipelineState
         );
         ~GLPipelineState();
 
+        bool IsReady() const override;
+
+    public:
+
         // Binds this pipeline state with the specified GL state manager.
         virtual void Bind(GLStateManager& stateMngr);
 
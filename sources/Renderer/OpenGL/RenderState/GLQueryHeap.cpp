@@ -74,6 +74,15 @@ GLQueryHeap::GLQueryHeap(const QueryHeapDescriptor& desc) :
     }
     else
     #endif
+    #ifdef GL_ARB_timer_query
+    if (desc.type == QueryType::TimeElapsed && HasExtension(GLExt::ARB_timer_query))
+    {
+        /* Allocate two IDs for start and end timestamps, since GL_TIME_ELAPSED queries can not be nested */
+        groupSize_  = 2;
+        timestamps_ = true;
+    }
+    else
+    #endif
     {
         /* Allocate single ID */
         groupSize_ = 1;
@@ -106,6 +115,15 @@ void GLQueryHeap::SetName(const char* name)
 
 void GLQueryHeap::Begin(std::uint32_t query)
 {
+    #ifdef GL_ARB_timer_query
+    if (timestamps_)
+    {
+        /* Record start timestamp */
+        glQueryCounter(ids_[groupSize_ * query], GL_TIMESTAMP);
+        return;
+    }
+    #endif
+
     /* Begin all queries in forward order: [0, n) */
     for (std::size_t i = 0; i < groupSize_; ++i)
         glBeginQuery(MapQueryType(GetType(), i), ids_[i + groupSize_ * query]);
@@ -113,6 +131,15 @@ void GLQueryHeap::Begin(std::uint32_t query)
 
 void GLQueryHeap::End(std::uint32_t query)
 {
+    #ifdef GL_ARB_timer_query
+    if (timestamps_)
+    {
+        /* Record end timestamp */
+        glQueryCounter(ids_[groupSize_ * query + 1], GL_TIMESTAMP);
+        return;
+    }
+    #endif
+
     /* End all queries in reverse order: (n, 0] */
     for (std::size_t i = 1; i <= groupSize_; ++i)
         glEndQuery(MapQueryType(GetType(), groupSize_ - i));
@@ -51,10 +51,17 @@ class GLQueryHeap final : public QueryHeap
             return groupSize_;
         }
 
+        // Returns true if each query consists of a start and end timestamp (for QueryType::TimeElapsed with GL_ARB_timer_query).
+        inline bool HasTimestamps() const
+        {
+            return timestamps_;
+        }
+
     private:
 
         std::vector<GLuint> ids_;
         std::uint32_t       groupSize_  = 1;
+        bool                timestamps_ = false;
 
 };
 
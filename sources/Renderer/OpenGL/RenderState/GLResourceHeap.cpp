@@ -22,6 +22,7 @@
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
 #include <LLGL/ResourceHeapFlags.h>
+#include <algorithm>
 #include <string.h>
 
 
@@ -134,6 +135,42 @@ static GLbitfield GetMemoryBarrierBitfield(const std::vector<ResourceViewDescrip
 
 #endif // /GL_ARB_shader_image_load_store
 
+#ifdef GL_ARB_bindless_texture
+
+// Returns the texture handle for the specified resource view and makes it resident in the active GL context
+static GLuint64 AcquireResidentTextureHandle(const ResourceViewDescriptor& rvDesc)
+{
+    auto resource = rvDesc.resource;
+    if (resource == nullptr || resource->GetResourceType() != ResourceType::Texture)
+        throw std::invalid_argument("cannot create bindless texture table with non-texture resource");
+
+    auto textureGL = LLGL_CAST(GLTexture*, resource);
+    if (textureGL->IsRenderbuffer())
+        throw std::invalid_argument("cannot create bindless texture table with renderbuffer");
+
+    auto handle = glGetTextureHandleARB(textureGL->GetID());
+    GLStateManager::Get().MakeTextureHandleResident(handle, textureGL->GetID());
+
+    return handle;
+}
+
+// Creates a shader storage buffer with the specified texture handles
+static GLuint CreateBindlessTableBuffer(const std::vector<GLuint64>& handles)
+{
+    GLuint buffer = 0;
+    glGenBuffers(1, &buffer);
+    GLStateManager::Get().BindBuffer(GLBufferTarget::SHADER_STORAGE_BUFFER, buffer);
+    glBufferData(
+        GL_SHADER_STORAGE_BUFFER,
+        static_cast<GLsizeiptr>(handles.size() * sizeof(GLuint64)),
+        handles.data(),
+        GL_STATIC_DRAW
+    );
+    return buffer;
+}
+
+#endif // /GL_ARB_bindless_texture
+
 // Returns the resource of the specified descriptor as <GLTexture> if it describes a texture-view.
 static GLTexture* GetAsTextureView(const ResourceViewDescriptor& rvDesc)
 {
@@ -162,7 +199,7 @@ GLResourceHeap::GLResourceHeap(const ResourceHeapDescriptor& desc)
 
     /* Validate binding descriptors */
     const auto& bindings            = pipelineLayoutGL->GetBindings();
-    const auto  numBindings         = bindings.size();
+    const auto  numBindings         = GetNumResourceViewsPerSet(bindings, desc.bindless);
     const auto  numResourceViews    = desc.resourceViews.size();
 
     if (numBindings == 0)
@@ -170,6 +207,8 @@ GLResourceHeap::GLResourceHeap(const ResourceHeapDescriptor& desc)
     if (numResourceViews % numBindings != 0)
         throw std::invalid_argument("failed to create resource heap because due to mismatch between number of resources and bindings");
 
+    numDescriptorSets_ = static_cast<std::uint32_t>(numResourceViews / numBindings);
+
     /* Determine memory barriers */
     #ifdef GL_ARB_shader_image_load_store
     barriers_ = GetMemoryBarrierBitfield(desc.resourceViews);
@@ -177,34 +216,17 @@ GLResourceHeap::GLResourceHeap(const ResourceHeapDescriptor& desc)
     barriers_ = 0;
     #endif // /GL_ARB_shader_image_load_store
 
-    /* Create all texture views */
-    for (std::size_t i = 0; i < numResourceViews; i += numBindings)
+    if (desc.bindless)
     {
-        ResourceBindingIterator resourceIterator{ desc.resourceViews, bindings, i };
-        BuildTextureViews(resourceIterator, BindFlags::Sampled);
-        BuildTextureViews(resourceIterator, BindFlags::Storage);
+        /* Build bindless texture tables and segments for all remaining bindings */
+        std::vector<BindingDescriptor>      regularBindings;
+        std::vector<ResourceViewDescriptor> regularResourceViews;
+        BuildBindlessTables(bindings, desc.resourceViews, regularBindings, regularResourceViews);
+        if (!regularBindings.empty())
+            BuildResourceViewSegments(regularBindings, regularResourceViews);
     }
-
-    /* Build all resource view segments */
-    for (std::size_t i = 0; i < numResourceViews; i += numBindings)
-    {
-        /* Reset segment header, only one is required */
-        ResourceBindingIterator resourceIterator{ desc.resourceViews, bindings, i };
-        ::memset(&segmentation_, 0, sizeof(segmentation_));
-
-        /* Build resource view segments for current descriptor set */
-        BuildUniformBufferSegments(resourceIterator);
-        BuildStorageBufferSegments(resourceIterator);
-        BuildTextureSegments(resourceIterator);
-        BuildImageTextureSegments(resourceIterator);
-        BuildSamplerSegments(resourceIterator);
-        #ifdef LLGL_GL_ENABLE_OPENGL2X
-        BuildGL2XSamplerSegments(resourceIterator);
-        #endif
-    }
-
-    /* Store buffer stride */
-    stride_ = GetSegmentationHeapSize() / (numResourceViews / numBindings);
+    else
+        BuildResourceViewSegments(bindings, desc.resourceViews);
 }
 
 GLResourceHeap::~GLResourceHeap()
@@ -213,6 +235,9 @@ GLResourceHeap::~GLResourceHeap()
     const GLuint* textureViewIDs = reinterpret_cast<const GLuint*>(buffer_.data());
     for (std::size_t i = 0; i < numTextureViews_; ++i)
         GLTextureViewPool::Get().ReleaseTextureView(textureViewIDs[i]);
+
+    /* Release all bindless texture tables */
+    ReleaseBindlessTables();
 }
 
 static void BindBuffersBaseSegment(GLStateManager& stateMngr, const std::int8_t*& byteAlignedBuffer, const GLBufferTarget bufferTarget)
@@ -308,7 +333,7 @@ static void BindTexturesWithGL2XSamplersSegment(GLStateManager& stateMngr, const
 
 std::uint32_t GLResourceHeap::GetNumDescriptorSets() const
 {
-    return static_cast<std::uint32_t>(stride_ > 0 ? GetSegmentationHeapSize() / stride_ : 0);
+    return numDescriptorSets_;
 }
 
 void GLResourceHeap::Bind(GLStateManager& stateMngr, std::uint32_t firstSet)
@@ -357,6 +382,17 @@ void GLResourceHeap::Bind(GLStateManager& stateMngr, std::uint32_t firstSet)
         for (std::uint8_t i = 0; i < segmentation_.numSamplerSegments; ++i)
             BindSamplersSegment(stateMngr, byteAlignedBuffer);
     }
+
+    /* Bind shader storage buffers of all bindless texture tables */
+    const auto numTables = bindlessTableSlots_.size();
+    for (std::size_t i = 0; i < numTables; ++i)
+    {
+        stateMngr.BindBufferBase(
+            GLBufferTarget::SHADER_STORAGE_BUFFER,
+            bindlessTableSlots_[i],
+            bindlessTableBuffers_[firstSet * numTables + i]
+        );
+    }
 }
 
 
@@ -364,6 +400,107 @@ void GLResourceHeap::Bind(GLStateManager& stateMngr, std::uint32_t firstSet)
  * ======= Private: =======
  */
 
+void GLResourceHeap::BuildResourceViewSegments(
+    const std::vector<BindingDescriptor>&       bindings,
+    const std::vector<ResourceViewDescriptor>&  resourceViews)
+{
+    const auto numBindings      = bindings.size();
+    const auto numResourceViews = resourceViews.size();
+
+    /* Create all texture views */
+    for (std::size_t i = 0; i < numResourceViews; i += numBindings)
+    {
+        ResourceBindingIterator resourceIterator{ resourceViews, bindings, i };
+        BuildTextureViews(resourceIterator, BindFlags::Sampled);
+        BuildTextureViews(resourceIterator, BindFlags::Storage);
+    }
+
+    /* Build all resource view segments */
+    for (std::size_t i = 0; i < numResourceViews; i += numBindings)
+    {
+        /* Reset segment header, only one is required */
+        ResourceBindingIterator resourceIterator{ resourceViews, bindings, i };
+        ::memset(&segmentation_, 0, sizeof(segmentation_));
+
+        /* Build resource view segments for current descriptor set */
+        BuildUniformBufferSegments(resourceIterator);
+        BuildStorageBufferSegments(resourceIterator);
+        BuildTextureSegments(resourceIterator);
+        BuildImageTextureSegments(resourceIterator);
+        BuildSamplerSegments(resourceIterator);
+        #ifdef LLGL_GL_ENABLE_OPENGL2X
+        BuildGL2XSamplerSegments(resourceIterator);
+        #endif
+    }
+
+    /* Store buffer stride */
+    stride_ = GetSegmentationHeapSize() / (numResourceViews / numBindings);
+}
+
+void GLResourceHeap::BuildBindlessTables(
+    const std::vector<BindingDescriptor>&       bindings,
+    const std::vector<ResourceViewDescriptor>&  resourceViews,
+    std::vector<BindingDescriptor>&             regularBindings,
+    std::vector<ResourceViewDescriptor>&        regularResourceViews)
+{
+    #ifdef GL_ARB_bindless_texture
+
+    if (!HasExtension(GLExt::ARB_bindless_texture) || !HasExtension(GLExt::ARB_shader_storage_buffer_object))
+        throw std::runtime_error("bindless resource heaps require the extensions GL_ARB_bindless_texture and GL_ARB_shader_storage_buffer_object");
+
+    /* Store binding slots of all tables and keep the remaining bindings for regular segments */
+    for (const auto& binding : bindings)
+    {
+        if (IsBindlessTableBinding(binding))
+            bindlessTableSlots_.push_back(binding.slot);
+        else
+            regularBindings.push_back(binding);
+    }
+
+    /* Write resident texture handles into one shader storage buffer for each table of each descriptor set */
+    std::vector<GLuint64> handles;
+
+    for (std::size_t i = 0; i < resourceViews.size();)
+    {
+        for (const auto& binding : bindings)
+        {
+            if (IsBindlessTableBinding(binding))
+            {
+                handles.resize(std::max(1u, binding.arraySize));
+                for (auto& handle : handles)
+                    handle = AcquireResidentTextureHandle(resourceViews[i++]);
+
+                bindlessTextureHandles_.insert(bindlessTextureHandles_.end(), handles.begin(), handles.end());
+                bindlessTableBuffers_.push_back(CreateBindlessTableBuffer(handles));
+            }
+            else
+                regularResourceViews.push_back(resourceViews[i++]);
+        }
+    }
+
+    #else
+
+    throw std::runtime_error("bindless resource heaps not supported for this OpenGL profile");
+
+    #endif // /GL_ARB_bindless_texture
+}
+
+void GLResourceHeap::ReleaseBindlessTables()
+{
+    #ifdef GL_ARB_bindless_texture
+
+    for (auto buffer : bindlessTableBuffers_)
+    {
+        GLStateManager::NotifyBufferRelease(buffer, GLBufferTarget::SHADER_STORAGE_BUFFER);
+        glDeleteBuffers(1, &buffer);
+    }
+
+    for (auto handle : bindlessTextureHandles_)
+        GLStateManager::Get().MakeTextureHandleNonResident(handle);
+
+    #endif // /GL_ARB_bindless_texture
+}
+
 using GLResourceBindingFunc = std::function<
     void(
         GLResourceBinding&              binding,
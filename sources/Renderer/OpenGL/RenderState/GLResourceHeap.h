@@ -23,6 +23,8 @@ namespace LLGL
 class GLStateManager;
 class ResourceBindingIterator;
 struct ResourceHeapDescriptor;
+struct ResourceViewDescriptor;
+struct BindingDescriptor;
 struct GLResourceBinding;
 
 /*
@@ -49,6 +51,21 @@ class GLResourceHeap final : public ResourceHeap
         using GLResourceBindingIter = std::vector<GLResourceBinding>::const_iterator;
         using BuildSegmentFunc = std::function<void(GLResourceBindingIter begin, GLsizei count)>;
 
+        void BuildResourceViewSegments(
+            const std::vector<BindingDescriptor>&       bindings,
+            const std::vector<ResourceViewDescriptor>&  resourceViews
+        );
+
+        // Builds the bindless texture tables and returns the remaining bindings and resource views that are built as regular segments.
+        void BuildBindlessTables(
+            const std::vector<BindingDescriptor>&       bindings,
+            const std::vector<ResourceViewDescriptor>&  resourceViews,
+            std::vector<BindingDescriptor>&             regularBindings,
+            std::vector<ResourceViewDescriptor>&        regularResourceViews
+        );
+
+        void ReleaseBindlessTables();
+
         void BuildTextureViews(ResourceBindingIterator& resourceIterator, long bindFlags);
 
         void BuildBufferSegments(ResourceBindingIterator& resourceIterator, long bindFlags, std::uint8_t& numSegments);
@@ -107,6 +124,11 @@ class GLResourceHeap final : public ResourceHeap
         std::vector<std::int8_t>    buffer_;                    // Raw buffer with resource binding information
 
         GLbitfield                  barriers_           = 0;    // Bitmask for glMemoryBarrier
+        std::uint32_t               numDescriptorSets_  = 0;
+
+        std::vector<GLuint>         bindlessTableSlots_;        // Binding slots of the bindless texture tables within one descriptor set
+        std::vector<GLuint>         bindlessTableBuffers_;      // Shader storage buffers with the texture handles of all bindless tables
+        std::vector<GLuint64>       bindlessTextureHandles_;    // Resident texture handles of all bindless tables
 
 };
 
@@ -21,6 +21,8 @@
 #include "../../../Core/Helper.h"
 #include "../../../Core/Assertion.h"
 #include <functional>
+#include <algorithm>
+#include <vector>
 
 
 namespace LLGL
@@ -152,9 +154,12 @@ const std::uint32_t         GLStateManager::numTextureTargets;
 const std::uint32_t         GLStateManager::numStatesExt;
 #endif // /LLGL_GL_ENABLE_VENDOR_EXT
 
-GLStateManager*             GLStateManager::active_;
+thread_local GLStateManager* GLStateManager::active_;
 GLStateManager::GLLimits    GLStateManager::commonLimits_;
 
+// State managers of all GL contexts that have been made current on the calling thread; they are notified about released shared objects
+static thread_local std::vector<GLStateManager*> g_threadStateMngrs;
+
 struct GLStateManager::GLIntermediateBufferWriteMasks
 {
     bool        isDepthMaskInvalidated      = false;
@@ -190,6 +195,23 @@ GLStateManager::GLStateManager()
         GLStateManager::active_ = this;
 }
 
+GLStateManager::~GLStateManager()
+{
+    /* Unregister from notifications; state managers are destroyed on the same thread their GL contexts are used on (except for finished worker threads) */
+    auto it = std::find(g_threadStateMngrs.begin(), g_threadStateMngrs.end(), this);
+    if (it != g_threadStateMngrs.end())
+        g_threadStateMngrs.erase(it);
+    if (GLStateManager::active_ == this)
+        GLStateManager::active_ = nullptr;
+}
+
+void GLStateManager::SetActive(GLStateManager* stateMngr)
+{
+    GLStateManager::active_ = stateMngr;
+    if (stateMngr != nullptr && std::find(g_threadStateMngrs.begin(), g_threadStateMngrs.end(), stateMngr) == g_threadStateMngrs.end())
+        g_threadStateMngrs.push_back(stateMngr);
+}
+
 void GLStateManager::DetermineExtensionsAndLimits()
 {
     DetermineLimits();
@@ -207,6 +229,33 @@ void GLStateManager::NotifyRenderTargetHeight(GLint height)
     //TODO...
 }
 
+void GLStateManager::InvalidateBoundObjects()
+{
+    Fill(bufferState_.boundBuffers, UINT_MAX);
+    Fill(framebufferState_.boundFramebuffers, UINT_MAX);
+    Fill(samplerState_.boundSamplers, UINT_MAX);
+    for (auto& layer : textureState_.layers)
+        Fill(layer.boundTextures, UINT_MAX);
+    renderbufferState_.boundRenderbuffer    = UINT_MAX;
+    vertexArrayState_.boundVertexArray      = UINT_MAX;
+    shaderState_.boundProgram               = UINT_MAX;
+}
+
+void GLStateManager::NotifyDirectStateChanges(long flags, GLuint drawIndirectBuffer, GLuint dispatchIndirectBuffer, const GLfloat* blendColor)
+{
+    if ((flags & DirectStateFlags::DrawIndirectBuffer) != 0)
+        bufferState_.boundBuffers[static_cast<std::size_t>(GLBufferTarget::DRAW_INDIRECT_BUFFER)] = drawIndirectBuffer;
+    if ((flags & DirectStateFlags::DispatchIndirectBuffer) != 0)
+        bufferState_.boundBuffers[static_cast<std::size_t>(GLBufferTarget::DISPATCH_INDIRECT_BUFFER)] = dispatchIndirectBuffer;
+    if ((flags & DirectStateFlags::BlendColor) != 0 && blendColor != nullptr)
+    {
+        commonState_.blendColor[0] = blendColor[0];
+        commonState_.blendColor[1] = blendColor[1];
+        commonState_.blendColor[2] = blendColor[2];
+        commonState_.blendColor[3] = blendColor[3];
+    }
+}
+
 void GLStateManager::SetGraphicsAPIDependentState(const OpenGLDependentStateDescriptor& stateDesc)
 {
     /* Check for necessary updates */
@@ -620,8 +669,11 @@ void GLStateManager::SetPixelStoreUnpack(GLint rowLength, GLint imageHeight, GLi
 
 void GLStateManager::NotifyDepthStencilStateRelease(GLDepthStencilState* depthStencilState)
 {
-    if (boundDepthStencilState_ == depthStencilState)
-        boundDepthStencilState_ = nullptr;
+    for (auto stateMngr : g_threadStateMngrs)
+    {
+        if (stateMngr->boundDepthStencilState_ == depthStencilState)
+            stateMngr->boundDepthStencilState_ = nullptr;
+    }
 }
 
 void GLStateManager::BindDepthStencilState(GLDepthStencilState* depthStencilState)
@@ -661,8 +713,11 @@ void GLStateManager::SetStencilRef(GLint ref, GLenum face)
 
 void GLStateManager::NotifyRasterizerStateRelease(GLRasterizerState* rasterizerState)
 {
-    if (boundRasterizerState_ == rasterizerState)
-        boundRasterizerState_ = nullptr;
+    for (auto stateMngr : g_threadStateMngrs)
+    {
+        if (stateMngr->boundRasterizerState_ == rasterizerState)
+            stateMngr->boundRasterizerState_ = nullptr;
+    }
 }
 
 void GLStateManager::BindRasterizerState(GLRasterizerState* rasterizerState)
@@ -678,8 +733,11 @@ void GLStateManager::BindRasterizerState(GLRasterizerState* rasterizerState)
 
 void GLStateManager::NotifyBlendStateRelease(GLBlendState* blendState)
 {
-    if (boundBlendState_ == blendState)
-        boundBlendState_ = nullptr;
+    for (auto stateMngr : g_threadStateMngrs)
+    {
+        if (stateMngr->boundBlendState_ == blendState)
+            stateMngr->boundBlendState_ = nullptr;
+    }
 }
 
 void GLStateManager::BindBlendState(GLBlendState* blendState)
@@ -953,7 +1011,8 @@ void GLStateManager::PopBoundBuffer()
 void GLStateManager::NotifyBufferRelease(GLuint buffer, GLBufferTarget target)
 {
     auto targetIdx = static_cast<std::size_t>(target);
-    InvalidateBoundGLObject(bufferState_.boundBuffers[targetIdx], buffer);
+    for (auto stateMngr : g_threadStateMngrs)
+        InvalidateBoundGLObject(stateMngr->bufferState_.boundBuffers[targetIdx], buffer);
 }
 
 void GLStateManager::NotifyBufferRelease(const GLBuffer& buffer)
@@ -1041,8 +1100,11 @@ void GLStateManager::NotifyFramebufferRelease(GLuint framebuffer)
 
 void GLStateManager::NotifyGLRenderTargetRelease(GLRenderTarget* renderTarget)
 {
-    if (framebufferState_.boundRenderTarget == renderTarget)
-        framebufferState_.boundRenderTarget = nullptr;
+    for (auto stateMngr : g_threadStateMngrs)
+    {
+        if (stateMngr->framebufferState_.boundRenderTarget == renderTarget)
+            stateMngr->framebufferState_.boundRenderTarget = nullptr;
+    }
 }
 
 GLRenderTarget* GLStateManager::GetBoundRenderTarget() const
@@ -1080,7 +1142,8 @@ void GLStateManager::DeleteRenderbuffer(GLuint renderbuffer)
     if (renderbuffer != 0)
     {
         glDeleteRenderbuffers(1, &renderbuffer);
-        InvalidateBoundGLObject(renderbufferState_.boundRenderbuffer, renderbuffer);
+        for (auto stateMngr : g_threadStateMngrs)
+            InvalidateBoundGLObject(stateMngr->renderbufferState_.boundRenderbuffer, renderbuffer);
     }
 }
 
@@ -1299,10 +1362,44 @@ void GLStateManager::DeleteTexture(GLuint texture, GLTextureTarget target, bool
     if (texture != 0)
     {
         glDeleteTextures(1, &texture);
-        NotifyTextureRelease(texture, target, activeLayerOnly);
+        if (activeLayerOnly)
+        {
+            /* Temporary textures are only bound to this state manager */
+            NotifyTextureRelease(texture, target, true);
+        }
+        else
+        {
+            for (auto stateMngr : g_threadStateMngrs)
+                stateMngr->NotifyTextureRelease(texture, target, false);
+        }
+    }
+}
+
+#ifdef GL_ARB_bindless_texture
+
+void GLStateManager::MakeTextureHandleResident(GLuint64 handle, GLuint texture)
+{
+    auto& entry = residentTextureHandles_[handle];
+    if (entry.refCount++ == 0)
+    {
+        entry.texture = texture;
+        glMakeTextureHandleResidentARB(handle);
+    }
+}
+
+void GLStateManager::MakeTextureHandleNonResident(GLuint64 handle)
+{
+    /* Ignore handles whose texture has already been deleted, since that also deleted the handle */
+    auto it = residentTextureHandles_.find(handle);
+    if (it != residentTextureHandles_.end() && --(it->second.refCount) == 0)
+    {
+        glMakeTextureHandleNonResidentARB(handle);
+        residentTextureHandles_.erase(it);
     }
 }
 
+#endif // /GL_ARB_bindless_texture
+
 /* ----- Sampler ----- */
 
 void GLStateManager::BindSampler(GLuint layer, GLuint sampler)
@@ -1346,8 +1443,11 @@ void GLStateManager::UnbindSamplers(GLuint first, GLsizei count)
 
 void GLStateManager::NotifySamplerRelease(GLuint sampler)
 {
-    for (auto& boundSampler : samplerState_.boundSamplers)
-        InvalidateBoundGLObject(boundSampler, sampler);
+    for (auto stateMngr : g_threadStateMngrs)
+    {
+        for (auto& boundSampler : stateMngr->samplerState_.boundSamplers)
+            InvalidateBoundGLObject(boundSampler, sampler);
+    }
 }
 
 void GLStateManager::BindGL2XSampler(GLuint layer, const GL2XSampler& sampler)
@@ -1378,7 +1478,8 @@ void GLStateManager::BindShaderProgram(GLuint program)
 
 void GLStateManager::NotifyShaderProgramRelease(GLuint program)
 {
-    InvalidateBoundGLObject(shaderState_.boundProgram, program);
+    for (auto stateMngr : g_threadStateMngrs)
+        InvalidateBoundGLObject(stateMngr->shaderState_.boundProgram, program);
 }
 
 GLuint GLStateManager::GetBoundShaderProgram() const
@@ -1529,6 +1630,17 @@ void GLStateManager::NotifyTextureRelease(GLuint texture, GLTextureTarget target
         /* Invalidate GL texture on all layers */
         for (auto& layer : textureState_.layers)
             InvalidateBoundGLObject(layer.boundTextures[targetIdx], texture);
+
+        #ifdef GL_ARB_bindless_texture
+        /* Drop resident handles of this texture; deleting a texture implicitly deletes all its handles */
+        for (auto it = residentTextureHandles_.begin(); it != residentTextureHandles_.end();)
+        {
+            if (it->second.texture == texture)
+                it = residentTextureHandles_.erase(it);
+            else
+                ++it;
+        }
+        #endif
     }
 }
 
@@ -15,6 +15,7 @@
 #include "../OpenGL.h"
 #include <array>
 #include <stack>
+#include <map>
 #include <cstdint>
 
 
@@ -62,6 +63,7 @@ class GLStateManager
         /* ----- Common ----- */
 
         GLStateManager();
+        ~GLStateManager();
 
         // Returns the active GL state manager.
         static inline GLStateManager& Get()
@@ -79,6 +81,23 @@ class GLStateManager
         // Sets and applies the specified OpenGL specific render state.
         void SetGraphicsAPIDependentState(const OpenGLDependentStateDescriptor& stateDesc);
 
+        // Invalidates all cached object bindings, so the next bindings are passed to GL (e.g. after objects have been released on another thread).
+        void InvalidateBoundObjects();
+
+        // Flags for states that have been changed with direct GL calls outside of this state manager (see NotifyDirectStateChanges).
+        struct DirectStateFlags
+        {
+            enum
+            {
+                DrawIndirectBuffer      = (1 << 0),
+                DispatchIndirectBuffer  = (1 << 1),
+                BlendColor              = (1 << 2),
+            };
+        };
+
+        // Updates the cached states that have been changed with direct GL calls, e.g. by a JIT compiled command buffer. Only the states specified by 'flags' (bitwise OR combination of 'DirectStateFlags') are updated.
+        void NotifyDirectStateChanges(long flags, GLuint drawIndirectBuffer, GLuint dispatchIndirectBuffer, const GLfloat* blendColor);
+
         /* ----- Boolean states ----- */
 
         // Resets all internal states by querying the values from OpenGL.
@@ -130,9 +149,15 @@ class GLStateManager
         void SetPixelStorePack(GLint rowLength, GLint imageHeight, GLint alignment);
         void SetPixelStoreUnpack(GLint rowLength, GLint imageHeight, GLint alignment);
 
+        /*
+        Notifications about released objects that are shared between GL contexts (e.g. buffers, textures, and state objects)
+        are static and invalidate the bindings of all state managers whose GL context has been made current on the calling thread.
+        Notifications about objects that are local to a GL context (VAOs and FBOs) only affect the respective state manager.
+        */
+
         /* ----- Depth-stencil states ----- */
 
-        void NotifyDepthStencilStateRelease(GLDepthStencilState* depthStencilState);
+        static void NotifyDepthStencilStateRelease(GLDepthStencilState* depthStencilState);
 
         void BindDepthStencilState(GLDepthStencilState* depthStencilState);
 
@@ -142,13 +167,13 @@ class GLStateManager
 
         /* ----- Rasterizer states ----- */
 
-        void NotifyRasterizerStateRelease(GLRasterizerState* rasterizerState);
+        static void NotifyRasterizerStateRelease(GLRasterizerState* rasterizerState);
 
         void BindRasterizerState(GLRasterizerState* rasterizerState);
 
         /* ----- Blend states ----- */
 
-        void NotifyBlendStateRelease(GLBlendState* blendState);
+        static void NotifyBlendStateRelease(GLBlendState* blendState);
 
         void BindBlendState(GLBlendState* blendState);
 
@@ -181,8 +206,8 @@ class GLStateManager
         void PushBoundBuffer(GLBufferTarget target);
         void PopBoundBuffer();
 
-        void NotifyBufferRelease(GLuint buffer, GLBufferTarget target);
-        void NotifyBufferRelease(const GLBuffer& buffer);
+        static void NotifyBufferRelease(GLuint buffer, GLBufferTarget target);
+        static void NotifyBufferRelease(const GLBuffer& buffer);
 
         // Disables all previous enabled vertex attrib arrays, and sets the specified index as the new highest enabled index.
         void DisableVertexAttribArrays(GLuint firstIndex);
@@ -196,7 +221,7 @@ class GLStateManager
         void PopBoundFramebuffer();
 
         void NotifyFramebufferRelease(GLuint framebuffer);
-        void NotifyGLRenderTargetRelease(GLRenderTarget* renderTarget);
+        static void NotifyGLRenderTargetRelease(GLRenderTarget* renderTarget);
 
         GLRenderTarget* GetBoundRenderTarget() const;
 
@@ -231,13 +256,23 @@ class GLStateManager
 
         void DeleteTexture(GLuint texture, GLTextureTarget target, bool activeLayerOnly = false);
 
+        #ifdef GL_ARB_bindless_texture
+
+        // Makes the texture handle resident in this GL context, or increments its reference counter if it is already resident.
+        void MakeTextureHandleResident(GLuint64 handle, GLuint texture);
+
+        // Decrements the reference counter of the texture handle and makes it non-resident in this GL context once it is no longer used.
+        void MakeTextureHandleNonResident(GLuint64 handle);
+
+        #endif // /GL_ARB_bindless_texture
+
         /* ----- Sampler ----- */
 
         void BindSampler(GLuint layer, GLuint sampler);
         void BindSamplers(GLuint first, GLsizei count, const GLuint* samplers);
         void UnbindSamplers(GLuint first, GLsizei count);
 
-        void NotifySamplerRelease(GLuint sampler);
+        static void NotifySamplerRelease(GLuint sampler);
 
         void BindGL2XSampler(GLuint layer, const GL2XSampler& sampler);
 
@@ -245,7 +280,7 @@ class GLStateManager
 
         void BindShaderProgram(GLuint program);
 
-        void NotifyShaderProgramRelease(GLuint program);
+        static void NotifyShaderProgramRelease(GLuint program);
 
         GLuint GetBoundShaderProgram() const;
 
@@ -472,12 +507,23 @@ class GLStateManager
             #endif
         };
 
+        #ifdef GL_ARB_bindless_texture
+        struct GLResidentTextureHandle
+        {
+            GLuint      texture     = 0;
+            std::size_t refCount    = 0;
+        };
+        #endif
+
     private:
 
         friend class GLContext;
 
-        static GLStateManager*          active_;
-        static GLLimits                 commonLimits_;          // Common denominator of limitations for all GL contexts
+        // Makes the specified state manager active on the calling thread and registers it for notifications about released shared objects.
+        static void SetActive(GLStateManager* stateMngr);
+
+        static thread_local GLStateManager* active_;            // State manager of the GL context that is current on the calling thread
+        static GLLimits                     commonLimits_;      // Common denominator of limitations for all GL contexts
 
     private:
 
@@ -508,6 +554,10 @@ class GLStateManager
         GLRasterizerState*              boundRasterizerState_   = nullptr;
         GLBlendState*                   boundBlendState_        = nullptr;
 
+        #ifdef GL_ARB_bindless_texture
+        std::map<GLuint64, GLResidentTextureHandle> residentTextureHandles_; // Texture handles that are resident in this GL context; residency is a per-context state
+        #endif
+
 };
 
 
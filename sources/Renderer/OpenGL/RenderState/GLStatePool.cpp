@@ -96,6 +96,8 @@ void GLStatePool::Clear()
     rasterizerStates_.clear();
     blendStates_.clear();
     shaderBindingLayouts_.clear();
+    vertexArrayFormats_.clear();
+    sharedShaders_.clear();
 }
 
 GLDepthStencilStateSPtr GLStatePool::CreateDepthStencilState(const DepthDescriptor& depthDesc, const StencilDescriptor& stencilDesc)
@@ -107,7 +109,7 @@ void GLStatePool::ReleaseDepthStencilState(GLDepthStencilStateSPtr&& depthStenci
 {
     ReleaseRenderStateObject<GLDepthStencilState>(
         depthStencilStates_,
-        std::bind(&GLStateManager::NotifyDepthStencilStateRelease, &(GLStateManager::Get()), std::placeholders::_1),
+        GLStateManager::NotifyDepthStencilStateRelease,
         std::forward<GLDepthStencilStateSPtr>(depthStencilState)
     );
 }
@@ -121,7 +123,7 @@ void GLStatePool::ReleaseRasterizerState(GLRasterizerStateSPtr&& rasterizerState
 {
     ReleaseRenderStateObject<GLRasterizerState>(
         rasterizerStates_,
-        std::bind(&GLStateManager::NotifyRasterizerStateRelease, &(GLStateManager::Get()), std::placeholders::_1),
+        GLStateManager::NotifyRasterizerStateRelease,
         std::forward<GLRasterizerStateSPtr>(rasterizerState)
     );
 }
@@ -135,7 +137,7 @@ void GLStatePool::ReleaseBlendState(GLBlendStateSPtr&& blendState)
 {
     ReleaseRenderStateObject<GLBlendState>(
         blendStates_,
-        std::bind(&GLStateManager::NotifyBlendStateRelease, &(GLStateManager::Get()), std::placeholders::_1),
+        GLStateManager::NotifyBlendStateRelease,
         std::forward<GLBlendStateSPtr>(blendState)
     );
 }
@@ -154,6 +156,42 @@ void GLStatePool::ReleaseShaderBindingLayout(GLShaderBindingLayoutSPtr&& shaderB
     );
 }
 
+GLVertexArrayFormatSPtr GLStatePool::CreateVertexArrayFormat(const std::vector<GLVertexAttribFormat>& attribFormats, const std::vector<GLuint>& bindingDivisors)
+{
+    /* Create VAO only once for each new vertex format */
+    auto vertexArrayFormat = CreateRenderStateObject(vertexArrayFormats_, attribFormats, bindingDivisors);
+    vertexArrayFormat->BuildVertexArray();
+    return vertexArrayFormat;
+}
+
+void GLStatePool::ReleaseVertexArrayFormat(GLVertexArrayFormatSPtr&& vertexArrayFormat)
+{
+    ReleaseRenderStateObject<GLVertexArrayFormat>(
+        vertexArrayFormats_,
+        nullptr,
+        std::forward<GLVertexArrayFormatSPtr>(vertexArrayFormat)
+    );
+}
+
+GLSharedShaderSPtr GLStatePool::CreateSharedShader(GLenum type, const std::string& source)
+{
+    return CreateRenderStateObject(sharedShaders_, type, source);
+}
+
+GLSharedShaderSPtr GLStatePool::CreateSharedShader(GLenum type, const void* binary, std::size_t binarySize, const char* entryPoint)
+{
+    return CreateRenderStateObject(sharedShaders_, type, binary, binarySize, entryPoint);
+}
+
+void GLStatePool::ReleaseSharedShader(GLSharedShaderSPtr&& sharedShader)
+{
+    ReleaseRenderStateObject<GLSharedShader>(
+        sharedShaders_,
+        nullptr,
+        std::forward<GLSharedShaderSPtr>(sharedShader)
+    );
+}
+
 
 } // /namespace LLGL
 
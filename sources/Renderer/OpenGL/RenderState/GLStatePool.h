@@ -15,6 +15,8 @@
 #include "GLBlendState.h"
 #include "GLPipelineLayout.h"
 #include "../Shader/GLShaderBindingLayout.h"
+#include "../Shader/GLSharedShader.h"
+#include "../Buffer/GLVertexArrayFormat.h"
 #include <vector>
 
 
@@ -23,7 +25,7 @@ namespace LLGL
 
 
 /*
-Singleton pool for OpenGL depth-stencil-, rasterizer-, and blend states.
+Singleton pool for OpenGL depth-stencil-, rasterizer-, and blend states, vertex array formats, and shared shader objects.
 These states are separated from the GLStateManager, because they don't need to exist for every GL context.
 */
 class GLStatePool
@@ -60,6 +62,21 @@ class GLStatePool
         GLShaderBindingLayoutSPtr CreateShaderBindingLayout(const GLPipelineLayout& pipelineLayout);
         void ReleaseShaderBindingLayout(GLShaderBindingLayoutSPtr&& shaderBindingLayout);
 
+        /* ----- Vertex array formats ----- */
+
+        GLVertexArrayFormatSPtr CreateVertexArrayFormat(const std::vector<GLVertexAttribFormat>& attribFormats, const std::vector<GLuint>& bindingDivisors);
+        void ReleaseVertexArrayFormat(GLVertexArrayFormatSPtr&& vertexArrayFormat);
+
+        /* ----- Shared shaders ----- */
+
+        // Returns the shared shader with the same type and source code; the GL shader is compiled on demand (see GLSharedShader::Compile).
+        GLSharedShaderSPtr CreateSharedShader(GLenum type, const std::string& source);
+
+        // Returns the shared shader with the same type, SPIR-V module, and entry point; the GL shader is loaded on demand (see GLSharedShader::LoadBinary).
+        GLSharedShaderSPtr CreateSharedShader(GLenum type, const void* binary, std::size_t binarySize, const char* entryPoint);
+
+        void ReleaseSharedShader(GLSharedShaderSPtr&& sharedShader);
+
     private:
 
         GLStatePool() = default;
@@ -70,6 +87,8 @@ class GLStatePool
         std::vector<GLRasterizerStateSPtr>      rasterizerStates_;
         std::vector<GLBlendStateSPtr>           blendStates_;
         std::vector<GLShaderBindingLayoutSPtr>  shaderBindingLayouts_;
+        std::vector<GLVertexArrayFormatSPtr>    vertexArrayFormats_;
+        std::vector<GLSharedShaderSPtr>         sharedShaders_;
 
 };
 
@@ -10,6 +10,7 @@
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
 #include "../GLTypes.h"
+#include "../RenderState/GLStatePool.h"
 #include "../../../Core/Helper.h"
 #include "../../../Core/Exception.h"
 #include <vector>
@@ -22,12 +23,11 @@ namespace LLGL
 {
 
 
-GLShader::GLShader(const ShaderDescriptor& desc) :
+GLShader::GLShader(const ShaderDescriptor& desc, ShaderCache* shaderCache) :
     Shader { desc.type }
 {
-    /* Create shader and  */
-    id_ = glCreateShader(GLTypes::Map(desc.type));
-    BuildShader(desc);
+    /* Create or share native shader */
+    BuildShader(desc, shaderCache);
     ReserveAttribs(desc);
     BuildVertexInputLayout(desc.vertex.inputAttribs.size(), desc.vertex.inputAttribs.data());
     BuildTransformFeedbackVaryings(desc.vertex.outputAttribs.size(), desc.vertex.outputAttribs.data());
@@ -36,22 +36,38 @@ GLShader::GLShader(const ShaderDescriptor& desc) :
 
 GLShader::~GLShader()
 {
-    glDeleteShader(id_);
+    GLStatePool::Get().ReleaseSharedShader(std::move(sharedShader_));
 }
 
 void GLShader::SetName(const char* name)
 {
-    GLSetObjectLabel(GL_SHADER, GetID(), name);
+    /* Store label, since the native shader might not have been created yet */
+    label_ = (name != nullptr ? name : "");
+    ApplyLabel();
 }
 
 bool GLShader::HasErrors() const
 {
-    return !GLShader::GetGLCompileStatus(id_);
+    /* Deferred compilation implies that this shader has been compiled successfully before */
+    if (!sharedShader_->IsCompiled())
+        return false;
+    return !GLShader::GetGLCompileStatus(GetID());
 }
 
 std::string GLShader::GetReport() const
 {
-    return GLShader::GetGLShaderLog(id_);
+    if (!sharedShader_->IsCompiled())
+        return "";
+    return GLShader::GetGLShaderLog(GetID());
+}
+
+void GLShader::CompilePendingSource()
+{
+    if (!sharedShader_->IsCompiled())
+    {
+        sharedShader_->Compile();
+        ApplyLabel();
+    }
 }
 
 const GLShaderAttribute* GLShader::GetVertexAttribs() const
@@ -117,17 +133,54 @@ std::string GLShader::GetGLShaderLog(GLuint shader)
     return "";
 }
 
+static const char* GetGLString(GLenum name)
+{
+    auto str = reinterpret_cast<const char*>(glGetString(name));
+    return (str != nullptr ? str : "");
+}
+
+bool GLShader::ClaimPendingCacheEntry()
+{
+    const bool pending = cacheEntryPending_;
+    cacheEntryPending_ = false;
+    return pending;
+}
+
+ShaderCache::Key GLShader::GetGLDriverCacheKey()
+{
+    return ShaderCache::CombineKeys(
+        ShaderCache::HashString(GetGLString(GL_RENDERER)),
+        ShaderCache::HashString(GetGLString(GL_VERSION))
+    );
+}
+
 
 /*
  * ======= Private: =======
  */
 
-void GLShader::BuildShader(const ShaderDescriptor& shaderDesc)
+void GLShader::BuildShader(const ShaderDescriptor& shaderDesc, ShaderCache* shaderCache)
 {
+    /* Shader cache is only used for program binaries, so shaders can only be cached with GL_ARB_get_program_binary */
+    if (shaderCache != nullptr && !HasExtension(GLExt::ARB_get_program_binary))
+        shaderCache = nullptr;
+
     if (IsShaderSourceCode(shaderDesc.sourceType))
-        CompileSource(shaderDesc);
+    {
+        if (shaderCache != nullptr)
+            CompileSourceWithCache(shaderDesc, *shaderCache);
+        else
+            CompileSource(shaderDesc);
+    }
     else
+    {
         LoadBinary(shaderDesc);
+        if (shaderCache != nullptr)
+        {
+            cacheKey_       = ShaderCache::CombineKeys(GLShader::GetGLDriverCacheKey(), ShaderCache::HashShaderDescriptor(shaderDesc));
+            hasCacheKey_    = true;
+        }
+    }
 }
 
 void GLShader::ReserveAttribs(const ShaderDescriptor& desc)
@@ -218,16 +271,48 @@ void GLShader::BuildTransformFeedbackVaryings(std::size_t numVaryings, const Ver
     }
 }
 
-void GLShader::CompileSource(const ShaderDescriptor& shaderDesc)
+// Returns the source code of the specified shader descriptor.
+static std::string GetShaderSource(const ShaderDescriptor& shaderDesc)
 {
-    /* Get source code */
     if (shaderDesc.sourceType == ShaderSourceType::CodeFile)
+        return ReadFileString(shaderDesc.source);
+    else
+        return shaderDesc.source;
+}
+
+void GLShader::CompileSource(const ShaderDescriptor& shaderDesc)
+{
+    /* Share native shader with equal source code, which is only compiled once */
+    sharedShader_ = GLStatePool::Get().CreateSharedShader(GLTypes::Map(shaderDesc.type), GetShaderSource(shaderDesc));
+    sharedShader_->Compile();
+}
+
+void GLShader::CompileSourceWithCache(const ShaderDescriptor& shaderDesc, ShaderCache& shaderCache)
+{
+    /* Share native shader with equal source code */
+    sharedShader_ = GLStatePool::Get().CreateSharedShader(GLTypes::Map(shaderDesc.type), GetShaderSource(shaderDesc));
+
+    const auto& source = sharedShader_->GetContent();
+
+    ShaderDescriptor cacheDesc = shaderDesc;
     {
-        const std::string fileContent = ReadFileString(shaderDesc.source);
-        GLShader::CompileGLShader(id_, fileContent.c_str());
+        cacheDesc.source        = source.c_str();
+        cacheDesc.sourceSize    = source.size();
+        cacheDesc.sourceType    = ShaderSourceType::CodeString;
+    }
+    cacheKey_       = ShaderCache::CombineKeys(GLShader::GetGLDriverCacheKey(), ShaderCache::HashShaderDescriptor(cacheDesc));
+    hasCacheKey_    = true;
+
+    /*
+    If the shader has been compiled successfully before, defer compilation until the shader program can not be loaded from the cache.
+    Otherwise, compile shader without querying its status, which would block with GL_KHR_parallel_shader_compile.
+    An empty entry is stored to mark this shader as successfully compiled once a shader program has been linked with it (see GLShaderProgram::FinalizeLink).
+    */
+    if (!shaderCache.Load(cacheKey_))
+    {
+        sharedShader_->Compile();
+        cacheEntryPending_ = true;
     }
-    else
-        GLShader::CompileGLShader(id_, shaderDesc.source);
 }
 
 void GLShader::LoadBinary(const ShaderDescriptor& shaderDesc)
@@ -235,31 +320,22 @@ void GLShader::LoadBinary(const ShaderDescriptor& shaderDesc)
     #if defined GL_ARB_gl_spirv && defined GL_ARB_ES2_compatibility
     if (HasExtension(GLExt::ARB_gl_spirv) && HasExtension(GLExt::ARB_ES2_compatibility))
     {
-        /* Get shader binary */
-        std::vector<char>   fileContent;
-        const void*         binaryBuffer    = nullptr;
-        GLsizei             binaryLength    = 0;
+        /* Share native shader with equal SPIR-V module and entry point, which is only loaded once */
+        const auto type = GLTypes::Map(shaderDesc.type);
 
         if (shaderDesc.sourceType == ShaderSourceType::BinaryFile)
         {
-            /* Load binary from file */
-            fileContent = ReadFileBuffer(shaderDesc.source);
-            binaryBuffer = fileContent.data();
-            binaryLength = static_cast<GLsizei>(fileContent.size());
+            /* Load binary from mapped file; the shared shader keeps its own copy to compare it with other shaders */
+            const auto fileContent = MapFileBuffer(shaderDesc.source);
+            sharedShader_ = GLStatePool::Get().CreateSharedShader(type, fileContent->GetData(), fileContent->GetSize(), shaderDesc.entryPoint);
         }
         else
         {
             /* Load binary from buffer */
-            binaryBuffer = shaderDesc.source;
-            binaryLength = static_cast<GLsizei>(shaderDesc.sourceSize);
+            sharedShader_ = GLStatePool::Get().CreateSharedShader(type, shaderDesc.source, shaderDesc.sourceSize, shaderDesc.entryPoint);
         }
 
-        /* Load shader binary */
-        glShaderBinary(1, &id_, GL_SHADER_BINARY_FORMAT_SPIR_V, binaryBuffer, binaryLength);
-
-        /* Specialize for the default "main" function in a SPIR-V module  */
-        const char* entryPoint = (shaderDesc.entryPoint == nullptr || *shaderDesc.entryPoint == '\0' ? "main" : shaderDesc.entryPoint);
-        glSpecializeShader(id_, entryPoint, 0, nullptr, nullptr);
+        sharedShader_->LoadBinary();
     }
     else
     #endif
@@ -268,6 +344,16 @@ void GLShader::LoadBinary(const ShaderDescriptor& shaderDesc)
     }
 }
 
+void GLShader::ApplyLabel()
+{
+    /*
+    Only label native shaders that are exclusively used by this shader, i.e. referenced by the state pool and this shader only.
+    Otherwise, all other shaders with the same source would be relabeled too.
+    */
+    if (sharedShader_->IsCompiled() && sharedShader_.use_count() == 2)
+        GLSetObjectLabel(GL_SHADER, GetID(), (label_.empty() ? nullptr : label_.c_str()));
+}
+
 
 } // /namespace LLGL
 
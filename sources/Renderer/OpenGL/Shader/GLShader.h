@@ -11,7 +11,10 @@
 
 #include <LLGL/Shader.h>
 #include "../OpenGL.h"
+#include "GLSharedShader.h"
+#include "../../ShaderCache.h"
 #include "../../../Core/LinearStringContainer.h"
+#include <string>
 
 
 namespace LLGL
@@ -46,15 +49,25 @@ class GLShader final : public Shader
         // Returns the native GL shader log and returns true on success. Otherwise, there is no log available.
         static std::string GetGLShaderLog(GLuint shader);
 
+        // Returns the shader cache key of the current GL driver, i.e. renderer and version string.
+        static ShaderCache::Key GetGLDriverCacheKey();
+
     public:
 
-        GLShader(const ShaderDescriptor& desc);
+        GLShader(const ShaderDescriptor& desc, ShaderCache* shaderCache = nullptr);
         ~GLShader();
 
-        // Returns the native shader ID.
+        /*
+        Compiles the shader source if compilation has been deferred.
+        This happens when the shader cache reported that this shader source has already been compiled successfully,
+        so compilation is only necessary if the shader program can not be loaded from the shader cache either.
+        */
+        void CompilePendingSource();
+
+        // Returns the native shader ID. The native shader is shared between all shaders with the same type and source.
         inline GLuint GetID() const
         {
-            return id_;
+            return sharedShader_->GetID();
         }
 
         // Returns the vertex input attributes:
@@ -71,26 +84,54 @@ class GLShader final : public Shader
             return transformFeedbackVaryings_;
         }
 
+        // Returns true if this shader has a shader cache key.
+        inline bool HasCacheKey() const
+        {
+            return hasCacheKey_;
+        }
+
+        // Returns the shader cache key of this shader. Only valid if HasCacheKey returns true.
+        inline ShaderCache::Key GetCacheKey() const
+        {
+            return cacheKey_;
+        }
+
+        /*
+        Returns true if this shader has been compiled on a shader cache miss and resets that state.
+        The shader program that claims this entry stores it in the cache once it has been linked successfully.
+        */
+        bool ClaimPendingCacheEntry();
+
     private:
 
-        void BuildShader(const ShaderDescriptor& shaderDesc);
+        void BuildShader(const ShaderDescriptor& shaderDesc, ShaderCache* shaderCache);
         void ReserveAttribs(const ShaderDescriptor& desc);
         void BuildVertexInputLayout(std::size_t numVertexAttribs, const VertexAttribute* vertexAttribs);
         void BuildFragmentOutputLayout(std::size_t numFragmentAttribs, const FragmentAttribute* fragmentAttribs);
         void BuildTransformFeedbackVaryings(std::size_t numVaryings, const VertexAttribute* varyings);
 
         void CompileSource(const ShaderDescriptor& shaderDesc);
+        void CompileSourceWithCache(const ShaderDescriptor& shaderDesc, ShaderCache& shaderCache);
         void LoadBinary(const ShaderDescriptor& shaderDesc);
 
+        // Assigns the debug label to the native shader if it has been created and is not shared with other shaders.
+        void ApplyLabel();
+
     private:
 
-        GLuint                          id_                         = 0;
+        GLSharedShaderSPtr              sharedShader_;
 
         LinearStringContainer           shaderAttribNames_;
         std::vector<GLShaderAttribute>  shaderAttribs_;
         std::size_t                     numVertexAttribs_           = 0;
         std::vector<const char*>        transformFeedbackVaryings_;
 
+        ShaderCache::Key                cacheKey_                   = 0;
+        bool                            hasCacheKey_                = false;
+        bool                            cacheEntryPending_          = false;
+
+        std::string                     label_;
+
 };
 
 
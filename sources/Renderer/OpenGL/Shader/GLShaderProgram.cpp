@@ -11,76 +11,168 @@
 #include "../GLTypes.h"
 #include "../GLObjectUtils.h"
 #include "../RenderState/GLStateManager.h"
+#include "../RenderState/GLStatePool.h"
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionLoader.h"
 #include "../../CheckedCast.h"
+#include "../../Serialization.h"
+#include "../../../Core/Helper.h"
 #include "../../../Core/Exception.h"
 #include <LLGL/VertexAttribute.h>
 #include <LLGL/Constants.h>
+#include <LLGL/RenderSystemFlags.h>
 #include <vector>
 #include <stdexcept>
+#include <algorithm>
 
 
 namespace LLGL
 {
 
 
-#ifdef __APPLE__
+// Returns true if the driver compiles and links shaders asynchronously until their status is queried.
+static bool HasParallelShaderCompile()
+{
+    #ifdef GL_KHR_parallel_shader_compile
+    return HasExtension(GLExt::KHR_parallel_shader_compile);
+    #else
+    return false;
+    #endif
+}
 
-// Helper class to manage shared GL objects only necessary workaround issues with Mac implementation of OpenGL.
-class SharedGLShader
+GLShaderProgram::GLShaderProgram(const ShaderProgramDescriptor& desc, ShaderCache* shaderCache) :
+    id_ { glCreateProgram() }
 {
+    #ifdef GL_ARB_get_program_binary
+    if (shaderCache != nullptr && HasExtension(GLExt::ARB_get_program_binary) && BuildCacheKey(desc))
+    {
+        /* Load program binary from shader cache or build program and store its binary in the cache */
+        if (!LoadFromShaderCache(*shaderCache))
+        {
+            glProgramParameteri(id_, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+            BuildProgram(desc);
+            GatherPendingShaderCacheKeys(desc);
+            pendingShaderCache_ = shaderCache;
+        }
+    }
+    else
+    #endif
+    {
+        BuildProgram(desc);
+    }
+
+    /* Query link result only when it's needed if the driver links shader programs asynchronously */
+    linkPending_ = true;
+    if (!HasParallelShaderCompile())
+        FinalizeLink();
+}
+
+GLShaderProgram::~GLShaderProgram()
+{
+    glDeleteProgram(id_);
+    GLStateManager::NotifyShaderProgramRelease(id_);
+    #ifdef __APPLE__
+    GLStatePool::Get().ReleaseSharedShader(std::move(nullFragmentShader_));
+    #endif
+}
+
+void GLShaderProgram::SetName(const char* name)
+{
+    GLSetObjectLabel(GL_PROGRAM, GetID(), name);
+}
 
-    public:
+bool GLShaderProgram::HasErrors() const
+{
+    GLint status = 0;
+    glGetProgramiv(id_, GL_LINK_STATUS, &status);
+    return (status == GL_FALSE);
+}
 
-        // Returns the native GL shader object and increments the reference counter.
-        GLuint GetOrCreate(GLenum type, const char* source);
+std::string GLShaderProgram::GetReport() const
+{
+    /* Query info log length */
+    GLint infoLogLength = 0;
+    glGetProgramiv(id_, GL_INFO_LOG_LENGTH, &infoLogLength);
 
-        // Decrements the reference counter and destroys the GL object once the counter reaches zero.
-        void Release();
+    if (infoLogLength > 0)
+    {
+        /* Store info log in byte buffer (because GL writes it's own null-terminator character!) */
+        std::vector<char> infoLog;
+        infoLog.resize(infoLogLength, '\0');
 
-    private:
+        /* Query info log output */
+        GLsizei charsWritten = 0;
+        glGetProgramInfoLog(id_, infoLogLength, &charsWritten, infoLog.data());
 
-        GLuint      id_         = 0;
-        std::size_t refCount_   = 0;
+        /* Convert byte buffer to string */
+        return std::string(infoLog.data());
+    }
 
-};
+    return "";
+}
 
-GLuint SharedGLShader::GetOrCreate(GLenum type, const char* source)
+bool GLShaderProgram::Reflect(ShaderReflection& reflection) const
 {
-    if (id_ == 0)
-    {
-        /* Create shader and compile with specified source */
-        id_ = glCreateShader(type);
-        GLShader::CompileGLShader(id_, source);
+    WaitForLink();
 
-        /* Check for errors */
-        if (!GLShader::GetGLCompileStatus(id_))
-            throw std::runtime_error(GLShader::GetGLShaderLog(id_));
+    /* Return reflection from shader cache if available */
+    if (cachedReflection_)
+    {
+        reflection = *cachedReflection_;
+        return true;
     }
-    ++refCount_;
-    return id_;
+
+    ShaderProgram::ClearShaderReflection(reflection);
+    QueryReflection(reflection);
+    ShaderProgram::FinalizeShaderReflection(reflection);
+    return true;
 }
 
-void SharedGLShader::Release()
+UniformLocation GLShaderProgram::FindUniformLocation(const char* name) const
 {
     if (id_ != 0)
+        return static_cast<UniformLocation>(glGetUniformLocation(id_, name));
+    else
+        return -1;
+}
+
+
+/*
+ * ======= Internal: =======
+ */
+
+bool GLShaderProgram::IsLinkComplete() const
+{
+    if (linkPending_)
     {
-        --refCount_;
-        if (refCount_ == 0)
-        {
-            glDeleteShader(id_);
-            id_ = 0;
-        }
+        #ifdef GL_KHR_parallel_shader_compile
+        /* Poll completion status, which never blocks */
+        GLint status = GL_FALSE;
+        glGetProgramiv(id_, GL_COMPLETION_STATUS_KHR, &status);
+        if (status == GL_FALSE)
+            return false;
+        #endif
+        FinalizeLink();
     }
+    return true;
 }
 
-static SharedGLShader g_nullFragmentShader;
+void GLShaderProgram::BindResourceSlots(const GLShaderBindingLayout& bindingLayout) const
+{
+    /* Keep track of state change with mutable reference to binding layout */
+    if (bindingLayout_ != &bindingLayout)
+    {
+        bindingLayout.BindResourceSlots(GetID());
+        bindingLayout_ = &bindingLayout;
+    }
+}
 
-#endif // /__APPLE__
 
-GLShaderProgram::GLShaderProgram(const ShaderProgramDescriptor& desc) :
-    id_ { glCreateProgram() }
+/*
+ * ======= Private: =======
+ */
+
+void GLShaderProgram::BuildProgram(const ShaderProgramDescriptor& desc)
 {
     Attach(desc.vertexShader);
     Attach(desc.tessControlShader);
@@ -100,9 +192,14 @@ GLShaderProgram::GLShaderProgram(const ShaderProgramDescriptor& desc) :
             "#version 330 core\n"
             "void main() {}\n"
         ;
-        const GLuint nullFragmentShader = g_nullFragmentShader.GetOrCreate(GL_FRAGMENT_SHADER, nullFragmentShaderSource);
-        glAttachShader(GetID(), nullFragmentShader);
-        hasNullFragmentShader_ = true;
+        nullFragmentShader_ = GLStatePool::Get().CreateSharedShader(GL_FRAGMENT_SHADER, nullFragmentShaderSource);
+        nullFragmentShader_->Compile();
+
+        /* Check for errors */
+        if (!GLShader::GetGLCompileStatus(nullFragmentShader_->GetID()))
+            throw std::runtime_error(GLShader::GetGLShaderLog(nullFragmentShader_->GetID()));
+
+        glAttachShader(GetID(), nullFragmentShader_->GetID());
     }
     #endif
 
@@ -145,98 +242,143 @@ GLShaderProgram::GLShaderProgram(const ShaderProgramDescriptor& desc) :
         LinkProgram(0, nullptr);
 }
 
-GLShaderProgram::~GLShaderProgram()
+void GLShaderProgram::Attach(Shader* shader)
 {
-    glDeleteProgram(id_);
-    GLStateManager::Get().NotifyShaderProgramRelease(id_);
-    #ifdef __APPLE__
-    if (hasNullFragmentShader_)
-        g_nullFragmentShader.Release();
-    #endif
-}
+    if (shader != nullptr)
+    {
+        auto shaderGL = LLGL_CAST(GLShader*, shader);
 
-void GLShaderProgram::SetName(const char* name)
-{
-    GLSetObjectLabel(GL_PROGRAM, GetID(), name);
-}
+        /* Compile shader if it has been deferred by the shader cache */
+        shaderGL->CompilePendingSource();
 
-bool GLShaderProgram::HasErrors() const
-{
-    GLint status = 0;
-    glGetProgramiv(id_, GL_LINK_STATUS, &status);
-    return (status == GL_FALSE);
+        /* Attach shader to shader program */
+        glAttachShader(id_, shaderGL->GetID());
+    }
 }
 
-std::string GLShaderProgram::GetReport() const
+// Segment identifiers for GL shader cache entries.
+enum GLShaderCacheIdent : Serialization::IdentType
 {
-    /* Query info log length */
-    GLint infoLogLength = 0;
-    glGetProgramiv(id_, GL_INFO_LOG_LENGTH, &infoLogLength);
+    GLShaderCacheIdent_ReservedGL = (RendererID::OpenGL << 8),
+    GLShaderCacheIdent_BinaryFormat,    // GLenum
+    GLShaderCacheIdent_Binary,          // Program binary
+    GLShaderCacheIdent_Reflection,      // Serialized ShaderReflection
+};
 
-    if (infoLogLength > 0)
+static bool AppendShaderCacheKey(ShaderCache::Key& key, Shader* shader)
+{
+    if (shader != nullptr)
     {
-        /* Store info log in byte buffer (because GL writes it's own null-terminator character!) */
-        std::vector<char> infoLog;
-        infoLog.resize(infoLogLength, '\0');
-
-        /* Query info log output */
-        GLsizei charsWritten = 0;
-        glGetProgramInfoLog(id_, infoLogLength, &charsWritten, infoLog.data());
-
-        /* Convert byte buffer to string */
-        return std::string(infoLog.data());
+        auto shaderGL = LLGL_CAST(GLShader*, shader);
+        if (!shaderGL->HasCacheKey())
+            return false;
+        key = ShaderCache::CombineKeys(key, shaderGL->GetCacheKey());
     }
-
-    return "";
+    else
+        key = ShaderCache::CombineKeys(key, 0);
+    return true;
 }
 
-bool GLShaderProgram::Reflect(ShaderReflection& reflection) const
+bool GLShaderProgram::BuildCacheKey(const ShaderProgramDescriptor& desc)
 {
-    ShaderProgram::ClearShaderReflection(reflection);
-    QueryReflection(reflection);
-    ShaderProgram::FinalizeShaderReflection(reflection);
-    return true;
+    /* Combine keys of all shaders in pipeline order; each shader key already contains the driver key */
+    cacheKey_ = ShaderCache::HashString("GLShaderProgram");
+    return
+    (
+        AppendShaderCacheKey(cacheKey_, desc.vertexShader)         &&
+        AppendShaderCacheKey(cacheKey_, desc.tessControlShader)    &&
+        AppendShaderCacheKey(cacheKey_, desc.tessEvaluationShader) &&
+        AppendShaderCacheKey(cacheKey_, desc.geometryShader)       &&
+        AppendShaderCacheKey(cacheKey_, desc.fragmentShader)       &&
+        AppendShaderCacheKey(cacheKey_, desc.computeShader)
+    );
 }
 
-UniformLocation GLShaderProgram::FindUniformLocation(const char* name) const
+static void AppendPendingShaderCacheKey(std::vector<ShaderCache::Key>& keys, Shader* shader)
 {
-    if (id_ != 0)
-        return static_cast<UniformLocation>(glGetUniformLocation(id_, name));
-    else
-        return -1;
+    if (shader != nullptr)
+    {
+        auto shaderGL = LLGL_CAST(GLShader*, shader);
+        if (shaderGL->ClaimPendingCacheEntry())
+            keys.push_back(shaderGL->GetCacheKey());
+    }
 }
 
+void GLShaderProgram::GatherPendingShaderCacheKeys(const ShaderProgramDescriptor& desc)
+{
+    AppendPendingShaderCacheKey(pendingShaderKeys_, desc.vertexShader);
+    AppendPendingShaderCacheKey(pendingShaderKeys_, desc.tessControlShader);
+    AppendPendingShaderCacheKey(pendingShaderKeys_, desc.tessEvaluationShader);
+    AppendPendingShaderCacheKey(pendingShaderKeys_, desc.geometryShader);
+    AppendPendingShaderCacheKey(pendingShaderKeys_, desc.fragmentShader);
+    AppendPendingShaderCacheKey(pendingShaderKeys_, desc.computeShader);
+}
 
-/*
- * ======= Internal: =======
- */
+#ifdef GL_ARB_get_program_binary
 
-void GLShaderProgram::BindResourceSlots(const GLShaderBindingLayout& bindingLayout) const
+bool GLShaderProgram::LoadFromShaderCache(ShaderCache& shaderCache)
 {
-    /* Keep track of state change with mutable reference to binding layout */
-    if (bindingLayout_ != &bindingLayout)
+    auto entry = shaderCache.Load(cacheKey_);
+    if (!entry)
+        return false;
+
+    try
     {
-        bindingLayout.BindResourceSlots(GetID());
-        bindingLayout_ = &bindingLayout;
+        /* Read program binary and serialized reflection */
+        Serialization::Deserializer reader{ *entry };
+
+        GLenum binaryFormat = 0;
+        reader.ReadSegment(GLShaderCacheIdent_BinaryFormat, &binaryFormat, sizeof(binaryFormat));
+        auto binarySeg      = reader.ReadSegment(GLShaderCacheIdent_Binary);
+        auto reflectionSeg  = reader.ReadSegment(GLShaderCacheIdent_Reflection);
+
+        /* Load program binary; this fails if the binary is no longer compatible with the driver */
+        glProgramBinary(id_, binaryFormat, binarySeg.data, static_cast<GLsizei>(binarySeg.size));
+        if (HasErrors())
+            return false;
+
+        cachedReflection_ = MakeUnique<ShaderReflection>();
+        if (!ShaderCache::DeserializeShaderReflection(reflectionSeg.data, reflectionSeg.size, *cachedReflection_))
+            cachedReflection_.reset();
+    }
+    catch (const std::exception&)
+    {
+        return false;
     }
+
+    return true;
 }
 
+void GLShaderProgram::StoreInShaderCache(ShaderCache& shaderCache) const
+{
+    /* Query program binary */
+    GLint binaryLength = 0;
+    glGetProgramiv(id_, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+    if (binaryLength <= 0)
+        return;
 
-/*
- * ======= Private: =======
- */
+    std::vector<char> binary(static_cast<std::size_t>(binaryLength));
+    GLenum binaryFormat = 0;
+    glGetProgramBinary(id_, binaryLength, &binaryLength, &binaryFormat, binary.data());
 
-void GLShaderProgram::Attach(Shader* shader)
-{
-    if (shader != nullptr)
-    {
-        auto shaderGL = LLGL_CAST(GLShader*, shader);
+    /* Query reflection once, so it is also available for this instance without further GL queries */
+    auto reflection = MakeUnique<ShaderReflection>();
+    Reflect(*reflection);
+    auto reflectionBlob = ShaderCache::SerializeShaderReflection(*reflection);
+    cachedReflection_ = std::move(reflection);
 
-        /* Attach shader to shader program */
-        glAttachShader(id_, shaderGL->GetID());
-    }
+    /* Serialize cache entry */
+    Serialization::Serializer writer;
+    writer.WriteSegment(GLShaderCacheIdent_BinaryFormat, &binaryFormat, sizeof(binaryFormat));
+    writer.WriteSegment(GLShaderCacheIdent_Binary, binary.data(), static_cast<std::size_t>(binaryLength));
+    writer.WriteSegment(GLShaderCacheIdent_Reflection, reflectionBlob->GetData(), reflectionBlob->GetSize());
+
+    auto entry = writer.Finalize();
+    shaderCache.Store(cacheKey_, entry->GetData(), entry->GetSize());
 }
 
+#endif // /GL_ARB_get_program_binary
+
 void GLShaderProgram::BindAttribLocations(std::size_t numVertexAttribs, const GLShaderAttribute* vertexAttribs)
 {
     /* Bind all vertex attribute locations */
@@ -857,6 +999,62 @@ void GLShaderProgram::QueryWorkGroupSize(ShaderReflection& reflection) const
     #endif // /GL_ARB_compute_shader
 }
 
+void GLShaderProgram::BuildUniformSetters() const
+{
+    /* Query active uniforms */
+    std::vector<char> uniformName;
+    GLint numUniforms = 0, maxNameLength = 0;
+    if (!QueryActiveAttribs(GL_ACTIVE_UNIFORMS, GL_ACTIVE_UNIFORM_MAX_LENGTH, numUniforms, maxNameLength, uniformName))
+        return;
+
+    for (GLuint i = 0; i < static_cast<GLuint>(numUniforms); ++i)
+    {
+        /* Query uniform type and array size */
+        GLint   size    = 0;
+        GLenum  type    = 0;
+        glGetActiveUniform(id_, i, maxNameLength, nullptr, &size, &type, uniformName.data());
+
+        /* Uniforms within uniform blocks have no location */
+        GLint location = glGetUniformLocation(id_, uniformName.data());
+        if (location < 0 || size < 1)
+            continue;
+
+        /* Store setter for all locations of this uniform, since array elements have consecutive locations */
+        const auto setter       = GLGetUniformSetter(GLTypes::UnmapUniformType(type));
+        const auto endLocation  = static_cast<std::size_t>(location) + static_cast<std::size_t>(size);
+
+        if (uniformSetters_.size() < endLocation)
+            uniformSetters_.resize(endLocation, nullptr);
+
+        std::fill(uniformSetters_.begin() + location, uniformSetters_.begin() + endLocation, setter);
+    }
+}
+
+void GLShaderProgram::FinalizeLink() const
+{
+    linkPending_ = false;
+
+    if (HasErrors())
+        return;
+
+    BuildUniformSetters();
+
+    #ifdef GL_ARB_get_program_binary
+    /* Store program binary in the shader cache once it has been linked successfully */
+    if (pendingShaderCache_ != nullptr)
+    {
+        StoreInShaderCache(*pendingShaderCache_);
+
+        /* Mark shaders as successfully compiled; their compile status is implied by the link status */
+        for (auto key : pendingShaderKeys_)
+            pendingShaderCache_->Store(key, nullptr, 0);
+
+        pendingShaderKeys_.clear();
+        pendingShaderCache_ = nullptr;
+    }
+    #endif
+}
+
 #ifdef GL_ARB_program_interface_query
 
 void GLShaderProgram::QueryBufferProperties(ShaderResource& resource, GLenum programInterface, GLuint resourceIndex) const
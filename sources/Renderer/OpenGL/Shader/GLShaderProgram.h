@@ -11,7 +11,11 @@
 
 #include <LLGL/ShaderProgram.h>
 #include "GLShaderUniform.h"
+#include "GLSharedShader.h"
 #include "../OpenGL.h"
+#include "../../ShaderCache.h"
+#include <memory>
+#include <vector>
 
 
 namespace LLGL
@@ -36,7 +40,7 @@ class GLShaderProgram final : public ShaderProgram
 
     public:
 
-        GLShaderProgram(const ShaderProgramDescriptor& desc);
+        GLShaderProgram(const ShaderProgramDescriptor& desc, ShaderCache* shaderCache = nullptr);
         ~GLShaderProgram();
 
         /*
@@ -51,8 +55,32 @@ class GLShaderProgram final : public ShaderProgram
             return id_;
         }
 
+        /*
+        Returns true if linking this shader program has been completed.
+        This never blocks, so it can be polled while the driver compiles and links shaders asynchronously (GL_KHR_parallel_shader_compile).
+        */
+        bool IsLinkComplete() const;
+
+        // Blocks until linking this shader program has been completed and all state that depends on the link result is available.
+        inline void WaitForLink() const
+        {
+            if (linkPending_)
+                FinalizeLink();
+        }
+
+        // Returns the setter function for the uniform at the specified location, or null if there is no such uniform.
+        inline GLUniformSetter GetUniformSetter(GLint location) const
+        {
+            WaitForLink();
+            if (location >= 0 && static_cast<std::size_t>(location) < uniformSetters_.size())
+                return uniformSetters_[location];
+            return nullptr;
+        }
+
     private:
 
+        void BuildProgram(const ShaderProgramDescriptor& desc);
+
         void Attach(Shader* shader);
         void BindAttribLocations(std::size_t numVertexAttribs, const GLShaderAttribute* vertexAttribs);
         void BindFragDataLocations(std::size_t numFragmentAttribs, const GLShaderAttribute* fragmentAttribs);
@@ -79,16 +107,45 @@ class GLShaderProgram final : public ShaderProgram
         void QueryUniforms(ShaderReflection& reflection) const;
         void QueryWorkGroupSize(ShaderReflection& reflection) const;
 
+        // Builds the table of uniform setter functions for all uniform locations of this linked program.
+        void BuildUniformSetters() const;
+
+        // Finalizes all state that depends on the link result, i.e. the uniform setters and the shader cache entry.
+        void FinalizeLink() const;
+
         #ifdef GL_ARB_program_interface_query
         void QueryBufferProperties(ShaderResource& resource, GLenum programInterface, GLuint resourceIndex) const;
         #endif
 
+        // Builds the shader cache key from all attached shaders and returns false if any of them has no cache key.
+        bool BuildCacheKey(const ShaderProgramDescriptor& desc);
+
+        // Gathers the cache keys of all attached shaders that have been compiled on a shader cache miss.
+        void GatherPendingShaderCacheKeys(const ShaderProgramDescriptor& desc);
+
+        #ifdef GL_ARB_get_program_binary
+        bool LoadFromShaderCache(ShaderCache& shaderCache);
+        void StoreInShaderCache(ShaderCache& shaderCache) const;
+        #endif
+
     private:
 
-        GLuint  id_                     = 0;
+        GLuint                              id_                     = 0;
+
+        ShaderCache::Key                    cacheKey_               = 0;
+
+        /*
+        State that depends on the link result is mutable,
+        since it is finalized lazily when the driver links shader programs asynchronously.
+        */
+        mutable bool                                linkPending_        = false;
+        mutable ShaderCache*                        pendingShaderCache_ = nullptr;
+        mutable std::vector<ShaderCache::Key>       pendingShaderKeys_;     // Keys of attached shaders that are marked as compiled once the link succeeded
+        mutable std::unique_ptr<ShaderReflection>   cachedReflection_;
+        mutable std::vector<GLUniformSetter>        uniformSetters_;
 
         #ifdef __APPLE__
-        bool    hasNullFragmentShader_  = false;
+        GLSharedShaderSPtr                  nullFragmentShader_;
         #endif
 
     private:
@@ -6,7 +6,6 @@
  */
 
 #include "GLShaderUniform.h"
-#include "../GLTypes.h"
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
 
@@ -15,180 +14,76 @@ namespace LLGL
 {
 
 
-// Requires GL 2.0
-static void GLSetUniformsInt(UniformType type, GLint location, GLsizei count, const GLint* data)
-{
-    switch (type)
-    {
-        case UniformType::Int1:
-        case UniformType::Bool1:
-        case UniformType::Sampler:
-        case UniformType::Image:
-        case UniformType::AtomicCounter:
-            glUniform1iv(location, count, data);
-            break;
-        case UniformType::Int2:
-        case UniformType::Bool2:
-            glUniform2iv(location, count, data);
-            break;
-        case UniformType::Int3:
-        case UniformType::Bool3:
-            glUniform3iv(location, count, data);
-            break;
-        case UniformType::Int4:
-        case UniformType::Bool4:
-            glUniform4iv(location, count, data);
-            break;
-        default:
-            break;
+/*
+Setter functions for each uniform type, so the uniform type only needs to be resolved once when a shader program is linked.
+Boolean, sampler, image, and atomic counter uniforms are set with the integral functions.
+*/
+
+#define LLGL_DEF_GL_UNIFORM_SETTER(NAME, FUNC, TYPE)                            \
+    static void NAME(GLint location, GLsizei count, const void* data)           \
+    {                                                                           \
+        FUNC(location, count, reinterpret_cast<const TYPE*>(data));             \
     }
-}
 
-// Requires GL 2.0
-static void GLSetUniformsFloat(UniformType type, GLint location, GLsizei count, const GLfloat* data)
-{
-    switch (type)
-    {
-        case UniformType::Float1:
-            glUniform1fv(location, count, data);
-            break;
-        case UniformType::Float2:
-            glUniform2fv(location, count, data);
-            break;
-        case UniformType::Float3:
-            glUniform3fv(location, count, data);
-            break;
-        case UniformType::Float4:
-            glUniform4fv(location, count, data);
-            break;
-        case UniformType::Float2x2:
-            glUniformMatrix2fv(location, count, GL_FALSE, data);
-            break;
-        case UniformType::Float3x3:
-            glUniformMatrix3fv(location, count, GL_FALSE, data);
-            break;
-        case UniformType::Float4x4:
-            glUniformMatrix4fv(location, count, GL_FALSE, data);
-            break;
-        default:
-            break;
+#define LLGL_DEF_GL_UNIFORM_MATRIX_SETTER(NAME, FUNC, TYPE)                     \
+    static void NAME(GLint location, GLsizei count, const void* data)           \
+    {                                                                           \
+        FUNC(location, count, GL_FALSE, reinterpret_cast<const TYPE*>(data));   \
     }
-}
 
-// Requires GL 2.1
-static void GLSetUniformsFloatNxM(UniformType type, GLint location, GLsizei count, const GLfloat* data)
-{
-    if (!HasExtension(GLExt::ARB_shader_objects_21))
-        return;
+// Requires GL 2.0
+LLGL_DEF_GL_UNIFORM_SETTER( GLSetUniformsInt1, glUniform1iv, GLint )
+LLGL_DEF_GL_UNIFORM_SETTER( GLSetUniformsInt2, glUniform2iv, GLint )
+LLGL_DEF_GL_UNIFORM_SETTER( GLSetUniformsInt3, glUniform3iv, GLint )
+LLGL_DEF_GL_UNIFORM_SETTER( GLSetUniformsInt4, glUniform4iv, GLint )
 
-    switch (type)
-    {
-        case UniformType::Float2x3:
-            glUniformMatrix2x3fv(location, count, GL_FALSE, data);
-            break;
-        case UniformType::Float2x4:
-            glUniformMatrix2x4fv(location, count, GL_FALSE, data);
-            break;
-        case UniformType::Float3x2:
-            glUniformMatrix3x2fv(location, count, GL_FALSE, data);
-            break;
-        case UniformType::Float3x4:
-            glUniformMatrix3x4fv(location, count, GL_FALSE, data);
-            break;
-        case UniformType::Float4x2:
-            glUniformMatrix4x2fv(location, count, GL_FALSE, data);
-            break;
-        case UniformType::Float4x3:
-            glUniformMatrix4x3fv(location, count, GL_FALSE, data);
-            break;
-        default:
-            break;
-    }
-}
+LLGL_DEF_GL_UNIFORM_SETTER( GLSetUniformsFloat1, glUniform1fv, GLfloat )
+LLGL_DEF_GL_UNIFORM_SETTER( GLSetUniformsFloat2, glUniform2fv, GLfloat )
+LLGL_DEF_GL_UNIFORM_SETTER( GLSetUniformsFloat3, glUniform3fv, GLfloat )
+LLGL_DEF_GL_UNIFORM_SETTER( GLSetUniformsFloat4, glUniform4fv, GLfloat )
 
-// Requires GL 3.0
-static void GLSetUniformsUInt(UniformType type, GLint location, GLsizei count, const GLuint* data)
-{
-    if (!HasExtension(GLExt::ARB_shader_objects_30))
-        return;
+LLGL_DEF_GL_UNIFORM_MATRIX_SETTER( GLSetUniformsFloat2x2, glUniformMatrix2fv, GLfloat )
+LLGL_DEF_GL_UNIFORM_MATRIX_SETTER( GLSetUniformsFloat3x3, glUniformMatrix3fv, GLfloat )
+LLGL_DEF_GL_UNIFORM_MATRIX_SETTER( GLSetUniformsFloat4x4, glUniformMatrix4fv, GLfloat )
 
-    switch (type)
-    {
-        case UniformType::UInt1:
-            glUniform1uiv(location, count, data);
-            break;
-        case UniformType::UInt2:
-            glUniform2uiv(location, count, data);
-            break;
-        case UniformType::UInt3:
-            glUniform3uiv(location, count, data);
-            break;
-        case UniformType::UInt4:
-            glUniform4uiv(location, count, data);
-            break;
-        default:
-            break;
-    }
-}
+// Requires GL 2.1
+LLGL_DEF_GL_UNIFORM_MATRIX_SETTER( GLSetUniformsFloat2x3, glUniformMatrix2x3fv, GLfloat )
+LLGL_DEF_GL_UNIFORM_MATRIX_SETTER( GLSetUniformsFloat2x4, glUniformMatrix2x4fv, GLfloat )
+LLGL_DEF_GL_UNIFORM_MATRIX_SETTER( GLSetUniformsFloat3x2, glUniformMatrix3x2fv, GLfloat )
+LLGL_DEF_GL_UNIFORM_MATRIX_SETTER( GLSetUniformsFloat3x4, glUniformMatrix3x4fv, GLfloat )
+LLGL_DEF_GL_UNIFORM_MATRIX_SETTER( GLSetUniformsFloat4x2, glUniformMatrix4x2fv, GLfloat )
+LLGL_DEF_GL_UNIFORM_MATRIX_SETTER( GLSetUniformsFloat4x3, glUniformMatrix4x3fv, GLfloat )
+
+// Requires GL 3.0
+LLGL_DEF_GL_UNIFORM_SETTER( GLSetUniformsUInt1, glUniform1uiv, GLuint )
+LLGL_DEF_GL_UNIFORM_SETTER( GLSetUniformsUInt2, glUniform2uiv, GLuint )
+LLGL_DEF_GL_UNIFORM_SETTER( GLSetUniformsUInt3, glUniform3uiv, GLuint )
+LLGL_DEF_GL_UNIFORM_SETTER( GLSetUniformsUInt4, glUniform4uiv, GLuint )
 
 #ifdef LLGL_OPENGL
 
 // Requires GL 4.0
-static void GLSetUniformsDouble(UniformType type, GLint location, GLsizei count, const GLdouble* data)
-{
-    if (!HasExtension(GLExt::ARB_shader_objects_40))
-        return;
-
-    switch (type)
-    {
-        case UniformType::Double1:
-            glUniform1dv(location, count, data);
-            break;
-        case UniformType::Double2:
-            glUniform2dv(location, count, data);
-            break;
-        case UniformType::Double3:
-            glUniform3dv(location, count, data);
-            break;
-        case UniformType::Double4:
-            glUniform4dv(location, count, data);
-            break;
-        case UniformType::Double2x2:
-            glUniformMatrix2dv(location, count, GL_FALSE, data);
-            break;
-        case UniformType::Double2x3:
-            glUniformMatrix2x3dv(location, count, GL_FALSE, data);
-            break;
-        case UniformType::Double2x4:
-            glUniformMatrix2x4dv(location, count, GL_FALSE, data);
-            break;
-        case UniformType::Double3x2:
-            glUniformMatrix3x2dv(location, count, GL_FALSE, data);
-            break;
-        case UniformType::Double3x3:
-            glUniformMatrix3dv(location, count, GL_FALSE, data);
-            break;
-        case UniformType::Double3x4:
-            glUniformMatrix3x4dv(location, count, GL_FALSE, data);
-            break;
-        case UniformType::Double4x2:
-            glUniformMatrix4x2dv(location, count, GL_FALSE, data);
-            break;
-        case UniformType::Double4x3:
-            glUniformMatrix4x3dv(location, count, GL_FALSE, data);
-            break;
-        case UniformType::Double4x4:
-            glUniformMatrix4dv(location, count, GL_FALSE, data);
-            break;
-        default:
-            break;
-    }
-}
+LLGL_DEF_GL_UNIFORM_SETTER( GLSetUniformsDouble1, glUniform1dv, GLdouble )
+LLGL_DEF_GL_UNIFORM_SETTER( GLSetUniformsDouble2, glUniform2dv, GLdouble )
+LLGL_DEF_GL_UNIFORM_SETTER( GLSetUniformsDouble3, glUniform3dv, GLdouble )
+LLGL_DEF_GL_UNIFORM_SETTER( GLSetUniformsDouble4, glUniform4dv, GLdouble )
+
+LLGL_DEF_GL_UNIFORM_MATRIX_SETTER( GLSetUniformsDouble2x2, glUniformMatrix2dv,   GLdouble )
+LLGL_DEF_GL_UNIFORM_MATRIX_SETTER( GLSetUniformsDouble2x3, glUniformMatrix2x3dv, GLdouble )
+LLGL_DEF_GL_UNIFORM_MATRIX_SETTER( GLSetUniformsDouble2x4, glUniformMatrix2x4dv, GLdouble )
+LLGL_DEF_GL_UNIFORM_MATRIX_SETTER( GLSetUniformsDouble3x2, glUniformMatrix3x2dv, GLdouble )
+LLGL_DEF_GL_UNIFORM_MATRIX_SETTER( GLSetUniformsDouble3x3, glUniformMatrix3dv,   GLdouble )
+LLGL_DEF_GL_UNIFORM_MATRIX_SETTER( GLSetUniformsDouble3x4, glUniformMatrix3x4dv, GLdouble )
+LLGL_DEF_GL_UNIFORM_MATRIX_SETTER( GLSetUniformsDouble4x2, glUniformMatrix4x2dv, GLdouble )
+LLGL_DEF_GL_UNIFORM_MATRIX_SETTER( GLSetUniformsDouble4x3, glUniformMatrix4x3dv, GLdouble )
+LLGL_DEF_GL_UNIFORM_MATRIX_SETTER( GLSetUniformsDouble4x4, glUniformMatrix4dv,   GLdouble )
 
 #endif // /LLGL_OPENGL
 
+#undef LLGL_DEF_GL_UNIFORM_SETTER
+#undef LLGL_DEF_GL_UNIFORM_MATRIX_SETTER
 
-void GLSetUniformsByType(UniformType type, GLint location, GLsizei count, const void* data)
+GLUniformSetter GLGetUniformSetter(UniformType type)
 {
     switch (type)
     {
@@ -196,59 +91,62 @@ void GLSetUniformsByType(UniformType type, GLint location, GLsizei count, const
             break;
 
         /* ----- Scalars & Vectors ----- */
-        case UniformType::Float1:
-        case UniformType::Float2:
-        case UniformType::Float3:
-        case UniformType::Float4:
-            GLSetUniformsFloat(type, location, count, reinterpret_cast<const GLfloat*>(data));
-            break;
-
+        case UniformType::Float1:   return GLSetUniformsFloat1;
+        case UniformType::Float2:   return GLSetUniformsFloat2;
+        case UniformType::Float3:   return GLSetUniformsFloat3;
+        case UniformType::Float4:   return GLSetUniformsFloat4;
+
+        #ifdef LLGL_OPENGL
+        case UniformType::Double1:  return (HasExtension(GLExt::ARB_shader_objects_40) ? GLSetUniformsDouble1 : nullptr);
+        case UniformType::Double2:  return (HasExtension(GLExt::ARB_shader_objects_40) ? GLSetUniformsDouble2 : nullptr);
+        case UniformType::Double3:  return (HasExtension(GLExt::ARB_shader_objects_40) ? GLSetUniformsDouble3 : nullptr);
+        case UniformType::Double4:  return (HasExtension(GLExt::ARB_shader_objects_40) ? GLSetUniformsDouble4 : nullptr);
+        #else
         case UniformType::Double1:
         case UniformType::Double2:
         case UniformType::Double3:
         case UniformType::Double4:
-            #ifdef LLGL_OPENGL
-            GLSetUniformsDouble(type, location, count, reinterpret_cast<const GLdouble*>(data));
-            #endif
             break;
+        #endif // /LLGL_OPENGL
 
-        case UniformType::Int1:
-        case UniformType::Int2:
-        case UniformType::Int3:
-        case UniformType::Int4:
-            GLSetUniformsInt(type, location, count, reinterpret_cast<const GLint*>(data));
-            break;
+        case UniformType::Int1:     return GLSetUniformsInt1;
+        case UniformType::Int2:     return GLSetUniformsInt2;
+        case UniformType::Int3:     return GLSetUniformsInt3;
+        case UniformType::Int4:     return GLSetUniformsInt4;
 
-        case UniformType::UInt1:
-        case UniformType::UInt2:
-        case UniformType::UInt3:
-        case UniformType::UInt4:
-            GLSetUniformsUInt(type, location, count, reinterpret_cast<const GLuint*>(data));
-            break;
+        case UniformType::UInt1:    return (HasExtension(GLExt::ARB_shader_objects_30) ? GLSetUniformsUInt1 : nullptr);
+        case UniformType::UInt2:    return (HasExtension(GLExt::ARB_shader_objects_30) ? GLSetUniformsUInt2 : nullptr);
+        case UniformType::UInt3:    return (HasExtension(GLExt::ARB_shader_objects_30) ? GLSetUniformsUInt3 : nullptr);
+        case UniformType::UInt4:    return (HasExtension(GLExt::ARB_shader_objects_30) ? GLSetUniformsUInt4 : nullptr);
 
-        case UniformType::Bool1:
-        case UniformType::Bool2:
-        case UniformType::Bool3:
-        case UniformType::Bool4:
-            GLSetUniformsInt(type, location, count, reinterpret_cast<const GLint*>(data));
-            break;
+        case UniformType::Bool1:    return GLSetUniformsInt1;
+        case UniformType::Bool2:    return GLSetUniformsInt2;
+        case UniformType::Bool3:    return GLSetUniformsInt3;
+        case UniformType::Bool4:    return GLSetUniformsInt4;
 
         /* ----- Matrices ----- */
-        case UniformType::Float2x2:
-        case UniformType::Float3x3:
-        case UniformType::Float4x4:
-            GLSetUniformsFloat(type, location, count, reinterpret_cast<const GLfloat*>(data));
-            break;
-
-        case UniformType::Float2x3:
-        case UniformType::Float2x4:
-        case UniformType::Float3x2:
-        case UniformType::Float3x4:
-        case UniformType::Float4x2:
-        case UniformType::Float4x3:
-            GLSetUniformsFloatNxM(type, location, count, reinterpret_cast<const GLfloat*>(data));
-            break;
-
+        case UniformType::Float2x2: return GLSetUniformsFloat2x2;
+        case UniformType::Float3x3: return GLSetUniformsFloat3x3;
+        case UniformType::Float4x4: return GLSetUniformsFloat4x4;
+
+        case UniformType::Float2x3: return (HasExtension(GLExt::ARB_shader_objects_21) ? GLSetUniformsFloat2x3 : nullptr);
+        case UniformType::Float2x4: return (HasExtension(GLExt::ARB_shader_objects_21) ? GLSetUniformsFloat2x4 : nullptr);
+        case UniformType::Float3x2: return (HasExtension(GLExt::ARB_shader_objects_21) ? GLSetUniformsFloat3x2 : nullptr);
+        case UniformType::Float3x4: return (HasExtension(GLExt::ARB_shader_objects_21) ? GLSetUniformsFloat3x4 : nullptr);
+        case UniformType::Float4x2: return (HasExtension(GLExt::ARB_shader_objects_21) ? GLSetUniformsFloat4x2 : nullptr);
+        case UniformType::Float4x3: return (HasExtension(GLExt::ARB_shader_objects_21) ? GLSetUniformsFloat4x3 : nullptr);
+
+        #ifdef LLGL_OPENGL
+        case UniformType::Double2x2: return (HasExtension(GLExt::ARB_shader_objects_40) ? GLSetUniformsDouble2x2 : nullptr);
+        case UniformType::Double2x3: return (HasExtension(GLExt::ARB_shader_objects_40) ? GLSetUniformsDouble2x3 : nullptr);
+        case UniformType::Double2x4: return (HasExtension(GLExt::ARB_shader_objects_40) ? GLSetUniformsDouble2x4 : nullptr);
+        case UniformType::Double3x2: return (HasExtension(GLExt::ARB_shader_objects_40) ? GLSetUniformsDouble3x2 : nullptr);
+        case UniformType::Double3x3: return (HasExtension(GLExt::ARB_shader_objects_40) ? GLSetUniformsDouble3x3 : nullptr);
+        case UniformType::Double3x4: return (HasExtension(GLExt::ARB_shader_objects_40) ? GLSetUniformsDouble3x4 : nullptr);
+        case UniformType::Double4x2: return (HasExtension(GLExt::ARB_shader_objects_40) ? GLSetUniformsDouble4x2 : nullptr);
+        case UniformType::Double4x3: return (HasExtension(GLExt::ARB_shader_objects_40) ? GLSetUniformsDouble4x3 : nullptr);
+        case UniformType::Double4x4: return (HasExtension(GLExt::ARB_shader_objects_40) ? GLSetUniformsDouble4x4 : nullptr);
+        #else
         case UniformType::Double2x2:
         case UniformType::Double2x3:
         case UniformType::Double2x4:
@@ -258,30 +156,16 @@ void GLSetUniformsByType(UniformType type, GLint location, GLsizei count, const
         case UniformType::Double4x2:
         case UniformType::Double4x3:
         case UniformType::Double4x4:
-            #ifdef LLGL_OPENGL
-            GLSetUniformsDouble(type, location, count, reinterpret_cast<const GLdouble*>(data));
-            #endif
             break;
+        #endif // /LLGL_OPENGL
 
         /* ----- Resources ----- */
         case UniformType::Sampler:
         case UniformType::Image:
         case UniformType::AtomicCounter:
-            GLSetUniformsInt(type, location, count, reinterpret_cast<const GLint*>(data));
-            break;
+            return GLSetUniformsInt1;
     }
-}
-
-void GLSetUniformsByLocation(GLuint program, GLint location, GLsizei count, const void* data)
-{
-    /* Determine type of uniform */
-    GLenum type = 0;
-    GLint size = 0;
-    glGetActiveUniform(program, static_cast<GLuint>(location), 0, nullptr, &size, &type, nullptr);
-
-    /* Submit data to respective uniform type */
-    UniformType uniformType = GLTypes::UnmapUniformType(type);
-    GLSetUniformsByType(uniformType, location, count, data);
+    return nullptr;
 }
 
 
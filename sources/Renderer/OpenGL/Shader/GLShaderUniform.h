@@ -17,11 +17,11 @@ namespace LLGL
 {
 
 
-// Sets the data of the specified uniform in the active shader program.
-void GLSetUniformsByType(UniformType type, GLint location, GLsizei count, const void* data);
+// Function type to set the data of a uniform with a specific type in the active shader program.
+using GLUniformSetter = void (*)(GLint location, GLsizei count, const void* data);
 
-// Sets the data of the specified uniform in the active shader program, where the type is determined by the specified shader program.
-void GLSetUniformsByLocation(GLuint program, GLint location, GLsizei count, const void* data);
+// Returns the setter function for the specified uniform type, or null if the type is not supported by the current GL context.
+GLUniformSetter GLGetUniformSetter(UniformType type);
 
 
 } // /namespace LLGL
@@ -0,0 +1,92 @@
+/*
+ * GLSharedShader.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLSharedShader.h"
+#include "GLShader.h"
+#include "../Ext/GLExtensions.h"
+#include "../../../Core/HelperMacros.h"
+
+
+namespace LLGL
+{
+
+
+GLSharedShader::GLSharedShader(GLenum type, const std::string& source) :
+    type_    { type   },
+    content_ { source }
+{
+}
+
+GLSharedShader::GLSharedShader(GLenum type, const void* binary, std::size_t binarySize, const char* entryPoint) :
+    type_       { type                                          },
+    isBinary_   { true                                          },
+    content_    { static_cast<const char*>(binary), binarySize }
+{
+    /* Specialize for the default "main" function in a SPIR-V module */
+    entryPoint_ = (entryPoint == nullptr || *entryPoint == '\0' ? "main" : entryPoint);
+}
+
+GLSharedShader::GLSharedShader(const GLSharedShader& rhs) :
+    type_       { rhs.type_       },
+    isBinary_   { rhs.isBinary_   },
+    content_    { rhs.content_    },
+    entryPoint_ { rhs.entryPoint_ }
+{
+}
+
+GLSharedShader::~GLSharedShader()
+{
+    if (id_ != 0)
+        glDeleteShader(id_);
+}
+
+void GLSharedShader::Compile()
+{
+    if (id_ != 0)
+        return;
+
+    id_ = glCreateShader(type_);
+    GLShader::CompileGLShader(id_, content_.c_str());
+}
+
+void GLSharedShader::LoadBinary()
+{
+    if (id_ != 0)
+        return;
+
+    #if defined GL_ARB_gl_spirv && defined GL_ARB_ES2_compatibility
+
+    /* Load shader binary and specialize it for its entry point (extensions are checked by GLShader) */
+    id_ = glCreateShader(type_);
+    glShaderBinary(1, &id_, GL_SHADER_BINARY_FORMAT_SPIR_V, content_.data(), static_cast<GLsizei>(content_.size()));
+    glSpecializeShader(id_, entryPoint_.c_str(), 0, nullptr, nullptr);
+
+    #endif
+}
+
+int GLSharedShader::CompareSWO(const GLSharedShader& lhs, const GLSharedShader& rhs)
+{
+    LLGL_COMPARE_MEMBER_SWO     ( type_           );
+    LLGL_COMPARE_BOOL_MEMBER_SWO( isBinary_       );
+    LLGL_COMPARE_MEMBER_SWO     ( content_.size() );
+
+    /* Compare content last, since shaders of the same type and size are rare unless they are equal */
+    if (auto order = lhs.content_.compare(rhs.content_))
+        return (order < 0 ? -1 : 1);
+
+    if (auto order = lhs.entryPoint_.compare(rhs.entryPoint_))
+        return (order < 0 ? -1 : 1);
+
+    return 0;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
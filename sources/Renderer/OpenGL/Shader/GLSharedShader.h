@@ -0,0 +1,95 @@
+/*
+ * GLSharedShader.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_SHARED_SHADER_H
+#define LLGL_GL_SHARED_SHADER_H
+
+
+#include "../OpenGL.h"
+#include <memory>
+#include <string>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+class GLSharedShader;
+
+using GLSharedShaderSPtr = std::shared_ptr<GLSharedShader>;
+
+/*
+Native GL shader object that is shared between all shaders with the same type and content (see GLStatePool).
+The content is either GLSL source code or a SPIR-V module, and macro definitions are not part of it since GLSL sources are passed to GL unmodified.
+The GL shader is not created before 'Compile' or 'LoadBinary' is called, so temporary instances to compare shaders don't allocate any GL objects.
+*/
+class GLSharedShader
+{
+
+    public:
+
+        // Initializes the shared shader with GLSL source code.
+        GLSharedShader(GLenum type, const std::string& source);
+
+        // Initializes the shared shader with a SPIR-V module and its entry point.
+        GLSharedShader(GLenum type, const void* binary, std::size_t binarySize, const char* entryPoint);
+
+        // Copies only the shader type and content but not the GL shader.
+        GLSharedShader(const GLSharedShader& rhs);
+        GLSharedShader& operator = (const GLSharedShader&) = delete;
+
+        ~GLSharedShader();
+
+        // Creates the GL shader and compiles its source code, unless this has already been done.
+        void Compile();
+
+        // Creates the GL shader and specializes its SPIR-V module, unless this has already been done.
+        void LoadBinary();
+
+        // Returns true if the GL shader has been compiled or loaded.
+        inline bool IsCompiled() const
+        {
+            return (id_ != 0);
+        }
+
+        // Returns the ID of the GL shader.
+        inline GLuint GetID() const
+        {
+            return id_;
+        }
+
+        // Returns the GLSL source code or SPIR-V module of this shader.
+        inline const std::string& GetContent() const
+        {
+            return content_;
+        }
+
+    public:
+
+        // Returns a signed integer of the strict-weak-order (SWO) comparison, and 0 on equality.
+        static int CompareSWO(const GLSharedShader& lhs, const GLSharedShader& rhs);
+
+    private:
+
+        GLenum      type_       = 0;
+        bool        isBinary_   = false;
+        std::string content_;
+        std::string entryPoint_;
+        GLuint      id_         = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
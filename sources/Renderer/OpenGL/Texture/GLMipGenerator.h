@@ -40,8 +40,8 @@ class GLMipGenerator
         // Releases the resource for this singleton class.
         void Clear();
 
-        // Generates the entire MIP-map chain for the currently bound OpenGL texture.
-        void GenerateMips(const TextureType type);
+        // Generates the entire MIP-map chain for the currently bound OpenGL texture. This does not access the singleton and can be called from the upload context.
+        static void GenerateMips(const TextureType type);
 
         // Generates the entire MIP-map chain for the specified OpenGL texture.
         void GenerateMipsForTexture(GLStateManager& stateMngr, GLTexture& textureGL);
@@ -82,7 +82,7 @@ GLRenderTarget::GLRenderTarget(const RenderTargetDescriptor& desc) :
 
 GLRenderTarget::~GLRenderTarget()
 {
-    GLStateManager::Get().NotifyGLRenderTargetRelease(this);
+    GLStateManager::NotifyGLRenderTargetRelease(this);
 }
 
 void GLRenderTarget::SetName(const char* name)
@@ -66,6 +66,18 @@ static bool IsRenderbufferSufficient(const TextureDescriptor& desc)
     );
 }
 
+// Returns the estimated number of bytes of the entire texture storage, including all MIP-maps and samples
+static std::uint64_t GetTextureStorageSize(const TextureDescriptor& desc)
+{
+    const auto& formatDesc  = GetFormatAttribs(desc.format);
+    const auto  blockSize   = static_cast<std::uint64_t>(formatDesc.blockWidth * formatDesc.blockHeight);
+    const auto  numTexels   = static_cast<std::uint64_t>(NumMipTexels(desc));
+    if (blockSize > 0)
+        return (numTexels * formatDesc.bitSize / (blockSize * 8)) * std::max(1u, desc.samples);
+    else
+        return 0;
+}
+
 // Maps the specified format to a swizzle format, or identity swizzle if texture swizzling is not necessary
 static GLSwizzleFormat MapSwizzleFormat(const Format format)
 {
@@ -218,7 +230,8 @@ TextureDescriptor GLTexture::GetDesc() const
     else
         texDesc.arrayLayers     = static_cast<std::uint32_t>(extent[2]);
 
-    texDesc.samples             = static_cast<std::uint32_t>(samples);
+    /* Renderbuffers without multi-sampling report zero samples */
+    texDesc.samples             = static_cast<std::uint32_t>(std::max(1, samples));
 
     return texDesc;
 }
@@ -293,6 +306,10 @@ void GLTexture::BindAndAllocStorage(const TextureDescriptor& textureDesc, const
 
     /* Query and store internal format */
     QueryInternalFormat();
+
+    /* Store storage size for memory statistics */
+    storageSize_    = GetTextureStorageSize(textureDesc);
+    hasStorage_     = true;
 }
 
 static TextureSwizzleRGBA GetTextureSwizzlePermutationBGRA(const TextureSwizzleRGBA& swizzle)
@@ -869,7 +886,7 @@ void GLTexture::AllocTextureStorage(const TextureDescriptor& textureDesc, const
 
     /* Generate MIP-maps if enabled */
     if (imageDesc != nullptr && MustGenerateMipsOnCreate(textureDesc))
-        GLMipGenerator::Get().GenerateMips(textureDesc.type);
+        GLMipGenerator::GenerateMips(textureDesc.type);
 }
 
 void GLTexture::AllocRenderbufferStorage(const TextureDescriptor& textureDesc)
@@ -889,7 +906,24 @@ void GLTexture::QueryInternalFormat()
     GLint format = 0;
     {
         if (IsRenderbuffer())
-            glGetRenderbufferParameteriv(GL_RENDERBUFFER, GL_RENDERBUFFER_INTERNAL_FORMAT, &format);
+        {
+            #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+            if (HasExtension(GLExt::ARB_direct_state_access))
+            {
+                /* Query internal format directly using DSA, since the renderbuffer storage might have been allocated without binding it */
+                glGetNamedRenderbufferParameteriv(id_, GL_RENDERBUFFER_INTERNAL_FORMAT, &format);
+            }
+            else
+            #endif
+            {
+                GLStateManager::Get().PushBoundRenderbuffer();
+                {
+                    GLStateManager::Get().BindRenderbuffer(id_);
+                    glGetRenderbufferParameteriv(GL_RENDERBUFFER, GL_RENDERBUFFER_INTERNAL_FORMAT, &format);
+                }
+                GLStateManager::Get().PopBoundRenderbuffer();
+            }
+        }
         else
             GLProfile::GetTexParameterInternalFormat(GetGLTexTarget(), &format);
     }
@@ -991,7 +1025,7 @@ void GLTexture::GetRenderbufferParams(GLint* extent, GLint* samples) const
             }
 
             if (samples != nullptr)
-                glGetRenderbufferParameteriv(id_, GL_RENDERBUFFER_SAMPLES, samples);
+                glGetRenderbufferParameteriv(GL_RENDERBUFFER, GL_RENDERBUFFER_SAMPLES, samples);
         }
         GLStateManager::Get().PopBoundRenderbuffer();
     }
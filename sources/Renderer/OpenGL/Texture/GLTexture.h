@@ -114,6 +114,18 @@ class GLTexture final : public Texture
             return numMipLevels_;
         }
 
+        // Returns the estimated memory footprint (in bytes) of the allocated storage including all MIP-maps and samples.
+        inline std::uint64_t GetStorageSize() const
+        {
+            return storageSize_;
+        }
+
+        // Returns true if this texture has allocated its own storage, i.e. it is not a view of another texture's storage.
+        inline bool HasStorage() const
+        {
+            return hasStorage_;
+        }
+
         // Returns true if this object managges a GL renderbuffer instead of a texture.
         inline bool IsRenderbuffer() const
         {
@@ -154,6 +166,8 @@ class GLTexture final : public Texture
         GLuint              id_             = 0;                        // GL object name for texture or renderbuffer
         GLenum              internalFormat_ = 0;
         GLsizei             numMipLevels_   = 1;
+        std::uint64_t       storageSize_    = 0;
+        bool                hasStorage_     = false;
         bool                isRenderbuffer_ = false;
         GLSwizzleFormat     swizzleFormat_  = GLSwizzleFormat::RGBA;    // Identity texture swizzle by default
 
@@ -139,7 +139,8 @@ static RenderSystem* LoadRenderSystem(Module& module, const std::string& moduleF
 std::unique_ptr<RenderSystem> RenderSystem::Load(
     const RenderSystemDescriptor&   renderSystemDesc,
     RenderingProfiler*              profiler,
-    RenderingDebugger*              debugger)
+    RenderingDebugger*              debugger,
+    RenderingCapture*               capture)
 {
     /* Initialize mobile specific states */
     #if defined LLGL_OS_ANDROID
@@ -155,12 +156,12 @@ std::unique_ptr<RenderSystem> RenderSystem::Load(
         reinterpret_cast<RenderSystem*>(StaticModule::AllocRenderSystem(renderSystemDesc))
     );
 
-    if (profiler != nullptr || debugger != nullptr)
+    if (profiler != nullptr || debugger != nullptr || capture != nullptr)
     {
         #ifdef LLGL_ENABLE_DEBUG_LAYER
 
         /* Create debug layer render system */
-        renderSystem = MakeUnique<DbgRenderSystem>(std::move(renderSystem), profiler, debugger);
+        renderSystem = MakeUnique<DbgRenderSystem>(std::move(renderSystem), profiler, debugger, capture);
 
         #else
 
@@ -193,12 +194,12 @@ std::unique_ptr<RenderSystem> RenderSystem::Load(
         /* Allocate render system */
         auto renderSystem = std::unique_ptr<RenderSystem>(LoadRenderSystem(*module, moduleFilename, renderSystemDesc));
 
-        if (profiler != nullptr || debugger != nullptr)
+        if (profiler != nullptr || debugger != nullptr || capture != nullptr)
         {
             #ifdef LLGL_ENABLE_DEBUG_LAYER
 
             /* Create debug layer render system */
-            renderSystem = MakeUnique<DbgRenderSystem>(std::move(renderSystem), profiler, debugger);
+            renderSystem = MakeUnique<DbgRenderSystem>(std::move(renderSystem), profiler, debugger, capture);
 
             #else
 
@@ -240,6 +241,20 @@ void RenderSystem::SetConfiguration(const RenderSystemConfiguration& config)
     config_ = config;
 }
 
+bool RenderSystem::QueryMemoryStatistics(MemoryStatistics& stats)
+{
+    stats.heaps.clear();
+    stats.numBuffers    = 0;
+    stats.numTextures   = 0;
+    return false;
+}
+
+bool RenderSystem::QueryShaderCacheStatistics(ShaderCacheStatistics& stats)
+{
+    stats = ShaderCacheStatistics{};
+    return false;
+}
+
 
 /*
  * ======= Protected: =======
@@ -101,6 +101,7 @@ LLGL_EXPORT bool ValidateRenderingCaps(
     LLGL_VALIDATE_FEATURE( hasLogicOp,                   "logic fragment operations"  );
     LLGL_VALIDATE_FEATURE( hasPipelineStatistics,        "query pipeline statistics"  );
     LLGL_VALIDATE_FEATURE( hasRenderCondition,           "conditional rendering"      );
+    LLGL_VALIDATE_FEATURE( hasBindlessResources,         "bindless resources"         );
 
     #undef LLGL_VALIDATE_FEATURE
 
@@ -0,0 +1,68 @@
+/*
+ * RenderingCapture.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/RenderingCapture.h>
+#include "CaptureWriter.h"
+#include "CaptureReplayer.h"
+#include "../Core/Helper.h"
+
+
+namespace LLGL
+{
+
+
+RenderingCapture::RenderingCapture() :
+    writer_ { MakeUnique<CaptureWriter>() }
+{
+}
+
+RenderingCapture::~RenderingCapture()
+{
+}
+
+std::unique_ptr<Blob> RenderingCapture::Finalize()
+{
+    return writer_->Finalize();
+}
+
+std::uint32_t RenderingCapture::GetNumFrames() const
+{
+    return writer_->GetNumFrames();
+}
+
+bool RenderingCapture::IsFinalized() const
+{
+    return writer_->IsFinalized();
+}
+
+
+/*
+ * ======= Protected: =======
+ */
+
+CaptureWriter& RenderingCapture::GetWriter()
+{
+    return *writer_;
+}
+
+
+/*
+ * Global functions
+ */
+
+LLGL_EXPORT CaptureReplayStatistics ReplayCapture(RenderSystem& renderSystem, const Blob& capture)
+{
+    CaptureReplayer replayer{ renderSystem, capture };
+    return replayer.Replay();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
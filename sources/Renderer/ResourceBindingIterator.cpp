@@ -87,6 +87,26 @@ Resource* ResourceBindingIterator::Next(const BindingDescriptor** bindingDesc, c
 }
 
 
+
+/* ----- Functions ----- */
+
+LLGL_EXPORT bool IsBindlessTableBinding(const BindingDescriptor& bindingDesc)
+{
+    return (bindingDesc.type == ResourceType::Texture && (bindingDesc.bindFlags & BindFlags::Sampled) != 0);
+}
+
+LLGL_EXPORT std::size_t GetNumResourceViewsPerSet(const std::vector<BindingDescriptor>& bindings, bool bindless)
+{
+    if (!bindless)
+        return bindings.size();
+
+    std::size_t numResourceViews = 0;
+    for (const auto& binding : bindings)
+        numResourceViews += (IsBindlessTableBinding(binding) ? std::max(1u, binding.arraySize) : 1u);
+
+    return numResourceViews;
+}
+
 } // /namespace LLGL
 
 
@@ -58,6 +58,15 @@ class LLGL_EXPORT ResourceBindingIterator
 };
 
 
+/* ----- Functions ----- */
+
+// Returns true if the specified binding denotes a table of textures within a bindless resource heap (see ResourceHeapDescriptor::bindless).
+LLGL_EXPORT bool IsBindlessTableBinding(const BindingDescriptor& bindingDesc);
+
+// Returns the number of resource views that are consumed by the specified bindings for a single descriptor set.
+LLGL_EXPORT std::size_t GetNumResourceViewsPerSet(const std::vector<BindingDescriptor>& bindings, bool bindless);
+
+
 } // /namespace LLGL
 
 
@@ -46,6 +46,18 @@ class SPIRVParser
         // Returns true if the parsing process has finished.
         bool HasFinished() const;
 
+        // Returns the words of the SPIR-V module that is currently being parsed (including the header).
+        inline const std::uint32_t* GetWords() const
+        {
+            return words_;
+        }
+
+        // Returns the number of words of the SPIR-V module that is currently being parsed.
+        inline std::uint32_t GetNumWords() const
+        {
+            return numWords_;
+        }
+
     protected:
 
         // Callback function for the SPIR-V shader module header.
@@ -56,7 +68,9 @@ class SPIRVParser
 
     private:
 
-        bool finished_ = false;
+        bool                    finished_   = false;
+        const std::uint32_t*    words_      = nullptr;
+        std::uint32_t           numWords_   = 0;
 
 };
 
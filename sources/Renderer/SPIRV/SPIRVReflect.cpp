@@ -8,6 +8,8 @@
 #include "SPIRVReflect.h"
 #include "../../Core/Helper.h"
 #include <string>
+#include <new>
+#include <stdexcept>
 
 
 namespace LLGL
@@ -44,9 +46,9 @@ bool SPIRVReflect::SpvType::RefersToType(const spv::Op opcodeType) const
 
 void SPIRVReflect::OnParseHeader(const SPIRVHeader& header)
 {
+    SPIRVParser::OnParseHeader(header);
     idBound_ = header.idBound;
-    if (idBound_ > 0)
-        names_.resize(idBound_);
+    AllocateArena();
 }
 
 void SPIRVReflect::OnParseInstruction(const SPIRVInstruction& instr)
@@ -114,7 +116,7 @@ void SPIRVReflect::OpDecorate(const Instr& instr)
 void SPIRVReflect::OpDecorateBinding(const Instr& instr)
 {
     auto id         = instr.GetUInt32(0);
-    auto& variable  = uniforms_[id];
+    auto& variable  = GetUniform(id);
 
     variable.name       = GetName(id);
     variable.binding    = instr.GetUInt32(2);
@@ -123,7 +125,7 @@ void SPIRVReflect::OpDecorateBinding(const Instr& instr)
 void SPIRVReflect::OpDecorateLocation(const Instr& instr)
 {
     auto id         = instr.GetUInt32(0);
-    auto& variable  = varyings_[id];
+    auto& variable  = GetVarying(id);
 
     variable.name       = GetName(id);
     variable.location   = instr.GetUInt32(2);
@@ -132,7 +134,7 @@ void SPIRVReflect::OpDecorateLocation(const Instr& instr)
 void SPIRVReflect::OpDecorateBuiltin(const Instr& instr)
 {
     auto id         = instr.GetUInt32(0);
-    auto& variable  = varyings_[id];
+    auto& variable  = GetVarying(id);
 
     variable.name       = GetName(id);
     variable.builtin    = static_cast<spv::BuiltIn>(instr.GetUInt32(2));
@@ -140,8 +142,12 @@ void SPIRVReflect::OpDecorateBuiltin(const Instr& instr)
 
 void SPIRVReflect::OpType(const Instr& instr)
 {
-    /* Register type and store it as current type to operate on */
-    auto& type = types_[instr.result];
+    /* Register type in the arena and store it as current type to operate on */
+    auto& slot = GetSlot(instr.result);
+    if (slot.type == nullptr)
+        slot.type = &(types_[numTypes_++]);
+
+    auto& type = *(slot.type);
     {
         type.opcode = instr.opcode;
         type.result = instr.result;
@@ -248,11 +254,13 @@ static void AccumulateSizeInVectorBoundary(std::uint32_t& size, std::uint32_t al
 
 void SPIRVReflect::OpTypeStruct(const Instr& instr, SpvType& type)
 {
-    type.fieldTypes.reserve(instr.numOperands);
+    /* Refer to field type IDs in place */
+    type.numFields      = instr.numOperands;
+    type.fieldTypeIds   = instr.operands;
+
     for (std::uint32_t i = 0; i < instr.numOperands; ++i)
     {
         auto fieldType = FindType(instr.GetUInt32(i));
-        type.fieldTypes.push_back(fieldType);
         AccumulateSizeInVectorBoundary(type.size, 16, fieldType->size);
     }
     type.size = GetAlignedSize(type.size, 16u);
@@ -291,7 +299,7 @@ void SPIRVReflect::OpVariable(const Instr& instr)
         case spv::StorageClass::UniformConstant:
         //case spv::StorageClass::PushConstant:
         {
-            auto& var = uniforms_[instr.result];
+            auto& var = GetUniform(instr.result);
             {
                 var.type = FindType(instr.type);
                 if (auto structType = var.type->DereferencePtr(spv::Op::OpTypeStruct))
@@ -308,7 +316,7 @@ void SPIRVReflect::OpVariable(const Instr& instr)
 
         case spv::StorageClass::Input:
         {
-            auto& var = varyings_[instr.result];
+            auto& var = GetVarying(instr.result);
             {
                 var.type    = FindType(instr.type);
                 var.input   = true;
@@ -318,7 +326,7 @@ void SPIRVReflect::OpVariable(const Instr& instr)
 
         case spv::StorageClass::Output:
         {
-            auto& var = varyings_[instr.result];
+            auto& var = GetVarying(instr.result);
             {
                 var.type    = FindType(instr.type);
                 var.input   = false;
@@ -333,7 +341,11 @@ void SPIRVReflect::OpVariable(const Instr& instr)
 
 void SPIRVReflect::OpConstant(const Instr& instr)
 {
-    auto& val = constants_[instr.result];
+    auto& slot = GetSlot(instr.result);
+    if (slot.constant == nullptr)
+        slot.constant = &(constants_[numConstants_++]);
+
+    auto& val = *(slot.constant);
     {
         val.type = FindType(instr.type);
 
@@ -356,16 +368,221 @@ void SPIRVReflect::OpConstant(const Instr& instr)
     }
 }
 
+// Returns true if the specified storage class denotes a uniform variable.
+static bool IsUniformStorageClass(std::uint32_t storage)
+{
+    return
+    (
+        storage == static_cast<std::uint32_t>(spv::StorageClass::Uniform) ||
+        storage == static_cast<std::uint32_t>(spv::StorageClass::UniformConstant)
+    );
+}
+
+// Returns true if the specified storage class denotes an input or output variable.
+static bool IsVaryingStorageClass(std::uint32_t storage)
+{
+    return
+    (
+        storage == static_cast<std::uint32_t>(spv::StorageClass::Input) ||
+        storage == static_cast<std::uint32_t>(spv::StorageClass::Output)
+    );
+}
+
+// Returns true if the specified opcode denotes one of the OpType* instructions that are reflected.
+static bool IsReflectedTypeOpcode(spv::Op opcode)
+{
+    switch (opcode)
+    {
+        case spv::Op::OpTypeVoid:
+        case spv::Op::OpTypeBool:
+        case spv::Op::OpTypeInt:
+        case spv::Op::OpTypeFloat:
+        case spv::Op::OpTypeVector:
+        case spv::Op::OpTypeMatrix:
+        case spv::Op::OpTypeImage:
+        case spv::Op::OpTypeSampler:
+        case spv::Op::OpTypeSampledImage:
+        case spv::Op::OpTypeArray:
+        case spv::Op::OpTypeRuntimeArray:
+        case spv::Op::OpTypeStruct:
+        case spv::Op::OpTypeOpaque:
+        case spv::Op::OpTypePointer:
+        case spv::Op::OpTypeFunction:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Calls the specified function for each instruction with its opcode and words (including the first word).
+template <typename TFunc>
+static void ForEachSpvInstruction(const std::uint32_t* words, std::uint32_t numWords, TFunc func)
+{
+    for (std::uint32_t i = 5; i < numWords;)
+    {
+        const auto wordCount = (words[i] >> spv::WordCountShift);
+        if (wordCount == 0 || i + wordCount > numWords)
+            throw std::invalid_argument("invalid word count in SPIR-V shader module instruction");
+        func(static_cast<spv::Op>(words[i] & spv::OpCodeMask), &(words[i]), wordCount);
+        i += wordCount;
+    }
+}
+
+template <typename T>
+static T* AllocateArenaObjects(std::uint64_t*& arenaPtr, std::uint32_t count)
+{
+    /* Construct objects in place and advance arena pointer to the next 64-bit word */
+    auto objects = reinterpret_cast<T*>(arenaPtr);
+    for (std::uint32_t i = 0; i < count; ++i)
+        new (&objects[i]) T{};
+    arenaPtr += (sizeof(T) * count + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+    return objects;
+}
+
+template <typename T>
+static std::size_t GetArenaObjectsSize(std::uint32_t count)
+{
+    return (sizeof(T) * count + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+}
+
+void SPIRVReflect::AllocateArena()
+{
+    const auto words    = GetWords();
+    const auto numWords = GetNumWords();
+
+    /*
+    Determine number of types and constants in a first pass.
+    All variables and decorations are counted as upper bound for uniforms and varyings.
+    */
+    std::uint32_t numTypes = 0, numConstants = 0, maxUniforms = 0, maxVaryings = 0;
+
+    ForEachSpvInstruction(
+        words, numWords,
+        [&](spv::Op opcode, const std::uint32_t* instrWords, std::uint32_t wordCount)
+        {
+            if (IsReflectedTypeOpcode(opcode))
+                ++numTypes;
+            else if (opcode == spv::Op::OpConstant)
+                ++numConstants;
+            else if (opcode == spv::Op::OpVariable && wordCount >= 4)
+            {
+                if (IsUniformStorageClass(instrWords[3]))
+                    ++maxUniforms;
+                else if (IsVaryingStorageClass(instrWords[3]))
+                    ++maxVaryings;
+            }
+            else if (opcode == spv::Op::OpDecorate && wordCount >= 3)
+            {
+                switch (static_cast<spv::Decoration>(instrWords[2]))
+                {
+                    case spv::Decoration::Binding:
+                        ++maxUniforms;
+                        break;
+                    case spv::Decoration::Location:
+                    case spv::Decoration::BuiltIn:
+                        ++maxVaryings;
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
+    );
+
+    /* Allocate single arena for all reflection objects */
+    const std::size_t arenaSize =
+    (
+        GetArenaObjectsSize<SpvIdSlot  >(idBound_    ) +
+        GetArenaObjectsSize<SpvType    >(numTypes    ) +
+        GetArenaObjectsSize<SpvConstant>(numConstants) +
+        GetArenaObjectsSize<SpvUniform >(maxUniforms ) +
+        GetArenaObjectsSize<SpvVarying >(maxVaryings )
+    );
+
+    arena_.clear();
+    arena_.resize(arenaSize);
+
+    auto arenaPtr = arena_.data();
+    slots_      = AllocateArenaObjects<SpvIdSlot  >(arenaPtr, idBound_    );
+    types_      = AllocateArenaObjects<SpvType    >(arenaPtr, numTypes    );
+    constants_  = AllocateArenaObjects<SpvConstant>(arenaPtr, numConstants);
+    uniforms_   = AllocateArenaObjects<SpvUniform >(arenaPtr, maxUniforms );
+    varyings_   = AllocateArenaObjects<SpvVarying >(arenaPtr, maxVaryings );
+
+    numTypes_       = 0;
+    numConstants_   = 0;
+    numUniforms_    = 0;
+    numVaryings_    = 0;
+
+    /* Mark IDs of uniforms and varyings in a second pass (the actual indices are assigned afterwards) */
+    const std::uint32_t markedIndex = (~0u - 1u);
+
+    auto MarkUniform = [&](spv::Id id)
+    {
+        if (id < idBound_)
+            slots_[id].uniform = markedIndex;
+    };
+
+    auto MarkVarying = [&](spv::Id id)
+    {
+        if (id < idBound_)
+            slots_[id].varying = markedIndex;
+    };
+
+    ForEachSpvInstruction(
+        words, numWords,
+        [&](spv::Op opcode, const std::uint32_t* instrWords, std::uint32_t wordCount)
+        {
+            if (opcode == spv::Op::OpVariable && wordCount >= 4)
+            {
+                if (IsUniformStorageClass(instrWords[3]))
+                    MarkUniform(instrWords[2]);
+                else if (IsVaryingStorageClass(instrWords[3]))
+                    MarkVarying(instrWords[2]);
+            }
+            else if (opcode == spv::Op::OpDecorate && wordCount >= 4)
+            {
+                switch (static_cast<spv::Decoration>(instrWords[2]))
+                {
+                    case spv::Decoration::Binding:
+                        MarkUniform(instrWords[1]);
+                        break;
+                    case spv::Decoration::Location:
+                    case spv::Decoration::BuiltIn:
+                        MarkVarying(instrWords[1]);
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
+    );
+
+    /* Assign uniform and varying indices in ascending order of their IDs */
+    for (spv::Id id = 0; id < idBound_; ++id)
+    {
+        auto& slot = slots_[id];
+        if (slot.uniform == markedIndex)
+        {
+            slot.uniform = numUniforms_++;
+            uniforms_[slot.uniform].id = id;
+        }
+        if (slot.varying == markedIndex)
+        {
+            slot.varying = numVaryings_++;
+            varyings_[slot.varying].id = id;
+        }
+    }
+}
+
 void SPIRVReflect::SetName(spv::Id id, const char* name)
 {
-    AssertIdBound(id);
-    names_[id] = name;
+    GetSlot(id).name = name;
 }
 
 const char* SPIRVReflect::GetName(spv::Id id) const
 {
-    AssertIdBound(id);
-    return names_[id];
+    return GetSlot(id).name;
 }
 
 void SPIRVReflect::AssertIdBound(spv::Id id) const
@@ -379,20 +596,48 @@ void SPIRVReflect::AssertIdBound(spv::Id id) const
     }
 }
 
+SPIRVReflect::SpvIdSlot& SPIRVReflect::GetSlot(spv::Id id)
+{
+    AssertIdBound(id);
+    return slots_[id];
+}
+
+const SPIRVReflect::SpvIdSlot& SPIRVReflect::GetSlot(spv::Id id) const
+{
+    AssertIdBound(id);
+    return slots_[id];
+}
+
+SPIRVReflect::SpvUniform& SPIRVReflect::GetUniform(spv::Id id)
+{
+    const auto& slot = GetSlot(id);
+    if (slot.uniform >= numUniforms_)
+        throw std::runtime_error("SPIR-V uniform with result ID %" + std::to_string(id) + " has not been allocated");
+    return uniforms_[slot.uniform];
+}
+
+SPIRVReflect::SpvVarying& SPIRVReflect::GetVarying(spv::Id id)
+{
+    const auto& slot = GetSlot(id);
+    if (slot.varying >= numVaryings_)
+        throw std::runtime_error("SPIR-V varying with result ID %" + std::to_string(id) + " has not been allocated");
+    return varyings_[slot.varying];
+}
+
 const SPIRVReflect::SpvType* SPIRVReflect::FindType(spv::Id id) const
 {
-    auto it = types_.find(id);
-    if (it == types_.end())
+    const auto& slot = GetSlot(id);
+    if (slot.type == nullptr)
         throw std::runtime_error("cannot find SPIR-V OpType* instruction with result ID %" + std::to_string(id));
-    return &(it->second);
+    return slot.type;
 }
 
 const SPIRVReflect::SpvConstant* SPIRVReflect::FindConstant(spv::Id id) const
 {
-    auto it = constants_.find(id);
-    if (it == constants_.end())
+    const auto& slot = GetSlot(id);
+    if (slot.constant == nullptr)
         throw std::runtime_error("cannot find SPIR-V OpConstant instruction with with result ID %" + std::to_string(id));
-    return &(it->second);
+    return slot.constant;
 }
 
 
@@ -11,14 +11,18 @@
 
 #include "SPIRVParser.h"
 #include <vector>
-#include <map>
 
 
 namespace LLGL
 {
 
 
-// SPIR-V shader module parser.
+/*
+SPIR-V shader module reflection.
+All reflection objects are stored in a single arena allocation that is sized by a pre-pass over the module.
+Objects are looked up via dense tables that are indexed by the ID numbers of the module (sized by the ID-bound of the header).
+Names and record fields refer to the SPIR-V words in place, so the module must outlive the reflection objects.
+*/
 class SPIRVReflect final : public SPIRVParser
 {
 
@@ -31,15 +35,16 @@ class SPIRVReflect final : public SPIRVParser
             const SpvType* DereferencePtr(const spv::Op opcodeType) const;
             bool RefersToType(const spv::Op opcodeType) const;
 
-            spv::Op                     opcode      = spv::Op::Max;             // Opcode for this type (e.g. spv::Op::OpTypeFloat).
-            spv::Id                     result      = 0;                        // Result ID of this type.
-            spv::StorageClass           storage     = spv::StorageClass::Max;   // Storage class of this type. By default spv::StorageClass::Max.
-            const char*                 name        = nullptr;                  // Name of this type (only for structures).
-            const SpvType*              baseType    = nullptr;                  // Reference to the base type, or null if there is no base type.
-            std::uint32_t               elements    = 0;                        // Number of elements for the base type, or 0 if there is no base type.
-            std::uint32_t               size        = 0;                        // Size (in bytes) of this type, or 0 if this is an OpTypeVoid type.
-            bool                        sign        = false;                    // Specifies whether or not this is a signed type (only for OpTypeInt).
-            std::vector<const SpvType*> fieldTypes;                             // List of types of each record field.
+            spv::Op             opcode          = spv::Op::Max;             // Opcode for this type (e.g. spv::Op::OpTypeFloat).
+            spv::Id             result          = 0;                        // Result ID of this type.
+            spv::StorageClass   storage         = spv::StorageClass::Max;   // Storage class of this type. By default spv::StorageClass::Max.
+            const char*         name            = nullptr;                  // Name of this type (only for structures).
+            const SpvType*      baseType        = nullptr;                  // Reference to the base type, or null if there is no base type.
+            std::uint32_t       elements        = 0;                        // Number of elements for the base type, or 0 if there is no base type.
+            std::uint32_t       size            = 0;                        // Size (in bytes) of this type, or 0 if this is an OpTypeVoid type.
+            bool                sign            = false;                    // Specifies whether or not this is a signed type (only for OpTypeInt).
+            std::uint32_t       numFields       = 0;                        // Number of record fields (only for OpTypeStruct).
+            const spv::Id*      fieldTypeIds    = nullptr;                  // Type IDs of each record field within the SPIR-V module (see FindType).
         };
 
         // SPIRV-V scalar constants.
@@ -57,17 +62,10 @@ class SPIRVReflect final : public SPIRVParser
             };
         };
 
-        // SPIR-V structures (a.k.a. records).
-        struct SpvRecord
-        {
-            const char*     name    = nullptr;
-            std::uint32_t   size    = 0;
-            std::uint32_t   padding = 0;
-        };
-
         // Global uniform objects.
         struct SpvUniform
         {
+            spv::Id         id      = 0;        // Result ID of the uniform variable.
             const char*     name    = nullptr;
             const SpvType*  type    = nullptr;
             std::uint32_t   set     = 0;        // Descriptor set
@@ -78,6 +76,7 @@ class SPIRVReflect final : public SPIRVParser
         // Module varyings, i.e. either input or output attributes.
         struct SpvVarying
         {
+            spv::Id         id          = 0;                    // Result ID of the varying variable.
             const char*     name        = nullptr;
             spv::BuiltIn    builtin     = spv::BuiltIn::Max;    // Optional built-in type
             const SpvType*  type        = nullptr;
@@ -85,27 +84,74 @@ class SPIRVReflect final : public SPIRVParser
             bool            input       = false;
         };
 
+        // Range of contiguous reflection objects, ordered by their ID numbers.
+        template <typename T>
+        class SpvRange
+        {
+
+            public:
+
+                SpvRange() = default;
+
+                inline SpvRange(const T* first, std::uint32_t count) :
+                    first_ { first },
+                    count_ { count }
+                {
+                }
+
+                inline const T* begin() const
+                {
+                    return first_;
+                }
+
+                inline const T* end() const
+                {
+                    return (first_ + count_);
+                }
+
+                inline std::uint32_t size() const
+                {
+                    return count_;
+                }
+
+            private:
+
+                const T*        first_  = nullptr;
+                std::uint32_t   count_  = 0;
+
+        };
+
     public:
 
-        inline const std::map<spv::Id, SpvRecord>& GetRecords() const
+        inline SpvRange<SpvUniform> GetUniforms() const
         {
-            return records_;
+            return { uniforms_, numUniforms_ };
         }
 
-        inline const std::map<spv::Id, SpvUniform>& GetUniforms() const
+        inline SpvRange<SpvVarying> GetVaryings() const
         {
-            return uniforms_;
+            return { varyings_, numVaryings_ };
         }
 
-        inline const std::map<spv::Id, SpvVarying>& GetVaryings() const
-        {
-            return varyings_;
-        }
+        // Returns the type with the specified result ID or throws an std::runtime_error exception if there is no such type.
+        const SpvType* FindType(spv::Id id) const;
 
     private:
 
         using Instr = SPIRVInstruction;
 
+        // Entry for each ID number of the module.
+        struct SpvIdSlot
+        {
+            const char*     name        = nullptr;
+            SpvType*        type        = nullptr;
+            SpvConstant*    constant    = nullptr;
+            std::uint32_t   uniform     = ~0u;      // Index into uniform array, or ~0 if this ID is not a uniform.
+            std::uint32_t   varying     = ~0u;      // Index into varying array, or ~0 if this ID is not a varying.
+        };
+
+    private:
+
         void OnParseHeader(const SPIRVHeader& header) override;
         void OnParseInstruction(const SPIRVInstruction& instr) override;
 
@@ -135,24 +181,39 @@ class SPIRVReflect final : public SPIRVParser
 
     private:
 
+        // Scans the module words to determine the number of reflection objects and allocates the arena for them.
+        void AllocateArena();
+
         void SetName(spv::Id id, const char* name);
         const char* GetName(spv::Id id) const;
 
         void AssertIdBound(spv::Id id) const;
 
-        const SpvType* FindType(spv::Id id) const;
+        SpvIdSlot& GetSlot(spv::Id id);
+        const SpvIdSlot& GetSlot(spv::Id id) const;
+
+        SpvUniform& GetUniform(spv::Id id);
+        SpvVarying& GetVarying(spv::Id id);
+
         const SpvConstant* FindConstant(spv::Id id) const;
 
     private:
 
-        std::uint32_t                   idBound_    = 0;
-        std::vector<const char*>        names_;
+        std::uint32_t               idBound_        = 0;
+
+        // Single allocation for all reflection objects; stored as 64-bit words to satisfy the alignment of all objects.
+        std::vector<std::uint64_t>  arena_;
+
+        SpvIdSlot*                  slots_          = nullptr;
+        SpvType*                    types_          = nullptr;
+        SpvConstant*                constants_      = nullptr;
+        SpvUniform*                 uniforms_       = nullptr;
+        SpvVarying*                 varyings_       = nullptr;
 
-        std::map<spv::Id, SpvType>      types_;
-        std::map<spv::Id, SpvConstant>  constants_;
-        std::map<spv::Id, SpvRecord>    records_;
-        std::map<spv::Id, SpvUniform>   uniforms_;
-        std::map<spv::Id, SpvVarying>   varyings_;
+        std::uint32_t               numTypes_       = 0;
+        std::uint32_t               numConstants_   = 0;
+        std::uint32_t               numUniforms_    = 0;
+        std::uint32_t               numVaryings_    = 0;
 
 };
 
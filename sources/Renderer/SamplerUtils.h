@@ -0,0 +1,39 @@
+/*
+ * SamplerUtils.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_SAMPLER_UTILS_H
+#define LLGL_SAMPLER_UTILS_H
+
+
+#include <LLGL/Export.h>
+#include "ContainerTypes.h"
+
+
+namespace LLGL
+{
+
+
+struct SamplerDescriptor;
+
+// Container type for sampler objects that are shared between equal sampler descriptors.
+template <typename T>
+using HWSamplerCache = HWObjectCache<T, SamplerDescriptor>;
+
+/* ----- Functions ----- */
+
+// Compares the two sampler descriptors in a strict-weak-order (SWO); used to share sampler objects between equal descriptors.
+LLGL_EXPORT int CompareSWO(const SamplerDescriptor& lhs, const SamplerDescriptor& rhs);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -109,14 +109,20 @@ void Deserializer::Reset()
 
 Segment Deserializer::Begin()
 {
-    if (pos_ + g_segmentHeaderSize >= size_)
+    if (pos_ >= size_)
         return {};
+    if (g_segmentHeaderSize > size_ - pos_)
+        throw std::out_of_range("incomplete segment header in serialization data");
 
     /* Read segment header */
     Segment seg;
     seg.ident   = *reinterpret_cast<const IdentType*>(data_ + pos_);
     seg.size    = *reinterpret_cast<const SizeType*>(data_ + pos_ + sizeof(IdentType));
 
+    /* Validate segment size against the remaining data */
+    if (seg.size > size_ - pos_ - g_segmentHeaderSize)
+        throw std::out_of_range("serialization segment exceeds size of serialization data");
+
     /* Set new reading position and end of segment */
     pos_ += g_segmentHeaderSize;
     segmentEnd_ = pos_ + seg.size;
@@ -145,11 +151,13 @@ Segment Deserializer::Begin(IdentType ident)
 
 Segment Deserializer::BeginOnMatch(IdentType ident)
 {
-    const auto prevPos = pos_;
+    const auto prevPos          = pos_;
+    const auto prevSegmentEnd   = segmentEnd_;
     auto seg = Begin();
     if (seg.ident != ident)
     {
-        pos_ = prevPos;
+        pos_        = prevPos;
+        segmentEnd_ = prevSegmentEnd;
         return {};
     }
     return seg;
@@ -158,7 +166,7 @@ Segment Deserializer::BeginOnMatch(IdentType ident)
 void Deserializer::Read(void* data, std::size_t size)
 {
     /* Out of bounds check */
-    if (pos_ + size > segmentEnd_)
+    if (size > GetRemainingSize())
         throw std::out_of_range("reading position out of bounds in serialization segment");
 
     /* Copy segment data into output buffer */
@@ -171,13 +179,12 @@ void Deserializer::Read(void* data, std::size_t size)
 const char* Deserializer::ReadCString()
 {
     /* Determine string length and validate segment boundary */
+    const auto maxLen = GetRemainingSize();
     std::size_t len = 0;
-    while (data_[pos_ + len] != '\0')
-    {
+    while (len < maxLen && data_[pos_ + len] != '\0')
         ++len;
-        if (pos_ + len > segmentEnd_)
-            throw std::out_of_range("null terminated string out of bounds in serialization segment");
-    }
+    if (len == maxLen)
+        throw std::out_of_range("null terminated string out of bounds in serialization segment");
 
     /* Return string and increment reading position */
     auto str = reinterpret_cast<const char*>(&(data_[pos_]));
@@ -185,6 +192,28 @@ const char* Deserializer::ReadCString()
     return str;
 }
 
+const void* Deserializer::ReadView(std::size_t size)
+{
+    /* Out of bounds check */
+    if (size > GetRemainingSize())
+        throw std::out_of_range("reading position out of bounds in serialization segment");
+
+    /* Return pointer to segment data and increase reading position */
+    auto data = (data_ + pos_);
+    pos_ += size;
+    return data;
+}
+
+std::size_t Deserializer::GetRemainingSize() const
+{
+    return (segmentEnd_ > pos_ ? segmentEnd_ - pos_ : 0);
+}
+
+bool Deserializer::IsEnd() const
+{
+    return (pos_ >= size_);
+}
+
 void Deserializer::End()
 {
     /* Set reading position to end of segment */
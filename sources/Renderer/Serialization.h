@@ -162,6 +162,15 @@ class LLGL_EXPORT Deserializer
         // Reads a null terminated string from the current segment.
         const char* ReadCString();
 
+        // Returns a pointer to the next data part of the current segment without copying it and moves the reading position forward.
+        const void* ReadView(std::size_t size);
+
+        // Returns the number of bytes that are left to read in the current segment.
+        std::size_t GetRemainingSize() const;
+
+        // Returns true if the reading position has reached the end of the serialized data.
+        bool IsEnd() const;
+
         // Fast forwards to the end of the current segment.
         void End();
 
@@ -0,0 +1,660 @@
+/*
+ * ShaderCache.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "ShaderCache.h"
+#include "Serialization.h"
+#include "../Core/Helper.h"
+#include <LLGL/RenderSystemFlags.h>
+#include <LLGL/Platform/Platform.h>
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+
+#ifdef LLGL_OS_WIN32
+#   include "../Platform/Win32/Win32LeanAndMean.h"
+#   include <Windows.h>
+#endif
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal structures ----- */
+
+static const std::uint32_t g_shaderCacheEntryMagic  = 0x4353474C; // "LGSC"
+static const std::uint32_t g_shaderCacheIndexMagic  = 0x4953474C; // "LGSI"
+static const std::uint32_t g_shaderCacheVersion     = 1;
+
+// Number of stored entries after which the index is written, so an abnormal termination loses at most this many index entries
+static const std::uint32_t g_shaderCacheIndexFlushInterval = 32;
+
+// FNV-1a 64-bit constants
+static const std::uint64_t g_fnvOffsetBasis         = 0xCBF29CE484222325ull;
+static const std::uint64_t g_fnvPrime               = 0x00000100000001B3ull;
+
+struct ShaderCacheEntryHeader
+{
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint64_t key;
+    std::uint64_t size;
+    std::uint64_t checksum;
+};
+
+struct ShaderCacheIndexHeader
+{
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint64_t numEntries;
+};
+
+struct ShaderCacheIndexEntry
+{
+    std::uint64_t key;
+    std::uint64_t size;
+    std::uint64_t lastUse;
+};
+
+// Segment identifiers for serialized shader reflections.
+enum ShaderCacheIdent : Serialization::IdentType
+{
+    ShaderCacheIdent_ReservedShaderCache = (RendererID::Reserved << 8),
+    ShaderCacheIdent_Resources,         // ShaderResource[n]
+    ShaderCacheIdent_Uniforms,          // ShaderUniform[n]
+    ShaderCacheIdent_VertexInputs,      // VertexAttribute[n]
+    ShaderCacheIdent_VertexOutputs,     // VertexAttribute[n]
+    ShaderCacheIdent_FragmentOutputs,   // FragmentAttribute[n]
+    ShaderCacheIdent_WorkGroupSize,     // Extent3D
+};
+
+
+/* ----- Internal functions ----- */
+
+static void HashBytes(std::uint64_t& hash, const void* data, std::size_t size)
+{
+    auto bytes = reinterpret_cast<const std::uint8_t*>(data);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= g_fnvPrime;
+    }
+}
+
+template <typename T>
+static void HashValue(std::uint64_t& hash, const T& value)
+{
+    HashBytes(hash, &value, sizeof(value));
+}
+
+// Hashes the string including its null terminator, so consecutive strings can not be confused; a null pointer is hashed like an empty string.
+static void HashCString(std::uint64_t& hash, const char* str)
+{
+    if (str != nullptr)
+        HashBytes(hash, str, std::strlen(str) + 1);
+    else
+        HashValue(hash, '\0');
+}
+
+static void HashVertexAttributes(std::uint64_t& hash, const std::vector<VertexAttribute>& attribs)
+{
+    HashValue(hash, static_cast<std::uint64_t>(attribs.size()));
+    for (const auto& attr : attribs)
+    {
+        HashCString(hash, attr.name.c_str());
+        HashValue(hash, static_cast<std::uint32_t>(attr.format));
+        HashValue(hash, attr.location);
+        HashValue(hash, attr.semanticIndex);
+        HashValue(hash, static_cast<std::uint32_t>(attr.systemValue));
+        HashValue(hash, attr.slot);
+        HashValue(hash, attr.offset);
+        HashValue(hash, attr.stride);
+        HashValue(hash, attr.instanceDivisor);
+    }
+}
+
+static void HashShaderSource(std::uint64_t& hash, const ShaderDescriptor& desc)
+{
+    switch (desc.sourceType)
+    {
+        case ShaderSourceType::CodeString:
+        {
+            const auto sourceSize = (desc.sourceSize > 0 ? desc.sourceSize : std::strlen(desc.source));
+            HashBytes(hash, desc.source, sourceSize);
+        }
+        break;
+
+        case ShaderSourceType::CodeFile:
+        {
+            const auto fileContent = ReadFileString(desc.source);
+            HashBytes(hash, fileContent.data(), fileContent.size());
+        }
+        break;
+
+        case ShaderSourceType::BinaryBuffer:
+        {
+            HashBytes(hash, desc.source, desc.sourceSize);
+        }
+        break;
+
+        case ShaderSourceType::BinaryFile:
+        {
+            const auto fileContent = MapFileBuffer(desc.source);
+            HashBytes(hash, fileContent->GetData(), fileContent->GetSize());
+        }
+        break;
+    }
+}
+
+static std::uint64_t ComputeChecksum(const void* data, std::size_t size)
+{
+    std::uint64_t hash = g_fnvOffsetBasis;
+    HashBytes(hash, data, size);
+    return hash;
+}
+
+// Writes the specified file to a temporary file first and renames it afterwards, so the destination file is never partially written.
+static bool WriteFileAtomic(const std::string& filename, const void* header, std::size_t headerSize, const void* data, std::size_t dataSize)
+{
+    const std::string tempFilename = filename + ".tmp";
+
+    {
+        std::ofstream file{ tempFilename, std::ios::out | std::ios::binary | std::ios::trunc };
+        if (!file.good())
+            return false;
+
+        file.write(reinterpret_cast<const char*>(header), static_cast<std::streamsize>(headerSize));
+        if (dataSize > 0)
+            file.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(dataSize));
+
+        file.close();
+        if (!file.good())
+        {
+            std::remove(tempFilename.c_str());
+            return false;
+        }
+    }
+
+    /* Replace destination file in a single step; std::rename does not replace existing files on Win32 */
+    #ifdef LLGL_OS_WIN32
+    if (!MoveFileExA(tempFilename.c_str(), filename.c_str(), MOVEFILE_REPLACE_EXISTING))
+    #else
+    if (std::rename(tempFilename.c_str(), filename.c_str()) != 0)
+    #endif
+    {
+        std::remove(tempFilename.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+template <typename T>
+static void ReadSerializedCount(Serialization::Deserializer& reader, std::vector<T>& container)
+{
+    std::uint32_t count = 0;
+    reader.ReadTyped(count);
+    container.resize(count);
+}
+
+static void WriteSerializedVertexAttributes(Serialization::Serializer& writer, Serialization::IdentType ident, const std::vector<VertexAttribute>& attribs)
+{
+    writer.Begin(ident);
+    {
+        writer.WriteTyped(static_cast<std::uint32_t>(attribs.size()));
+        for (const auto& attr : attribs)
+        {
+            writer.WriteCString(attr.name.c_str());
+            writer.WriteTyped(attr.format);
+            writer.WriteTyped(attr.location);
+            writer.WriteTyped(attr.semanticIndex);
+            writer.WriteTyped(attr.systemValue);
+            writer.WriteTyped(attr.slot);
+            writer.WriteTyped(attr.offset);
+            writer.WriteTyped(attr.stride);
+            writer.WriteTyped(attr.instanceDivisor);
+        }
+    }
+    writer.End();
+}
+
+static void ReadSerializedVertexAttributes(Serialization::Deserializer& reader, Serialization::IdentType ident, std::vector<VertexAttribute>& attribs)
+{
+    reader.Begin(ident);
+    {
+        ReadSerializedCount(reader, attribs);
+        for (auto& attr : attribs)
+        {
+            attr.name = reader.ReadCString();
+            reader.ReadTyped(attr.format);
+            reader.ReadTyped(attr.location);
+            reader.ReadTyped(attr.semanticIndex);
+            reader.ReadTyped(attr.systemValue);
+            reader.ReadTyped(attr.slot);
+            reader.ReadTyped(attr.offset);
+            reader.ReadTyped(attr.stride);
+            reader.ReadTyped(attr.instanceDivisor);
+        }
+    }
+    reader.End();
+}
+
+
+/* ----- ShaderCache class ----- */
+
+ShaderCache::ShaderCache(const ShaderCacheDescriptor& desc) :
+    path_    { desc.path    },
+    maxSize_ { desc.maxSize }
+{
+    /* Append path separator if necessary */
+    if (!path_.empty() && path_.back() != '/' && path_.back() != '\\')
+        path_ += '/';
+
+    ReadIndex();
+}
+
+ShaderCache::~ShaderCache()
+{
+    /* Write index on destruction to persist the recent usage of all entries */
+    std::lock_guard<std::mutex> guard { mutex_ };
+    if (indexDirty_)
+        WriteIndex();
+}
+
+std::unique_ptr<Blob> ShaderCache::Load(Key key)
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    auto it = entries_.find(key);
+    if (it == entries_.end())
+    {
+        ++stats_.numMisses;
+        return nullptr;
+    }
+
+    /* Read and validate entry header */
+    std::ifstream file{ GetEntryFilename(key), std::ios::in | std::ios::binary };
+
+    ShaderCacheEntryHeader header = {};
+    std::vector<std::int8_t> data;
+
+    if (file.good())
+    {
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        if (file.good()                                 &&
+            header.magic    == g_shaderCacheEntryMagic  &&
+            header.version  == g_shaderCacheVersion     &&
+            header.key      == key                      &&
+            header.size     == it->second.size - sizeof(header))
+        {
+            /* Read entry data and validate checksum */
+            data.resize(static_cast<std::size_t>(header.size));
+            file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+            if (file.good() && ComputeChecksum(data.data(), data.size()) == header.checksum)
+            {
+                it->second.lastUse = ++useCounter_;
+                indexDirty_ = true;
+                ++stats_.numHits;
+                return Blob::CreateStrongRef(std::move(data));
+            }
+        }
+    }
+
+    /* Discard missing or corrupted entry */
+    file.close();
+    RemoveEntry(key);
+    ++stats_.numCorrupted;
+    ++stats_.numMisses;
+
+    return nullptr;
+}
+
+bool ShaderCache::Store(Key key, const void* data, std::size_t size)
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    /* Reject entries that would never fit into the cache */
+    const std::uint64_t entrySize = sizeof(ShaderCacheEntryHeader) + size;
+    if (entrySize > maxSize_)
+        return false;
+
+    /* Write entry to file */
+    ShaderCacheEntryHeader header;
+    {
+        header.magic    = g_shaderCacheEntryMagic;
+        header.version  = g_shaderCacheVersion;
+        header.key      = key;
+        header.size     = size;
+        header.checksum = ComputeChecksum(data, size);
+    }
+
+    /* Remove previous entry first, so the total size is consistent even if writing fails */
+    if (entries_.find(key) != entries_.end())
+        RemoveEntry(key);
+
+    if (!WriteFileAtomic(GetEntryFilename(key), &header, sizeof(header), data, size))
+        return false;
+
+    /* Register new entry */
+    auto& entry = entries_[key];
+    {
+        entry.size      = entrySize;
+        entry.lastUse   = ++useCounter_;
+    }
+    stats_.totalSize += entrySize;
+    ++stats_.numWrites;
+
+    EvictEntries();
+
+    /* Write index only in batches, since it contains all entries */
+    indexDirty_ = true;
+    if (++numUnsavedStores_ >= g_shaderCacheIndexFlushInterval)
+        WriteIndex();
+
+    return true;
+}
+
+ShaderCache::Statistics ShaderCache::GetStatistics() const
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+    return stats_;
+}
+
+ShaderCache::Key ShaderCache::HashShaderDescriptor(const ShaderDescriptor& desc)
+{
+    std::uint64_t hash = g_fnvOffsetBasis;
+
+    /* Hash shader type and source */
+    HashValue(hash, static_cast<std::uint32_t>(desc.type));
+    HashValue(hash, static_cast<std::uint32_t>(desc.sourceType));
+    HashShaderSource(hash, desc);
+
+    /* Hash compile options */
+    HashCString(hash, desc.entryPoint);
+    HashCString(hash, desc.profile);
+
+    if (desc.defines != nullptr)
+    {
+        for (auto macro = desc.defines; macro->name != nullptr; ++macro)
+        {
+            HashCString(hash, macro->name);
+            HashCString(hash, macro->definition);
+        }
+    }
+    HashValue(hash, '\0');
+
+    HashValue(hash, static_cast<std::int64_t>(desc.flags));
+
+    /* Hash shader attributes, since they affect the linkage of shader programs */
+    HashVertexAttributes(hash, desc.vertex.inputAttribs);
+    HashVertexAttributes(hash, desc.vertex.outputAttribs);
+
+    HashValue(hash, static_cast<std::uint64_t>(desc.fragment.outputAttribs.size()));
+    for (const auto& attr : desc.fragment.outputAttribs)
+    {
+        HashCString(hash, attr.name.c_str());
+        HashValue(hash, static_cast<std::uint32_t>(attr.format));
+        HashValue(hash, attr.location);
+        HashValue(hash, static_cast<std::uint32_t>(attr.systemValue));
+    }
+
+    HashValue(hash, desc.compute.workGroupSize.width);
+    HashValue(hash, desc.compute.workGroupSize.height);
+    HashValue(hash, desc.compute.workGroupSize.depth);
+
+    return hash;
+}
+
+ShaderCache::Key ShaderCache::HashString(const char* str)
+{
+    std::uint64_t hash = g_fnvOffsetBasis;
+    HashCString(hash, str);
+    return hash;
+}
+
+ShaderCache::Key ShaderCache::CombineKeys(Key lhs, Key rhs)
+{
+    return (lhs ^ (rhs + 0x9E3779B97F4A7C15ull + (lhs << 6) + (lhs >> 2)));
+}
+
+std::unique_ptr<Blob> ShaderCache::SerializeShaderReflection(const ShaderReflection& reflection)
+{
+    Serialization::Serializer writer;
+
+    writer.Begin(ShaderCacheIdent_Resources);
+    {
+        writer.WriteTyped(static_cast<std::uint32_t>(reflection.resources.size()));
+        for (const auto& resource : reflection.resources)
+        {
+            writer.WriteCString(resource.binding.name.c_str());
+            writer.WriteTyped(resource.binding.type);
+            writer.WriteTyped(static_cast<std::int64_t>(resource.binding.bindFlags));
+            writer.WriteTyped(static_cast<std::int64_t>(resource.binding.stageFlags));
+            writer.WriteTyped(resource.binding.slot);
+            writer.WriteTyped(resource.binding.arraySize);
+            writer.WriteTyped(resource.constantBufferSize);
+            writer.WriteTyped(resource.storageBufferType);
+        }
+    }
+    writer.End();
+
+    writer.Begin(ShaderCacheIdent_Uniforms);
+    {
+        writer.WriteTyped(static_cast<std::uint32_t>(reflection.uniforms.size()));
+        for (const auto& uniform : reflection.uniforms)
+        {
+            writer.WriteCString(uniform.name.c_str());
+            writer.WriteTyped(uniform.type);
+            writer.WriteTyped(uniform.location);
+            writer.WriteTyped(uniform.size);
+        }
+    }
+    writer.End();
+
+    WriteSerializedVertexAttributes(writer, ShaderCacheIdent_VertexInputs, reflection.vertex.inputAttribs);
+    WriteSerializedVertexAttributes(writer, ShaderCacheIdent_VertexOutputs, reflection.vertex.outputAttribs);
+
+    writer.Begin(ShaderCacheIdent_FragmentOutputs);
+    {
+        writer.WriteTyped(static_cast<std::uint32_t>(reflection.fragment.outputAttribs.size()));
+        for (const auto& attr : reflection.fragment.outputAttribs)
+        {
+            writer.WriteCString(attr.name.c_str());
+            writer.WriteTyped(attr.format);
+            writer.WriteTyped(attr.location);
+            writer.WriteTyped(attr.systemValue);
+        }
+    }
+    writer.End();
+
+    writer.WriteSegment(ShaderCacheIdent_WorkGroupSize, &(reflection.compute.workGroupSize), sizeof(Extent3D));
+
+    return writer.Finalize();
+}
+
+bool ShaderCache::DeserializeShaderReflection(const void* data, std::size_t size, ShaderReflection& reflection)
+{
+    try
+    {
+        Serialization::Deserializer reader{ data, size };
+
+        reader.Begin(ShaderCacheIdent_Resources);
+        {
+            ReadSerializedCount(reader, reflection.resources);
+            for (auto& resource : reflection.resources)
+            {
+                std::int64_t bindFlags = 0, stageFlags = 0;
+                resource.binding.name = reader.ReadCString();
+                reader.ReadTyped(resource.binding.type);
+                reader.ReadTyped(bindFlags);
+                reader.ReadTyped(stageFlags);
+                reader.ReadTyped(resource.binding.slot);
+                reader.ReadTyped(resource.binding.arraySize);
+                reader.ReadTyped(resource.constantBufferSize);
+                reader.ReadTyped(resource.storageBufferType);
+                resource.binding.bindFlags  = static_cast<long>(bindFlags);
+                resource.binding.stageFlags = static_cast<long>(stageFlags);
+            }
+        }
+        reader.End();
+
+        reader.Begin(ShaderCacheIdent_Uniforms);
+        {
+            ReadSerializedCount(reader, reflection.uniforms);
+            for (auto& uniform : reflection.uniforms)
+            {
+                uniform.name = reader.ReadCString();
+                reader.ReadTyped(uniform.type);
+                reader.ReadTyped(uniform.location);
+                reader.ReadTyped(uniform.size);
+            }
+        }
+        reader.End();
+
+        ReadSerializedVertexAttributes(reader, ShaderCacheIdent_VertexInputs, reflection.vertex.inputAttribs);
+        ReadSerializedVertexAttributes(reader, ShaderCacheIdent_VertexOutputs, reflection.vertex.outputAttribs);
+
+        reader.Begin(ShaderCacheIdent_FragmentOutputs);
+        {
+            ReadSerializedCount(reader, reflection.fragment.outputAttribs);
+            for (auto& attr : reflection.fragment.outputAttribs)
+            {
+                attr.name = reader.ReadCString();
+                reader.ReadTyped(attr.format);
+                reader.ReadTyped(attr.location);
+                reader.ReadTyped(attr.systemValue);
+            }
+        }
+        reader.End();
+
+        reader.ReadSegment(ShaderCacheIdent_WorkGroupSize, &(reflection.compute.workGroupSize), sizeof(Extent3D));
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+    return true;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+std::string ShaderCache::GetEntryFilename(Key key) const
+{
+    char name[17];
+    std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(key));
+    return path_ + name + ".bin";
+}
+
+std::string ShaderCache::GetIndexFilename() const
+{
+    return path_ + "index.bin";
+}
+
+void ShaderCache::ReadIndex()
+{
+    std::ifstream file{ GetIndexFilename(), std::ios::in | std::ios::binary };
+    if (!file.good())
+        return;
+
+    /* Read and validate index header */
+    ShaderCacheIndexHeader header = {};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file.good() || header.magic != g_shaderCacheIndexMagic || header.version != g_shaderCacheVersion)
+        return;
+
+    /* Read all index entries; the index is discarded entirely if it is incomplete */
+    std::vector<ShaderCacheIndexEntry> indexEntries(static_cast<std::size_t>(header.numEntries));
+    file.read(reinterpret_cast<char*>(indexEntries.data()), static_cast<std::streamsize>(indexEntries.size() * sizeof(ShaderCacheIndexEntry)));
+    if (!file.good())
+        return;
+
+    for (const auto& indexEntry : indexEntries)
+    {
+        auto& entry = entries_[indexEntry.key];
+        {
+            entry.size      = indexEntry.size;
+            entry.lastUse   = indexEntry.lastUse;
+        }
+        stats_.totalSize += indexEntry.size;
+        useCounter_ = std::max(useCounter_, indexEntry.lastUse);
+    }
+
+    /* Evict entries in case the maximum size has been decreased */
+    EvictEntries();
+}
+
+void ShaderCache::WriteIndex()
+{
+    ShaderCacheIndexHeader header;
+    {
+        header.magic        = g_shaderCacheIndexMagic;
+        header.version      = g_shaderCacheVersion;
+        header.numEntries   = entries_.size();
+    }
+
+    std::vector<ShaderCacheIndexEntry> indexEntries;
+    indexEntries.reserve(entries_.size());
+
+    for (const auto& it : entries_)
+        indexEntries.push_back({ it.first, it.second.size, it.second.lastUse });
+
+    const bool succeeded = WriteFileAtomic(
+        GetIndexFilename(),
+        &header,
+        sizeof(header),
+        indexEntries.data(),
+        indexEntries.size() * sizeof(ShaderCacheIndexEntry)
+    );
+
+    if (succeeded)
+    {
+        indexDirty_         = false;
+        numUnsavedStores_   = 0;
+    }
+}
+
+void ShaderCache::RemoveEntry(Key key)
+{
+    auto it = entries_.find(key);
+    if (it != entries_.end())
+    {
+        std::remove(GetEntryFilename(key).c_str());
+        stats_.totalSize -= std::min(stats_.totalSize, it->second.size);
+        entries_.erase(it);
+        indexDirty_ = true;
+    }
+}
+
+void ShaderCache::EvictEntries()
+{
+    while (stats_.totalSize > maxSize_ && !entries_.empty())
+    {
+        /* Find least recently used entry */
+        auto lruEntry = entries_.begin();
+        for (auto it = entries_.begin(); it != entries_.end(); ++it)
+        {
+            if (it->second.lastUse < lruEntry->second.lastUse)
+                lruEntry = it;
+        }
+
+        RemoveEntry(lruEntry->first);
+        ++stats_.numEvictions;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
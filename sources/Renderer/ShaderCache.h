@@ -0,0 +1,125 @@
+/*
+ * ShaderCache.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_SHADER_CACHE_H
+#define LLGL_SHADER_CACHE_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/Blob.h>
+#include <LLGL/RendererConfiguration.h>
+#include <LLGL/RenderSystemFlags.h>
+#include <LLGL/ShaderFlags.h>
+#include <LLGL/ShaderProgramFlags.h>
+#include <cstdint>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <map>
+
+
+namespace LLGL
+{
+
+
+/*
+Persistent, content-addressed shader cache that is shared by all shaders of a render system.
+Each entry is stored in its own file within the cache directory and is validated with a checksum when it is loaded.
+Entries are written to a temporary file first and then renamed, so an interrupted write never leaves a corrupted entry behind.
+The least recently used entries are evicted once the total size of all entries exceeds the maximum size.
+The index of all entries is only written in batches and on destruction; entries that are missing in the index are ignored.
+*/
+class LLGL_EXPORT ShaderCache
+{
+
+    public:
+
+        // Cache key type; see HashShaderDescriptor and CombineKeys.
+        using Key = std::uint64_t;
+
+        // Statistics of the cache operations since the cache has been created.
+        using Statistics = ShaderCacheStatistics;
+
+    public:
+
+        ShaderCache(const ShaderCacheDescriptor& desc);
+        ~ShaderCache();
+
+        ShaderCache(const ShaderCache&) = delete;
+        ShaderCache& operator = (const ShaderCache&) = delete;
+
+        // Returns the data of the specified cache entry, or null if there is no such entry or the entry is corrupted.
+        std::unique_ptr<Blob> Load(Key key);
+
+        // Stores the specified data as cache entry and evicts the least recently used entries if the maximum size is exceeded.
+        bool Store(Key key, const void* data, std::size_t size);
+
+        // Returns the statistics of this cache.
+        Statistics GetStatistics() const;
+
+    public:
+
+        /*
+        Returns the cache key for the specified shader descriptor.
+        This includes the shader type, source (or the content of the source file), entry point, profile, macros, compile flags, and all shader attributes.
+        */
+        static Key HashShaderDescriptor(const ShaderDescriptor& desc);
+
+        // Returns the cache key for the specified string, e.g. to distinguish the entries of different drivers.
+        static Key HashString(const char* str);
+
+        // Returns a new cache key that combines the two specified keys in an order dependent manner.
+        static Key CombineKeys(Key lhs, Key rhs);
+
+        // Serializes the specified shader reflection into a blob.
+        static std::unique_ptr<Blob> SerializeShaderReflection(const ShaderReflection& reflection);
+
+        // Deserializes the specified blob into the output shader reflection and returns true on success.
+        static bool DeserializeShaderReflection(const void* data, std::size_t size, ShaderReflection& reflection);
+
+    private:
+
+        struct Entry
+        {
+            std::uint64_t size      = 0;
+            std::uint64_t lastUse   = 0;
+        };
+
+    private:
+
+        std::string GetEntryFilename(Key key) const;
+        std::string GetIndexFilename() const;
+
+        void ReadIndex();
+        void WriteIndex();
+
+        void RemoveEntry(Key key);
+        void EvictEntries();
+
+    private:
+
+        std::string             path_;
+        std::uint64_t           maxSize_            = 0;
+
+        mutable std::mutex      mutex_;
+        std::map<Key, Entry>    entries_;
+        std::uint64_t           useCounter_         = 0;
+        bool                    indexDirty_         = false;
+        std::uint32_t           numUnsavedStores_   = 0;
+        Statistics              stats_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,674 @@
+/*
+ * TextureContainer.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/TextureContainer.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/Texture.h>
+#include <LLGL/Blob.h>
+#include <LLGL/Format.h>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <limits>
+
+
+namespace LLGL
+{
+
+
+/*
+ * DDS container
+ */
+
+// "DDS " identifier
+static const std::uint32_t g_ddsMagic               = 0x20534444;
+
+static const std::uint32_t g_ddsFlagMipMapCount     = 0x00020000; // DDSD_MIPMAPCOUNT
+static const std::uint32_t g_ddsFlagDepth           = 0x00800000; // DDSD_DEPTH
+static const std::uint32_t g_ddsPixelFourCC         = 0x00000004; // DDPF_FOURCC
+static const std::uint32_t g_ddsPixelRGB            = 0x00000040; // DDPF_RGB
+static const std::uint32_t g_ddsPixelLuminance      = 0x00020000; // DDPF_LUMINANCE
+static const std::uint32_t g_ddsCaps2CubeMap        = 0x00000200; // DDSCAPS2_CUBEMAP
+static const std::uint32_t g_ddsCaps2CubeMapFaces   = 0x0000FC00; // DDSCAPS2_CUBEMAP_POSITIVEX ... DDSCAPS2_CUBEMAP_NEGATIVEZ
+static const std::uint32_t g_ddsCaps2Volume         = 0x00200000; // DDSCAPS2_VOLUME
+static const std::uint32_t g_ddsDX10MiscCube        = 0x00000004; // D3D11_RESOURCE_MISC_TEXTURECUBE
+
+struct DDSPixelFormat
+{
+    std::uint32_t size;
+    std::uint32_t flags;
+    std::uint32_t fourCC;
+    std::uint32_t rgbBitCount;
+    std::uint32_t rBitMask;
+    std::uint32_t gBitMask;
+    std::uint32_t bBitMask;
+    std::uint32_t aBitMask;
+};
+
+struct DDSHeader
+{
+    std::uint32_t   size;
+    std::uint32_t   flags;
+    std::uint32_t   height;
+    std::uint32_t   width;
+    std::uint32_t   pitchOrLinearSize;
+    std::uint32_t   depth;
+    std::uint32_t   mipMapCount;
+    std::uint32_t   reserved1[11];
+    DDSPixelFormat  pixelFormat;
+    std::uint32_t   caps;
+    std::uint32_t   caps2;
+    std::uint32_t   caps3;
+    std::uint32_t   caps4;
+    std::uint32_t   reserved2;
+};
+
+struct DDSHeaderDX10
+{
+    std::uint32_t dxgiFormat;
+    std::uint32_t resourceDimension;
+    std::uint32_t miscFlag;
+    std::uint32_t arraySize;
+    std::uint32_t miscFlags2;
+};
+
+static_assert(sizeof(DDSHeader) == 124, "DDSHeader must have a size of 124 bytes");
+static_assert(sizeof(DDSHeaderDX10) == 20, "DDSHeaderDX10 must have a size of 20 bytes");
+
+static constexpr std::uint32_t MakeFourCC(char c0, char c1, char c2, char c3)
+{
+    return
+    (
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(c0))      ) |
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(c1)) <<  8) |
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(c2)) << 16) |
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(c3)) << 24)
+    );
+}
+
+// Maps the DXGI_FORMAT of the DX10 header extension to LLGL::Format.
+static Format MapDXGIFormat(std::uint32_t format)
+{
+    switch (format)
+    {
+        case  2: return Format::RGBA32Float;        // DXGI_FORMAT_R32G32B32A32_FLOAT
+        case  3: return Format::RGBA32UInt;         // DXGI_FORMAT_R32G32B32A32_UINT
+        case  4: return Format::RGBA32SInt;         // DXGI_FORMAT_R32G32B32A32_SINT
+        case  6: return Format::RGB32Float;         // DXGI_FORMAT_R32G32B32_FLOAT
+        case  7: return Format::RGB32UInt;          // DXGI_FORMAT_R32G32B32_UINT
+        case  8: return Format::RGB32SInt;          // DXGI_FORMAT_R32G32B32_SINT
+        case 10: return Format::RGBA16Float;        // DXGI_FORMAT_R16G16B16A16_FLOAT
+        case 11: return Format::RGBA16UNorm;        // DXGI_FORMAT_R16G16B16A16_UNORM
+        case 12: return Format::RGBA16UInt;         // DXGI_FORMAT_R16G16B16A16_UINT
+        case 13: return Format::RGBA16SNorm;        // DXGI_FORMAT_R16G16B16A16_SNORM
+        case 14: return Format::RGBA16SInt;         // DXGI_FORMAT_R16G16B16A16_SINT
+        case 16: return Format::RG32Float;          // DXGI_FORMAT_R32G32_FLOAT
+        case 17: return Format::RG32UInt;           // DXGI_FORMAT_R32G32_UINT
+        case 18: return Format::RG32SInt;           // DXGI_FORMAT_R32G32_SINT
+        case 28: return Format::RGBA8UNorm;         // DXGI_FORMAT_R8G8B8A8_UNORM
+        case 29: return Format::RGBA8UNorm_sRGB;    // DXGI_FORMAT_R8G8B8A8_UNORM_SRGB
+        case 30: return Format::RGBA8UInt;          // DXGI_FORMAT_R8G8B8A8_UINT
+        case 31: return Format::RGBA8SNorm;         // DXGI_FORMAT_R8G8B8A8_SNORM
+        case 32: return Format::RGBA8SInt;          // DXGI_FORMAT_R8G8B8A8_SINT
+        case 34: return Format::RG16Float;          // DXGI_FORMAT_R16G16_FLOAT
+        case 35: return Format::RG16UNorm;          // DXGI_FORMAT_R16G16_UNORM
+        case 36: return Format::RG16UInt;           // DXGI_FORMAT_R16G16_UINT
+        case 37: return Format::RG16SNorm;          // DXGI_FORMAT_R16G16_SNORM
+        case 38: return Format::RG16SInt;           // DXGI_FORMAT_R16G16_SINT
+        case 41: return Format::R32Float;           // DXGI_FORMAT_R32_FLOAT
+        case 42: return Format::R32UInt;            // DXGI_FORMAT_R32_UINT
+        case 43: return Format::R32SInt;            // DXGI_FORMAT_R32_SINT
+        case 49: return Format::RG8UNorm;           // DXGI_FORMAT_R8G8_UNORM
+        case 50: return Format::RG8UInt;            // DXGI_FORMAT_R8G8_UINT
+        case 51: return Format::RG8SNorm;           // DXGI_FORMAT_R8G8_SNORM
+        case 52: return Format::RG8SInt;            // DXGI_FORMAT_R8G8_SINT
+        case 54: return Format::R16Float;           // DXGI_FORMAT_R16_FLOAT
+        case 56: return Format::R16UNorm;           // DXGI_FORMAT_R16_UNORM
+        case 57: return Format::R16UInt;            // DXGI_FORMAT_R16_UINT
+        case 58: return Format::R16SNorm;           // DXGI_FORMAT_R16_SNORM
+        case 59: return Format::R16SInt;            // DXGI_FORMAT_R16_SINT
+        case 61: return Format::R8UNorm;            // DXGI_FORMAT_R8_UNORM
+        case 62: return Format::R8UInt;             // DXGI_FORMAT_R8_UINT
+        case 63: return Format::R8SNorm;            // DXGI_FORMAT_R8_SNORM
+        case 64: return Format::R8SInt;             // DXGI_FORMAT_R8_SINT
+        case 71: return Format::BC1UNorm;           // DXGI_FORMAT_BC1_UNORM
+        case 72: return Format::BC1UNorm_sRGB;      // DXGI_FORMAT_BC1_UNORM_SRGB
+        case 74: return Format::BC2UNorm;           // DXGI_FORMAT_BC2_UNORM
+        case 75: return Format::BC2UNorm_sRGB;      // DXGI_FORMAT_BC2_UNORM_SRGB
+        case 77: return Format::BC3UNorm;           // DXGI_FORMAT_BC3_UNORM
+        case 78: return Format::BC3UNorm_sRGB;      // DXGI_FORMAT_BC3_UNORM_SRGB
+        case 80: return Format::BC4UNorm;           // DXGI_FORMAT_BC4_UNORM
+        case 81: return Format::BC4SNorm;           // DXGI_FORMAT_BC4_SNORM
+        case 83: return Format::BC5UNorm;           // DXGI_FORMAT_BC5_UNORM
+        case 84: return Format::BC5SNorm;           // DXGI_FORMAT_BC5_SNORM
+        case 87: return Format::BGRA8UNorm;         // DXGI_FORMAT_B8G8R8A8_UNORM
+        case 91: return Format::BGRA8UNorm_sRGB;    // DXGI_FORMAT_B8G8R8A8_UNORM_SRGB
+        default: return Format::Undefined;
+    }
+}
+
+// Maps the legacy pixel format of the DDS header to LLGL::Format.
+static Format MapDDSPixelFormat(const DDSPixelFormat& pf)
+{
+    if ((pf.flags & g_ddsPixelFourCC) != 0)
+    {
+        switch (pf.fourCC)
+        {
+            case MakeFourCC('D', 'X', 'T', '1'): return Format::BC1UNorm;
+            case MakeFourCC('D', 'X', 'T', '2'): return Format::BC2UNorm;
+            case MakeFourCC('D', 'X', 'T', '3'): return Format::BC2UNorm;
+            case MakeFourCC('D', 'X', 'T', '4'): return Format::BC3UNorm;
+            case MakeFourCC('D', 'X', 'T', '5'): return Format::BC3UNorm;
+            case MakeFourCC('A', 'T', 'I', '1'): return Format::BC4UNorm;
+            case MakeFourCC('B', 'C', '4', 'U'): return Format::BC4UNorm;
+            case MakeFourCC('B', 'C', '4', 'S'): return Format::BC4SNorm;
+            case MakeFourCC('A', 'T', 'I', '2'): return Format::BC5UNorm;
+            case MakeFourCC('B', 'C', '5', 'U'): return Format::BC5UNorm;
+            case MakeFourCC('B', 'C', '5', 'S'): return Format::BC5SNorm;
+            case  36: return Format::RGBA16UNorm;   // D3DFMT_A16B16G16R16
+            case 110: return Format::RGBA16SNorm;   // D3DFMT_Q16W16V16U16
+            case 111: return Format::R16Float;      // D3DFMT_R16F
+            case 112: return Format::RG16Float;     // D3DFMT_G16R16F
+            case 113: return Format::RGBA16Float;   // D3DFMT_A16B16G16R16F
+            case 114: return Format::R32Float;      // D3DFMT_R32F
+            case 115: return Format::RG32Float;     // D3DFMT_G32R32F
+            case 116: return Format::RGBA32Float;   // D3DFMT_A32B32G32R32F
+            default:  return Format::Undefined;
+        }
+    }
+
+    if ((pf.flags & g_ddsPixelRGB) != 0)
+    {
+        if (pf.rgbBitCount == 32)
+        {
+            if (pf.rBitMask == 0x000000FF && pf.gBitMask == 0x0000FF00 && pf.bBitMask == 0x00FF0000)
+                return Format::RGBA8UNorm;
+            if (pf.rBitMask == 0x00FF0000 && pf.gBitMask == 0x0000FF00 && pf.bBitMask == 0x000000FF)
+                return Format::BGRA8UNorm;
+            if (pf.rBitMask == 0x0000FFFF && pf.gBitMask == 0xFFFF0000)
+                return Format::RG16UNorm;
+        }
+        else if (pf.rgbBitCount == 16 && pf.rBitMask == 0x00FF && pf.gBitMask == 0xFF00)
+            return Format::RG8UNorm;
+    }
+
+    if ((pf.flags & g_ddsPixelLuminance) != 0)
+    {
+        if (pf.rgbBitCount == 8)
+            return Format::R8UNorm;
+        if (pf.rgbBitCount == 16 && pf.rBitMask == 0xFFFF)
+            return Format::R16UNorm;
+    }
+
+    return Format::Undefined;
+}
+
+
+/*
+ * KTX2 container
+ */
+
+static const std::uint8_t g_ktx2Identifier[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+struct KTX2Header
+{
+    std::uint8_t    identifier[12];
+    std::uint32_t   vkFormat;
+    std::uint32_t   typeSize;
+    std::uint32_t   pixelWidth;
+    std::uint32_t   pixelHeight;
+    std::uint32_t   pixelDepth;
+    std::uint32_t   layerCount;
+    std::uint32_t   faceCount;
+    std::uint32_t   levelCount;
+    std::uint32_t   supercompressionScheme;
+    std::uint32_t   dfdByteOffset;
+    std::uint32_t   dfdByteLength;
+    std::uint32_t   kvdByteOffset;
+    std::uint32_t   kvdByteLength;
+    std::uint64_t   sgdByteOffset;
+    std::uint64_t   sgdByteLength;
+};
+
+struct KTX2LevelIndex
+{
+    std::uint64_t byteOffset;
+    std::uint64_t byteLength;
+    std::uint64_t uncompressedByteLength;
+};
+
+static_assert(sizeof(KTX2Header) == 80, "KTX2Header must have a size of 80 bytes");
+static_assert(sizeof(KTX2LevelIndex) == 24, "KTX2LevelIndex must have a size of 24 bytes");
+
+// Maps the VkFormat of the KTX2 header to LLGL::Format.
+static Format MapVkFormat(std::uint32_t format)
+{
+    switch (format)
+    {
+        case   9: return Format::R8UNorm;           // VK_FORMAT_R8_UNORM
+        case  10: return Format::R8SNorm;           // VK_FORMAT_R8_SNORM
+        case  13: return Format::R8UInt;            // VK_FORMAT_R8_UINT
+        case  14: return Format::R8SInt;            // VK_FORMAT_R8_SINT
+        case  16: return Format::RG8UNorm;          // VK_FORMAT_R8G8_UNORM
+        case  17: return Format::RG8SNorm;          // VK_FORMAT_R8G8_SNORM
+        case  20: return Format::RG8UInt;           // VK_FORMAT_R8G8_UINT
+        case  21: return Format::RG8SInt;           // VK_FORMAT_R8G8_SINT
+        case  37: return Format::RGBA8UNorm;        // VK_FORMAT_R8G8B8A8_UNORM
+        case  38: return Format::RGBA8SNorm;        // VK_FORMAT_R8G8B8A8_SNORM
+        case  41: return Format::RGBA8UInt;         // VK_FORMAT_R8G8B8A8_UINT
+        case  42: return Format::RGBA8SInt;         // VK_FORMAT_R8G8B8A8_SINT
+        case  43: return Format::RGBA8UNorm_sRGB;   // VK_FORMAT_R8G8B8A8_SRGB
+        case  44: return Format::BGRA8UNorm;        // VK_FORMAT_B8G8R8A8_UNORM
+        case  50: return Format::BGRA8UNorm_sRGB;   // VK_FORMAT_B8G8R8A8_SRGB
+        case  70: return Format::R16UNorm;          // VK_FORMAT_R16_UNORM
+        case  71: return Format::R16SNorm;          // VK_FORMAT_R16_SNORM
+        case  74: return Format::R16UInt;           // VK_FORMAT_R16_UINT
+        case  75: return Format::R16SInt;           // VK_FORMAT_R16_SINT
+        case  76: return Format::R16Float;          // VK_FORMAT_R16_SFLOAT
+        case  77: return Format::RG16UNorm;         // VK_FORMAT_R16G16_UNORM
+        case  78: return Format::RG16SNorm;         // VK_FORMAT_R16G16_SNORM
+        case  81: return Format::RG16UInt;          // VK_FORMAT_R16G16_UINT
+        case  82: return Format::RG16SInt;          // VK_FORMAT_R16G16_SINT
+        case  83: return Format::RG16Float;         // VK_FORMAT_R16G16_SFLOAT
+        case  91: return Format::RGBA16UNorm;       // VK_FORMAT_R16G16B16A16_UNORM
+        case  92: return Format::RGBA16SNorm;       // VK_FORMAT_R16G16B16A16_SNORM
+        case  95: return Format::RGBA16UInt;        // VK_FORMAT_R16G16B16A16_UINT
+        case  96: return Format::RGBA16SInt;        // VK_FORMAT_R16G16B16A16_SINT
+        case  97: return Format::RGBA16Float;       // VK_FORMAT_R16G16B16A16_SFLOAT
+        case  98: return Format::R32UInt;           // VK_FORMAT_R32_UINT
+        case  99: return Format::R32SInt;           // VK_FORMAT_R32_SINT
+        case 100: return Format::R32Float;          // VK_FORMAT_R32_SFLOAT
+        case 101: return Format::RG32UInt;          // VK_FORMAT_R32G32_UINT
+        case 102: return Format::RG32SInt;          // VK_FORMAT_R32G32_SINT
+        case 103: return Format::RG32Float;         // VK_FORMAT_R32G32_SFLOAT
+        case 104: return Format::RGB32UInt;         // VK_FORMAT_R32G32B32_UINT
+        case 105: return Format::RGB32SInt;         // VK_FORMAT_R32G32B32_SINT
+        case 106: return Format::RGB32Float;        // VK_FORMAT_R32G32B32_SFLOAT
+        case 107: return Format::RGBA32UInt;        // VK_FORMAT_R32G32B32A32_UINT
+        case 108: return Format::RGBA32SInt;        // VK_FORMAT_R32G32B32A32_SINT
+        case 109: return Format::RGBA32Float;       // VK_FORMAT_R32G32B32A32_SFLOAT
+        case 131: return Format::BC1UNorm;          // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+        case 132: return Format::BC1UNorm_sRGB;     // VK_FORMAT_BC1_RGB_SRGB_BLOCK
+        case 133: return Format::BC1UNorm;          // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+        case 134: return Format::BC1UNorm_sRGB;     // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+        case 135: return Format::BC2UNorm;          // VK_FORMAT_BC2_UNORM_BLOCK
+        case 136: return Format::BC2UNorm_sRGB;     // VK_FORMAT_BC2_SRGB_BLOCK
+        case 137: return Format::BC3UNorm;          // VK_FORMAT_BC3_UNORM_BLOCK
+        case 138: return Format::BC3UNorm_sRGB;     // VK_FORMAT_BC3_SRGB_BLOCK
+        case 139: return Format::BC4UNorm;          // VK_FORMAT_BC4_UNORM_BLOCK
+        case 140: return Format::BC4SNorm;          // VK_FORMAT_BC4_SNORM_BLOCK
+        case 141: return Format::BC5UNorm;          // VK_FORMAT_BC5_UNORM_BLOCK
+        case 142: return Format::BC5SNorm;          // VK_FORMAT_BC5_SNORM_BLOCK
+        default:  return Format::Undefined;
+    }
+}
+
+
+/*
+ * Container layout
+ */
+
+// Layout of the images within a texture container.
+struct TextureContainerLayout
+{
+    TextureDescriptor       desc;
+    std::uint32_t           numLayers       = 1;        // Number of array layers including cube faces
+    std::size_t             dataOffset      = 0;        // DDS: offset to the first image; images are stored layer by layer and each layer stores all its MIP-map levels
+    const KTX2LevelIndex*   levelIndices    = nullptr;  // KTX2: level index for each MIP-map level; each level stores all its array layers and faces
+};
+
+// Returns the product of the two values, or throws an exception if it overflows, since all sizes in a container are untrusted.
+template <typename T>
+static T MultiplyContainerSize(T lhs, T rhs, const char* containerName)
+{
+    if (lhs != 0 && rhs > std::numeric_limits<T>::max() / lhs)
+        throw std::runtime_error("invalid " + std::string(containerName) + " container: image size overflow");
+    return lhs * rhs;
+}
+
+// Copies the header at the specified offset, or throws an exception if the container is too small.
+template <typename T>
+static void ReadContainerHeader(const Blob& blob, std::size_t offset, T& header, const char* containerName)
+{
+    if (blob.GetSize() < offset + sizeof(T))
+        throw std::runtime_error("texture container is truncated: failed to read " + std::string(containerName) + " header");
+    ::memcpy(&header, static_cast<const std::int8_t*>(blob.GetData()) + offset, sizeof(T));
+}
+
+static void AssertFormatMapped(Format format, const char* containerName, std::uint32_t containerFormat)
+{
+    if (format == Format::Undefined)
+        throw std::runtime_error("unsupported pixel format in " + std::string(containerName) + " container: " + std::to_string(containerFormat));
+
+    /* Packed formats have no CPU data type that can be passed to RenderSystem::WriteTexture */
+    const auto& formatAttribs = GetFormatAttribs(format);
+    if ((formatAttribs.flags & FormatFlags::IsPacked) != 0)
+        throw std::runtime_error("unsupported packed pixel format in " + std::string(containerName) + " container: " + std::to_string(containerFormat));
+}
+
+static void ReadDDSLayout(const Blob& blob, TextureContainerLayout& layout)
+{
+    DDSHeader header;
+    ReadContainerHeader(blob, sizeof(std::uint32_t), header, "DDS");
+
+    if (header.size != sizeof(DDSHeader) || header.width == 0)
+        throw std::runtime_error("invalid DDS header");
+
+    auto& desc = layout.desc;
+
+    desc.extent.width   = header.width;
+    desc.extent.height  = std::max(1u, header.height);
+    desc.extent.depth   = 1;
+    desc.mipLevels      = ((header.flags & g_ddsFlagMipMapCount) != 0 ? std::max(1u, header.mipMapCount) : 1u);
+    layout.dataOffset   = sizeof(std::uint32_t) + sizeof(DDSHeader);
+
+    if ((header.pixelFormat.flags & g_ddsPixelFourCC) != 0 && header.pixelFormat.fourCC == MakeFourCC('D', 'X', '1', '0'))
+    {
+        /* Read DX10 header extension */
+        DDSHeaderDX10 headerDX10;
+        ReadContainerHeader(blob, layout.dataOffset, headerDX10, "DDS DX10");
+        layout.dataOffset += sizeof(DDSHeaderDX10);
+
+        desc.format = MapDXGIFormat(headerDX10.dxgiFormat);
+        AssertFormatMapped(desc.format, "DDS", headerDX10.dxgiFormat);
+
+        const auto arraySize = std::max(1u, headerDX10.arraySize);
+
+        switch (headerDX10.resourceDimension)
+        {
+            case 2: // D3D11_RESOURCE_DIMENSION_TEXTURE1D
+                desc.type           = (arraySize > 1 ? TextureType::Texture1DArray : TextureType::Texture1D);
+                desc.extent.height  = 1;
+                layout.numLayers    = arraySize;
+                break;
+
+            case 3: // D3D11_RESOURCE_DIMENSION_TEXTURE2D
+                if ((headerDX10.miscFlag & g_ddsDX10MiscCube) != 0)
+                {
+                    desc.type           = (arraySize > 1 ? TextureType::TextureCubeArray : TextureType::TextureCube);
+                    layout.numLayers    = MultiplyContainerSize(arraySize, 6u, "DDS");
+                }
+                else
+                {
+                    desc.type           = (arraySize > 1 ? TextureType::Texture2DArray : TextureType::Texture2D);
+                    layout.numLayers    = arraySize;
+                }
+                break;
+
+            case 4: // D3D11_RESOURCE_DIMENSION_TEXTURE3D
+                desc.type           = TextureType::Texture3D;
+                desc.extent.depth   = std::max(1u, header.depth);
+                break;
+
+            default:
+                throw std::runtime_error("invalid resource dimension in DDS DX10 header: " + std::to_string(headerDX10.resourceDimension));
+        }
+    }
+    else
+    {
+        /* Read legacy pixel format */
+        desc.format = MapDDSPixelFormat(header.pixelFormat);
+        AssertFormatMapped(desc.format, "DDS", header.pixelFormat.fourCC);
+
+        if ((header.caps2 & g_ddsCaps2CubeMap) != 0)
+        {
+            if ((header.caps2 & g_ddsCaps2CubeMapFaces) != g_ddsCaps2CubeMapFaces)
+                throw std::runtime_error("DDS cube maps with missing faces are not supported");
+            desc.type           = TextureType::TextureCube;
+            layout.numLayers    = 6;
+        }
+        else if ((header.caps2 & g_ddsCaps2Volume) != 0 && (header.flags & g_ddsFlagDepth) != 0)
+        {
+            desc.type           = TextureType::Texture3D;
+            desc.extent.depth   = std::max(1u, header.depth);
+        }
+        else
+            desc.type = TextureType::Texture2D;
+    }
+
+    if (desc.mipLevels > NumMipLevels(desc.type, desc.extent))
+        throw std::runtime_error("invalid DDS header: too many MIP-map levels (" + std::to_string(desc.mipLevels) + ")");
+}
+
+static void ReadKTX2Layout(const Blob& blob, TextureContainerLayout& layout)
+{
+    KTX2Header header;
+    ReadContainerHeader(blob, 0, header, "KTX2");
+
+    if (header.supercompressionScheme != 0)
+        throw std::runtime_error("supercompressed KTX2 containers are not supported (scheme " + std::to_string(header.supercompressionScheme) + ")");
+    if (header.pixelWidth == 0)
+        throw std::runtime_error("invalid KTX2 header: pixel width must not be zero");
+    if (header.faceCount != 1 && header.faceCount != 6)
+        throw std::runtime_error("invalid KTX2 header: face count must be 1 or 6, but got " + std::to_string(header.faceCount));
+
+    auto& desc = layout.desc;
+
+    desc.format = MapVkFormat(header.vkFormat);
+    AssertFormatMapped(desc.format, "KTX2", header.vkFormat);
+
+    /* A level count of zero requests MIP-map generation, so only the base level is stored */
+    const auto numLevels = std::max(1u, header.levelCount);
+    const auto arraySize = std::max(1u, header.layerCount);
+
+    desc.extent.width   = header.pixelWidth;
+    desc.extent.height  = std::max(1u, header.pixelHeight);
+    desc.extent.depth   = 1;
+    desc.mipLevels      = numLevels;
+    layout.numLayers    = MultiplyContainerSize(arraySize, header.faceCount, "KTX2");
+
+    if (header.pixelDepth > 0)
+    {
+        desc.type           = TextureType::Texture3D;
+        desc.extent.depth   = header.pixelDepth;
+        layout.numLayers    = 1;
+    }
+    else if (header.faceCount == 6)
+        desc.type = (header.layerCount > 0 ? TextureType::TextureCubeArray : TextureType::TextureCube);
+    else if (header.pixelHeight == 0)
+        desc.type = (header.layerCount > 0 ? TextureType::Texture1DArray : TextureType::Texture1D);
+    else
+        desc.type = (header.layerCount > 0 ? TextureType::Texture2DArray : TextureType::Texture2D);
+
+    if (desc.mipLevels > NumMipLevels(desc.type, desc.extent))
+        throw std::runtime_error("invalid KTX2 header: too many MIP-map levels (" + std::to_string(desc.mipLevels) + ")");
+
+    /* Level index follows the header directly; the header has already been read, so the subtraction cannot underflow */
+    if ((blob.GetSize() - sizeof(KTX2Header)) / sizeof(KTX2LevelIndex) < numLevels)
+        throw std::runtime_error("texture container is truncated: failed to read KTX2 level index");
+
+    layout.levelIndices = reinterpret_cast<const KTX2LevelIndex*>(static_cast<const std::int8_t*>(blob.GetData()) + sizeof(KTX2Header));
+}
+
+static TextureContainerLayout ReadTextureContainerLayout(const Blob& blob)
+{
+    TextureContainerLayout layout;
+
+    switch (GetTextureContainerFormat(blob))
+    {
+        case TextureContainerFormat::DDS:
+            ReadDDSLayout(blob, layout);
+            break;
+        case TextureContainerFormat::KTX2:
+            ReadKTX2Layout(blob, layout);
+            break;
+        default:
+            throw std::runtime_error("unknown texture container format");
+    }
+
+    layout.desc.arrayLayers = (IsArrayTexture(layout.desc.type) || IsCubeTexture(layout.desc.type) ? layout.numLayers : 1);
+
+    return layout;
+}
+
+
+/*
+ * Image upload
+ */
+
+// Returns the extent of a single array layer for the specified MIP-map level.
+static Extent3D GetLayerMipExtent(const TextureDescriptor& desc, std::uint32_t mipLevel)
+{
+    return Extent3D
+    {
+        std::max(1u, desc.extent.width  >> mipLevel),
+        std::max(1u, desc.extent.height >> mipLevel),
+        std::max(1u, desc.extent.depth  >> mipLevel)
+    };
+}
+
+// Returns the size (in bytes) of a tightly packed image with the specified format and extent.
+static std::size_t GetImageDataSize(const FormatAttributes& formatAttribs, const Extent3D& extent, const char* containerName)
+{
+    const std::size_t numBlocksX = (static_cast<std::size_t>(extent.width)  + formatAttribs.blockWidth  - 1) / formatAttribs.blockWidth;
+    const std::size_t numBlocksY = (static_cast<std::size_t>(extent.height) + formatAttribs.blockHeight - 1) / formatAttribs.blockHeight;
+    const std::size_t numBlocks  = MultiplyContainerSize(MultiplyContainerSize(numBlocksX, numBlocksY, containerName), static_cast<std::size_t>(extent.depth), containerName);
+    return (MultiplyContainerSize(numBlocks, static_cast<std::size_t>(formatAttribs.bitSize), containerName) / 8);
+}
+
+static void WriteContainerImage(
+    RenderSystem&           renderSystem,
+    Texture&                texture,
+    const FormatAttributes& formatAttribs,
+    std::uint32_t           arrayLayer,
+    std::uint32_t           mipLevel,
+    const Extent3D&         extent,
+    const void*             data,
+    std::size_t             dataSize)
+{
+    TextureRegion region;
+    {
+        region.subresource.baseArrayLayer   = arrayLayer;
+        region.subresource.numArrayLayers   = 1;
+        region.subresource.baseMipLevel     = mipLevel;
+        region.subresource.numMipLevels     = 1;
+        region.extent                       = extent;
+    }
+    SrcImageDescriptor imageDesc{ formatAttribs.format, formatAttribs.dataType, data, dataSize };
+    renderSystem.WriteTexture(texture, region, imageDesc);
+}
+
+static void WriteDDSImages(RenderSystem& renderSystem, Texture& texture, const Blob& blob, const TextureContainerLayout& layout)
+{
+    const auto& formatAttribs = GetFormatAttribs(layout.desc.format);
+    const auto  data        = static_cast<const std::int8_t*>(blob.GetData());
+    auto        offset      = layout.dataOffset;
+
+    for (std::uint32_t arrayLayer = 0; arrayLayer < layout.numLayers; ++arrayLayer)
+    {
+        for (std::uint32_t mipLevel = 0; mipLevel < layout.desc.mipLevels; ++mipLevel)
+        {
+            const auto extent   = GetLayerMipExtent(layout.desc, mipLevel);
+            const auto size     = GetImageDataSize(formatAttribs, extent, "DDS");
+
+            /* Offset never exceeds the blob size, since it only advances by validated image sizes */
+            if (size > blob.GetSize() - offset)
+                throw std::runtime_error("texture container is truncated: failed to read DDS image data");
+
+            WriteContainerImage(renderSystem, texture, formatAttribs, arrayLayer, mipLevel, extent, data + offset, size);
+            offset += size;
+        }
+    }
+}
+
+static void WriteKTX2Images(RenderSystem& renderSystem, Texture& texture, const Blob& blob, const TextureContainerLayout& layout)
+{
+    const auto& formatAttribs = GetFormatAttribs(layout.desc.format);
+    const auto  data        = static_cast<const std::int8_t*>(blob.GetData());
+
+    for (std::uint32_t mipLevel = 0; mipLevel < layout.desc.mipLevels; ++mipLevel)
+    {
+        const auto extent       = GetLayerMipExtent(layout.desc, mipLevel);
+        const auto size         = GetImageDataSize(formatAttribs, extent, "KTX2");
+        const auto levelSize    = MultiplyContainerSize(static_cast<std::uint64_t>(size), static_cast<std::uint64_t>(layout.numLayers), "KTX2");
+
+        /* Copy level index, since it is not guaranteed to be aligned */
+        KTX2LevelIndex levelIndex;
+        ::memcpy(&levelIndex, &(layout.levelIndices[mipLevel]), sizeof(levelIndex));
+
+        const auto blobSize = static_cast<std::uint64_t>(blob.GetSize());
+        if (levelIndex.byteLength < levelSize || levelIndex.byteOffset > blobSize || levelIndex.byteLength > blobSize - levelIndex.byteOffset)
+            throw std::runtime_error("texture container is truncated: failed to read KTX2 image data for MIP-map level " + std::to_string(mipLevel));
+
+        auto offset = static_cast<std::size_t>(levelIndex.byteOffset);
+        for (std::uint32_t arrayLayer = 0; arrayLayer < layout.numLayers; ++arrayLayer)
+        {
+            WriteContainerImage(renderSystem, texture, formatAttribs, arrayLayer, mipLevel, extent, data + offset, size);
+            offset += size;
+        }
+    }
+}
+
+
+/*
+ * Global functions
+ */
+
+LLGL_EXPORT TextureContainerFormat GetTextureContainerFormat(const Blob& blob)
+{
+    const auto data = static_cast<const std::uint8_t*>(blob.GetData());
+    const auto size = blob.GetSize();
+
+    if (size >= sizeof(g_ktx2Identifier) && ::memcmp(data, g_ktx2Identifier, sizeof(g_ktx2Identifier)) == 0)
+        return TextureContainerFormat::KTX2;
+
+    std::uint32_t magic = 0;
+    if (size >= sizeof(magic))
+    {
+        ::memcpy(&magic, data, sizeof(magic));
+        if (magic == g_ddsMagic)
+            return TextureContainerFormat::DDS;
+    }
+
+    return TextureContainerFormat::Unknown;
+}
+
+LLGL_EXPORT TextureDescriptor GetTextureContainerDesc(const Blob& blob, long bindFlags, long miscFlags)
+{
+    auto desc = ReadTextureContainerLayout(blob).desc;
+    {
+        desc.bindFlags = bindFlags;
+        desc.miscFlags = miscFlags;
+    }
+    return desc;
+}
+
+LLGL_EXPORT Texture* CreateTextureFromContainer(RenderSystem& renderSystem, const Blob& blob, long bindFlags, long miscFlags)
+{
+    auto layout = ReadTextureContainerLayout(blob);
+    {
+        layout.desc.bindFlags = bindFlags;
+        layout.desc.miscFlags = miscFlags;
+    }
+
+    /* Create texture without initial data and write each image directly from the container */
+    auto texture = renderSystem.CreateTexture(layout.desc);
+
+    try
+    {
+        if (layout.levelIndices != nullptr)
+            WriteKTX2Images(renderSystem, *texture, blob, layout);
+        else
+            WriteDDSImages(renderSystem, *texture, blob, layout);
+    }
+    catch (...)
+    {
+        renderSystem.Release(*texture);
+        throw;
+    }
+
+    return texture;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,603 @@
+/*
+ * TextureResidency.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/TextureResidency.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandQueue.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/Texture.h>
+#include <LLGL/ResourceHeap.h>
+#include <LLGL/Log.h>
+#include "TextureUtils.h"
+#include "../Core/Helper.h"
+#include <algorithm>
+#include <stdexcept>
+#include <chrono>
+
+
+namespace LLGL
+{
+
+
+// Returns the size (in bytes) of the specified MIP-map level including all array layers, rounded up to entire blocks for compressed formats.
+static std::uint64_t GetMipLevelSize(const TextureDescriptor& textureDesc, std::uint32_t mipLevel)
+{
+    const auto& formatAttribs   = GetFormatAttribs(textureDesc.format);
+    const auto  extent          = GetMipExtent(textureDesc.type, textureDesc.extent, mipLevel);
+    const auto  numBlocksX      = static_cast<std::uint64_t>((extent.width  + formatAttribs.blockWidth  - 1) / formatAttribs.blockWidth);
+    const auto  numBlocksY      = static_cast<std::uint64_t>((extent.height + formatAttribs.blockHeight - 1) / formatAttribs.blockHeight);
+    const auto  numLayers       = static_cast<std::uint64_t>(extent.depth) * std::max(1u, textureDesc.arrayLayers);
+    return (numBlocksX * numBlocksY * numLayers * formatAttribs.bitSize / 8);
+}
+
+template <typename TEntry>
+static std::uint32_t AllocHandle(std::vector<TEntry>& entries, std::vector<std::uint32_t>& freeHandles)
+{
+    if (!freeHandles.empty())
+    {
+        const auto handle = freeHandles.back();
+        freeHandles.pop_back();
+        return handle;
+    }
+    entries.emplace_back();
+    return static_cast<std::uint32_t>(entries.size() - 1);
+}
+
+TextureResidencyManager::TextureResidencyManager(RenderSystem& renderSystem, const TextureResidencyDescriptor& desc) :
+    renderSystem_ { renderSystem },
+    desc_         { desc         }
+{
+    if (desc.minResidentMipLevels == 0)
+        throw std::invalid_argument("texture residency manager requires at least one resident MIP-map level");
+    if (desc.maxPendingLoads == 0)
+        throw std::invalid_argument("texture residency manager requires at least one pending load");
+    if (desc.numFramesInFlight == 0)
+        throw std::invalid_argument("texture residency manager requires at least one frame in flight");
+
+    commandBuffer_ = renderSystem_.CreateCommandBuffer();
+}
+
+TextureResidencyManager::~TextureResidencyManager()
+{
+    /* Wait for all workers, since they write into the pending loads */
+    for (auto& entry : textures_)
+    {
+        if (entry.pendingLoad)
+            entry.pendingLoad->result.wait();
+    }
+
+    /* Wait until the GPU no longer uses any of the textures and resource heaps, including the ones that are not retired yet */
+    renderSystem_.GetCommandQueue()->WaitIdle();
+
+    ReleaseRetiredObjects(true);
+
+    for (auto& entry : resourceHeaps_)
+    {
+        if (entry.resourceHeap != nullptr)
+            renderSystem_.Release(*entry.resourceHeap);
+    }
+    for (auto& entry : textures_)
+    {
+        if (entry.active)
+            renderSystem_.Release(*entry.texture);
+    }
+
+    renderSystem_.Release(*commandBuffer_);
+}
+
+ResidentTexture TextureResidencyManager::AddTexture(const TextureDescriptor& textureDesc, const TextureMipLoadFunction& loadFunction)
+{
+    if (IsMultiSampleTexture(textureDesc.type))
+        throw std::invalid_argument("cannot manage residency of multi-sampled texture");
+    if (!loadFunction)
+        throw std::invalid_argument("cannot add resident texture without MIP-map load function");
+
+    TextureEntry entry;
+    {
+        entry.textureDesc               = textureDesc;
+        entry.textureDesc.mipLevels     = NumMipLevels(textureDesc);
+        entry.textureDesc.bindFlags     |= (BindFlags::CopySrc | BindFlags::CopyDst);
+        entry.textureDesc.miscFlags     &= ~MiscFlags::GenerateMips;
+        entry.loadFunction              = loadFunction;
+        entry.active                    = true;
+    }
+
+    const auto numMipLevels = entry.textureDesc.mipLevels;
+    entry.mipSizes.resize(numMipLevels);
+    for (std::uint32_t mipLevel = 0; mipLevel < numMipLevels; ++mipLevel)
+        entry.mipSizes[mipLevel] = GetMipLevelSize(entry.textureDesc, mipLevel);
+
+    /* Create texture with the smallest MIP-map levels, which always stay resident */
+    entry.tailLevel     = numMipLevels - std::min(desc_.minResidentMipLevels, numMipLevels);
+    entry.residentLevel = entry.tailLevel;
+    entry.texture       = CreateResidentTexture(entry, entry.residentLevel);
+
+    std::vector<char> imageData;
+    for (auto mipLevel = entry.tailLevel; mipLevel < numMipLevels; ++mipLevel)
+    {
+        imageData.clear();
+        if (!entry.loadFunction(mipLevel, imageData) || imageData.size() < entry.mipSizes[mipLevel])
+        {
+            renderSystem_.Release(*entry.texture);
+            throw std::runtime_error("failed to load MIP-map level " + std::to_string(mipLevel) + " of resident texture");
+        }
+        WriteMipLevel(*entry.texture, entry, mipLevel, entry.residentLevel, imageData);
+    }
+
+    /* Store texture entry */
+    residentMemory_     += GetResidentMemory(entry, entry.residentLevel);
+    requestedMemory_    += GetResidentMemory(entry, 0);
+
+    const auto handle = AllocHandle(textures_, freeTextures_);
+    textureHandles_[entry.texture] = handle;
+    textures_[handle] = std::move(entry);
+
+    return handle;
+}
+
+void TextureResidencyManager::RemoveTexture(ResidentTexture texture)
+{
+    auto& entry = GetTextureEntry(texture);
+
+    /* Handles are reused by AddTexture, so a resource heap must not outlive its textures */
+    for (const auto& heapEntry : resourceHeaps_)
+    {
+        if (std::find(heapEntry.textures.begin(), heapEntry.textures.end(), texture) != heapEntry.textures.end())
+            throw std::invalid_argument("cannot remove resident texture " + std::to_string(texture) + " that is still referred to by a resource heap");
+    }
+
+    if (entry.pendingLoad)
+    {
+        entry.pendingLoad->result.wait();
+        --numPendingLoads_;
+    }
+
+    residentMemory_     -= GetResidentMemory(entry, entry.residentLevel);
+    requestedMemory_    -= GetResidentMemory(entry, 0);
+
+    textureHandles_.erase(entry.texture);
+    Retire(entry.texture, nullptr);
+
+    entry = TextureEntry{};
+    freeTextures_.push_back(texture);
+}
+
+Texture* TextureResidencyManager::GetTexture(ResidentTexture texture) const
+{
+    return GetTextureEntry(texture).texture;
+}
+
+std::uint32_t TextureResidencyManager::GetResidentMipLevel(ResidentTexture texture) const
+{
+    return GetTextureEntry(texture).residentLevel;
+}
+
+void TextureResidencyManager::UseTexture(ResidentTexture texture)
+{
+    GetTextureEntry(texture).lastUse = frame_;
+}
+
+ResidentResourceHeap TextureResidencyManager::CreateResourceHeap(const ResourceHeapDescriptor& desc)
+{
+    ResourceHeapEntry entry;
+    entry.desc = desc;
+
+    /* Find all resource views that refer to managed textures */
+    for (std::size_t i = 0; i < desc.resourceViews.size(); ++i)
+    {
+        const auto& resourceView = desc.resourceViews[i];
+        if (resourceView.resource != nullptr && resourceView.resource->GetResourceType() == ResourceType::Texture)
+        {
+            auto it = textureHandles_.find(static_cast<const Texture*>(resourceView.resource));
+            if (it != textureHandles_.end())
+            {
+                if (IsTextureViewEnabled(resourceView.textureView))
+                    throw std::invalid_argument("cannot refer to resident texture with texture subresource view");
+                entry.textureViews.push_back(static_cast<std::uint32_t>(i));
+                entry.textures.push_back(it->second);
+            }
+        }
+    }
+
+    entry.resourceHeap = renderSystem_.CreateResourceHeap(desc);
+
+    const auto handle = AllocHandle(resourceHeaps_, freeResourceHeaps_);
+    resourceHeaps_[handle] = std::move(entry);
+
+    return handle;
+}
+
+void TextureResidencyManager::ReleaseResourceHeap(ResidentResourceHeap resourceHeap)
+{
+    auto& entry = GetResourceHeapEntry(resourceHeap);
+    Retire(nullptr, entry.resourceHeap);
+    entry = ResourceHeapEntry{};
+    freeResourceHeaps_.push_back(resourceHeap);
+}
+
+ResourceHeap& TextureResidencyManager::UseResourceHeap(ResidentResourceHeap resourceHeap)
+{
+    auto& entry = GetResourceHeapEntry(resourceHeap);
+
+    /* Recreate resource heap with the current textures if any of them has been replaced */
+    if (entry.dirty)
+    {
+        for (std::size_t i = 0; i < entry.textures.size(); ++i)
+            entry.desc.resourceViews[entry.textureViews[i]].resource = GetTextureEntry(entry.textures[i]).texture;
+
+        Retire(nullptr, entry.resourceHeap);
+        entry.resourceHeap  = renderSystem_.CreateResourceHeap(entry.desc);
+        entry.dirty         = false;
+    }
+
+    for (auto texture : entry.textures)
+        GetTextureEntry(texture).lastUse = frame_;
+
+    return *entry.resourceHeap;
+}
+
+void TextureResidencyManager::Update()
+{
+    ++frame_;
+
+    stats_.uploadedBytes    = 0;
+    stats_.numDowngrades    = 0;
+    stats_.numUpgrades      = 0;
+
+    ReleaseRetiredObjects(false);
+
+    const auto budget = DetermineBudget();
+
+    /* Upload finished loads first, so their textures can be downgraded again if the budget has shrunk in the meantime */
+    UploadPendingLoads();
+
+    /* Downgrade unused textures first, and only then any other textures to keep the memory bounded */
+    if (residentMemory_ > budget)
+        DowngradeTextures(budget, desc_.evictionDelay);
+    if (residentMemory_ > budget)
+        DowngradeTextures(budget, 0);
+
+    StartPendingLoads(budget);
+
+    /* Submit copy commands before any replaced texture is used */
+    if (recording_)
+    {
+        commandBuffer_->End();
+        renderSystem_.GetCommandQueue()->Submit(*commandBuffer_);
+        recording_ = false;
+    }
+
+    stats_.budget           = budget;
+    stats_.residentMemory   = residentMemory_;
+    stats_.requestedMemory  = requestedMemory_;
+    stats_.numTextures      = static_cast<std::uint32_t>(textures_.size() - freeTextures_.size());
+    stats_.numPendingLoads  = numPendingLoads_;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+TextureResidencyManager::TextureEntry& TextureResidencyManager::GetTextureEntry(ResidentTexture texture)
+{
+    if (texture >= textures_.size() || !textures_[texture].active)
+        throw std::invalid_argument("invalid resident texture handle: " + std::to_string(texture));
+    return textures_[texture];
+}
+
+const TextureResidencyManager::TextureEntry& TextureResidencyManager::GetTextureEntry(ResidentTexture texture) const
+{
+    if (texture >= textures_.size() || !textures_[texture].active)
+        throw std::invalid_argument("invalid resident texture handle: " + std::to_string(texture));
+    return textures_[texture];
+}
+
+TextureResidencyManager::ResourceHeapEntry& TextureResidencyManager::GetResourceHeapEntry(ResidentResourceHeap resourceHeap)
+{
+    if (resourceHeap >= resourceHeaps_.size() || resourceHeaps_[resourceHeap].resourceHeap == nullptr)
+        throw std::invalid_argument("invalid resident resource heap handle: " + std::to_string(resourceHeap));
+    return resourceHeaps_[resourceHeap];
+}
+
+std::uint64_t TextureResidencyManager::GetResidentMemory(const TextureEntry& entry, std::uint32_t residentLevel) const
+{
+    std::uint64_t size = 0;
+    for (auto mipLevel = residentLevel; mipLevel < entry.mipSizes.size(); ++mipLevel)
+        size += entry.mipSizes[mipLevel];
+    return size;
+}
+
+std::uint64_t TextureResidencyManager::DetermineBudget()
+{
+    if (desc_.budget > 0)
+        return desc_.budget;
+
+    /* Add remaining budget of all device local heaps to the memory of the resident textures */
+    if (renderSystem_.QueryMemoryStatistics(memoryStats_))
+    {
+        std::uint64_t heapBudget = 0, heapUsage = 0;
+        for (const auto& heap : memoryStats_.heaps)
+        {
+            if (heap.deviceLocal && heap.budget > 0)
+            {
+                heapBudget  += heap.budget;
+                heapUsage   += heap.usage;
+            }
+        }
+        if (heapBudget > 0)
+            return (heapBudget > heapUsage ? heapBudget - heapUsage : 0) + residentMemory_;
+    }
+
+    return ~0ull;
+}
+
+Texture* TextureResidencyManager::CreateResidentTexture(const TextureEntry& entry, std::uint32_t residentLevel)
+{
+    TextureDescriptor textureDesc = entry.textureDesc;
+    {
+        textureDesc.extent      = GetMipExtent(textureDesc.type, entry.textureDesc.extent, residentLevel);
+        textureDesc.mipLevels   = entry.textureDesc.mipLevels - residentLevel;
+        textureDesc.miscFlags   |= MiscFlags::NoInitialData;
+    }
+    return renderSystem_.CreateTexture(textureDesc);
+}
+
+void TextureResidencyManager::WriteMipLevel(
+    Texture&                    texture,
+    const TextureEntry&         entry,
+    std::uint32_t               mipLevel,
+    std::uint32_t               residentLevel,
+    const std::vector<char>&    imageData)
+{
+    const auto& formatAttribs = GetFormatAttribs(entry.textureDesc.format);
+
+    TextureRegion region;
+    {
+        region.subresource.baseArrayLayer   = 0;
+        region.subresource.numArrayLayers   = entry.textureDesc.arrayLayers;
+        region.subresource.baseMipLevel     = mipLevel - residentLevel;
+        region.subresource.numMipLevels     = 1;
+        region.extent                       = GetMipExtent(entry.textureDesc.type, entry.textureDesc.extent, mipLevel);
+    }
+    SrcImageDescriptor imageDesc{ formatAttribs.format, formatAttribs.dataType, imageData.data(), imageData.size() };
+    renderSystem_.WriteTexture(texture, region, imageDesc);
+}
+
+void TextureResidencyManager::ReplaceTexture(ResidentTexture texture, std::uint32_t residentLevel)
+{
+    auto& entry = textures_[texture];
+
+    auto oldTexture = entry.texture;
+    auto oldLevel   = entry.residentLevel;
+    auto newTexture = CreateResidentTexture(entry, residentLevel);
+
+    /* Copy all MIP-map levels that are resident in both textures */
+    BeginCopyCommands();
+    for (auto mipLevel = std::max(oldLevel, residentLevel); mipLevel < entry.textureDesc.mipLevels; ++mipLevel)
+    {
+        const auto extent = CalcTextureExtent(
+            entry.textureDesc.type,
+            GetMipExtent(entry.textureDesc.type, entry.textureDesc.extent, mipLevel),
+            entry.textureDesc.arrayLayers
+        );
+        commandBuffer_->CopyTexture(
+            *newTexture, TextureLocation{ Offset3D{}, 0, mipLevel - residentLevel },
+            *oldTexture, TextureLocation{ Offset3D{}, 0, mipLevel - oldLevel },
+            extent
+        );
+    }
+
+    /* Replace texture and keep the old one until it is no longer in flight */
+    residentMemory_ -= GetResidentMemory(entry, oldLevel);
+    residentMemory_ += GetResidentMemory(entry, residentLevel);
+
+    textureHandles_.erase(oldTexture);
+    textureHandles_[newTexture] = texture;
+
+    entry.texture       = newTexture;
+    entry.residentLevel = residentLevel;
+
+    Retire(oldTexture, nullptr);
+
+    /* Invalidate all resource heaps that refer to this texture */
+    for (auto& heapEntry : resourceHeaps_)
+    {
+        if (!heapEntry.dirty && std::find(heapEntry.textures.begin(), heapEntry.textures.end(), texture) != heapEntry.textures.end())
+            heapEntry.dirty = true;
+    }
+}
+
+void TextureResidencyManager::UploadPendingLoads()
+{
+    for (std::size_t i = 0; i < textures_.size(); ++i)
+    {
+        auto& entry = textures_[i];
+        if (!entry.pendingLoad || stats_.uploadedBytes >= desc_.uploadBytesPerFrame)
+            continue;
+
+        auto& pendingLoad = *entry.pendingLoad;
+        if (pendingLoad.result.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            continue;
+
+        bool succeeded = false;
+        try
+        {
+            succeeded = pendingLoad.result.get();
+        }
+        catch (const std::exception& e)
+        {
+            Log::PostReport(Log::ReportType::Error, e.what());
+        }
+
+        const auto mipLevel = pendingLoad.mipLevel;
+        if (!succeeded || pendingLoad.imageData.size() < entry.mipSizes[mipLevel])
+        {
+            /* Keep texture at its current residency and don't try to load it again */
+            Log::PostReport(Log::ReportType::Error, "failed to load MIP-map level " + std::to_string(mipLevel) + " of resident texture");
+            entry.loadFailed = true;
+        }
+        else if (mipLevel + 1 == entry.residentLevel)
+        {
+            /* Upgrade texture by one MIP-map level and upload the new level */
+            ReplaceTexture(static_cast<ResidentTexture>(i), mipLevel);
+            WriteMipLevel(*entry.texture, entry, mipLevel, mipLevel, pendingLoad.imageData);
+            stats_.uploadedBytes += entry.mipSizes[mipLevel];
+            stats_.numUpgrades++;
+        }
+
+        /* Drop loads of textures that have been downgraded in the meantime */
+        entry.pendingLoad.reset();
+        --numPendingLoads_;
+    }
+}
+
+void TextureResidencyManager::DowngradeTextures(std::uint64_t maxResidentMemory, std::uint64_t minUnusedFrames)
+{
+    /* Gather all textures that can be downgraded, ordered from least to most recently used */
+    evictCandidates_.clear();
+    for (std::size_t i = 0; i < textures_.size(); ++i)
+    {
+        const auto& entry = textures_[i];
+        if (entry.active && entry.residentLevel < entry.tailLevel && frame_ - entry.lastUse >= minUnusedFrames)
+            evictCandidates_.push_back(static_cast<ResidentTexture>(i));
+    }
+
+    std::sort(
+        evictCandidates_.begin(), evictCandidates_.end(),
+        [this](ResidentTexture lhs, ResidentTexture rhs)
+        {
+            return (textures_[lhs].lastUse < textures_[rhs].lastUse);
+        }
+    );
+
+    /* Drop as many of the largest MIP-map levels as necessary */
+    for (auto texture : evictCandidates_)
+    {
+        if (residentMemory_ <= maxResidentMemory)
+            break;
+
+        const auto& entry = textures_[texture];
+        auto residentLevel  = entry.residentLevel;
+        auto freedMemory    = std::uint64_t(0);
+
+        while (residentLevel < entry.tailLevel && residentMemory_ - freedMemory > maxResidentMemory)
+            freedMemory += entry.mipSizes[residentLevel++];
+
+        ReplaceTexture(texture, residentLevel);
+        stats_.numDowngrades++;
+    }
+}
+
+void TextureResidencyManager::StartPendingLoads(std::uint64_t budget)
+{
+    /* Gather all textures that have been used since the previous update and are not entirely resident, ordered from most to least recently used */
+    std::uint64_t pendingMemory = 0;
+
+    loadCandidates_.clear();
+    for (std::size_t i = 0; i < textures_.size(); ++i)
+    {
+        const auto& entry = textures_[i];
+        if (entry.pendingLoad)
+            pendingMemory += entry.mipSizes[entry.pendingLoad->mipLevel];
+        else if (entry.active && entry.residentLevel > 0 && !entry.loadFailed && entry.lastUse > 0 && entry.lastUse + 1 >= frame_)
+            loadCandidates_.push_back(static_cast<ResidentTexture>(i));
+    }
+
+    std::sort(
+        loadCandidates_.begin(), loadCandidates_.end(),
+        [this](ResidentTexture lhs, ResidentTexture rhs)
+        {
+            return (textures_[lhs].lastUse > textures_[rhs].lastUse);
+        }
+    );
+
+    for (auto texture : loadCandidates_)
+    {
+        if (numPendingLoads_ >= desc_.maxPendingLoads)
+            break;
+
+        auto& entry = textures_[texture];
+        const auto mipLevel = entry.residentLevel - 1;
+        const auto requiredMemory = residentMemory_ + pendingMemory + entry.mipSizes[mipLevel];
+
+        /* Make room by downgrading textures that have not been used for a while */
+        if (requiredMemory > budget)
+        {
+            const auto minUnusedFrames = std::max<std::uint64_t>(desc_.evictionDelay, 2);
+            const auto reservedMemory  = pendingMemory + entry.mipSizes[mipLevel];
+            if (budget > reservedMemory)
+                DowngradeTextures(budget - reservedMemory, minUnusedFrames);
+            if (residentMemory_ + reservedMemory > budget)
+                break;
+        }
+
+        /* Load next MIP-map level on a worker thread */
+        entry.pendingLoad = MakeUnique<PendingLoad>();
+        auto pendingLoad = entry.pendingLoad.get();
+        {
+            pendingLoad->mipLevel   = mipLevel;
+            pendingLoad->result     = std::async(
+                std::launch::async,
+                [pendingLoad](TextureMipLoadFunction loadFunction)
+                {
+                    return loadFunction(pendingLoad->mipLevel, pendingLoad->imageData);
+                },
+                entry.loadFunction
+            );
+        }
+        pendingMemory += entry.mipSizes[mipLevel];
+        ++numPendingLoads_;
+    }
+}
+
+void TextureResidencyManager::BeginCopyCommands()
+{
+    if (!recording_)
+    {
+        commandBuffer_->Begin();
+        recording_ = true;
+    }
+}
+
+void TextureResidencyManager::Retire(Texture* texture, ResourceHeap* resourceHeap)
+{
+    RetiredObject retiredObject;
+    {
+        retiredObject.texture       = texture;
+        retiredObject.resourceHeap  = resourceHeap;
+        retiredObject.frame         = frame_;
+    }
+    retiredObjects_.push_back(retiredObject);
+}
+
+void TextureResidencyManager::ReleaseRetiredObjects(bool releaseAll)
+{
+    auto it = std::remove_if(
+        retiredObjects_.begin(), retiredObjects_.end(),
+        [this, releaseAll](const RetiredObject& retiredObject) -> bool
+        {
+            if (releaseAll || retiredObject.frame + desc_.numFramesInFlight <= frame_)
+            {
+                if (retiredObject.resourceHeap != nullptr)
+                    renderSystem_.Release(*retiredObject.resourceHeap);
+                if (retiredObject.texture != nullptr)
+                    renderSystem_.Release(*retiredObject.texture);
+                return true;
+            }
+            return false;
+        }
+    );
+    retiredObjects_.erase(it, retiredObjects_.end());
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -181,6 +181,8 @@ bool VKLoadDeviceExtensions(VkDevice device, const std::vector<const char*>& sup
     LOAD_VKEXT( EXT_transform_feedback              );
 
     ENABLE_VKEXT( EXT_conservative_rasterization );
+    ENABLE_VKEXT( EXT_memory_budget              );
+    ENABLE_VKEXT( EXT_descriptor_indexing        );
 
     #undef LOAD_VKEXT
 
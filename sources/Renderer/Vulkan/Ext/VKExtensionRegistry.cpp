@@ -24,6 +24,12 @@ static const char* g_optionalExtensions[] =
     VK_EXT_DEBUG_MARKER_EXTENSION_NAME,
     VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME,
     VK_EXT_CONSERVATIVE_RASTERIZATION_EXTENSION_NAME,
+    #ifdef VK_EXT_memory_budget
+    VK_EXT_MEMORY_BUDGET_EXTENSION_NAME,
+    #endif
+    #ifdef VK_EXT_descriptor_indexing
+    VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME,
+    #endif
     //VK_EXT_TRANSFORM_FEEDBACK_EXTENSION_NAME,
     nullptr,
 };
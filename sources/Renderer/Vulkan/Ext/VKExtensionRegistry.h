@@ -28,6 +28,8 @@ enum class VKExt
     EXT_conditional_rendering,
     EXT_transform_feedback,
     EXT_conservative_rasterization,
+    EXT_memory_budget,
+    EXT_descriptor_indexing,
 
     /* Enumeration entry counter */
     Count,
@@ -124,6 +124,12 @@ void VKDeviceMemory::AccumDetails(VKDeviceMemoryDetails& details) const
     details.numFragments            += fragmentedBlocks_.size();
     details.maxNewBlockSize         = std::max(details.maxNewBlockSize, maxNewBlockSize_);
     details.maxFragmentedBlockSize  = std::max(details.maxFragmentedBlockSize, maxFragmentedBlockSize_);
+    details.allocatedSize           += GetSize();
+
+    for (const auto& block : blocks_)
+        details.usedSize += block->GetSize();
+    for (const auto& block : fragmentedBlocks_)
+        details.fragmentedSize += block->GetSize();
 }
 
 #ifdef LLGL_DEBUG
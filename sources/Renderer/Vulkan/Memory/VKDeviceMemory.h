@@ -33,6 +33,9 @@ struct VKDeviceMemoryDetails
     std::size_t     numFragments            = 0;
     VkDeviceSize    maxNewBlockSize         = 0;
     VkDeviceSize    maxFragmentedBlockSize  = 0;
+    VkDeviceSize    allocatedSize           = 0;
+    VkDeviceSize    usedSize                = 0;
+    VkDeviceSize    fragmentedSize          = 0;
 };
 
 // An instance of this class holds a single VkDeviceMemory allocation chunk.
@@ -37,6 +37,8 @@ VKDeviceMemoryRegion* VKDeviceMemoryManager::Allocate(
     const auto memoryTypeIndex  = FindMemoryType(memoryTypeBits, properties);
     const auto allocationSize   = std::max(minAllocationSize_, alignedSize);
 
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
     if (auto chunk = FindOrAllocChunk(allocationSize, memoryTypeIndex, alignedSize))
         return chunk->Allocate(size, alignment);
     else
@@ -59,6 +61,7 @@ void VKDeviceMemoryManager::Release(VKDeviceMemoryRegion* region)
 {
     if (region)
     {
+        std::lock_guard<std::mutex> guard{ mutex_ };
         if (auto chunk = region->GetParentChunk())
         {
             /* Release block in chunk */
@@ -79,20 +82,42 @@ void VKDeviceMemoryManager::Release(VKDeviceMemoryRegion* region)
     }
 }
 
+bool VKDeviceMemoryManager::HasMemoryType(std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties) const
+{
+    std::uint32_t memoryTypeIndex = 0;
+    return VKFindMemoryType(memoryProperties_, memoryTypeBits, properties, memoryTypeIndex);
+}
+
 VKDeviceMemoryDetails VKDeviceMemoryManager::QueryDetails() const
 {
     VKDeviceMemoryDetails details;
     {
+        std::lock_guard<std::mutex> guard{ mutex_ };
         for (const auto& chunk : chunks_)
             chunk->AccumDetails(details);
     }
     return details;
 }
 
+void VKDeviceMemoryManager::QueryHeapDetails(std::vector<VKDeviceMemoryDetails>& heapDetails) const
+{
+    heapDetails.clear();
+    heapDetails.resize(memoryProperties_.memoryHeapCount);
+
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    for (const auto& chunk : chunks_)
+    {
+        const auto heapIndex = memoryProperties_.memoryTypes[chunk->GetMemoryTypeIndex()].heapIndex;
+        chunk->AccumDetails(heapDetails[heapIndex]);
+    }
+}
+
 #ifdef LLGL_DEBUG
 
 void VKDeviceMemoryManager::PrintBlocks(std::ostream& s, const std::string& title) const
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
     std::size_t i = 0;
     for (const auto& chunk : chunks_)
     {
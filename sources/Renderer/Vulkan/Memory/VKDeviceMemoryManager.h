@@ -16,6 +16,7 @@
 #include "VKDeviceMemoryRegion.h"
 #include <vector>
 #include <memory>
+#include <mutex>
 
 
 namespace LLGL
@@ -23,7 +24,7 @@ namespace LLGL
 
 
 /*
-Vulkan device memory manager. Memory allocations are stored in a small hierarchy:
+Vulkan device memory manager; allocating and releasing memory is thread-safe. Memory allocations are stored in a small hierarchy:
  - Chunk: denotes a single Vulkan memory allocation of type VkDeviceMemory
  - Block: denotes one of multiple regions inside a chunk of type VkBuffer
  - Region: denotes a sub-range inside a block and holds a reference to the VkBuffer and its offset and size (both of type VkDeviceSize).
@@ -60,9 +61,15 @@ class VKDeviceMemoryManager
         // Releases the specified device memory block.
         void Release(VKDeviceMemoryRegion* region);
 
+        // Returns true if there is a memory type for the specified attributes.
+        bool HasMemoryType(std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties) const;
+
         // Queries the memory details of all chunks.
         VKDeviceMemoryDetails QueryDetails() const;
 
+        // Queries the memory details of all chunks for each memory heap. The output container is resized to the number of memory heaps.
+        void QueryHeapDetails(std::vector<VKDeviceMemoryDetails>& heapDetails) const;
+
         #ifdef LLGL_DEBUG
 
         void PrintBlocks(std::ostream& s, const std::string& title = "") const;
@@ -95,6 +102,7 @@ class VKDeviceMemoryManager
         bool                                            reduceFragmentation_    = false;
 
         std::vector<std::unique_ptr<VKDeviceMemory>>    chunks_;
+        mutable std::mutex                              mutex_;
 
 };
 
@@ -0,0 +1,251 @@
+/*
+ * VKDescriptorPoolManager.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "VKDescriptorPoolManager.h"
+#include "../VKDevice.h"
+#include "../VKCore.h"
+#include "../../../Core/Helper.h"
+#include <algorithm>
+#include <limits>
+
+
+namespace LLGL
+{
+
+
+// Initial and maximal number of descriptor sets for new descriptor pools within a bucket
+static const std::uint32_t g_minDescriptorPoolCapacity = 16;
+static const std::uint32_t g_maxDescriptorPoolCapacity = 1024;
+
+VKDescriptorPoolManager::VKDescriptorPoolManager(VKDevice& device) :
+    device_ { device }
+{
+}
+
+VKDescriptorPoolManager::~VKDescriptorPoolManager()
+{
+    /* Wait for all retirement fences, since released descriptor sets might still be used by command buffers in flight */
+    std::vector<VkFence> pendingFences;
+    pendingFences.reserve(retirementQueue_.size());
+    for (const auto& batch : retirementQueue_)
+        pendingFences.push_back(batch.fence);
+
+    if (!pendingFences.empty())
+        vkWaitForFences(device_, static_cast<std::uint32_t>(pendingFences.size()), pendingFences.data(), VK_TRUE, std::numeric_limits<std::uint64_t>::max());
+
+    /* Descriptor sets that have not been released yet might also still be in use, so wait until the device is idle before the pools are destroyed */
+    device_.WaitIdle();
+
+    /* Descriptor sets are implicitly freed with their pools, so only fences must be destroyed */
+    for (auto fence : fences_)
+        vkDestroyFence(device_, fence, nullptr);
+}
+
+VkDescriptorPool VKDescriptorPoolManager::AllocateDescriptorSets(
+    std::uint32_t               numPoolSizes,
+    const VkDescriptorPoolSize* poolSizes,
+    VkDescriptorSetLayout       setLayout,
+    std::uint32_t               numSets,
+    VkDescriptorSet*            outSets)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* Recycle descriptor sets that are no longer in use by the GPU */
+    FreeRetiredDescriptorSets();
+
+    /* Sort pool sizes by descriptor type to build unique bucket key */
+    std::vector<VkDescriptorPoolSize> sortedPoolSizes{ poolSizes, poolSizes + numPoolSizes };
+    std::sort(
+        sortedPoolSizes.begin(),
+        sortedPoolSizes.end(),
+        [](const VkDescriptorPoolSize& lhs, const VkDescriptorPoolSize& rhs)
+        {
+            return (lhs.type < rhs.type);
+        }
+    );
+
+    PoolBucketKey key;
+    key.reserve(sortedPoolSizes.size() * 2);
+    for (const auto& size : sortedPoolSizes)
+    {
+        key.push_back(static_cast<std::uint32_t>(size.type));
+        key.push_back(size.descriptorCount);
+    }
+
+    /* Find pool with enough capacity in the bucket for this descriptor set size */
+    auto pool = FindOrCreatePool(buckets_[key], sortedPoolSizes, numSets);
+
+    /* Allocate descriptor sets from pool */
+    std::vector<VkDescriptorSetLayout> setLayouts(numSets, setLayout);
+
+    VkDescriptorSetAllocateInfo allocInfo;
+    {
+        allocInfo.sType                 = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.pNext                 = nullptr;
+        allocInfo.descriptorPool        = pool->pool;
+        allocInfo.descriptorSetCount    = numSets;
+        allocInfo.pSetLayouts           = setLayouts.data();
+    }
+    auto result = vkAllocateDescriptorSets(device_, &allocInfo, outSets);
+    VKThrowIfFailed(result, "failed to allocate Vulkan descriptor sets");
+
+    pool->numAllocatedSets += numSets;
+
+    return pool->pool.Get();
+}
+
+void VKDescriptorPoolManager::ReleaseDescriptorSets(VkDescriptorPool descriptorPool, std::uint32_t numSets, const VkDescriptorSet* sets)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    auto it = poolMap_.find(descriptorPool);
+    if (it != poolMap_.end() && numSets > 0)
+    {
+        /* Defer release until the next fence has been signaled; it is submitted with the next command queue submission */
+        ReleasedDescriptorSets entry;
+        {
+            entry.pool = it->second;
+            entry.sets = std::vector<VkDescriptorSet>{ sets, sets + numSets };
+        }
+        releasedSets_.emplace_back(std::move(entry));
+    }
+}
+
+void VKDescriptorPoolManager::RetireReleasedDescriptorSets()
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    SubmitRetirementFence();
+    FreeRetiredDescriptorSets();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+VKDescriptorPoolManager::DescriptorPool::DescriptorPool(const VKPtr<VkDevice>& device) :
+    pool { device, vkDestroyDescriptorPool }
+{
+}
+
+void VKDescriptorPoolManager::SubmitRetirementFence()
+{
+    if (releasedSets_.empty())
+        return;
+
+    /* Submit fence right after the command buffer submission, so it is signaled once the last commands that might use these sets are completed */
+    auto fence = AcquireFence();
+    auto result = device_.QueueSubmit(0, nullptr, fence);
+    VKThrowIfFailed(result, "failed to submit Vulkan fence for descriptor set retirement");
+
+    RetirementBatch batch;
+    {
+        batch.fence         = fence;
+        batch.releasedSets  = std::move(releasedSets_);
+    }
+    retirementQueue_.emplace_back(std::move(batch));
+    releasedSets_.clear();
+}
+
+void VKDescriptorPoolManager::FreeRetiredDescriptorSets()
+{
+    /* Free descriptor sets of all batches whose fence has been signaled (fences are signaled in submission order) */
+    while (!retirementQueue_.empty())
+    {
+        auto& batch = retirementQueue_.front();
+        if (vkGetFenceStatus(device_, batch.fence) != VK_SUCCESS)
+            break;
+
+        for (const auto& entry : batch.releasedSets)
+        {
+            vkFreeDescriptorSets(device_, entry.pool->pool, static_cast<std::uint32_t>(entry.sets.size()), entry.sets.data());
+            entry.pool->numAllocatedSets -= static_cast<std::uint32_t>(entry.sets.size());
+        }
+
+        /* Return fence for the next batch */
+        vkResetFences(device_, 1, &batch.fence);
+        freeFences_.push_back(batch.fence);
+
+        retirementQueue_.pop_front();
+    }
+}
+
+VKDescriptorPoolManager::DescriptorPool* VKDescriptorPoolManager::FindOrCreatePool(
+    PoolBucket&                                 bucket,
+    const std::vector<VkDescriptorPoolSize>&    poolSizes,
+    std::uint32_t                               numSets)
+{
+    /* Find pool with enough remaining descriptor sets */
+    for (const auto& pool : bucket.pools)
+    {
+        if (pool->capacity - pool->numAllocatedSets >= numSets)
+            return pool.get();
+    }
+
+    /* Grow capacity for each new pool within this bucket */
+    bucket.nextCapacity = std::max(g_minDescriptorPoolCapacity, std::min(bucket.nextCapacity * 2, g_maxDescriptorPoolCapacity));
+    const auto capacity = std::max(bucket.nextCapacity, numSets);
+
+    /* Scale pool sizes of a single descriptor set by the pool capacity */
+    std::vector<VkDescriptorPoolSize> scaledPoolSizes = poolSizes;
+    for (auto& size : scaledPoolSizes)
+        size.descriptorCount *= capacity;
+
+    /* Create new descriptor pool; individual sets can be freed, because all sets within a pool have the same size */
+    auto pool = MakeUnique<DescriptorPool>(device_);
+    pool->capacity = capacity;
+
+    VkDescriptorPoolCreateInfo poolCreateInfo;
+    {
+        poolCreateInfo.sType            = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolCreateInfo.pNext            = nullptr;
+        poolCreateInfo.flags            = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+        poolCreateInfo.maxSets          = capacity;
+        poolCreateInfo.poolSizeCount    = static_cast<std::uint32_t>(scaledPoolSizes.size());
+        poolCreateInfo.pPoolSizes       = scaledPoolSizes.data();
+    }
+    auto result = vkCreateDescriptorPool(device_, &poolCreateInfo, nullptr, pool->pool.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan descriptor pool");
+
+    poolMap_[pool->pool.Get()] = pool.get();
+    bucket.pools.emplace_back(std::move(pool));
+
+    return bucket.pools.back().get();
+}
+
+VkFence VKDescriptorPoolManager::AcquireFence()
+{
+    if (!freeFences_.empty())
+    {
+        /* Reuse previously signaled fence */
+        auto fence = freeFences_.back();
+        freeFences_.pop_back();
+        return fence;
+    }
+
+    /* Create new fence */
+    VkFenceCreateInfo createInfo;
+    {
+        createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = 0;
+    }
+    VkFence fence = VK_NULL_HANDLE;
+    auto result = vkCreateFence(device_, &createInfo, nullptr, &fence);
+    VKThrowIfFailed(result, "failed to create Vulkan fence");
+
+    fences_.push_back(fence);
+
+    return fence;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
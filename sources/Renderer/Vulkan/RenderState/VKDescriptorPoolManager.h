@@ -0,0 +1,138 @@
+/*
+ * VKDescriptorPoolManager.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VK_DESCRIPTOR_POOL_MANAGER_H
+#define LLGL_VK_DESCRIPTOR_POOL_MANAGER_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include <vector>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+class VKDevice;
+
+/*
+Vulkan descriptor pool manager that is shared between all resource heaps.
+Descriptor pools are bucketed by the pool sizes of a single descriptor set,
+so all descriptor sets within a pool are equally sized and releasing them never fragments the pool.
+Released descriptor sets are freed and recycled once the graphics queue has signaled a fence that was submitted with the next command queue submission after their release.
+Allocating and releasing descriptor sets is thread-safe.
+*/
+class VKDescriptorPoolManager
+{
+
+    public:
+
+        VKDescriptorPoolManager(VKDevice& device);
+        ~VKDescriptorPoolManager();
+
+        VKDescriptorPoolManager(const VKDescriptorPoolManager&) = delete;
+        VKDescriptorPoolManager& operator = (const VKDescriptorPoolManager&) = delete;
+
+        /*
+        Allocates the specified number of descriptor sets with the same layout and returns the pool they were allocated from.
+        The pool sizes specify the number of descriptors for a single descriptor set.
+        */
+        VkDescriptorPool AllocateDescriptorSets(
+            std::uint32_t               numPoolSizes,
+            const VkDescriptorPoolSize* poolSizes,
+            VkDescriptorSetLayout       setLayout,
+            std::uint32_t               numSets,
+            VkDescriptorSet*            outSets
+        );
+
+        // Releases the specified descriptor sets once all commands up to the next queue submission have been completed.
+        void ReleaseDescriptorSets(VkDescriptorPool descriptorPool, std::uint32_t numSets, const VkDescriptorSet* sets);
+
+        /*
+        Submits a fence for all descriptor sets that have been released since the last queue submission
+        and frees all descriptor sets whose fence has been signaled. This is called by the command queue after each submission.
+        */
+        void RetireReleasedDescriptorSets();
+
+    private:
+
+        struct DescriptorPool
+        {
+            DescriptorPool(const VKPtr<VkDevice>& device);
+
+            VKPtr<VkDescriptorPool> pool;
+            std::uint32_t           capacity            = 0;
+            std::uint32_t           numAllocatedSets    = 0;
+        };
+
+        struct PoolBucket
+        {
+            std::vector<std::unique_ptr<DescriptorPool>>    pools;
+            std::uint32_t                                   nextCapacity    = 0;
+        };
+
+        struct ReleasedDescriptorSets
+        {
+            DescriptorPool*                 pool;
+            std::vector<VkDescriptorSet>    sets;
+        };
+
+        struct RetirementBatch
+        {
+            VkFence                             fence;
+            std::vector<ReleasedDescriptorSets> releasedSets;
+        };
+
+        using PoolBucketKey = std::vector<std::uint32_t>;
+
+    private:
+
+        // Submits a single fence for all recently released descriptor sets.
+        void SubmitRetirementFence();
+
+        // Frees all released descriptor sets whose fence has been signaled.
+        void FreeRetiredDescriptorSets();
+
+        // Returns a pool of the specified bucket with enough capacity or creates a new one.
+        DescriptorPool* FindOrCreatePool(
+            PoolBucket&                                 bucket,
+            const std::vector<VkDescriptorPoolSize>&    poolSizes,
+            std::uint32_t                               numSets
+        );
+
+        VkFence AcquireFence();
+
+    private:
+
+        VKDevice&                                       device_;
+
+        std::map<PoolBucketKey, PoolBucket>             buckets_;
+        std::map<VkDescriptorPool, DescriptorPool*>     poolMap_;
+
+        std::vector<ReleasedDescriptorSets>             releasedSets_;
+        std::deque<RetirementBatch>                     retirementQueue_;
+        std::vector<VkFence>                            fences_;
+        std::vector<VkFence>                            freeFences_;
+
+        std::mutex                                      mutex_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -8,6 +8,8 @@
 #include "VKPipelineLayout.h"
 #include "../VKTypes.h"
 #include "../VKCore.h"
+#include "../../ResourceBindingIterator.h"
+#include <algorithm>
 
 
 namespace LLGL
@@ -126,7 +128,9 @@ VKPipelineLayout::VKPipelineLayout(const VKPtr<VkDevice>& device, const Pipeline
             {
                 desc.bindings[i].slot,
                 desc.bindings[i].stageFlags,
-                layoutBindings[i].descriptorType
+                layoutBindings[i].descriptorType,
+                std::max(1u, desc.bindings[i].arraySize),
+                IsBindlessTableBinding(desc.bindings[i])
             }
         );
     }
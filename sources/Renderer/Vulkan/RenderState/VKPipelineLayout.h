@@ -25,6 +25,8 @@ struct VKLayoutBinding
     std::uint32_t       dstBinding;
     long                stageFlags;
     VkDescriptorType    descriptorType;
+    std::uint32_t       arraySize;
+    bool                bindlessTable;  // Specifies whether this binding denotes a texture table in bindless resource heaps
 };
 
 class VKPipelineLayout final : public PipelineLayout
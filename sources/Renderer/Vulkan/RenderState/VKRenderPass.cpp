@@ -85,7 +85,7 @@ static void Convert(
     dst.finalLayout     = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
 }
 
-void VKRenderPass::CreateVkRenderPass(VkDevice device, const RenderPassDescriptor& desc)
+void VKRenderPass::CreateVkRenderPass(VkDevice device, const RenderPassDescriptor& desc, bool transientMultiSampling)
 {
     /* Get number of attachments */
     std::uint32_t numColorAttachments   = static_cast<std::uint32_t>(desc.colorAttachments.size());
@@ -117,7 +117,11 @@ void VKRenderPass::CreateVkRenderPass(VkDevice device, const RenderPassDescripto
     {
         /* Take color attachment format descriptors for multi-sampled attachemnts */
         for (std::uint32_t i = 0; i < numColorAttachments; ++i)
+        {
             Convert(attachmentDescs[numAttachments + i], desc.colorAttachments[i], sampleCountBits);
+            if (transientMultiSampling)
+                VKConvertToTransientAttachment(attachmentDescs[numAttachments + i], VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+        }
 
         /* Modify original attachment descriptors */
         for (std::uint32_t i = 0; i < numColorAttachments; ++i)
@@ -246,6 +250,28 @@ void VKRenderPass::CreateVkRenderPassWithDescriptors(
 }
 
 
+
+/*
+ * Global functions
+ */
+
+void VKConvertToTransientAttachment(VkAttachmentDescription& attachmentDesc, VkImageLayout attachmentLayout)
+{
+    /* Never load previous content, but keep clear operations */
+    if (attachmentDesc.loadOp == VK_ATTACHMENT_LOAD_OP_LOAD)
+        attachmentDesc.loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    if (attachmentDesc.stencilLoadOp == VK_ATTACHMENT_LOAD_OP_LOAD)
+        attachmentDesc.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+
+    /* Never store content, so the attachment can stay in tile memory */
+    attachmentDesc.storeOp          = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    attachmentDesc.stencilStoreOp   = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+
+    /* Transient images can only be used as attachments, so they must never be transitioned into any other layout */
+    attachmentDesc.initialLayout    = VK_IMAGE_LAYOUT_UNDEFINED;
+    attachmentDesc.finalLayout      = attachmentLayout;
+}
+
 } // /namespace LLGL
 
 
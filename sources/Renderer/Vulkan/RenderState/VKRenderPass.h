@@ -29,10 +29,11 @@ class VKRenderPass final : public RenderPass
         VKRenderPass(const VKPtr<VkDevice>& device);
         VKRenderPass(const VKPtr<VkDevice>& device, const RenderPassDescriptor& desc);
 
-        // (Re-)creates the render pass object.
+        // (Re-)creates the render pass object. If 'transientMultiSampling' is true, the multi-sampled color attachments are discarded after they have been resolved.
         void CreateVkRenderPass(
             VkDevice                    device,
-            const RenderPassDescriptor& desc
+            const RenderPassDescriptor& desc,
+            bool                        transientMultiSampling = false
         );
 
         void CreateVkRenderPassWithDescriptors(
@@ -95,6 +96,10 @@ class VKRenderPass final : public RenderPass
 };
 
 
+// Modifies the attachment descriptor of a transient attachment, so that its content is neither loaded from nor stored into memory. Clear operations are preserved.
+void VKConvertToTransientAttachment(VkAttachmentDescription& attachmentDesc, VkImageLayout attachmentLayout);
+
+
 } // /namespace LLGL
 
 
@@ -7,6 +7,7 @@
 
 #include "VKResourceHeap.h"
 #include "VKPipelineLayout.h"
+#include "VKDescriptorPoolManager.h"
 #include "../Buffer/VKBuffer.h"
 #include "../Texture/VKSampler.h"
 #include "../Texture/VKTexture.h"
@@ -41,8 +42,18 @@ static VkPipelineBindPoint FindPipelineBindPoint(const VKPipelineLayout& pipelin
     return VK_PIPELINE_BIND_POINT_MAX_ENUM;
 }
 
-VKResourceHeap::VKResourceHeap(const VKPtr<VkDevice>& device, const ResourceHeapDescriptor& desc) :
-    descriptorPool_ { device, vkDestroyDescriptorPool }
+// Returns the number of resource views the specified binding consumes within a single descriptor set
+static std::uint32_t GetNumResourceViewsForBinding(const VKLayoutBinding& binding, bool bindless)
+{
+    return (bindless && binding.bindlessTable ? binding.arraySize : 1u);
+}
+
+VKResourceHeap::VKResourceHeap(
+    const VKPtr<VkDevice>&          device,
+    VKDescriptorPoolManager&        descriptorPoolMngr,
+    const ResourceHeapDescriptor&   desc)
+:
+    descriptorPoolMngr_ { descriptorPoolMngr }
 {
     /* Get pipeline layout object */
     auto pipelineLayoutVK = LLGL_CAST(VKPipelineLayout*, desc.pipelineLayout);
@@ -52,10 +63,19 @@ VKResourceHeap::VKResourceHeap(const VKPtr<VkDevice>& device, const ResourceHeap
     pipelineLayout_ = pipelineLayoutVK->GetVkPipelineLayout();
     bindPoint_      = FindPipelineBindPoint(*pipelineLayoutVK);
 
+    /* Determine layout binding for each resource view of a descriptor set, bindless texture tables consume one resource view per array element */
+    const auto& bindings = pipelineLayoutVK->GetBindings();
+
+    VKResourceViewBindingList viewBindings;
+    for (const auto& binding : bindings)
+    {
+        for (std::uint32_t i = 0, n = GetNumResourceViewsForBinding(binding, desc.bindless); i < n; ++i)
+            viewBindings.push_back({ &binding, i });
+    }
+
     /* Validate binding descriptors */
-    const auto& bindings            = pipelineLayoutVK->GetBindings();
-    const auto  numBindings         = bindings.size();
-    const auto  numResourceViews    = desc.resourceViews.size();
+    const auto numBindings      = viewBindings.size();
+    const auto numResourceViews = desc.resourceViews.size();
 
     if (numBindings == 0)
         throw std::invalid_argument("cannot create resource heap without bindings in pipeline layout");
@@ -66,19 +86,20 @@ VKResourceHeap::VKResourceHeap(const VKPtr<VkDevice>& device, const ResourceHeap
     const auto numDescriptorSets = (numResourceViews / numBindings);
     descriptorSets_.resize(numDescriptorSets, VK_NULL_HANDLE);
 
-    /* Create resource descriptor pool */
-    CreateDescriptorPool(device, desc, bindings);
-
-    /* Create resource descriptor set for pipeline layout */
-    std::vector<VkDescriptorSetLayout> setLayouts;
-    setLayouts.resize(numDescriptorSets, pipelineLayoutVK->GetVkDescriptorSetLayout());
-    CreateDescriptorSets(device, static_cast<std::uint32_t>(numDescriptorSets), setLayouts.data());
+    /* Allocate resource descriptor sets for pipeline layout from shared descriptor pools */
+    CreateDescriptorSets(bindings, pipelineLayoutVK->GetVkDescriptorSetLayout(), desc.bindless);
 
     /* Update write descriptors in descriptor set */
-    UpdateDescriptorSets(device, desc, bindings);
+    UpdateDescriptorSets(device, desc, viewBindings);
 
     /* Create pipeline barrier for resource views that require it, e.g. those with storage binding flags */
-    CreatePipelineBarrier(desc.resourceViews, pipelineLayoutVK->GetBindings());
+    CreatePipelineBarrier(desc.resourceViews, viewBindings);
+}
+
+VKResourceHeap::~VKResourceHeap()
+{
+    /* Return descriptor sets to the pool manager; they are recycled once the GPU no longer uses them */
+    descriptorPoolMngr_.ReleaseDescriptorSets(descriptorPool_, GetNumDescriptorSets(), descriptorSets_.data());
 }
 
 std::uint32_t VKResourceHeap::GetNumDescriptorSets() const
@@ -132,74 +153,48 @@ static void CompressDescriptorPoolSizes(std::vector<VkDescriptorPoolSize>& poolS
     );
 }
 
-//TODO: enhance pool size accumulation
-void VKResourceHeap::CreateDescriptorPool(
-    const VKPtr<VkDevice>&              device,
-    const ResourceHeapDescriptor&       desc,
-    const std::vector<VKLayoutBinding>& bindings)
+void VKResourceHeap::CreateDescriptorSets(
+    const std::vector<VKLayoutBinding>& bindings,
+    VkDescriptorSetLayout               setLayout,
+    bool                                bindless)
 {
-    /* Initialize descriptor pool sizes */
-    const auto numResourceViews = desc.resourceViews.size();
-    const auto numBindings      = bindings.size();
-
-    std::vector<VkDescriptorPoolSize> poolSizes(numResourceViews);
-    for (std::size_t i = 0; i < numResourceViews; ++i)
+    /* Initialize descriptor pool sizes for a single descriptor set (one descriptor per resource view) */
+    std::vector<VkDescriptorPoolSize> poolSizes(bindings.size());
+    for (std::size_t i = 0; i < bindings.size(); ++i)
     {
-        poolSizes[i].type               = bindings[i % numBindings].descriptorType;
-        poolSizes[i].descriptorCount    = 1;
+        poolSizes[i].type               = bindings[i].descriptorType;
+        poolSizes[i].descriptorCount    = GetNumResourceViewsForBinding(bindings[i], bindless);
     }
 
     /* Compress pool sizes by merging equal types with accumulated number of descriptors */
     CompressDescriptorPoolSizes(poolSizes);
 
-    /* Create descriptor pool */
-    VkDescriptorPoolCreateInfo poolCreateInfo;
-    {
-        poolCreateInfo.sType            = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-        poolCreateInfo.pNext            = nullptr;
-        poolCreateInfo.flags            = 0;
-        poolCreateInfo.maxSets          = GetNumDescriptorSets();
-        poolCreateInfo.poolSizeCount    = static_cast<std::uint32_t>(poolSizes.size());
-        poolCreateInfo.pPoolSizes       = poolSizes.data();
-    }
-    auto result = vkCreateDescriptorPool(device, &poolCreateInfo, nullptr, descriptorPool_.ReleaseAndGetAddressOf());
-    VKThrowIfFailed(result, "failed to create Vulkan descriptor pool");
-}
-
-void VKResourceHeap::CreateDescriptorSets(
-    const VKPtr<VkDevice>&          device,
-    std::uint32_t                   numSetLayouts,
-    const VkDescriptorSetLayout*    setLayouts)
-{
-    /* Allocate descriptor set */
-    VkDescriptorSetAllocateInfo allocInfo;
-    {
-        allocInfo.sType                 = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-        allocInfo.pNext                 = nullptr;
-        allocInfo.descriptorPool        = descriptorPool_;
-        allocInfo.descriptorSetCount    = numSetLayouts;
-        allocInfo.pSetLayouts           = setLayouts;
-    }
-    auto result = vkAllocateDescriptorSets(device, &allocInfo, descriptorSets_.data());
-    VKThrowIfFailed(result, "failed to allocate Vulkan descriptor sets");
+    /* Allocate descriptor sets from a shared pool with matching pool sizes */
+    descriptorPool_ = descriptorPoolMngr_.AllocateDescriptorSets(
+        static_cast<std::uint32_t>(poolSizes.size()),
+        poolSizes.data(),
+        setLayout,
+        GetNumDescriptorSets(),
+        descriptorSets_.data()
+    );
 }
 
 void VKResourceHeap::UpdateDescriptorSets(
     const VKPtr<VkDevice>&              device,
     const ResourceHeapDescriptor&       desc,
-    const std::vector<VKLayoutBinding>& bindings)
+    const VKResourceViewBindingList&    viewBindings)
 {
     /* Allocate local storage for buffer and image descriptors */
     const auto numResourceViews = desc.resourceViews.size();
-    const auto numBindings      = bindings.size();
+    const auto numBindings      = viewBindings.size();
 
     VKWriteDescriptorContainer container{ numResourceViews };
 
     for (std::size_t i = 0; i < numResourceViews; ++i)
     {
         /* Get resource view information */
-        const auto& binding = bindings[i % numBindings];
-        const auto descriptorType = binding.descriptorType;
+        const auto& viewBinding = viewBindings[i % numBindings];
+        const auto descriptorType = viewBinding.binding->descriptorType;
 
         const auto& rvDesc = desc.resourceViews[i];
         VkDescriptorSet descSet = descriptorSets_[i / numBindings];
@@ -207,16 +202,16 @@ void VKResourceHeap::UpdateDescriptorSets(
         switch (descriptorType)
         {
             case VK_DESCRIPTOR_TYPE_SAMPLER:
-                FillWriteDescriptorForSampler(rvDesc, descSet, binding, container);
+                FillWriteDescriptorForSampler(rvDesc, descSet, viewBinding, container);
                 break;
 
             case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
-                FillWriteDescriptorForTexture(device, rvDesc, descSet, binding, container);
+                FillWriteDescriptorForTexture(device, rvDesc, descSet, viewBinding, container);
                 break;
 
             case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
             case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
-                FillWriteDescriptorForBuffer(device, rvDesc, descSet, binding, container);
+                FillWriteDescriptorForBuffer(device, rvDesc, descSet, viewBinding, container);
                 break;
 
             default:
@@ -243,7 +238,7 @@ void VKResourceHeap::UpdateDescriptorSets(
 void VKResourceHeap::FillWriteDescriptorForSampler(
     const ResourceViewDescriptor&   rvDesc,
     VkDescriptorSet                 descSet,
-    const VKLayoutBinding&          binding,
+    const VKResourceViewBinding&    viewBinding,
     VKWriteDescriptorContainer&     container)
 {
     auto samplerVK = LLGL_CAST(VKSampler*, rvDesc.resource);
@@ -260,10 +255,10 @@ void VKResourceHeap::FillWriteDescriptorForSampler(
     auto writeDesc = container.NextWriteDescriptor();
     {
         writeDesc->dstSet           = descSet;
-        writeDesc->dstBinding       = binding.dstBinding;
-        writeDesc->dstArrayElement  = 0;
+        writeDesc->dstBinding       = viewBinding.binding->dstBinding;
+        writeDesc->dstArrayElement  = viewBinding.arrayElement;
         writeDesc->descriptorCount  = 1;
-        writeDesc->descriptorType   = binding.descriptorType;
+        writeDesc->descriptorType   = viewBinding.binding->descriptorType;
         writeDesc->pImageInfo       = imageInfo;
         writeDesc->pBufferInfo      = nullptr;
         writeDesc->pTexelBufferView = nullptr;
@@ -274,7 +269,7 @@ void VKResourceHeap::FillWriteDescriptorForTexture(
     const VKPtr<VkDevice>&          device,
     const ResourceViewDescriptor&   rvDesc,
     VkDescriptorSet                 descSet,
-    const VKLayoutBinding&          binding,
+    const VKResourceViewBinding&    viewBinding,
     VKWriteDescriptorContainer&     container)
 {
     auto textureVK = LLGL_CAST(VKTexture*, rvDesc.resource);
@@ -291,10 +286,10 @@ void VKResourceHeap::FillWriteDescriptorForTexture(
     auto writeDesc = container.NextWriteDescriptor();
     {
         writeDesc->dstSet           = descSet;
-        writeDesc->dstBinding       = binding.dstBinding;
-        writeDesc->dstArrayElement  = 0;
+        writeDesc->dstBinding       = viewBinding.binding->dstBinding;
+        writeDesc->dstArrayElement  = viewBinding.arrayElement;
         writeDesc->descriptorCount  = 1;
-        writeDesc->descriptorType   = binding.descriptorType;
+        writeDesc->descriptorType   = viewBinding.binding->descriptorType;
         writeDesc->pImageInfo       = imageInfo;
         writeDesc->pBufferInfo      = nullptr;
         writeDesc->pTexelBufferView = nullptr;
@@ -305,7 +300,7 @@ void VKResourceHeap::FillWriteDescriptorForBuffer(
     const VKPtr<VkDevice>&          /*device*/,
     const ResourceViewDescriptor&   rvDesc,
     VkDescriptorSet                 descSet,
-    const VKLayoutBinding&          binding,
+    const VKResourceViewBinding&    viewBinding,
     VKWriteDescriptorContainer&     container)
 {
     auto bufferVK = LLGL_CAST(VKBuffer*, rvDesc.resource);
@@ -330,10 +325,10 @@ void VKResourceHeap::FillWriteDescriptorForBuffer(
     auto writeDesc = container.NextWriteDescriptor();
     {
         writeDesc->dstSet           = descSet;
-        writeDesc->dstBinding       = binding.dstBinding;
-        writeDesc->dstArrayElement  = 0;
+        writeDesc->dstBinding       = viewBinding.binding->dstBinding;
+        writeDesc->dstArrayElement  = viewBinding.arrayElement;
         writeDesc->descriptorCount  = 1;
-        writeDesc->descriptorType   = binding.descriptorType;
+        writeDesc->descriptorType   = viewBinding.binding->descriptorType;
         writeDesc->pImageInfo       = nullptr;
         writeDesc->pBufferInfo      = bufferInfo;
         writeDesc->pTexelBufferView = nullptr;
@@ -342,13 +337,13 @@ void VKResourceHeap::FillWriteDescriptorForBuffer(
 
 void VKResourceHeap::CreatePipelineBarrier(
     const std::vector<ResourceViewDescriptor>&  resourceViews,
-    const std::vector<VKLayoutBinding>&         bindings)
+    const VKResourceViewBindingList&            viewBindings)
 {
-    const auto numBindings = bindings.size();
+    const auto numBindings = viewBindings.size();
     for (std::size_t i = 0; i < resourceViews.size(); ++i)
     {
         const auto& desc    = resourceViews[i];
-        const auto& binding = bindings[i % numBindings];
+        const auto& binding = *(viewBindings[i % numBindings].binding);
 
         if (auto resource = desc.resource)
         {
@@ -22,6 +22,7 @@ namespace LLGL
 
 class VKBuffer;
 class VKTexture;
+class VKDescriptorPoolManager;
 struct VKWriteDescriptorContainer;
 struct VKLayoutBinding;
 struct ResourceHeapDescriptor;
@@ -37,7 +38,12 @@ class VKResourceHeap final : public ResourceHeap
 
     public:
 
-        VKResourceHeap(const VKPtr<VkDevice>& device, const ResourceHeapDescriptor& desc);
+        VKResourceHeap(
+            const VKPtr<VkDevice>&          device,
+            VKDescriptorPoolManager&        descriptorPoolMngr,
+            const ResourceHeapDescriptor&   desc
+        );
+        ~VKResourceHeap();
 
         // Inserts a pipeline barrier command into the command buffer if this resource heap requires it.
         void InsertPipelineBarrier(VkCommandBuffer commandBuffer);
@@ -48,10 +54,10 @@ class VKResourceHeap final : public ResourceHeap
             return pipelineLayout_;
         }
 
-        // Returns the native Vulkan descritpor pool.
+        // Returns the native Vulkan descriptor pool the descriptor sets were allocated from.
         inline VkDescriptorPool GetVkDescriptorPool() const
         {
-            return descriptorPool_.Get();
+            return descriptorPool_;
         }
 
         // Returns the list of native Vulkan descriptor sets.
@@ -71,28 +77,33 @@ class VKResourceHeap final : public ResourceHeap
 
     private:
 
-        void CreateDescriptorPool(
-            const VKPtr<VkDevice>&              device,
-            const ResourceHeapDescriptor&       desc,
-            const std::vector<VKLayoutBinding>& bindings
-        );
+        // Layout binding and array element for a single resource view within a descriptor set.
+        struct VKResourceViewBinding
+        {
+            const VKLayoutBinding*  binding;
+            std::uint32_t           arrayElement;
+        };
+
+        using VKResourceViewBindingList = std::vector<VKResourceViewBinding>;
+
+    private:
 
         void CreateDescriptorSets(
-            const VKPtr<VkDevice>&          device,
-            std::uint32_t                   numSetLayouts,
-            const VkDescriptorSetLayout*    setLayouts
+            const std::vector<VKLayoutBinding>& bindings,
+            VkDescriptorSetLayout               setLayout,
+            bool                                bindless
         );
 
         void UpdateDescriptorSets(
             const VKPtr<VkDevice>&              device,
             const ResourceHeapDescriptor&       desc,
-            const std::vector<VKLayoutBinding>& bindings
+            const VKResourceViewBindingList&    viewBindings
         );
 
         void FillWriteDescriptorForSampler(
             const ResourceViewDescriptor&   rvDesc,
             VkDescriptorSet                 descSet,
-            const VKLayoutBinding&          binding,
+            const VKResourceViewBinding&    viewBinding,
             VKWriteDescriptorContainer&     container
         );
 
@@ -100,7 +111,7 @@ class VKResourceHeap final : public ResourceHeap
             const VKPtr<VkDevice>&          device,
             const ResourceViewDescriptor&   rvDesc,
             VkDescriptorSet                 descSet,
-            const VKLayoutBinding&          binding,
+            const VKResourceViewBinding&    viewBinding,
             VKWriteDescriptorContainer&     container
         );
 
@@ -108,13 +119,13 @@ class VKResourceHeap final : public ResourceHeap
             const VKPtr<VkDevice>&          device,
             const ResourceViewDescriptor&   rvDesc,
             VkDescriptorSet                 descSet,
-            const VKLayoutBinding&          binding,
+            const VKResourceViewBinding&    viewBinding,
             VKWriteDescriptorContainer&     container
         );
 
         void CreatePipelineBarrier(
             const std::vector<ResourceViewDescriptor>&  resourceViews,
-            const std::vector<VKLayoutBinding>&         bindings
+            const VKResourceViewBindingList&            viewBindings
         );
 
         // Returns the image view for the specified texture or creates one if the texture-view is enabled.
@@ -126,9 +137,11 @@ class VKResourceHeap final : public ResourceHeap
 
     private:
 
+        VKDescriptorPoolManager&        descriptorPoolMngr_;
+
         VkPipelineLayout                pipelineLayout_ = VK_NULL_HANDLE;
 
-        VKPtr<VkDescriptorPool>         descriptorPool_;
+        VkDescriptorPool                descriptorPool_ = VK_NULL_HANDLE;
         std::vector<VkDescriptorSet>    descriptorSets_;
 
         std::vector<VKPtr<VkImageView>> imageViews_;
@@ -0,0 +1,5 @@
+#!/bin/sh
+# Compiles all shaders into SPIR-V with glslangValidator (from the Vulkan SDK)
+# The output is stored as text of 32-bit hexadecimal numbers to be included by VKBuiltin.h
+
+glslangValidator -V -x -o GenerateMips2D.spv GenerateMips2D.comp
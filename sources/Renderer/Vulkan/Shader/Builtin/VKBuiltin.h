@@ -0,0 +1,33 @@
+/*
+ * VKBuiltin.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VK_BUILTIN_H
+#define LLGL_VK_BUILTIN_H
+
+
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// SPIR-V module of "GenerateMips2D.comp" (see Compile.sh)
+static const std::uint32_t g_spirvGenerateMips2D[] =
+{
+    #include "GenerateMips2D.spv"
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -22,13 +22,15 @@ namespace LLGL
 {
 
 
-VKShader::VKShader(const VKPtr<VkDevice>& device, const ShaderDescriptor& desc) :
+VKShader::VKShader(const VKPtr<VkDevice>& device, const ShaderDescriptor& desc, bool computeCacheKey) :
     Shader        { desc.type                     },
     device_       { device                        },
     shaderModule_ { device, vkDestroyShaderModule }
 {
     BuildShader(desc);
     BuildInputLayout(desc.vertex.inputAttribs.size(), desc.vertex.inputAttribs.data());
+    if (computeCacheKey && loadBinaryResult_ == LoadBinaryResult::Successful)
+        BuildCacheKey(desc);
 }
 
 bool VKShader::HasErrors() const
@@ -329,9 +331,8 @@ bool VKShader::Reflect(ShaderReflection& reflection) const
     spvReflect.Parse(shaderModuleData_.data(), shaderModuleData_.size());
 
     /* Gather input/output attributes */
-    for (const auto& it : spvReflect.GetVaryings())
+    for (const auto& var : spvReflect.GetVaryings())
     {
-        const auto& var = it.second;
         if (GetType() == ShaderType::Vertex)
         {
             std::uint32_t numVectors = 1;
@@ -370,9 +371,8 @@ bool VKShader::Reflect(ShaderReflection& reflection) const
     }
 
     /* Gather resources */
-    for (const auto& it : spvReflect.GetUniforms())
+    for (const auto& var : spvReflect.GetUniforms())
     {
-        const auto& var = it.second;
         if (auto resource = FindOrAppendShaderResource(reflection, var))
             resource->binding.stageFlags |= ShaderTypeToStageFlags(GetType());
     }
@@ -480,6 +480,20 @@ void VKShader::BuildInputLayout(std::size_t numVertexAttribs, const VertexAttrib
     inputLayout_.bindingDescs.insert(inputLayout_.bindingDescs.end(), bindingDescSet.begin(), bindingDescSet.end());
 }
 
+void VKShader::BuildCacheKey(const ShaderDescriptor& shaderDesc)
+{
+    /* Hash SPIR-V module from memory, so a binary file does not need to be read twice */
+    ShaderDescriptor cacheDesc = shaderDesc;
+    {
+        cacheDesc.source        = shaderModuleData_.data();
+        cacheDesc.sourceSize    = shaderModuleData_.size();
+        cacheDesc.sourceType    = ShaderSourceType::BinaryBuffer;
+        cacheDesc.entryPoint    = entryPoint_.c_str();
+    }
+    cacheKey_       = ShaderCache::HashShaderDescriptor(cacheDesc);
+    hasCacheKey_    = true;
+}
+
 bool VKShader::CompileSource(const ShaderDescriptor& shaderDesc)
 {
     return false; // dummy
@@ -488,16 +502,16 @@ bool VKShader::CompileSource(const ShaderDescriptor& shaderDesc)
 bool VKShader::LoadBinary(const ShaderDescriptor& shaderDesc)
 {
     /* Get shader binary */
-    std::vector<char>   fileContent;
-    const char*         binaryBuffer = nullptr;
-    std::size_t         binaryLength = 0;
+    std::unique_ptr<Blob>   fileContent;
+    const char*             binaryBuffer = nullptr;
+    std::size_t             binaryLength = 0;
 
     if (shaderDesc.sourceType == ShaderSourceType::BinaryFile)
     {
-        /* Load binary from file */
-        fileContent = ReadFileBuffer(shaderDesc.source);
-        binaryBuffer = fileContent.data();
-        binaryLength = fileContent.size();
+        /* Load binary from mapped file */
+        fileContent = MapFileBuffer(shaderDesc.source);
+        binaryBuffer = static_cast<const char*>(fileContent->GetData());
+        binaryLength = fileContent->GetSize();
     }
     else
     {
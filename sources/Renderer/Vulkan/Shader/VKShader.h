@@ -13,6 +13,7 @@
 #include <vector>
 #include "../Vulkan.h"
 #include "../VKPtr.h"
+#include "../../ShaderCache.h"
 
 
 namespace LLGL
@@ -33,7 +34,7 @@ class VKShader final : public Shader
 
     public:
 
-        VKShader(const VKPtr<VkDevice>& device, const ShaderDescriptor& desc);
+        VKShader(const VKPtr<VkDevice>& device, const ShaderDescriptor& desc, bool computeCacheKey = false);
 
         void FillShaderStageCreateInfo(VkPipelineShaderStageCreateInfo& createInfo) const;
         void FillVertexInputStateCreateInfo(VkPipelineVertexInputStateCreateInfo& createInfo) const;
@@ -47,6 +48,18 @@ class VKShader final : public Shader
             return shaderModule_;
         }
 
+        // Returns true if this shader has a shader cache key.
+        inline bool HasCacheKey() const
+        {
+            return hasCacheKey_;
+        }
+
+        // Returns the shader cache key of this shader. Only valid if HasCacheKey returns true.
+        inline ShaderCache::Key GetCacheKey() const
+        {
+            return cacheKey_;
+        }
+
     private:
 
         // Note: "Success" is a reserved macro by X11 lib.
@@ -62,6 +75,7 @@ class VKShader final : public Shader
 
         bool BuildShader(const ShaderDescriptor& shaderDesc);
         void BuildInputLayout(std::size_t numVertexAttribs, const VertexAttribute* vertexAttribs);
+        void BuildCacheKey(const ShaderDescriptor& shaderDesc);
 
         bool CompileSource(const ShaderDescriptor& shaderDesc);
         bool LoadBinary(const ShaderDescriptor& shaderDesc);
@@ -85,6 +99,9 @@ class VKShader final : public Shader
         std::string             entryPoint_;
         std::string             errorLog_;
 
+        ShaderCache::Key        cacheKey_           = 0;
+        bool                    hasCacheKey_        = false;
+
 };
 
 
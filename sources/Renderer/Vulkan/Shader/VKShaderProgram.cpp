@@ -19,7 +19,8 @@ namespace LLGL
 {
 
 
-VKShaderProgram::VKShaderProgram(const ShaderProgramDescriptor& desc)
+VKShaderProgram::VKShaderProgram(const ShaderProgramDescriptor& desc, ShaderCache* shaderCache) :
+    shaderCache_ { shaderCache }
 {
     Attach(desc.vertexShader);
     Attach(desc.tessControlShader);
@@ -45,18 +46,27 @@ std::string VKShaderProgram::GetReport() const
 
 bool VKShaderProgram::Reflect(ShaderReflection& reflection) const
 {
-    ShaderProgram::ClearShaderReflection(reflection);
-
-    for (auto shader : shaders_)
+    ShaderCache::Key cacheKey = 0;
+    if (shaderCache_ != nullptr && GetCacheKey(cacheKey))
     {
-        if (!shader->Reflect(reflection))
-            return false;
-        if (shader->GetType() == ShaderType::Compute && !shader->ReflectLocalSize(reflection.compute.workGroupSize))
+        /* Load reflection from shader cache, so SPIR-V modules don't need to be reflected again */
+        if (auto entry = shaderCache_->Load(cacheKey))
+        {
+            ShaderProgram::ClearShaderReflection(reflection);
+            if (ShaderCache::DeserializeShaderReflection(entry->GetData(), entry->GetSize(), reflection))
+                return true;
+        }
+
+        /* Reflect shaders and store result in shader cache */
+        if (!ReflectShaders(reflection))
             return false;
-    }
 
-    ShaderProgram::FinalizeShaderReflection(reflection);
-    return true;
+        if (auto entry = ShaderCache::SerializeShaderReflection(reflection))
+            shaderCache_->Store(cacheKey, entry->GetData(), entry->GetSize());
+
+        return true;
+    }
+    return ReflectShaders(reflection);
 }
 
 UniformLocation VKShaderProgram::FindUniformLocation(const char* name) const
@@ -146,6 +156,35 @@ void VKShaderProgram::LinkProgram()
         linkError_ = LinkError::InvalidComposition;
 }
 
+bool VKShaderProgram::ReflectShaders(ShaderReflection& reflection) const
+{
+    ShaderProgram::ClearShaderReflection(reflection);
+
+    for (auto shader : shaders_)
+    {
+        if (!shader->Reflect(reflection))
+            return false;
+        if (shader->GetType() == ShaderType::Compute && !shader->ReflectLocalSize(reflection.compute.workGroupSize))
+            return false;
+    }
+
+    ShaderProgram::FinalizeShaderReflection(reflection);
+    return true;
+}
+
+bool VKShaderProgram::GetCacheKey(ShaderCache::Key& key) const
+{
+    /* Combine keys of all shaders in the order they have been attached */
+    key = ShaderCache::HashString("VKShaderProgram");
+    for (auto shader : shaders_)
+    {
+        if (!shader->HasCacheKey())
+            return false;
+        key = ShaderCache::CombineKeys(key, shader->GetCacheKey());
+    }
+    return true;
+}
+
 
 } // /namespace LLGL
 
@@ -12,6 +12,7 @@
 #include <LLGL/ShaderProgram.h>
 #include "../Vulkan.h"
 #include "../VKPtr.h"
+#include "../../ShaderCache.h"
 #include <vector>
 
 
@@ -26,7 +27,7 @@ class VKShaderProgram final : public ShaderProgram
 
     public:
 
-        VKShaderProgram(const ShaderProgramDescriptor& desc);
+        VKShaderProgram(const ShaderProgramDescriptor& desc, ShaderCache* shaderCache = nullptr);
 
         bool HasErrors() const override;
         std::string GetReport() const override;
@@ -47,10 +48,16 @@ class VKShaderProgram final : public ShaderProgram
         void Attach(Shader* shader);
         void LinkProgram();
 
+        bool ReflectShaders(ShaderReflection& reflection) const;
+
+        // Returns true and the shader cache key if all attached shaders have a cache key.
+        bool GetCacheKey(ShaderCache::Key& key) const;
+
     private:
 
         std::vector<VKShader*>  shaders_;
-        LinkError               linkError_ = LinkError::NoError;
+        LinkError               linkError_      = LinkError::NoError;
+        ShaderCache*            shaderCache_    = nullptr;
 
 };
 
@@ -21,7 +21,8 @@ void VKColorBuffer::Create(
     VKDeviceMemoryManager&  deviceMemoryMngr,
     const Extent2D&         extent,
     VkFormat                format,
-    VkSampleCountFlagBits   sampleCountBits)
+    VkSampleCountFlagBits   sampleCountBits,
+    bool                    transient)
 {
     VKRenderBuffer::Create(
         deviceMemoryMngr,
@@ -29,7 +30,7 @@ void VKColorBuffer::Create(
         format,
         VK_IMAGE_ASPECT_COLOR_BIT,
         sampleCountBits,
-        VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT
+        (transient ? VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT : VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT)
     );
 }
 
@@ -31,7 +31,8 @@ class VKColorBuffer final : private VKRenderBuffer
             VKDeviceMemoryManager&  deviceMemoryMngr,
             const Extent2D&         extent,
             VkFormat                format,
-            VkSampleCountFlagBits   sampleCountBits
+            VkSampleCountFlagBits   sampleCountBits,
+            bool                    transient
         );
 
         void Release();
@@ -38,7 +38,8 @@ void VKDepthStencilBuffer::Create(
     VKDeviceMemoryManager&  deviceMemoryMngr,
     const Extent2D&         extent,
     VkFormat                format,
-    VkSampleCountFlagBits   sampleCountBits)
+    VkSampleCountFlagBits   sampleCountBits,
+    bool                    transient)
 {
     /* Determine image aspect */
     auto aspectFlags = GetVkImageAspectByFormat(format);
@@ -52,7 +53,7 @@ void VKDepthStencilBuffer::Create(
         format,
         aspectFlags,
         sampleCountBits,
-        VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT
+        (transient ? VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT : VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT)
     );
 }
 
@@ -27,7 +27,8 @@ class VKDepthStencilBuffer final : private VKRenderBuffer
             VKDeviceMemoryManager&  deviceMemoryMngr,
             const Extent2D&         extent,
             VkFormat                format,
-            VkSampleCountFlagBits   sampleCountBits
+            VkSampleCountFlagBits   sampleCountBits,
+            bool                    transient
         );
 
         void Release();
@@ -28,12 +28,21 @@ void VKDeviceImage::AllocateMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr
     VkMemoryRequirements requirements;
     vkGetImageMemoryRequirements(device, image_, &requirements);
 
+    /* Prefer lazily allocated memory for transient attachments, which might never be backed by physical memory on tile-based GPUs */
+    VkMemoryPropertyFlags properties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+
+    if ((usageFlags_ & VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT) != 0)
+    {
+        if (deviceMemoryMngr.HasMemoryType(requirements.memoryTypeBits, properties | VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT))
+            properties |= VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT;
+    }
+
     /* Allocate device memory */
     memoryRegion_ = deviceMemoryMngr.Allocate(
         requirements.size,
         requirements.alignment,
         requirements.memoryTypeBits,
-        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+        properties
     );
 
     /* Bind image to device memory region */
@@ -90,6 +99,9 @@ void VKDeviceImage::CreateVkImage(
     }
     VkResult result = vkCreateImage(device, &createInfo, nullptr, image_.ReleaseAndGetAddressOf());
     VKThrowIfCreateFailed(result, "VkImage");
+
+    /* Store usage flags to select memory type */
+    usageFlags_ = usageFlags;
 }
 
 void VKDeviceImage::ReleaseVkImage()
@@ -78,10 +78,17 @@ class VKDeviceImage
             return memoryRegion_;
         }
 
+        // Returns the usage flags whereby the VkImage object was created.
+        inline VkImageUsageFlags GetVkUsageFlags() const
+        {
+            return usageFlags_;
+        }
+
     private:
 
         VKPtr<VkImage>          image_;
         VKDeviceMemoryRegion*   memoryRegion_   = nullptr;
+        VkImageUsageFlags       usageFlags_     = 0;
 
 };
 
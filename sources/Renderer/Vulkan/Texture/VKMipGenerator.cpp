@@ -0,0 +1,499 @@
+/*
+ * VKMipGenerator.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "VKMipGenerator.h"
+#include "VKTexture.h"
+#include "../VKDevice.h"
+#include "../VKCore.h"
+#include "../RenderState/VKDescriptorPoolManager.h"
+#include "../Memory/VKDeviceMemoryManager.h"
+#include "../Shader/Builtin/VKBuiltin.h"
+#include <LLGL/Format.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+// Size of the tile in X and Y dimension that is reduced by each work group (see GenerateMips2D.comp)
+static const std::uint32_t g_mipGenTileSize         = 64;
+
+// Maximum number of MIP-map levels that are generated by a single dispatch (see GenerateMips2D.comp)
+static const std::uint32_t g_mipGenMaxLevels        = 12;
+
+// Number of MIP-map levels that are reduced per tile; only one tile of this level can be reduced into the remaining levels
+static const std::uint32_t g_mipGenLevelsPerTile    = 6;
+
+// Push constants of the compute shader (see GenerateMips2D.comp)
+struct MipGenParams
+{
+    std::int32_t srcSize[2];
+    std::int32_t numMips;
+    std::int32_t baseLayer;
+};
+
+VKMipGenerator::TextureMipChain::TextureMipChain(const VKPtr<VkDevice>& device) :
+    counterBuffer { device }
+{
+}
+
+VKMipGenerator::VKMipGenerator(
+    VkPhysicalDevice                physicalDevice,
+    const VkPhysicalDeviceFeatures& features,
+    VKDevice&                       device,
+    VKDeviceMemoryManager&          deviceMemoryMngr,
+    VKDescriptorPoolManager&        descriptorPoolMngr)
+:
+    physicalDevice_      { physicalDevice                                     },
+    device_              { device                                             },
+    deviceMemoryMngr_    { deviceMemoryMngr                                   },
+    descriptorPoolMngr_  { descriptorPoolMngr                                 },
+    descriptorSetLayout_ { device.GetVkDevice(), vkDestroyDescriptorSetLayout },
+    pipelineLayout_      { device.GetVkDevice(), vkDestroyPipelineLayout      },
+    pipeline_            { device.GetVkDevice(), vkDestroyPipeline            }
+{
+    /* The compute shader loads from and stores into images of unknown format */
+    storageWithoutFormat_ =
+    (
+        features.shaderStorageImageReadWithoutFormat  != VK_FALSE &&
+        features.shaderStorageImageWriteWithoutFormat != VK_FALSE
+    );
+
+    CreateDescriptorSetLayout();
+    CreatePipelineLayout();
+    CreatePipeline();
+}
+
+VKMipGenerator::~VKMipGenerator()
+{
+    for (auto& entry : mipChains_)
+        ReleaseMipChain(*entry.second);
+}
+
+bool VKMipGenerator::GenerateMips(
+    VkCommandBuffer             commandBuffer,
+    VKTexture&                  textureVK,
+    const TextureSubresource&   subresource)
+{
+    if (!IsTextureSupported(textureVK))
+        return false;
+
+    if (subresource.baseMipLevel >= textureVK.GetNumMipLevels() || subresource.baseArrayLayer >= textureVK.GetNumArrayLayers())
+        return true;
+
+    /* Clamp subresource range to the texture dimensions */
+    const std::uint32_t lastMipLevel    = std::min(subresource.baseMipLevel + subresource.numMipLevels, textureVK.GetNumMipLevels()) - 1;
+    const std::uint32_t numArrayLayers  = std::min(subresource.numArrayLayers, textureVK.GetNumArrayLayers() - subresource.baseArrayLayer);
+
+    if (lastMipLevel <= subresource.baseMipLevel || numArrayLayers == 0)
+    {
+        /* Nothing to generate, but still handled by this generator */
+        return true;
+    }
+
+    const auto& mipChain = GetOrCreateMipChain(textureVK);
+
+    /* Reset work group counters, since a previous command buffer that used them might never have been submitted */
+    const VkDeviceSize counterBufferSize = numArrayLayers * sizeof(std::uint32_t);
+    vkCmdFillBuffer(commandBuffer, mipChain.counterBuffer.GetVkBuffer(), 0, counterBufferSize, 0);
+
+    /* Transition entire subresource to VK_IMAGE_LAYOUT_GENERAL for loading and storing within the same dispatch */
+    VkMemoryBarrier memoryBarrier;
+    {
+        memoryBarrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        memoryBarrier.pNext         = nullptr;
+        memoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        memoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    }
+    VkImageMemoryBarrier barrier;
+    {
+        barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.pNext                           = nullptr;
+        barrier.srcAccessMask                   = VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.dstAccessMask                   = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+        barrier.oldLayout                       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        barrier.newLayout                       = VK_IMAGE_LAYOUT_GENERAL;
+        barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image                           = textureVK.GetVkImage();
+        barrier.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+        barrier.subresourceRange.baseMipLevel   = subresource.baseMipLevel;
+        barrier.subresourceRange.levelCount     = lastMipLevel - subresource.baseMipLevel + 1;
+        barrier.subresourceRange.baseArrayLayer = subresource.baseArrayLayer;
+        barrier.subresourceRange.layerCount     = numArrayLayers;
+    }
+    vkCmdPipelineBarrier(
+        commandBuffer,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
+        1, &memoryBarrier,
+        0, nullptr,
+        1, &barrier
+    );
+
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_);
+
+    /* Make the MIP-map levels and counters of each pass visible to the next pass */
+    memoryBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    memoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+
+    for (auto mipLevel = subresource.baseMipLevel; mipLevel < lastMipLevel;)
+    {
+        const auto extent = textureVK.GetMipExtent(mipLevel);
+
+        /* Only a single tile can be reduced beyond the first levels, so large MIP-maps need more than one pass */
+        std::uint32_t numMips = std::min(lastMipLevel - mipLevel, g_mipGenMaxLevels);
+        if (std::max(extent.width, extent.height) > (g_mipGenTileSize << g_mipGenLevelsPerTile))
+            numMips = std::min(numMips, g_mipGenLevelsPerTile);
+
+        MipGenParams params;
+        {
+            params.srcSize[0]   = static_cast<std::int32_t>(extent.width);
+            params.srcSize[1]   = static_cast<std::int32_t>(extent.height);
+            params.numMips      = static_cast<std::int32_t>(numMips);
+            params.baseLayer    = static_cast<std::int32_t>(subresource.baseArrayLayer);
+        }
+        vkCmdPushConstants(commandBuffer, pipelineLayout_, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(params), &params);
+
+        vkCmdBindDescriptorSets(
+            commandBuffer,
+            VK_PIPELINE_BIND_POINT_COMPUTE,
+            pipelineLayout_,
+            0,
+            1, &(mipChain.descriptorSets[mipLevel]),
+            0, nullptr
+        );
+
+        vkCmdDispatch(
+            commandBuffer,
+            (extent.width  + g_mipGenTileSize - 1) / g_mipGenTileSize,
+            (extent.height + g_mipGenTileSize - 1) / g_mipGenTileSize,
+            numArrayLayers
+        );
+
+        mipLevel += numMips;
+
+        if (mipLevel < lastMipLevel)
+        {
+            vkCmdPipelineBarrier(
+                commandBuffer,
+                VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
+                1, &memoryBarrier,
+                0, nullptr,
+                0, nullptr
+            );
+        }
+    }
+
+    /* Transition entire subresource back to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL */
+    barrier.srcAccessMask                   = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    barrier.dstAccessMask                   = VK_ACCESS_SHADER_READ_BIT;
+    barrier.oldLayout                       = VK_IMAGE_LAYOUT_GENERAL;
+    barrier.newLayout                       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+    vkCmdPipelineBarrier(
+        commandBuffer,
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0,
+        0, nullptr,
+        0, nullptr,
+        1, &barrier
+    );
+
+    return true;
+}
+
+void VKMipGenerator::ReleaseTexture(VKTexture& textureVK)
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+    auto it = mipChains_.find(&textureVK);
+    if (it != mipChains_.end())
+    {
+        ReleaseMipChain(*it->second);
+        mipChains_.erase(it);
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VKMipGenerator::CreateDescriptorSetLayout()
+{
+    /* Binding 0: source MIP-map level, binding 1: destination MIP-map levels, binding 2: work group counters */
+    VkDescriptorSetLayoutBinding bindings[3];
+    {
+        bindings[0].binding             = 0;
+        bindings[0].descriptorType      = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+        bindings[0].descriptorCount     = 1;
+        bindings[0].stageFlags          = VK_SHADER_STAGE_COMPUTE_BIT;
+        bindings[0].pImmutableSamplers  = nullptr;
+
+        bindings[1].binding             = 1;
+        bindings[1].descriptorType      = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+        bindings[1].descriptorCount     = g_mipGenMaxLevels;
+        bindings[1].stageFlags          = VK_SHADER_STAGE_COMPUTE_BIT;
+        bindings[1].pImmutableSamplers  = nullptr;
+
+        bindings[2].binding             = 2;
+        bindings[2].descriptorType      = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        bindings[2].descriptorCount     = 1;
+        bindings[2].stageFlags          = VK_SHADER_STAGE_COMPUTE_BIT;
+        bindings[2].pImmutableSamplers  = nullptr;
+    }
+    VkDescriptorSetLayoutCreateInfo createInfo;
+    {
+        createInfo.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        createInfo.pNext        = nullptr;
+        createInfo.flags        = 0;
+        createInfo.bindingCount = 3;
+        createInfo.pBindings    = bindings;
+    }
+    auto result = vkCreateDescriptorSetLayout(device_, &createInfo, nullptr, descriptorSetLayout_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan descriptor set layout for MIP-map generation");
+}
+
+void VKMipGenerator::CreatePipelineLayout()
+{
+    /* Push constants for the source MIP-map size, number of MIP-map levels, and base array layer */
+    VkPushConstantRange pushConstantRange;
+    {
+        pushConstantRange.stageFlags    = VK_SHADER_STAGE_COMPUTE_BIT;
+        pushConstantRange.offset        = 0;
+        pushConstantRange.size          = sizeof(MipGenParams);
+    }
+    VkPipelineLayoutCreateInfo createInfo;
+    {
+        createInfo.sType                    = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        createInfo.pNext                    = nullptr;
+        createInfo.flags                    = 0;
+        createInfo.setLayoutCount           = 1;
+        createInfo.pSetLayouts              = &descriptorSetLayout_;
+        createInfo.pushConstantRangeCount   = 1;
+        createInfo.pPushConstantRanges      = &pushConstantRange;
+    }
+    auto result = vkCreatePipelineLayout(device_, &createInfo, nullptr, pipelineLayout_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan pipeline layout for MIP-map generation");
+}
+
+void VKMipGenerator::CreatePipeline()
+{
+    /* Create temporary shader module from built-in SPIR-V module */
+    VKPtr<VkShaderModule> shaderModule { device_.GetVkDevice(), vkDestroyShaderModule };
+
+    VkShaderModuleCreateInfo moduleCreateInfo;
+    {
+        moduleCreateInfo.sType      = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        moduleCreateInfo.pNext      = nullptr;
+        moduleCreateInfo.flags      = 0;
+        moduleCreateInfo.codeSize   = sizeof(g_spirvGenerateMips2D);
+        moduleCreateInfo.pCode      = g_spirvGenerateMips2D;
+    }
+    auto result = vkCreateShaderModule(device_, &moduleCreateInfo, nullptr, shaderModule.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan shader module for MIP-map generation");
+
+    /* Create compute pipeline */
+    VkComputePipelineCreateInfo createInfo;
+    {
+        createInfo.sType                        = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+        createInfo.pNext                        = nullptr;
+        createInfo.flags                        = 0;
+        createInfo.stage.sType                  = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        createInfo.stage.pNext                  = nullptr;
+        createInfo.stage.flags                  = 0;
+        createInfo.stage.stage                  = VK_SHADER_STAGE_COMPUTE_BIT;
+        createInfo.stage.module                 = shaderModule;
+        createInfo.stage.pName                  = "main";
+        createInfo.stage.pSpecializationInfo    = nullptr;
+        createInfo.layout                       = pipelineLayout_;
+        createInfo.basePipelineHandle           = VK_NULL_HANDLE;
+        createInfo.basePipelineIndex            = 0;
+    }
+    result = vkCreateComputePipelines(device_, VK_NULL_HANDLE, 1, &createInfo, nullptr, pipeline_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan compute pipeline for MIP-map generation");
+}
+
+static bool IsMipGenTextureType(const TextureType type)
+{
+    switch (type)
+    {
+        case TextureType::Texture2D:
+        case TextureType::Texture2DArray:
+        case TextureType::TextureCube:
+        case TextureType::TextureCubeArray:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool VKMipGenerator::IsTextureSupported(const VKTexture& textureVK)
+{
+    if (!storageWithoutFormat_)
+        return false;
+
+    /* Only 2D textures (and their array and cube variants) that can be sampled and stored are supported */
+    const VkImageUsageFlags requiredUsage = (VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_STORAGE_BIT);
+    if (!IsMipGenTextureType(textureVK.GetType()) || (textureVK.GetVkUsageFlags() & requiredUsage) != requiredUsage)
+        return false;
+
+    /* Integer and depth-stencil formats cannot be loaded as floating-point images */
+    const auto format = textureVK.GetFormat();
+    if (IsIntegralFormat(format) || IsDepthStencilFormat(format))
+        return false;
+
+    /* Query format support only once per format */
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    auto it = formatSupport_.find(textureVK.GetVkFormat());
+    if (it != formatSupport_.end())
+        return it->second;
+
+    VkFormatProperties formatProperties;
+    vkGetPhysicalDeviceFormatProperties(physicalDevice_, textureVK.GetVkFormat(), &formatProperties);
+
+    const bool supported = ((formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT) != 0);
+
+    formatSupport_[textureVK.GetVkFormat()] = supported;
+
+    return supported;
+}
+
+const VKMipGenerator::TextureMipChain& VKMipGenerator::GetOrCreateMipChain(VKTexture& textureVK)
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    auto& mipChain = mipChains_[&textureVK];
+    if (mipChain)
+        return *mipChain;
+
+    mipChain = std::unique_ptr<TextureMipChain>(new TextureMipChain{ device_.GetVkDevice() });
+
+    const auto numMipLevels     = textureVK.GetNumMipLevels();
+    const auto numArrayLayers   = textureVK.GetNumArrayLayers();
+
+    /* Create one 2D-array view per MIP-map level; cube textures are processed as arrays of six faces */
+    mipChain->mipLevelViews.reserve(numMipLevels);
+
+    for (std::uint32_t mipLevel = 0; mipLevel < numMipLevels; ++mipLevel)
+    {
+        TextureViewDescriptor viewDesc;
+        {
+            viewDesc.type                       = TextureType::Texture2DArray;
+            viewDesc.format                     = textureVK.GetFormat();
+            viewDesc.subresource.baseArrayLayer = 0;
+            viewDesc.subresource.numArrayLayers = numArrayLayers;
+            viewDesc.subresource.baseMipLevel   = mipLevel;
+            viewDesc.subresource.numMipLevels   = 1;
+        }
+        mipChain->mipLevelViews.emplace_back(device_.GetVkDevice(), vkDestroyImageView);
+        textureVK.CreateImageView(device_, viewDesc, mipChain->mipLevelViews.back().ReleaseAndGetAddressOf());
+    }
+
+    /* Create buffer for one work group counter per array layer */
+    VkBufferCreateInfo bufferCreateInfo;
+    {
+        bufferCreateInfo.sType                  = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        bufferCreateInfo.pNext                  = nullptr;
+        bufferCreateInfo.flags                  = 0;
+        bufferCreateInfo.size                   = numArrayLayers * sizeof(std::uint32_t);
+        bufferCreateInfo.usage                  = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+        bufferCreateInfo.sharingMode            = VK_SHARING_MODE_EXCLUSIVE;
+        bufferCreateInfo.queueFamilyIndexCount  = 0;
+        bufferCreateInfo.pQueueFamilyIndices    = nullptr;
+    }
+    mipChain->counterBuffer.CreateVkBufferAndMemoryRegion(
+        device_.GetVkDevice(),
+        bufferCreateInfo,
+        deviceMemoryMngr_,
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+    );
+
+    /* Allocate one descriptor set per MIP-map level that can be the source of a dispatch */
+    const std::uint32_t numSets = numMipLevels - 1;
+
+    const VkDescriptorPoolSize poolSizes[2] =
+    {
+        { VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,  1 + g_mipGenMaxLevels },
+        { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1                     },
+    };
+
+    mipChain->descriptorSets.resize(numSets);
+    mipChain->descriptorPool = descriptorPoolMngr_.AllocateDescriptorSets(2, poolSizes, descriptorSetLayout_, numSets, mipChain->descriptorSets.data());
+
+    /* Write image views into descriptor sets; destination levels beyond the last MIP-map level refer to the last MIP-map level */
+    VkDescriptorBufferInfo bufferInfo;
+    {
+        bufferInfo.buffer   = mipChain->counterBuffer.GetVkBuffer();
+        bufferInfo.offset   = 0;
+        bufferInfo.range    = VK_WHOLE_SIZE;
+    }
+
+    std::vector<VkDescriptorImageInfo> imageInfos(numSets * (1 + g_mipGenMaxLevels));
+    std::vector<VkWriteDescriptorSet> writeDescs;
+    writeDescs.reserve(numSets * 3);
+
+    for (std::uint32_t setIndex = 0; setIndex < numSets; ++setIndex)
+    {
+        auto* setImageInfos = &imageInfos[setIndex * (1 + g_mipGenMaxLevels)];
+
+        for (std::uint32_t i = 0; i <= g_mipGenMaxLevels; ++i)
+        {
+            auto& imageInfo = setImageInfos[i];
+            {
+                imageInfo.sampler       = VK_NULL_HANDLE;
+                imageInfo.imageView     = mipChain->mipLevelViews[std::min(setIndex + i, numMipLevels - 1)];
+                imageInfo.imageLayout   = VK_IMAGE_LAYOUT_GENERAL;
+            }
+        }
+
+        for (std::uint32_t binding = 0; binding < 3; ++binding)
+        {
+            VkWriteDescriptorSet writeDesc;
+            {
+                writeDesc.sType             = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+                writeDesc.pNext             = nullptr;
+                writeDesc.dstSet            = mipChain->descriptorSets[setIndex];
+                writeDesc.dstBinding        = binding;
+                writeDesc.dstArrayElement   = 0;
+                writeDesc.descriptorCount   = (binding == 1 ? g_mipGenMaxLevels : 1);
+                writeDesc.descriptorType    = (binding == 2 ? VK_DESCRIPTOR_TYPE_STORAGE_BUFFER : VK_DESCRIPTOR_TYPE_STORAGE_IMAGE);
+                writeDesc.pImageInfo        = (binding == 2 ? nullptr : &setImageInfos[binding]);
+                writeDesc.pBufferInfo       = (binding == 2 ? &bufferInfo : nullptr);
+                writeDesc.pTexelBufferView  = nullptr;
+            }
+            writeDescs.push_back(writeDesc);
+        }
+    }
+
+    vkUpdateDescriptorSets(device_, static_cast<std::uint32_t>(writeDescs.size()), writeDescs.data(), 0, nullptr);
+
+    return *mipChain;
+}
+
+void VKMipGenerator::ReleaseMipChain(TextureMipChain& mipChain)
+{
+    /* Descriptor sets are recycled once the GPU no longer uses them */
+    if (!mipChain.descriptorSets.empty())
+    {
+        descriptorPoolMngr_.ReleaseDescriptorSets(
+            mipChain.descriptorPool,
+            static_cast<std::uint32_t>(mipChain.descriptorSets.size()),
+            mipChain.descriptorSets.data()
+        );
+        mipChain.descriptorSets.clear();
+    }
+    mipChain.counterBuffer.ReleaseMemoryRegion(deviceMemoryMngr_);
+    mipChain.mipLevelViews.clear();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
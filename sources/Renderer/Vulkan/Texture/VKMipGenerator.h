@@ -0,0 +1,118 @@
+/*
+ * VKMipGenerator.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VK_MIP_GENERATOR_H
+#define LLGL_VK_MIP_GENERATOR_H
+
+
+#include <LLGL/TextureFlags.h>
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include "../Buffer/VKDeviceBuffer.h"
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class VKDevice;
+class VKTexture;
+class VKDescriptorPoolManager;
+class VKDeviceMemoryManager;
+
+/*
+Vulkan MIP-map generator with a single-pass compute shader (see RendererConfigurationVulkan::computeMips).
+Each dispatch generates up to 12 MIP-map levels of all selected array layers (see GenerateMips2D.comp).
+The image views, descriptor sets, and work group counters for a texture are created on first use and kept until the texture is released.
+*/
+class VKMipGenerator
+{
+
+    public:
+
+        VKMipGenerator(
+            VkPhysicalDevice                physicalDevice,
+            const VkPhysicalDeviceFeatures& features,
+            VKDevice&                       device,
+            VKDeviceMemoryManager&          deviceMemoryMngr,
+            VKDescriptorPoolManager&        descriptorPoolMngr
+        );
+        ~VKMipGenerator();
+
+        VKMipGenerator(const VKMipGenerator&) = delete;
+        VKMipGenerator& operator = (const VKMipGenerator&) = delete;
+
+        /*
+        Records the MIP-map generation for the specified texture subresource with the compute shader.
+        The subresource must be in VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL and is left in that layout.
+        Returns false if the texture is not supported, in which case nothing is recorded and the caller must fall back to image blits.
+        */
+        bool GenerateMips(
+            VkCommandBuffer             commandBuffer,
+            VKTexture&                  textureVK,
+            const TextureSubresource&   subresource
+        );
+
+        // Releases the image views and descriptor sets that were created for the specified texture.
+        void ReleaseTexture(VKTexture& textureVK);
+
+    private:
+
+        struct TextureMipChain
+        {
+            TextureMipChain(const VKPtr<VkDevice>& device);
+
+            std::vector<VKPtr<VkImageView>> mipLevelViews;      // One 2D-array view per MIP-map level
+            VKDeviceBuffer                  counterBuffer;      // One work group counter per array layer
+            VkDescriptorPool                descriptorPool  = VK_NULL_HANDLE;
+            std::vector<VkDescriptorSet>    descriptorSets;     // Set N reads MIP-map level N and writes MIP-map levels N+1 to N+12
+        };
+
+    private:
+
+        void CreateDescriptorSetLayout();
+        void CreatePipelineLayout();
+        void CreatePipeline();
+
+        bool IsTextureSupported(const VKTexture& textureVK);
+
+        // Returns the MIP-map chain of the specified texture and creates it on demand.
+        const TextureMipChain& GetOrCreateMipChain(VKTexture& textureVK);
+
+        void ReleaseMipChain(TextureMipChain& mipChain);
+
+    private:
+
+        VkPhysicalDevice                                              physicalDevice_         = VK_NULL_HANDLE;
+        VKDevice&                                                     device_;
+        VKDeviceMemoryManager&                                        deviceMemoryMngr_;
+        VKDescriptorPoolManager&                                      descriptorPoolMngr_;
+        bool                                                          storageWithoutFormat_   = false;
+
+        VKPtr<VkDescriptorSetLayout>                                  descriptorSetLayout_;
+        VKPtr<VkPipelineLayout>                                       pipelineLayout_;
+        VKPtr<VkPipeline>                                             pipeline_;
+
+        std::map<VkFormat, bool>                                      formatSupport_;
+        std::map<const VKTexture*, std::unique_ptr<TextureMipChain>>  mipChains_;
+        std::mutex                                                    mutex_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
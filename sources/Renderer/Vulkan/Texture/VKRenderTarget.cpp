@@ -110,7 +110,7 @@ static bool HasStencilComponent(const AttachmentType type)
     return (type == AttachmentType::Stencil || type == AttachmentType::DepthStencil);
 }
 
-void VKRenderTarget::CreateDepthStencilForAttachment(VKDeviceMemoryManager& deviceMemoryMngr, const AttachmentDescriptor& attachmentDesc)
+void VKRenderTarget::CreateDepthStencilForAttachment(VKDeviceMemoryManager& deviceMemoryMngr, const AttachmentDescriptor& attachmentDesc, bool transient)
 {
     /* Create depth-stencil buffer */
     if (depthStencilBuffer_.GetVkFormat() == VK_FORMAT_UNDEFINED)
@@ -119,7 +119,8 @@ void VKRenderTarget::CreateDepthStencilForAttachment(VKDeviceMemoryManager& devi
             deviceMemoryMngr,
             GetResolution(),
             GetDepthAttachmentVkFormat(attachmentDesc.type),
-            sampleCountBits_
+            sampleCountBits_,
+            transient
         );
     }
     else
@@ -190,6 +191,15 @@ void VKRenderTarget::CreateRenderPass(
                 loadContent
             );
 
+            /* Discard content of transient textures at the end of the render pass */
+            if (textureVK->IsTransient())
+            {
+                VKConvertToTransientAttachment(
+                    attachmentDescs[numColorAttachments],
+                    (attachment.type == AttachmentType::Color ? VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL : VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL)
+                );
+            }
+
             if (attachment.type == AttachmentType::Color)
                 colorFormats[numColorAttachments++] = textureVK->GetVkFormat();
         }
@@ -203,6 +213,10 @@ void VKRenderTarget::CreateRenderPass(
                 sampleCountBits_,
                 loadContent
             );
+
+            /* Discard content of internal depth-stencil buffer at the end of the render pass */
+            if (desc.transientAttachments)
+                VKConvertToTransientAttachment(attachmentDescs[numAttachments - 1], VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL);
         }
     }
 
@@ -220,6 +234,10 @@ void VKRenderTarget::CreateRenderPass(
                 sampleCountBits_,
                 loadContent
             );
+
+            /* Discard content of multi-sampled color buffers after they have been resolved */
+            if (desc.transientAttachments)
+                VKConvertToTransientAttachment(attachmentDescs[numAttachments + i], VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
         }
 
         /* Modify original attachment descriptors */
@@ -306,7 +324,7 @@ void VKRenderTarget::CreateFramebuffer(
         else
         {
             /* Create depth-stencil buffer */
-            CreateDepthStencilForAttachment(deviceMemoryMngr, attachment);
+            CreateDepthStencilForAttachment(deviceMemoryMngr, attachment, desc.transientAttachments);
 
             /* Add depth-stencil image view to attachments */
             imageViewRefs[numAttachments - 1] = depthStencilBuffer_.GetVkImageView();
@@ -327,7 +345,7 @@ void VKRenderTarget::CreateFramebuffer(
             /* Create new multi-sampled color buffer and store reference to image view in primary attachment container */
             auto colorBuffer = MakeUnique<VKColorBuffer>(device);
             {
-                colorBuffer->Create(deviceMemoryMngr, GetResolution(), colorFormats[i], sampleCountBits_);
+                colorBuffer->Create(deviceMemoryMngr, GetResolution(), colorFormats[i], sampleCountBits_, desc.transientAttachments);
                 imageViewRefs.push_back(colorBuffer->GetVkImageView());
             }
             colorBuffers_.push_back(std::move(colorBuffer));
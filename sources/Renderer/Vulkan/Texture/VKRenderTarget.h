@@ -73,7 +73,7 @@ class VKRenderTarget final : public RenderTarget
 
     private:
 
-        void CreateDepthStencilForAttachment(VKDeviceMemoryManager& deviceMemoryMngr, const AttachmentDescriptor& attachmentDesc);
+        void CreateDepthStencilForAttachment(VKDeviceMemoryManager& deviceMemoryMngr, const AttachmentDescriptor& attachmentDesc, bool transient);
 
         void CreateRenderPass(
             VkDevice                        device,
@@ -114,6 +114,9 @@ TextureDescriptor VKTexture::GetDesc() const
             break;
     }
 
+    if (IsTransient())
+        texDesc.miscFlags |= MiscFlags::Transient;
+
     return texDesc;
 }
 
@@ -300,6 +303,15 @@ static VkSampleCountFlagBits GetVkImageSampleCountFlags(const TextureDescriptor&
 
 static VkImageUsageFlags GetVkImageUsageFlags(const TextureDescriptor& desc)
 {
+    /* Transient attachments must not have any other usage than attachments */
+    if ((desc.miscFlags & MiscFlags::Transient) != 0)
+    {
+        if ((desc.bindFlags & BindFlags::ColorAttachment) != 0)
+            return (VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT);
+        if ((desc.bindFlags & BindFlags::DepthStencilAttachment) != 0)
+            return (VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT);
+    }
+
     VkImageUsageFlags usageFlags = VK_IMAGE_USAGE_TRANSFER_DST_BIT;
 
     /* Enable TRANSFER_SRC_BIT image usage when MIP-maps are enabled */
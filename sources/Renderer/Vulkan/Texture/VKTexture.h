@@ -89,6 +89,12 @@ class VKTexture final : public Texture
             return extent_;
         }
 
+        // Returns the VkImageUsageFlags with whereby the VkImage object was created.
+        inline VkImageUsageFlags GetVkUsageFlags() const
+        {
+            return imageWrapper_.GetVkUsageFlags();
+        }
+
         // Returns the number of MIP level with whereby the VkImage object was created.
         inline std::uint32_t GetNumMipLevels() const
         {
@@ -107,6 +113,12 @@ class VKTexture final : public Texture
             return imageWrapper_.GetMemoryRegion();
         }
 
+        // Returns true if this texture was created as transient attachment (see MiscFlags::Transient).
+        inline bool IsTransient() const
+        {
+            return ((imageWrapper_.GetVkUsageFlags() & VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT) != 0);
+        }
+
     private:
 
         void CreateImage(VkDevice device, const TextureDescriptor& desc);
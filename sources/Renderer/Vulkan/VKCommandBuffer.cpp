@@ -18,6 +18,7 @@
 #include "RenderState/VKPredicateQueryHeap.h"
 #include "Texture/VKSampler.h"
 #include "Texture/VKTexture.h"
+#include "Texture/VKMipGenerator.h"
 #include "Texture/VKRenderTarget.h"
 #include "Buffer/VKBuffer.h"
 #include "Buffer/VKBufferArray.h"
@@ -54,12 +55,12 @@ static std::uint32_t GetNumVkCommandBuffers(const CommandBufferDescriptor& desc)
 VKCommandBuffer::VKCommandBuffer(
     const VKPhysicalDevice&         physicalDevice,
     VKDevice&                       device,
-    VkQueue                         graphicsQueue,
     const QueueFamilyIndices&       queueFamilyIndices,
-    const CommandBufferDescriptor&  desc)
+    const CommandBufferDescriptor&  desc,
+    VKMipGenerator*                 mipGenerator)
 :
     device_               { device                                  },
-    commandPool_          { device, vkDestroyCommandPool            },
+    mipGenerator_         { mipGenerator                            },
     queuePresentFamily_   { queueFamilyIndices.presentFamily        },
     maxDrawIndirectCount_ { GetMaxDrawIndirectCount(physicalDevice) }
 {
@@ -68,6 +69,20 @@ VKCommandBuffer::VKCommandBuffer(
     {
         usageFlags_     = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
         bufferLevel_    = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+
+        /* Store render pass the secondary command buffer is executed in */
+        if (desc.renderPass != nullptr)
+        {
+            auto renderPassVK = LLGL_CAST(const VKRenderPass*, desc.renderPass);
+            usageFlags_             |= VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+            inheritanceRenderPass_  = renderPassVK->GetVkRenderPass();
+            numColorAttachments_    = renderPassVK->GetNumColorAttachments();
+            hasDSVAttachment_       = (renderPassVK->GetDepthStencilIndex() != 0xFF);
+
+            /* Framebuffer is unknown while recording, so default scissor covers maximum framebuffer size */
+            const auto& limits = physicalDevice.GetProperties().limits;
+            framebufferExtent_ = { limits.maxFramebufferWidth, limits.maxFramebufferHeight };
+        }
     }
     else if ((desc.flags & CommandBufferFlags::MultiSubmit) != 0)
         usageFlags_ = 0;
@@ -76,9 +91,9 @@ VKCommandBuffer::VKCommandBuffer(
     const auto bufferCount = GetNumVkCommandBuffers(desc);
 
     /* Create native command buffer objects */
-    CreateCommandPool(queueFamilyIndices.graphicsFamily);
+    CreateCommandPools(bufferCount, (desc.flags & CommandBufferFlags::MultiSubmit) == 0);
     CreateCommandBuffers(bufferCount);
-    CreateRecordingFences(graphicsQueue, bufferCount);
+    CreateRecordingFences(bufferCount);
 
     /* Acquire first native command buffer */
     AcquireNextBuffer();
@@ -86,12 +101,8 @@ VKCommandBuffer::VKCommandBuffer(
 
 VKCommandBuffer::~VKCommandBuffer()
 {
-    vkFreeCommandBuffers(
-        device_,
-        commandPool_,
-        static_cast<std::uint32_t>(commandBufferList_.size()),
-        commandBufferList_.data()
-    );
+    for (std::size_t i = 0; i < commandBufferList_.size(); ++i)
+        vkFreeCommandBuffers(device_, commandPoolList_[i], 1, &commandBufferList_[i]);
 }
 
 /* ----- Encoding ----- */
@@ -101,19 +112,43 @@ void VKCommandBuffer::Begin()
     /* Use next internal VkCommandBuffer object to reduce latency */
     AcquireNextBuffer();
 
-    /* Wait for fence before recording */
-    vkWaitForFences(device_, 1, &recordingFence_, VK_TRUE, UINT64_MAX);
-    vkResetFences(device_, 1, &recordingFence_);
+    /*
+    Wait for fence before recording (only for primary command buffers),
+    secondary command buffers are never submitted to a queue, so their lifetime is bound to the primary command buffers they are executed in.
+    The client must not encode a secondary command buffer again while such a primary command buffer is still in flight (see CommandBufferFlags::DeferredSubmit),
+    otherwise its command pool would be reset while the GPU still reads from it.
+    */
+    if (!IsSecondaryCmdBuffer())
+    {
+        vkWaitForFences(device_, 1, &recordingFence_, VK_TRUE, UINT64_MAX);
+        vkResetFences(device_, 1, &recordingFence_);
+    }
+
+    /* Reset all command buffer memory of this frame in bulk */
+    auto result = vkResetCommandPool(device_, commandPool_, 0);
+    VKThrowIfFailed(result, "failed to reset Vulkan command pool");
 
     /* Begin recording of current command buffer */
+    VkCommandBufferInheritanceInfo inheritanceInfo;
+    {
+        inheritanceInfo.sType                   = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        inheritanceInfo.pNext                   = nullptr;
+        inheritanceInfo.renderPass              = inheritanceRenderPass_;
+        inheritanceInfo.subpass                 = 0;
+        inheritanceInfo.framebuffer             = VK_NULL_HANDLE;
+        inheritanceInfo.occlusionQueryEnable    = VK_FALSE;
+        inheritanceInfo.queryFlags              = 0;
+        inheritanceInfo.pipelineStatistics      = 0;
+    }
+
     VkCommandBufferBeginInfo beginInfo;
     {
         beginInfo.sType             = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
         beginInfo.pNext             = nullptr;
         beginInfo.flags             = usageFlags_;
-        beginInfo.pInheritanceInfo  = nullptr;
+        beginInfo.pInheritanceInfo  = (IsSecondaryCmdBuffer() ? &inheritanceInfo : nullptr);
     }
-    auto result = vkBeginCommandBuffer(commandBuffer_, &beginInfo);
+    result = vkBeginCommandBuffer(commandBuffer_, &beginInfo);
     VKThrowIfFailed(result, "failed to begin Vulkan command buffer");
 
     #if 0//TODO: optimize
@@ -121,8 +156,14 @@ void VKCommandBuffer::Begin()
     ResetQueryPoolsInFlight();
     #endif
 
-    /* Store new record state */
-    recordState_ = RecordState::OutsideRenderPass;
+    /* Store new record state (secondary command buffers continue the render pass of their primary command buffer) */
+    if (inheritanceRenderPass_ != VK_NULL_HANDLE)
+    {
+        recordState_            = RecordState::InsideRenderPass;
+        scissorRectInvalidated_ = true;
+    }
+    else
+        recordState_ = RecordState::OutsideRenderPass;
 }
 
 void VKCommandBuffer::End()
@@ -139,7 +180,26 @@ void VKCommandBuffer::Execute(CommandBuffer& deferredCommandBuffer)
 {
     auto& cmdBufferVK = LLGL_CAST(VKCommandBuffer&, deferredCommandBuffer);
     VkCommandBuffer cmdBuffers[] = { cmdBufferVK.GetVkCommandBuffer() };
-    vkCmdExecuteCommands(commandBuffer_, 1, cmdBuffers);
+
+    if (IsInsideRenderPass())
+    {
+        /*
+        Active render pass was begun with inline contents,
+        so secondary command buffers are executed within a render pass instance of their own
+        */
+        PauseRenderPass();
+        if (cmdBufferVK.IsInheritingRenderPass())
+        {
+            ResumeRenderPass(VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+            vkCmdExecuteCommands(commandBuffer_, 1, cmdBuffers);
+            PauseRenderPass();
+        }
+        else
+            vkCmdExecuteCommands(commandBuffer_, 1, cmdBuffers);
+        ResumeRenderPass();
+    }
+    else
+        vkCmdExecuteCommands(commandBuffer_, 1, cmdBuffers);
 }
 
 /* ----- Blitting ----- */
@@ -330,13 +390,17 @@ void VKCommandBuffer::CopyTextureFromBuffer(
 void VKCommandBuffer::GenerateMips(Texture& texture)
 {
     auto& textureVK = LLGL_CAST(VKTexture&, texture);
-    device_.GenerateMips(
-        commandBuffer_,
-        textureVK.GetVkImage(),
-        textureVK.GetVkFormat(),
-        textureVK.GetVkExtent(),
-        TextureSubresource{ 0, textureVK.GetNumArrayLayers(), 0, textureVK.GetNumMipLevels() }
-    );
+    const TextureSubresource subresource{ 0, textureVK.GetNumArrayLayers(), 0, textureVK.GetNumMipLevels() };
+    if (mipGenerator_ == nullptr || !mipGenerator_->GenerateMips(commandBuffer_, textureVK, subresource))
+    {
+        device_.GenerateMips(
+            commandBuffer_,
+            textureVK.GetVkImage(),
+            textureVK.GetVkFormat(),
+            textureVK.GetVkExtent(),
+            subresource
+        );
+    }
 }
 
 void VKCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource& subresource)
@@ -349,13 +413,16 @@ void VKCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource& s
     if (subresource.baseMipLevel   < maxNumMipLevels   && subresource.numMipLevels   > 0 &&
         subresource.baseArrayLayer < maxNumArrayLayers && subresource.numArrayLayers > 0)
     {
-        device_.GenerateMips(
-            commandBuffer_,
-            textureVK.GetVkImage(),
-            textureVK.GetVkFormat(),
-            textureVK.GetVkExtent(),
-            subresource
-        );
+        if (mipGenerator_ == nullptr || !mipGenerator_->GenerateMips(commandBuffer_, textureVK, subresource))
+        {
+            device_.GenerateMips(
+                commandBuffer_,
+                textureVK.GetVkImage(),
+                textureVK.GetVkFormat(),
+                textureVK.GetVkExtent(),
+                subresource
+            );
+        }
     }
 }
 
@@ -814,6 +881,10 @@ void VKCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
 
     query *= queryHeapVK.GetGroupSize();
 
+    /* Reset query before it is reused; this is only allowed outside of a render pass */
+    if (recordState_ == RecordState::OutsideRenderPass)
+        vkCmdResetQueryPool(commandBuffer_, queryHeapVK.GetVkQueryPool(), query, queryHeapVK.GetGroupSize());
+
     if (queryHeapVK.GetType() == QueryType::TimeElapsed)
     {
         /* Record first timestamp */
@@ -1064,46 +1135,47 @@ void VKCommandBuffer::SetGraphicsAPIDependentState(const void* stateDesc, std::s
  * ======= Private: =======
  */
 
-void VKCommandBuffer::CreateCommandPool(std::uint32_t queueFamilyIndex)
+void VKCommandBuffer::CreateCommandPools(std::uint32_t poolCount, bool transient)
 {
-    /* Create command pool */
-    VkCommandPoolCreateInfo createInfo;
-    {
-        createInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-        createInfo.pNext            = nullptr;
-        createInfo.flags            = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-        createInfo.queueFamilyIndex = queueFamilyIndex;
-    }
-    auto result = vkCreateCommandPool(device_, &createInfo, nullptr, commandPool_.ReleaseAndGetAddressOf());
-    VKThrowIfFailed(result, "failed to create Vulkan command pool");
+    /*
+    Create one command pool per native command buffer,
+    so each frame can be reset in bulk once its recording fence has been signaled
+    */
+    commandPoolList_.reserve(poolCount);
+    for (std::uint32_t i = 0; i < poolCount; ++i)
+        commandPoolList_.emplace_back(device_.CreateCommandPool(transient ? VK_COMMAND_POOL_CREATE_TRANSIENT_BIT : 0));
 }
 
 void VKCommandBuffer::CreateCommandBuffers(std::uint32_t bufferCount)
 {
-    /* Allocate command buffers */
+    /* Allocate one command buffer from each command pool */
     commandBufferList_.resize(bufferCount);
 
-    VkCommandBufferAllocateInfo allocInfo;
+    for (std::uint32_t i = 0; i < bufferCount; ++i)
     {
-        allocInfo.sType                 = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-        allocInfo.pNext                 = nullptr;
-        allocInfo.commandPool           = commandPool_;
-        allocInfo.level                 = bufferLevel_;
-        allocInfo.commandBufferCount    = bufferCount;
+        VkCommandBufferAllocateInfo allocInfo;
+        {
+            allocInfo.sType                 = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocInfo.pNext                 = nullptr;
+            allocInfo.commandPool           = commandPoolList_[i];
+            allocInfo.level                 = bufferLevel_;
+            allocInfo.commandBufferCount    = 1;
+        }
+        auto result = vkAllocateCommandBuffers(device_, &allocInfo, &commandBufferList_[i]);
+        VKThrowIfFailed(result, "failed to allocate Vulkan command buffers");
     }
-    auto result = vkAllocateCommandBuffers(device_, &allocInfo, commandBufferList_.data());
-    VKThrowIfFailed(result, "failed to allocate Vulkan command buffers");
 }
 
-void VKCommandBuffer::CreateRecordingFences(VkQueue graphicsQueue, std::uint32_t numFences)
+void VKCommandBuffer::CreateRecordingFences(std::uint32_t numFences)
 {
     recordingFenceList_.reserve(numFences);
 
+    /* Create fences in signaled state, so the first recording does not wait */
     VkFenceCreateInfo createInfo;
     {
         createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
         createInfo.pNext = nullptr;
-        createInfo.flags = 0;
+        createInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
     }
 
     for (std::uint32_t i = 0; i < numFences; ++i)
@@ -1113,9 +1185,6 @@ void VKCommandBuffer::CreateRecordingFences(VkQueue graphicsQueue, std::uint32_t
             /* Create fence for command buffer recording */
             auto result = vkCreateFence(device_, &createInfo, nullptr, fence.ReleaseAndGetAddressOf());
             VKThrowIfFailed(result, "failed to create Vulkan fence");
-
-            /* Initial fence signal */
-            vkQueueSubmit(graphicsQueue, 0, nullptr, fence);
         }
         recordingFenceList_.emplace_back(std::move(fence));
     }
@@ -1201,7 +1270,7 @@ void VKCommandBuffer::PauseRenderPass()
     vkCmdEndRenderPass(commandBuffer_);
 }
 
-void VKCommandBuffer::ResumeRenderPass()
+void VKCommandBuffer::ResumeRenderPass(VkSubpassContents contents)
 {
     /* Record begin of render pass */
     VkRenderPassBeginInfo beginInfo;
@@ -1215,7 +1284,7 @@ void VKCommandBuffer::ResumeRenderPass()
         beginInfo.clearValueCount   = 0;
         beginInfo.pClearValues      = nullptr;
     }
-    vkCmdBeginRenderPass(commandBuffer_, &beginInfo, VK_SUBPASS_CONTENTS_INLINE);
+    vkCmdBeginRenderPass(commandBuffer_, &beginInfo, contents);
 }
 
 bool VKCommandBuffer::IsInsideRenderPass() const
@@ -1223,10 +1292,16 @@ bool VKCommandBuffer::IsInsideRenderPass() const
     return (recordState_ == RecordState::InsideRenderPass);
 }
 
+bool VKCommandBuffer::IsSecondaryCmdBuffer() const
+{
+    return (bufferLevel_ == VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+}
+
 void VKCommandBuffer::AcquireNextBuffer()
 {
     commandBufferIndex_ = (commandBufferIndex_ + 1) % commandBufferList_.size();
     commandBuffer_      = commandBufferList_[commandBufferIndex_];
+    commandPool_        = commandPoolList_[commandBufferIndex_].Get();
     recordingFence_     = recordingFenceList_[commandBufferIndex_].Get();
 }
 
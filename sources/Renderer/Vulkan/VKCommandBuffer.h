@@ -26,6 +26,7 @@ class VKPhysicalDevice;
 class VKResourceHeap;
 class VKRenderPass;
 class VKQueryHeap;
+class VKMipGenerator;
 
 class VKCommandBuffer final : public CommandBuffer
 {
@@ -37,9 +38,9 @@ class VKCommandBuffer final : public CommandBuffer
         VKCommandBuffer(
             const VKPhysicalDevice&         physicalDevice,
             VKDevice&                       device,
-            VkQueue                         graphicsQueue,
             const QueueFamilyIndices&       queueFamilyIndices,
-            const CommandBufferDescriptor&  desc
+            const CommandBufferDescriptor&  desc,
+            VKMipGenerator*                 mipGenerator = nullptr
         );
         ~VKCommandBuffer();
 
@@ -244,6 +245,12 @@ class VKCommandBuffer final : public CommandBuffer
             return recordingFence_;
         }
 
+        // Returns true if this is a secondary command buffer that continues the render pass of its primary command buffer.
+        inline bool IsInheritingRenderPass() const
+        {
+            return (inheritanceRenderPass_ != VK_NULL_HANDLE);
+        }
+
     private:
 
         enum class RecordState
@@ -256,9 +263,9 @@ class VKCommandBuffer final : public CommandBuffer
 
     private:
 
-        void CreateCommandPool(std::uint32_t queueFamilyIndex);
+        void CreateCommandPools(std::uint32_t poolCount, bool transient);
         void CreateCommandBuffers(std::uint32_t bufferCount);
-        void CreateRecordingFences(VkQueue graphicsQueue, std::uint32_t numFences);
+        void CreateRecordingFences(std::uint32_t numFences);
 
         void ClearFramebufferAttachments(std::uint32_t numAttachments, const VkClearAttachment* attachments);
 
@@ -271,9 +278,10 @@ class VKCommandBuffer final : public CommandBuffer
         );
 
         void PauseRenderPass();
-        void ResumeRenderPass();
+        void ResumeRenderPass(VkSubpassContents contents = VK_SUBPASS_CONTENTS_INLINE);
 
         bool IsInsideRenderPass() const;
+        bool IsSecondaryCmdBuffer() const;
 
         void BindResourceHeap(VKResourceHeap& resourceHeapVK, VkPipelineBindPoint bindingPoint, std::uint32_t firstSet);
 
@@ -288,7 +296,10 @@ class VKCommandBuffer final : public CommandBuffer
     private:
 
         VKDevice&                       device_;
-        VKPtr<VkCommandPool>            commandPool_;
+        VKMipGenerator*                 mipGenerator_               = nullptr; // optional compute MIP-map generator
+
+        std::vector<VKPtr<VkCommandPool>> commandPoolList_;
+        VkCommandPool                   commandPool_                = VK_NULL_HANDLE;
 
         std::vector<VkCommandBuffer>    commandBufferList_;
         VkCommandBuffer                 commandBuffer_;
@@ -307,6 +318,7 @@ class VKCommandBuffer final : public CommandBuffer
 
         VkRenderPass                    renderPass_                 = VK_NULL_HANDLE; // primary render pass
         VkRenderPass                    secondaryRenderPass_        = VK_NULL_HANDLE; // to pause/resume render pass (load and store content)
+        VkRenderPass                    inheritanceRenderPass_      = VK_NULL_HANDLE; // render pass a secondary command buffer continues
         VkFramebuffer                   framebuffer_                = VK_NULL_HANDLE; // active framebuffer handle
         VkExtent2D                      framebufferExtent_          = { 0, 0 };
         std::uint32_t                   numColorAttachments_        = 0;
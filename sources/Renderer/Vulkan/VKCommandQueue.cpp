@@ -9,6 +9,7 @@
 #include "VKCommandBuffer.h"
 #include "RenderState/VKFence.h"
 #include "RenderState/VKQueryHeap.h"
+#include "RenderState/VKDescriptorPoolManager.h"
 #include "../CheckedCast.h"
 #include "VKCore.h"
 
@@ -17,9 +18,10 @@ namespace LLGL
 {
 
 
-VKCommandQueue::VKCommandQueue(const VKPtr<VkDevice>& device, VkQueue queue) :
-    device_ { device },
-    native_ { queue  }
+VKCommandQueue::VKCommandQueue(VKDevice& device, VKDescriptorPoolManager& descriptorPoolMngr, float timestampPeriod) :
+    device_             { device             },
+    descriptorPoolMngr_ { descriptorPoolMngr },
+    timestampPeriod_    { timestampPeriod    }
 {
 }
 
@@ -44,8 +46,11 @@ void VKCommandQueue::Submit(CommandBuffer& commandBuffer)
         submitInfo.signalSemaphoreCount = 0;
         submitInfo.pSignalSemaphores    = nullptr;
     }
-    auto result = vkQueueSubmit(native_, 1, &submitInfo, commandBufferVK.GetQueueSubmitFence());
+    auto result = device_.QueueSubmit(1, &submitInfo, commandBufferVK.GetQueueSubmitFence());
     VKThrowIfFailed(result, "failed to submit command buffer to Vulkan graphics queue");
+
+    /* Retire descriptor sets that have been released until this submission */
+    descriptorPoolMngr_.RetireReleasedDescriptorSets();
 }
 
 /* ----- Queries ----- */
@@ -96,7 +101,7 @@ void VKCommandQueue::Submit(Fence& fence)
 {
     auto& fenceVK = LLGL_CAST(VKFence&, fence);
     fenceVK.Reset(device_);
-    vkQueueSubmit(native_, 0, nullptr, fenceVK.GetVkFence());
+    device_.QueueSubmit(0, nullptr, fenceVK.GetVkFence());
 }
 
 bool VKCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
@@ -107,7 +112,7 @@ bool VKCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 
 void VKCommandQueue::WaitIdle()
 {
-    vkQueueWaitIdle(native_);
+    device_.QueueWaitIdle();
 }
 
 
@@ -211,8 +216,10 @@ VkResult VKCommandQueue::GetQuerySingleResult(
 
         if (result == VK_SUCCESS)
         {
-            /* Store difference between timestamps in output buffer */
-            const auto elapsedTime = (timestamps[1] - timestamps[0]);
+            /* Store difference between timestamps in output buffer and normalize it to nanoseconds */
+            auto elapsedTime = (timestamps[1] - timestamps[0]);
+            if (timestampPeriod_ != 1.0f)
+                elapsedTime = static_cast<std::uint64_t>(static_cast<double>(elapsedTime) * static_cast<double>(timestampPeriod_) + 0.5);
             if (stride == sizeof(std::uint64_t))
             {
                 auto dst = reinterpret_cast<std::uint64_t*>(data);
@@ -13,6 +13,7 @@
 #include "Vulkan.h"
 #include "VKPtr.h"
 #include "VKCore.h"
+#include "VKDevice.h"
 #include "RenderState/VKFence.h"
 
 
@@ -21,6 +22,7 @@ namespace LLGL
 
 
 class VKQueryHeap;
+class VKDescriptorPoolManager;
 
 class VKCommandQueue final : public CommandQueue
 {
@@ -29,7 +31,7 @@ class VKCommandQueue final : public CommandQueue
 
         /* ----- Common ----- */
 
-        VKCommandQueue(const VKPtr<VkDevice>& device, VkQueue queue);
+        VKCommandQueue(VKDevice& device, VKDescriptorPoolManager& descriptorPoolMngr, float timestampPeriod);
 
         /* ----- Command Buffers ----- */
 
@@ -76,8 +78,9 @@ class VKCommandQueue final : public CommandQueue
 
     private:
 
-        VkDevice    device_;
-        VkQueue     native_ = VK_NULL_HANDLE;
+        VKDevice&                   device_;
+        VKDescriptorPoolManager&    descriptorPoolMngr_;
+        float                       timestampPeriod_    = 1.0f; // Number of nanoseconds per timestamp tick
 
 };
 
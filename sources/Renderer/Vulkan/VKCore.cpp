@@ -316,13 +316,24 @@ VkFormat VKFindSupportedImageFormat(VkPhysicalDevice device, const std::initiali
 }
 
 std::uint32_t VKFindMemoryType(const VkPhysicalDeviceMemoryProperties& memoryProperties, std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties)
+{
+    std::uint32_t memoryTypeIndex = 0;
+    if (!VKFindMemoryType(memoryProperties, memoryTypeBits, properties, memoryTypeIndex))
+        throw std::runtime_error("failed to find suitable Vulkan memory type");
+    return memoryTypeIndex;
+}
+
+bool VKFindMemoryType(const VkPhysicalDeviceMemoryProperties& memoryProperties, std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties, std::uint32_t& memoryTypeIndex)
 {
     for (std::uint32_t i = 0; i < memoryProperties.memoryTypeCount; ++i)
     {
         if ((memoryTypeBits & (1 << i)) != 0 && (memoryProperties.memoryTypes[i].propertyFlags & properties) == properties)
-            return i;
+        {
+            memoryTypeIndex = i;
+            return true;
+        }
     }
-    throw std::runtime_error("failed to find suitable Vulkan memory type");
+    return false;
 }
 
 
@@ -88,6 +88,9 @@ VkFormat VKFindSupportedImageFormat(VkPhysicalDevice device, const std::initiali
 // Returns the memory type index that supports the specified type bits and properties, or throws an std::runtime_error exception on failure.
 std::uint32_t VKFindMemoryType(const VkPhysicalDeviceMemoryProperties& memoryProperties, std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties);
 
+// Returns true if there is a memory type that supports the specified type bits and properties, and writes its index to 'memoryTypeIndex'.
+bool VKFindMemoryType(const VkPhysicalDeviceMemoryProperties& memoryProperties, std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties, std::uint32_t& memoryTypeIndex);
+
 
 } // /namespace LLGL
 
@@ -13,6 +13,8 @@
 #include "Memory/VKDeviceMemoryRegion.h"
 #include "Memory/VKDeviceMemory.h"
 #include <set>
+#include <map>
+#include <thread>
 #include <algorithm>
 #include <string.h>
 #include <limits.h>
@@ -22,28 +24,146 @@ namespace LLGL
 {
 
 
+/*
+Staging command pools of a device for each thread. This object is shared with the thread-local registries (see below),
+so each thread can release its command pool on exit, independent of the life time and address of the VKDevice object.
+*/
+class VKThreadCommandPools
+{
+
+    public:
+
+        VKThreadCommandPools(VkDevice device, std::uint32_t queueFamilyIndex) :
+            device_           { device           },
+            queueFamilyIndex_ { queueFamilyIndex }
+        {
+        }
+
+        // Returns the command pool for the specified thread and creates it on demand. Sets 'created' to true if a new command pool has been created.
+        VkCommandPool GetOrCreate(std::thread::id threadID, bool& created)
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+
+            auto& commandPool = commandPools_[threadID];
+            if (commandPool == VK_NULL_HANDLE)
+            {
+                /* Create transient staging command pool for one-shot command buffers */
+                VkCommandPoolCreateInfo createInfo;
+                {
+                    createInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+                    createInfo.pNext            = nullptr;
+                    createInfo.flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+                    createInfo.queueFamilyIndex = queueFamilyIndex_;
+                }
+                auto result = vkCreateCommandPool(device_, &createInfo, nullptr, &commandPool);
+                if (result != VK_SUCCESS)
+                    commandPools_.erase(threadID);
+                VKThrowIfFailed(result, "failed to create Vulkan staging command pool");
+                created = true;
+            }
+
+            return commandPool;
+        }
+
+        // Releases the command pool of the specified thread. All command buffers of this pool have already finished, since they are flushed synchronously.
+        void Release(std::thread::id threadID)
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+
+            auto it = commandPools_.find(threadID);
+            if (it != commandPools_.end())
+            {
+                if (device_ != VK_NULL_HANDLE)
+                    vkDestroyCommandPool(device_, it->second, nullptr);
+                commandPools_.erase(it);
+            }
+        }
+
+        // Releases the command pools of all threads. Threads that exit afterwards won't touch the device anymore.
+        void ReleaseAll()
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+
+            if (device_ != VK_NULL_HANDLE)
+            {
+                for (const auto& entry : commandPools_)
+                    vkDestroyCommandPool(device_, entry.second, nullptr);
+            }
+            commandPools_.clear();
+            device_ = VK_NULL_HANDLE;
+        }
+
+    private:
+
+        std::mutex                                  mutex_;
+        VkDevice                                    device_             = VK_NULL_HANDLE;
+        std::uint32_t                               queueFamilyIndex_   = 0;
+        std::map<std::thread::id, VkCommandPool>    commandPools_;
+
+};
+
+// Thread-local registry of all devices the owning thread has created a staging command pool for.
+struct VKThreadCommandPoolRegistry
+{
+    ~VKThreadCommandPoolRegistry()
+    {
+        const auto threadID = std::this_thread::get_id();
+        for (const auto& entry : commandPools)
+        {
+            if (auto threadCommandPools = entry.lock())
+                threadCommandPools->Release(threadID);
+        }
+    }
+
+    void Register(const std::shared_ptr<VKThreadCommandPools>& threadCommandPools)
+    {
+        /* Drop registrations of devices that have been destroyed in the meantime */
+        commandPools.erase(
+            std::remove_if(
+                commandPools.begin(), commandPools.end(),
+                [](const std::weak_ptr<VKThreadCommandPools>& entry)
+                {
+                    return entry.expired();
+                }
+            ),
+            commandPools.end()
+        );
+        commandPools.push_back(threadCommandPools);
+    }
+
+    std::vector<std::weak_ptr<VKThreadCommandPools>> commandPools;
+};
+
+static thread_local VKThreadCommandPoolRegistry g_threadCommandPoolRegistry;
+
+
 /* ----- Common ----- */
 
 VKDevice::VKDevice() :
-    device_      { vkDestroyDevice               },
-    commandPool_ { device_, vkDestroyCommandPool }
+    device_ { vkDestroyDevice }
 {
 }
 
 VKDevice::VKDevice(VKDevice&& device) :
-    device_             { std::move(device.device_)      },
-    queueFamilyIndices_ { device.queueFamilyIndices_     },
-    graphicsQueue_      { device.graphicsQueue_          },
-    commandPool_        { std::move(device.commandPool_) }
+    device_             { std::move(device.device_)             },
+    queueFamilyIndices_ { device.queueFamilyIndices_            },
+    graphicsQueue_      { device.graphicsQueue_                 },
+    threadCommandPools_ { std::move(device.threadCommandPools_) }
 {
 }
 
+VKDevice::~VKDevice()
+{
+    ReleaseThreadCommandPools();
+}
+
 VKDevice& VKDevice::operator = (VKDevice&& device)
 {
+    ReleaseThreadCommandPools();
     device_             = std::move(device.device_);
     queueFamilyIndices_ = device.queueFamilyIndices_;
     graphicsQueue_      = device.graphicsQueue_;
-    commandPool_        = std::move(device.commandPool_);
+    threadCommandPools_ = std::move(device.threadCommandPools_);
     return *this;
 }
 
@@ -95,26 +215,27 @@ void VKDevice::CreateLogicalDevice(
         createInfo.ppEnabledExtensionNames  = extensions;
         createInfo.pEnabledFeatures         = features;
     }
+    ReleaseThreadCommandPools();
     auto result = vkCreateDevice(physicalDevice, &createInfo, nullptr, device_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan logical device");
 
     /* Query device graphics queue */
     vkGetDeviceQueue(device_, queueFamilyIndices_.graphicsFamily, 0, &graphicsQueue_);
 
-    /* Create default command pool */
-    commandPool_ = CreateCommandPool();
+    /* Create container for the staging command pools of each thread */
+    threadCommandPools_ = std::make_shared<VKThreadCommandPools>(device_, queueFamilyIndices_.graphicsFamily);
 }
 
-VKPtr<VkCommandPool> VKDevice::CreateCommandPool()
+VKPtr<VkCommandPool> VKDevice::CreateCommandPool(VkCommandPoolCreateFlags flags)
 {
     VKPtr<VkCommandPool> commandPool{ device_, vkDestroyCommandPool };
 
-    /* Create staging command pool */
+    /* Create command pool for graphics queue family */
     VkCommandPoolCreateInfo createInfo;
     {
         createInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
         createInfo.pNext            = nullptr;
-        createInfo.flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        createInfo.flags            = flags;
         createInfo.queueFamilyIndex = queueFamilyIndices_.graphicsFamily;
     }
     auto result = vkCreateCommandPool(device_, &createInfo, nullptr, commandPool.ReleaseAndGetAddressOf());
@@ -127,12 +248,12 @@ VkCommandBuffer VKDevice::AllocCommandBuffer(bool begin)
 {
     VkCommandBuffer cmdBuffer = VK_NULL_HANDLE;
 
-    /* Allocate new primary level command buffer via staging command pool */
+    /* Allocate new primary level command buffer via staging command pool of the calling thread */
     VkCommandBufferAllocateInfo allocInfo;
     {
         allocInfo.sType                = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
         allocInfo.pNext                = nullptr;
-        allocInfo.commandPool          = commandPool_;
+        allocInfo.commandPool          = GetThreadCommandPool();
         allocInfo.level                = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
         allocInfo.commandBufferCount   = 1;
     }
@@ -173,7 +294,8 @@ void VKDevice::FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release)
             submitInfo.commandBufferCount   = 1;
             submitInfo.pCommandBuffers      = (&cmdBuffer);
         }
-        vkQueueSubmit(graphicsQueue_, 1, &submitInfo, fence.GetVkFence());
+        result = QueueSubmit(1, &submitInfo, fence.GetVkFence());
+        VKThrowIfFailed(result, "failed to submit Vulkan command buffer to graphics queue");
 
         /* Wait for fence to be signaled */
         fence.Wait(device_, ULLONG_MAX);
@@ -181,7 +303,25 @@ void VKDevice::FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release)
 
     /* Release command buffer (if enabled) */
     if (release)
-        vkFreeCommandBuffers(device_, commandPool_, 1, &cmdBuffer);
+        vkFreeCommandBuffers(device_, GetThreadCommandPool(), 1, &cmdBuffer);
+}
+
+VkResult VKDevice::QueueSubmit(std::uint32_t submitCount, const VkSubmitInfo* submits, VkFence fence)
+{
+    std::lock_guard<std::mutex> guard{ queueMutex_ };
+    return vkQueueSubmit(graphicsQueue_, submitCount, submits, fence);
+}
+
+VkResult VKDevice::QueuePresent(VkQueue presentQueue, const VkPresentInfoKHR& presentInfo)
+{
+    std::lock_guard<std::mutex> guard{ queueMutex_ };
+    return vkQueuePresentKHR(presentQueue, &presentInfo);
+}
+
+void VKDevice::QueueWaitIdle()
+{
+    std::lock_guard<std::mutex> guard{ queueMutex_ };
+    vkQueueWaitIdle(graphicsQueue_);
 }
 
 // Returns the image aspect for the specified Vulkan format
@@ -410,90 +550,71 @@ void VKDevice::GenerateMips(
     barrier.subresourceRange.baseMipLevel   = subresource.baseMipLevel;
     barrier.subresourceRange.levelCount     = 1;
     barrier.subresourceRange.baseArrayLayer = subresource.baseArrayLayer;
-    barrier.subresourceRange.layerCount     = 1;
+    barrier.subresourceRange.layerCount     = subresource.numArrayLayers;
+
+    /*
+    Blit each MIP-map from previous (lower) MIP level for all array layers at once,
+    so each MIP level only requires a single blit command and two barriers regardless of the number of array layers
+    */
+    auto currExtent = extent;
 
-    /* Blit each MIP-map from previous (lower) MIP level */
-    for (std::uint32_t arrayLayer = 0; arrayLayer < subresource.numArrayLayers; ++arrayLayer)
+    for (std::uint32_t mipLevel = 1; mipLevel < subresource.numMipLevels; ++mipLevel)
     {
-        auto currExtent = extent;
+        /* Determine extent of next MIP level */
+        auto nextExtent = currExtent;
 
-        for (std::uint32_t mipLevel = 1; mipLevel < subresource.numMipLevels; ++mipLevel)
-        {
-            /* Determine extent of next MIP level */
-            auto nextExtent = currExtent;
-
-            nextExtent.width    = std::max(1u, currExtent.width  / 2);
-            nextExtent.height   = std::max(1u, currExtent.height / 2);
-            nextExtent.depth    = std::max(1u, currExtent.depth  / 2);
-
-            /* Transition previous MIP level to VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL */
-            barrier.srcAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
-            barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_READ_BIT;
-            barrier.oldLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-            barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-            barrier.subresourceRange.baseMipLevel   = subresource.baseMipLevel + mipLevel - 1;
-            barrier.subresourceRange.baseArrayLayer = subresource.baseArrayLayer + arrayLayer;
-
-            vkCmdPipelineBarrier(
-                commandBuffer,
-                VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
-                0, nullptr,
-                0, nullptr,
-                1, &barrier
-            );
-
-            /* Blit previous MIP level into next higher MIP level (with smaller extent) */
-            VkImageBlit blit;
-
-            blit.srcSubresource.aspectMask      = aspectMask;
-            blit.srcSubresource.mipLevel        = subresource.baseMipLevel + mipLevel - 1;
-            blit.srcSubresource.baseArrayLayer  = subresource.baseArrayLayer + arrayLayer;
-            blit.srcSubresource.layerCount      = 1;
-            blit.srcOffsets[0]                  = { 0, 0, 0 };
-            blit.srcOffsets[1].x                = static_cast<std::int32_t>(currExtent.width);
-            blit.srcOffsets[1].y                = static_cast<std::int32_t>(currExtent.height);
-            blit.srcOffsets[1].z                = static_cast<std::int32_t>(currExtent.depth);
-            blit.dstSubresource.aspectMask      = aspectMask;
-            blit.dstSubresource.mipLevel        = subresource.baseMipLevel + mipLevel;
-            blit.dstSubresource.baseArrayLayer  = subresource.baseArrayLayer + arrayLayer;
-            blit.dstSubresource.layerCount      = 1;
-            blit.dstOffsets[0]                  = { 0, 0, 0 };
-            blit.dstOffsets[1].x                = static_cast<std::int32_t>(nextExtent.width);
-            blit.dstOffsets[1].y                = static_cast<std::int32_t>(nextExtent.height);
-            blit.dstOffsets[1].z                = static_cast<std::int32_t>(nextExtent.depth);
-
-            vkCmdBlitImage(
-                commandBuffer,
-                image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-                image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                1, &blit,
-                VK_FILTER_LINEAR
-            );
-
-            /* Transition previous MIP level back to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL */
-            barrier.srcAccessMask   = VK_ACCESS_TRANSFER_READ_BIT;
-            barrier.dstAccessMask   = VK_ACCESS_SHADER_READ_BIT;
-            barrier.oldLayout       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-            barrier.newLayout       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-
-            vkCmdPipelineBarrier(
-                commandBuffer,
-                VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
-                0, nullptr,
-                0, nullptr,
-                1, &barrier
-            );
-
-            /* Reduce image extent to next MIP level */
-            currExtent = nextExtent;
-        }
+        nextExtent.width    = std::max(1u, currExtent.width  / 2);
+        nextExtent.height   = std::max(1u, currExtent.height / 2);
+        nextExtent.depth    = std::max(1u, currExtent.depth  / 2);
 
-        /* Transition last MIP level back to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL */
+        /* Transition previous MIP level to VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL */
         barrier.srcAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
-        barrier.dstAccessMask                   = VK_ACCESS_SHADER_READ_BIT;
+        barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_READ_BIT;
         barrier.oldLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-        barrier.newLayout                       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-        barrier.subresourceRange.baseMipLevel   = subresource.numMipLevels - 1;
+        barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        barrier.subresourceRange.baseMipLevel   = subresource.baseMipLevel + mipLevel - 1;
+
+        vkCmdPipelineBarrier(
+            commandBuffer,
+            VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+            0, nullptr,
+            0, nullptr,
+            1, &barrier
+        );
+
+        /* Blit previous MIP level into next higher MIP level (with smaller extent) */
+        VkImageBlit blit;
+
+        blit.srcSubresource.aspectMask      = aspectMask;
+        blit.srcSubresource.mipLevel        = subresource.baseMipLevel + mipLevel - 1;
+        blit.srcSubresource.baseArrayLayer  = subresource.baseArrayLayer;
+        blit.srcSubresource.layerCount      = subresource.numArrayLayers;
+        blit.srcOffsets[0]                  = { 0, 0, 0 };
+        blit.srcOffsets[1].x                = static_cast<std::int32_t>(currExtent.width);
+        blit.srcOffsets[1].y                = static_cast<std::int32_t>(currExtent.height);
+        blit.srcOffsets[1].z                = static_cast<std::int32_t>(currExtent.depth);
+        blit.dstSubresource.aspectMask      = aspectMask;
+        blit.dstSubresource.mipLevel        = subresource.baseMipLevel + mipLevel;
+        blit.dstSubresource.baseArrayLayer  = subresource.baseArrayLayer;
+        blit.dstSubresource.layerCount      = subresource.numArrayLayers;
+        blit.dstOffsets[0]                  = { 0, 0, 0 };
+        blit.dstOffsets[1].x                = static_cast<std::int32_t>(nextExtent.width);
+        blit.dstOffsets[1].y                = static_cast<std::int32_t>(nextExtent.height);
+        blit.dstOffsets[1].z                = static_cast<std::int32_t>(nextExtent.depth);
+
+        vkCmdBlitImage(
+            commandBuffer,
+            image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            1, &blit,
+            VK_FILTER_LINEAR
+        );
+
+        /* Transition previous MIP level back to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL */
+        barrier.srcAccessMask   = VK_ACCESS_TRANSFER_READ_BIT;
+        barrier.dstAccessMask   = VK_ACCESS_SHADER_READ_BIT;
+        barrier.oldLayout       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        barrier.newLayout       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 
         vkCmdPipelineBarrier(
             commandBuffer,
@@ -502,7 +623,25 @@ void VKDevice::GenerateMips(
             0, nullptr,
             1, &barrier
         );
+
+        /* Reduce image extent to next MIP level */
+        currExtent = nextExtent;
     }
+
+    /* Transition last MIP level back to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL */
+    barrier.srcAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask                   = VK_ACCESS_SHADER_READ_BIT;
+    barrier.oldLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.newLayout                       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    barrier.subresourceRange.baseMipLevel   = subresource.baseMipLevel + subresource.numMipLevels - 1;
+
+    vkCmdPipelineBarrier(
+        commandBuffer,
+        VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
+        0, nullptr,
+        0, nullptr,
+        1, &barrier
+    );
 }
 
 void VKDevice::WriteBuffer(VKDeviceBuffer& buffer, const void* data, VkDeviceSize size, VkDeviceSize offset)
@@ -539,6 +678,30 @@ void VKDevice::FlushMappedBuffer(VKDeviceBuffer& buffer, VkDeviceSize size, VkDe
 }
 
 
+/*
+ * ======= Private: =======
+ */
+
+VkCommandPool VKDevice::GetThreadCommandPool()
+{
+    /* Find command pool for the calling thread and register it to be released when the thread exits */
+    bool created = false;
+    auto commandPool = threadCommandPools_->GetOrCreate(std::this_thread::get_id(), created);
+    if (created)
+        g_threadCommandPoolRegistry.Register(threadCommandPools_);
+    return commandPool;
+}
+
+void VKDevice::ReleaseThreadCommandPools()
+{
+    if (threadCommandPools_)
+    {
+        threadCommandPools_->ReleaseAll();
+        threadCommandPools_.reset();
+    }
+}
+
+
 } // /namespace LLGL
 
 
@@ -14,6 +14,8 @@
 #include "VKPtr.h"
 #include "VKCore.h"
 #include "Buffer/VKDeviceBuffer.h"
+#include <memory>
+#include <mutex>
 
 
 namespace LLGL
@@ -22,6 +24,7 @@ namespace LLGL
 
 class VKBuffer;
 class VKTexture;
+class VKThreadCommandPools;
 
 class VKDevice
 {
@@ -32,6 +35,7 @@ class VKDevice
 
         VKDevice();
         VKDevice(VKDevice&& device);
+        ~VKDevice();
 
         VKDevice& operator = (VKDevice&& device);
 
@@ -47,13 +51,26 @@ class VKDevice
 
         /* ----- Allocation ----- */
 
-        VKPtr<VkCommandPool> CreateCommandPool();
+        // Creates a new command pool for the graphics queue family with the specified creation flags.
+        VKPtr<VkCommandPool> CreateCommandPool(VkCommandPoolCreateFlags flags = 0);
 
         /* ----- Queue ----- */
 
+        // Allocates a primary command buffer from the staging command pool of the calling thread.
         VkCommandBuffer AllocCommandBuffer(bool begin = true);
+
+        // Submits the command buffer, waits for its completion, and releases it to the staging command pool of the calling thread.
         void FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release = true);
 
+        // Submits the specified batches to the graphics queue. Access to the queue is synchronized with all other threads.
+        VkResult QueueSubmit(std::uint32_t submitCount, const VkSubmitInfo* submits, VkFence fence);
+
+        // Presents the specified swap-chain images. Access to the queue is synchronized with all other threads.
+        VkResult QueuePresent(VkQueue presentQueue, const VkPresentInfoKHR& presentInfo);
+
+        // Blocks until the graphics queue becomes idle.
+        void QueueWaitIdle();
+
         /* ----- Buffer/Image operatons ----- */
 
         void TransitionImageLayout(
@@ -168,18 +185,26 @@ class VKDevice
             return graphicsQueue_;
         }
 
-        // Returns the native VkCommandPool handle.
-        inline const VKPtr<VkCommandPool>& GetVkCommandPool() const
-        {
-            return commandPool_;
-        }
+    private:
+
+        // Returns the staging command pool of the calling thread and creates it on demand.
+        VkCommandPool GetThreadCommandPool();
+
+        void ReleaseThreadCommandPools();
 
     private:
 
-        VKPtr<VkDevice>         device_;
-        QueueFamilyIndices      queueFamilyIndices_;
-        VkQueue                 graphicsQueue_      = VK_NULL_HANDLE;
-        VKPtr<VkCommandPool>    commandPool_;
+        VKPtr<VkDevice>                             device_;
+        QueueFamilyIndices                          queueFamilyIndices_;
+        VkQueue                                     graphicsQueue_      = VK_NULL_HANDLE;
+        std::mutex                                  queueMutex_;
+
+        /*
+        Staging command pools are thread-affine, so one-shot uploads can be recorded
+        from any thread without synchronizing the allocation of command buffers.
+        Each thread releases its command pool when it exits (see VKThreadCommandPools).
+        */
+        std::shared_ptr<VKThreadCommandPools>       threadCommandPools_;
 
 };
 
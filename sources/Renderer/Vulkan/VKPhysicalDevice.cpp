@@ -7,6 +7,7 @@
 
 #include "VKPhysicalDevice.h"
 #include "Ext/VKExtensionRegistry.h"
+#include "Ext/VKExtensions.h"
 #include "VKCore.h"
 #include "RenderState/VKGraphicsPSO.h"
 #include "../../Core/Vendor.h"
@@ -193,6 +194,7 @@ void VKPhysicalDevice::QueryDeviceProperties(
     caps.features.hasLogicOp                        = (features_.logicOp != VK_FALSE);
     caps.features.hasPipelineStatistics             = (features_.pipelineStatisticsQuery != VK_FALSE);
     caps.features.hasRenderCondition                = SupportsExtension(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME);
+    caps.features.hasBindlessResources              = false; // Requires device extensions (see QueryBindlessResourcesSupport)
 
     /* Query limits */
     caps.limits.lineWidthRange[0]                   = limits.lineWidthRange[0];
@@ -264,6 +266,65 @@ bool VKPhysicalDevice::SupportsExtension(const char* extension) const
     return (it != supportedExtensionNames_.end());
 }
 
+bool VKPhysicalDevice::QueryMemoryBudget(VkDeviceSize (&heapBudget)[VK_MAX_MEMORY_HEAPS], VkDeviceSize (&heapUsage)[VK_MAX_MEMORY_HEAPS]) const
+{
+    #ifdef VK_EXT_memory_budget
+    if (HasExtension(VKExt::EXT_memory_budget) && HasExtension(VKExt::KHR_get_physical_device_properties2))
+    {
+        /* Chain memory budget properties into memory properties */
+        VkPhysicalDeviceMemoryBudgetPropertiesEXT budgetProps = {};
+        budgetProps.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+
+        VkPhysicalDeviceMemoryProperties2 memoryPropsExt = {};
+        memoryPropsExt.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+        memoryPropsExt.pNext = &budgetProps;
+
+        /* Query memory properties with extension "VK_KHR_get_physical_device_properties2" */
+        vkGetPhysicalDeviceMemoryProperties2KHR(physicalDevice_, &memoryPropsExt);
+
+        for (std::uint32_t i = 0; i < VK_MAX_MEMORY_HEAPS; ++i)
+        {
+            heapBudget[i]   = budgetProps.heapBudget[i];
+            heapUsage[i]    = budgetProps.heapUsage[i];
+        }
+
+        return true;
+    }
+    #endif // /VK_EXT_memory_budget
+    return false;
+}
+
+bool VKPhysicalDevice::QueryBindlessResourcesSupport() const
+{
+    if (features_.shaderSampledImageArrayDynamicIndexing == VK_FALSE)
+        return false;
+
+    #ifdef VK_EXT_descriptor_indexing
+    if (HasExtension(VKExt::EXT_descriptor_indexing) && HasExtension(VKExt::KHR_get_physical_device_properties2))
+    {
+        /* Chain descriptor indexing features into device features */
+        VkPhysicalDeviceDescriptorIndexingFeaturesEXT indexingFeatures = {};
+        indexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+
+        VkPhysicalDeviceFeatures2 featuresExt = {};
+        featuresExt.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        featuresExt.pNext = &indexingFeatures;
+
+        /* Query device features with extension "VK_KHR_get_physical_device_properties2" */
+        vkGetPhysicalDeviceFeatures2KHR(physicalDevice_, &featuresExt);
+
+        return
+        (
+            indexingFeatures.runtimeDescriptorArray                         != VK_FALSE &&
+            indexingFeatures.descriptorBindingPartiallyBound                != VK_FALSE &&
+            indexingFeatures.descriptorBindingSampledImageUpdateAfterBind   != VK_FALSE
+        );
+    }
+    #endif // /VK_EXT_descriptor_indexing
+
+    return false;
+}
+
 
 /*
  * ======= Private: =======
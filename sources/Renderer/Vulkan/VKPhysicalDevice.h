@@ -45,6 +45,15 @@ class VKPhysicalDevice
         // Returns true if the specified Vulkan extension is supported by this physical device.
         bool SupportsExtension(const char* extension) const;
 
+        // Queries the current budget and usage (in bytes) of all memory heaps. Returns false if "VK_EXT_memory_budget" is not supported.
+        bool QueryMemoryBudget(VkDeviceSize (&heapBudget)[VK_MAX_MEMORY_HEAPS], VkDeviceSize (&heapUsage)[VK_MAX_MEMORY_HEAPS]) const;
+
+        /*
+        Returns true if bindless resource tables are supported, i.e. dynamic indexing of sampled image arrays and the "VK_EXT_descriptor_indexing" features
+        for runtime descriptor arrays, partially bound descriptors, and updating sampled images after binding. Device extensions must have been loaded.
+        */
+        bool QueryBindlessResourcesSupport() const;
+
         /* ----- Handles ----- */
 
         // Returns the native VkPhysicalDevice handle.
@@ -42,7 +42,7 @@ static VKPtr<VkFramebuffer> NullVkFramebuffer(const VKPtr<VkDevice>& device)
 VKRenderContext::VKRenderContext(
     const VKPtr<VkInstance>&        instance,
     VkPhysicalDevice                physicalDevice,
-    const VKPtr<VkDevice>&          device,
+    VKDevice&                       device,
     VKDeviceMemoryManager&          deviceMemoryMngr,
     RenderContextDescriptor         desc,
     const std::shared_ptr<Surface>& surface)
@@ -54,17 +54,20 @@ VKRenderContext::VKRenderContext(
     deviceMemoryMngr_        { deviceMemoryMngr                },
     surface_                 { instance, vkDestroySurfaceKHR   },
     swapChain_               { device, vkDestroySwapchainKHR   },
-    swapChainRenderPass_     { device                          },
+    swapChainRenderPass_     { device.GetVkDevice()            },
     swapChainSamples_        { GetClampedSamples(desc.samples) },
+    transientAttachments_    { desc.transientAttachments       },
     swapChainImageViews_     { NullVkImageView(device_),
                                NullVkImageView(device_),
                                NullVkImageView(device_)        },
     swapChainFramebuffers_   { NullVkFramebuffer(device_),
                                NullVkFramebuffer(device_),
                                NullVkFramebuffer(device_)      },
-    secondaryRenderPass_     { device                          },
-    depthStencilBuffer_      { device                          },
-    colorBuffers_            { device, device, device          },
+    secondaryRenderPass_     { device.GetVkDevice()            },
+    depthStencilBuffer_      { device.GetVkDevice()            },
+    colorBuffers_            { device.GetVkDevice(),
+                               device.GetVkDevice(),
+                               device.GetVkDevice()            },
     imageAvailableSemaphore_ { device, vkDestroySemaphore      },
     renderFinishedSemaphore_ { device, vkDestroySemaphore      }
 {
@@ -103,7 +106,7 @@ void VKRenderContext::Present()
         submitInfo.signalSemaphoreCount = 1;
         submitInfo.pSignalSemaphores    = signalSemaphores;
     }
-    auto result = vkQueueSubmit(graphicsQueue_, 1, &submitInfo, VK_NULL_HANDLE);
+    auto result = device_.QueueSubmit(1, &submitInfo, VK_NULL_HANDLE);
     VKThrowIfFailed(result, "failed to submit semaphore to Vulkan graphics queue");
 
     /* Present result on screen */
@@ -120,7 +123,7 @@ void VKRenderContext::Present()
         presentInfo.pImageIndices       = &presentImageIndex_;
         presentInfo.pResults            = nullptr;
     }
-    result = vkQueuePresentKHR(presentQueue_, &presentInfo);
+    result = device_.QueuePresent(presentQueue_, presentInfo);
     VKThrowIfFailed(result, "failed to present Vulkan graphics queue");
 
     /* Get image index for next presentation */
@@ -169,7 +172,7 @@ bool VKRenderContext::OnSetVideoMode(const VideoModeDescriptor& videoModeDesc)
     const auto& prevVideoMode = GetVideoMode();
 
     /* Wait until graphics queue is idle before resources are destroyed and recreated */
-    vkQueueWaitIdle(graphicsQueue_);
+    device_.QueueWaitIdle();
 
     /* Recreate presenting semaphores and Vulkan surface */
     CreatePresentSemaphores();
@@ -271,6 +274,10 @@ void VKRenderContext::CreateRenderPass(VKRenderPass& renderPass, bool isSecondar
         auto loadOp     = (isSecondary ? AttachmentLoadOp::Load : AttachmentLoadOp::Undefined);
         auto storeOp    = AttachmentStoreOp::Store;
 
+        /* Never load or store transient depth-stencil buffer */
+        auto depthStencilLoadOp     = (transientAttachments_ ? AttachmentLoadOp::Undefined : loadOp);
+        auto depthStencilStoreOp    = (transientAttachments_ ? AttachmentStoreOp::Undefined : storeOp);
+
         /* Specify single color attachment */
         renderPassDesc.colorAttachments =
         {
@@ -281,11 +288,11 @@ void VKRenderContext::CreateRenderPass(VKRenderPass& renderPass, bool isSecondar
         auto depthStencilFormat = GetDepthStencilFormat();
 
         if (IsDepthFormat(depthStencilFormat))
-            renderPassDesc.depthAttachment = AttachmentFormatDescriptor{ depthStencilFormat, loadOp, storeOp };
+            renderPassDesc.depthAttachment = AttachmentFormatDescriptor{ depthStencilFormat, depthStencilLoadOp, depthStencilStoreOp };
         if (IsStencilFormat(depthStencilFormat))
-            renderPassDesc.stencilAttachment = AttachmentFormatDescriptor{ depthStencilFormat, loadOp, storeOp };
+            renderPassDesc.stencilAttachment = AttachmentFormatDescriptor{ depthStencilFormat, depthStencilLoadOp, depthStencilStoreOp };
     }
-    renderPass.CreateVkRenderPass(device_, renderPassDesc);
+    renderPass.CreateVkRenderPass(device_, renderPassDesc, transientAttachments_);
 }
 
 void VKRenderContext::CreateSecondaryRenderPass()
@@ -315,11 +322,10 @@ void VKRenderContext::CreateSwapChain(const VideoModeDescriptor& videoModeDesc,
 
     numSwapChainBuffers_ = std::min(numSwapChainBuffers_, g_maxNumColorBuffers);
 
-    /* Get device queues for graphics and presentation */
+    /* Get device queue for presentation (graphics queue is shared with the device) */
     VkSurfaceKHR surface = surface_.Get();
     auto queueFamilyIndices = VKFindQueueFamilies(physicalDevice_, VK_QUEUE_GRAPHICS_BIT, &surface);
 
-    vkGetDeviceQueue(device_, queueFamilyIndices.graphicsFamily, 0, &graphicsQueue_);
     vkGetDeviceQueue(device_, queueFamilyIndices.presentFamily, 0, &presentQueue_);
 
     /* Pick swap-chain presentation mode (with v-sync parameters) */
@@ -478,7 +484,8 @@ void VKRenderContext::CreateDepthStencilBuffer(const VideoModeDescriptor& videoM
         deviceMemoryMngr_,
         videoModeDesc.resolution,
         (videoModeDesc.stencilBits > 0 ? PickDepthStencilFormat() : PickDepthFormat()),
-        sampleCountBits
+        sampleCountBits,
+        transientAttachments_
     );
 }
 
@@ -492,7 +499,8 @@ void VKRenderContext::CreateColorBuffers(const VideoModeDescriptor& videoModeDes
             deviceMemoryMngr_,
             videoModeDesc.resolution,
             swapChainFormat_.format,
-            sampleCountBits
+            sampleCountBits,
+            transientAttachments_
         );
     }
 }
@@ -13,6 +13,7 @@
 #include <LLGL/RenderContext.h>
 #include "VKCore.h"
 #include "VKPtr.h"
+#include "VKDevice.h"
 #include "RenderState/VKRenderPass.h"
 #include "Texture/VKDepthStencilBuffer.h"
 #include "Texture/VKColorBuffer.h"
@@ -35,7 +36,7 @@ class VKRenderContext final : public RenderContext
         VKRenderContext(
             const VKPtr<VkInstance>&        instance,
             VkPhysicalDevice                physicalDevice,
-            const VKPtr<VkDevice>&          device,
+            VKDevice&                       device,
             VKDeviceMemoryManager&          deviceMemoryMngr,
             RenderContextDescriptor         desc,
             const std::shared_ptr<Surface>& surface
@@ -117,7 +118,7 @@ class VKRenderContext final : public RenderContext
 
         VkInstance              instance_                                       = VK_NULL_HANDLE;
         VkPhysicalDevice        physicalDevice_                                 = VK_NULL_HANDLE;
-        const VKPtr<VkDevice>&  device_;
+        VKDevice&               device_;
 
         VKDeviceMemoryManager&  deviceMemoryMngr_;
 
@@ -128,6 +129,7 @@ class VKRenderContext final : public RenderContext
         VKRenderPass            swapChainRenderPass_;
         VkSurfaceFormatKHR      swapChainFormat_                                = {};
         std::uint32_t           swapChainSamples_                               = 1;
+        bool                    transientAttachments_                           = false;
         VkExtent2D              swapChainExtent_                                = { 0, 0 };
         VkImage                 swapChainImages_[g_maxNumColorBuffers];
         VKPtr<VkImageView>      swapChainImageViews_[g_maxNumColorBuffers];
@@ -140,7 +142,6 @@ class VKRenderContext final : public RenderContext
         VKDepthStencilBuffer    depthStencilBuffer_;
         VKColorBuffer           colorBuffers_[g_maxNumColorBuffers];
 
-        VkQueue                 graphicsQueue_                                  = VK_NULL_HANDLE;
         VkQueue                 presentQueue_                                   = VK_NULL_HANDLE;
 
         VKPtr<VkSemaphore>      imageAvailableSemaphore_;
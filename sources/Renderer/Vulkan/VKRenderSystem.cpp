@@ -84,6 +84,22 @@ VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
         (rendererConfigVK != nullptr ? rendererConfigVK->minDeviceMemoryAllocationSize : 1024*1024),
         (rendererConfigVK != nullptr ? rendererConfigVK->reduceDeviceMemoryFragmentation : false)
     );
+
+    /* Create compute MIP-map generator if enabled */
+    if (rendererConfigVK != nullptr && rendererConfigVK->computeMips)
+    {
+        mipGenerator_ = MakeUnique<VKMipGenerator>(
+            physicalDevice_.GetVkPhysicalDevice(),
+            physicalDevice_.GetFeatures(),
+            device_,
+            *deviceMemoryMngr_,
+            *descriptorPoolMngr_
+        );
+    }
+
+    /* Create persistent shader cache if a cache directory is specified */
+    if (rendererConfigVK != nullptr && !rendererConfigVK->shaderCache.path.empty())
+        shaderCache_ = MakeUnique<ShaderCache>(rendererConfigVK->shaderCache);
 }
 
 VKRenderSystem::~VKRenderSystem()
@@ -91,6 +107,52 @@ VKRenderSystem::~VKRenderSystem()
     device_.WaitIdle();
 }
 
+bool VKRenderSystem::QueryMemoryStatistics(MemoryStatistics& stats)
+{
+    const auto& memoryProperties = physicalDevice_.GetMemoryProperties();
+
+    /* Accumulate details of all device memory chunks per memory heap */
+    deviceMemoryMngr_->QueryHeapDetails(memoryHeapDetails_);
+
+    /* Query budget and usage from the driver if "VK_EXT_memory_budget" is supported */
+    VkDeviceSize heapBudget[VK_MAX_MEMORY_HEAPS] = {};
+    VkDeviceSize heapUsage[VK_MAX_MEMORY_HEAPS] = {};
+    const bool hasMemoryBudget = physicalDevice_.QueryMemoryBudget(heapBudget, heapUsage);
+
+    stats.heaps.resize(memoryProperties.memoryHeapCount);
+    for (std::uint32_t i = 0; i < memoryProperties.memoryHeapCount; ++i)
+    {
+        const auto& heapProps   = memoryProperties.memoryHeaps[i];
+        const auto& details     = memoryHeapDetails_[i];
+        auto&       heap        = stats.heaps[i];
+        {
+            heap.size               = heapProps.size;
+            heap.budget             = (hasMemoryBudget ? heapBudget[i] : 0);
+            heap.usage              = (hasMemoryBudget ? heapUsage[i] : details.allocatedSize);
+            heap.allocatedBytes     = details.allocatedSize;
+            heap.usedBytes          = details.usedSize;
+            heap.fragmentedBytes    = details.fragmentedSize;
+            heap.numAllocations     = static_cast<std::uint32_t>(details.numChunks);
+            heap.numBlocks          = static_cast<std::uint32_t>(details.numBlocks);
+            heap.numFragments       = static_cast<std::uint32_t>(details.numFragments);
+            heap.deviceLocal        = ((heapProps.flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0);
+        }
+    }
+
+    stats.numBuffers    = static_cast<std::uint32_t>(buffers_.size());
+    stats.numTextures   = static_cast<std::uint32_t>(textures_.size());
+
+    return true;
+}
+
+bool VKRenderSystem::QueryShaderCacheStatistics(ShaderCacheStatistics& stats)
+{
+    if (!shaderCache_)
+        return RenderSystem::QueryShaderCacheStatistics(stats);
+    stats = shaderCache_->GetStatistics();
+    return true;
+}
+
 /* ----- Render Context ----- */
 
 RenderContext* VKRenderSystem::CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface)
@@ -119,7 +181,7 @@ CommandBuffer* VKRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor
 {
     return TakeOwnership(
         commandBuffers_,
-        MakeUnique<VKCommandBuffer>(physicalDevice_, device_, device_.GetVkQueue(), device_.GetQueueFamilyIndices(), desc)
+        MakeUnique<VKCommandBuffer>(physicalDevice_, device_, device_.GetQueueFamilyIndices(), desc, mipGenerator_.get())
     );
 }
 
@@ -260,6 +322,14 @@ void VKRenderSystem::UnmapBuffer(Buffer& buffer)
 
 Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc)
 {
+    /* Transient attachments are never initialized, because their content is discarded at the end of each render pass */
+    if ((textureDesc.miscFlags & MiscFlags::Transient) != 0)
+    {
+        auto textureVK = MakeUnique<VKTexture>(device_, *deviceMemoryMngr_, textureDesc);
+        textureVK->CreateInternalImageView(device_);
+        return TakeOwnership(textures_, std::move(textureVK));
+    }
+
     const auto& cfg = GetConfiguration();
 
     /* Determine size of image for staging buffer */
@@ -364,13 +434,16 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
         /* Generate MIP-maps if enabled */
         if (imageDesc != nullptr && MustGenerateMipsOnCreate(textureDesc))
         {
-            device_.GenerateMips(
-                cmdBuffer,
-                textureVK->GetVkImage(),
-                textureVK->GetVkFormat(),
-                textureVK->GetVkExtent(),
-                subresource
-            );
+            if (mipGenerator_ == nullptr || !mipGenerator_->GenerateMips(cmdBuffer, *textureVK, subresource))
+            {
+                device_.GenerateMips(
+                    cmdBuffer,
+                    textureVK->GetVkImage(),
+                    textureVK->GetVkFormat(),
+                    textureVK->GetVkExtent(),
+                    subresource
+                );
+            }
         }
     }
     device_.FlushCommandBuffer(cmdBuffer);
@@ -386,8 +459,10 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
 
 void VKRenderSystem::Release(Texture& texture)
 {
-    /* Release device memory region, then release texture object */
+    /* Release MIP-map views and device memory region, then release texture object */
     auto& textureVK = LLGL_CAST(VKTexture&, texture);
+    if (mipGenerator_)
+        mipGenerator_->ReleaseTexture(textureVK);
     deviceMemoryMngr_->Release(textureVK.GetMemoryRegion());
     RemoveFromUniqueSet(textures_, &texture);
 }
@@ -558,7 +633,7 @@ void VKRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureR
 
 Sampler* VKRenderSystem::CreateSampler(const SamplerDescriptor& desc)
 {
-    return TakeOwnership(samplers_, MakeUnique<VKSampler>(device_, desc));
+    return samplers_.acquire(desc, [&]() { return MakeUnique<VKSampler>(device_, desc); });
 }
 
 void VKRenderSystem::Release(Sampler& sampler)
@@ -570,7 +645,7 @@ void VKRenderSystem::Release(Sampler& sampler)
 
 ResourceHeap* VKRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& desc)
 {
-    return TakeOwnership(resourceHeaps_, MakeUnique<VKResourceHeap>(device_, desc));
+    return TakeOwnership(resourceHeaps_, MakeUnique<VKResourceHeap>(device_, *descriptorPoolMngr_, desc));
 }
 
 void VKRenderSystem::Release(ResourceHeap& resourceHeap)
@@ -611,13 +686,13 @@ void VKRenderSystem::Release(RenderTarget& renderTarget)
 Shader* VKRenderSystem::CreateShader(const ShaderDescriptor& desc)
 {
     AssertCreateShader(desc);
-    return TakeOwnership(shaders_, MakeUnique<VKShader>(device_, desc));
+    return TakeOwnership(shaders_, MakeUnique<VKShader>(device_, desc, (shaderCache_ != nullptr)));
 }
 
 ShaderProgram* VKRenderSystem::CreateShaderProgram(const ShaderProgramDescriptor& desc)
 {
     AssertCreateShaderProgram(desc);
-    return TakeOwnership(shaderPrograms_, MakeUnique<VKShaderProgram>(desc));
+    return TakeOwnership(shaderPrograms_, MakeUnique<VKShaderProgram>(desc, shaderCache_.get()));
 }
 
 void VKRenderSystem::Release(Shader& shader)
@@ -867,11 +942,19 @@ void VKRenderSystem::CreateLogicalDevice()
     /* Create logical device with all supported physical device feature */
     device_ = physicalDevice_.CreateLogicalDevice();
 
+    /* Create descriptor pool manager shared by all resource heaps (retired by the command queue) */
+    descriptorPoolMngr_ = MakeUnique<VKDescriptorPoolManager>(device_);
+
     /* Create command queue interface */
-    commandQueue_ = MakeUnique<VKCommandQueue>(device_, device_.GetVkQueue());
+    commandQueue_ = MakeUnique<VKCommandQueue>(device_, *descriptorPoolMngr_, physicalDevice_.GetProperties().limits.timestampPeriod);
 
     /* Load Vulkan device extensions */
     VKLoadDeviceExtensions(device_, physicalDevice_.GetExtensionNames());
+
+    /* Update rendering capabilities that depend on device extensions */
+    auto caps = GetRenderingCaps();
+    caps.features.hasBindlessResources = physicalDevice_.QueryBindlessResourcesSupport();
+    SetRenderingCaps(caps);
 }
 
 void VKRenderSystem::CreateDefaultPipelineLayout()
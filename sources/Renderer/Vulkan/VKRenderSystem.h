@@ -13,6 +13,7 @@
 #include "VKPhysicalDevice.h"
 #include "VKDevice.h"
 #include "../ContainerTypes.h"
+#include "../SamplerUtils.h"
 #include "Memory/VKDeviceMemoryManager.h"
 
 #include "VKCommandQueue.h"
@@ -28,6 +29,7 @@
 #include "Texture/VKTexture.h"
 #include "Texture/VKSampler.h"
 #include "Texture/VKRenderTarget.h"
+#include "Texture/VKMipGenerator.h"
 
 #include "RenderState/VKQueryHeap.h"
 #include "RenderState/VKFence.h"
@@ -35,6 +37,7 @@
 #include "RenderState/VKPipelineLayout.h"
 #include "RenderState/VKGraphicsPSO.h"
 #include "RenderState/VKResourceHeap.h"
+#include "RenderState/VKDescriptorPoolManager.h"
 
 #include <string>
 #include <memory>
@@ -57,6 +60,9 @@ class VKRenderSystem final : public RenderSystem
         VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
         ~VKRenderSystem();
 
+        bool QueryMemoryStatistics(MemoryStatistics& stats) override;
+        bool QueryShaderCacheStatistics(ShaderCacheStatistics& stats) override;
+
         /* ----- Render Context ----- */
 
         RenderContext* CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface = nullptr) override;
@@ -187,9 +193,14 @@ class VKRenderSystem final : public RenderSystem
         bool                                    debugLayerEnabled_      = false;
 
         std::unique_ptr<VKDeviceMemoryManager>  deviceMemoryMngr_;
+        std::unique_ptr<VKDescriptorPoolManager> descriptorPoolMngr_;
+        std::unique_ptr<VKMipGenerator>         mipGenerator_;          // Only created if RendererConfigurationVulkan::computeMips is enabled
+        std::unique_ptr<ShaderCache>            shaderCache_;
 
         VKGraphicsPipelineLimits                gfxPipelineLimits_;
 
+        std::vector<VKDeviceMemoryDetails>      memoryHeapDetails_;     // Reused between memory statistics queries
+
         /* ----- Hardware object containers ----- */
 
         HWObjectContainer<VKRenderContext>      renderContexts_;
@@ -198,7 +209,7 @@ class VKRenderSystem final : public RenderSystem
         HWObjectContainer<VKBuffer>             buffers_;
         HWObjectContainer<VKBufferArray>        bufferArrays_;
         HWObjectContainer<VKTexture>            textures_;
-        HWObjectContainer<VKSampler>            samplers_;
+        HWSamplerCache<VKSampler>               samplers_;
         HWObjectContainer<VKRenderPass>         renderPasses_;
         HWObjectContainer<VKRenderTarget>       renderTargets_;
         HWObjectContainer<VKShader>             shaders_;
@@ -0,0 +1,89 @@
+/*
+ * ReplayCapture.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/LLGL.h>
+#include <LLGL/RenderingCapture.h>
+#include <LLGL/RendererConfiguration.h>
+#include <LLGL/Blob.h>
+#include <iostream>
+#include <algorithm>
+#include <string>
+#include <cstdlib>
+
+
+// Command line tool to replay a command capture (*.llct) that was recorded with LLGL::RenderingCapture.
+static void PrintUsage()
+{
+    std::cout << "usage: ReplayCapture FILE [RENDERER] [ITERATIONS]" << std::endl;
+    std::cout << "  FILE        Command capture (*.llct) that was written from LLGL::RenderingCapture::Finalize" << std::endl;
+    std::cout << "  RENDERER    Render system module to replay the capture with (default: OpenGL, which runs headless)" << std::endl;
+    std::cout << "  ITERATIONS  Number of times the capture is replayed (default: 1)" << std::endl;
+}
+
+static void PrintStatistics(const LLGL::CaptureReplayStatistics& stats)
+{
+    std::cout << "commands:    " << stats.numCommands << std::endl;
+    std::cout << "frames:      " << stats.numFrames << std::endl;
+    std::cout << "total time:  " << (stats.totalTime * 1000.0) << " ms" << std::endl;
+
+    if (!stats.frameTimes.empty())
+    {
+        const auto minmax = std::minmax_element(stats.frameTimes.begin(), stats.frameTimes.end());
+        std::cout << "frame times: min = " << (*minmax.first * 1000.0) << " ms, max = " << (*minmax.second * 1000.0) << " ms" << std::endl;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    try
+    {
+        const std::string   filename        = argv[1];
+        const std::string   rendererModule  = (argc > 2 ? argv[2] : "OpenGL");
+        const int           numIterations   = (argc > 3 ? std::max(1, std::atoi(argv[3])) : 1);
+
+        auto capture = LLGL::Blob::CreateFromFile(filename);
+        if (!capture)
+            throw std::runtime_error("failed to read command capture: " + filename);
+
+        // Load render system module (OpenGL renderer runs headless, so no window is required)
+        LLGL::RendererConfigurationOpenGL configGL;
+        configGL.headless = true;
+
+        LLGL::RenderSystemDescriptor rendererDesc{ rendererModule };
+        if (rendererModule == "OpenGL")
+        {
+            rendererDesc.rendererConfig     = &configGL;
+            rendererDesc.rendererConfigSize = sizeof(configGL);
+        }
+
+        auto renderer = LLGL::RenderSystem::Load(rendererDesc);
+        std::cout << "renderer:    " << renderer->GetName() << std::endl;
+
+        for (int i = 0; i < numIterations; ++i)
+        {
+            std::cout << "iteration " << (i + 1) << "/" << numIterations << ":" << std::endl;
+            PrintStatistics(LLGL::ReplayCapture(*renderer, *capture));
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+
+
+// ================================================================================
@@ -0,0 +1,252 @@
+/*
+ * Test_BindlessResources.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/LLGL.h>
+#include <LLGL/RendererConfiguration.h>
+#include "../sources/Renderer/ResourceBindingIterator.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <stdexcept>
+#include <cstdint>
+
+
+static int g_numFailures = 0;
+
+static void Check(bool condition, const std::string& testName)
+{
+    if (!condition)
+    {
+        std::cerr << "FAILED: " << testName << std::endl;
+        ++g_numFailures;
+    }
+    else
+        std::cout << "passed: " << testName << std::endl;
+}
+
+// Number of textures in the bindless texture table
+static const std::uint32_t g_tableSize = 4;
+
+// Returns the pipeline layout bindings with a constant buffer, a table of sampled textures, and a sampler.
+static std::vector<LLGL::BindingDescriptor> GetLayoutBindings()
+{
+    return
+    {
+        LLGL::BindingDescriptor{ LLGL::ResourceType::Buffer,  LLGL::BindFlags::ConstantBuffer, LLGL::StageFlags::FragmentStage, 0             },
+        LLGL::BindingDescriptor{ LLGL::ResourceType::Texture, LLGL::BindFlags::Sampled,        LLGL::StageFlags::FragmentStage, 1, g_tableSize },
+        LLGL::BindingDescriptor{ LLGL::ResourceType::Sampler, 0,                               LLGL::StageFlags::FragmentStage, 2             },
+    };
+}
+
+// Counts all errors of type ErrorType::UnsupportedFeature that are reported by the debug layer.
+class ErrorCounter final : public LLGL::RenderingDebugger
+{
+
+    public:
+
+        std::uint32_t numUnsupportedFeatures = 0;
+
+    protected:
+
+        void OnError(LLGL::ErrorType type, Message& message) override
+        {
+            if (type == LLGL::ErrorType::UnsupportedFeature)
+                ++numUnsupportedFeatures;
+        }
+
+};
+
+static void Test_TableBindings()
+{
+    const auto bindings = GetLayoutBindings();
+
+    Check(!LLGL::IsBindlessTableBinding(bindings[0]), "constant buffer is not a texture table");
+    Check(LLGL::IsBindlessTableBinding(bindings[1]), "sampled texture is a texture table");
+    Check(!LLGL::IsBindlessTableBinding(bindings[2]), "sampler is not a texture table");
+    Check(
+        !LLGL::IsBindlessTableBinding({ LLGL::ResourceType::Texture, LLGL::BindFlags::Storage, LLGL::StageFlags::ComputeStage, 0, g_tableSize }),
+        "storage texture is not a texture table"
+    );
+
+    Check(LLGL::GetNumResourceViewsPerSet(bindings, false) == 3, "resource views per set without bindless tables");
+    Check(LLGL::GetNumResourceViewsPerSet(bindings, true) == 2 + g_tableSize, "resource views per set with bindless tables");
+
+    /* Array size of 0 is treated as a single texture */
+    std::vector<LLGL::BindingDescriptor> zeroSizedTable = { { LLGL::ResourceType::Texture, LLGL::BindFlags::Sampled, LLGL::StageFlags::FragmentStage, 0, 0 } };
+    Check(LLGL::GetNumResourceViewsPerSet(zeroSizedTable, true) == 1, "texture table with zero array size consumes one resource view");
+}
+
+// Creates all resources to fill the resource heaps for the bindings of GetLayoutBindings().
+class HeapResources
+{
+
+    public:
+
+        HeapResources(LLGL::RenderSystem& renderer)
+        {
+            LLGL::BufferDescriptor bufferDesc;
+            {
+                bufferDesc.size         = 16;
+                bufferDesc.bindFlags    = LLGL::BindFlags::ConstantBuffer;
+            }
+            buffer = renderer.CreateBuffer(bufferDesc);
+
+            const std::uint32_t texel = 0xFF0000FF;
+            LLGL::SrcImageDescriptor imageDesc{ LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, &texel, sizeof(texel) };
+
+            LLGL::TextureDescriptor textureDesc;
+            {
+                textureDesc.type        = LLGL::TextureType::Texture2D;
+                textureDesc.bindFlags   = LLGL::BindFlags::Sampled;
+                textureDesc.format      = LLGL::Format::RGBA8UNorm;
+                textureDesc.extent      = { 1, 1, 1 };
+                textureDesc.mipLevels   = 1;
+            }
+            for (std::uint32_t i = 0; i < g_tableSize; ++i)
+                textures.push_back(renderer.CreateTexture(textureDesc, &imageDesc));
+
+            sampler = renderer.CreateSampler({});
+
+            LLGL::PipelineLayoutDescriptor layoutDesc;
+            {
+                layoutDesc.bindings = GetLayoutBindings();
+            }
+            pipelineLayout = renderer.CreatePipelineLayout(layoutDesc);
+        }
+
+        // Returns the descriptor for a resource heap with the specified number of descriptor sets.
+        LLGL::ResourceHeapDescriptor GetHeapDesc(bool bindless, std::uint32_t numSets) const
+        {
+            LLGL::ResourceHeapDescriptor heapDesc;
+            heapDesc.pipelineLayout = pipelineLayout;
+            heapDesc.bindless       = bindless;
+
+            for (std::uint32_t i = 0; i < numSets; ++i)
+            {
+                heapDesc.resourceViews.push_back(buffer);
+                if (bindless)
+                {
+                    /* Bindless heaps consume one resource view per table entry */
+                    for (auto texture : textures)
+                        heapDesc.resourceViews.push_back(texture);
+                }
+                else
+                    heapDesc.resourceViews.push_back(textures[i % g_tableSize]);
+                heapDesc.resourceViews.push_back(sampler);
+            }
+
+            return heapDesc;
+        }
+
+    public:
+
+        LLGL::Buffer*               buffer          = nullptr;
+        std::vector<LLGL::Texture*> textures;
+        LLGL::Sampler*              sampler         = nullptr;
+        LLGL::PipelineLayout*       pipelineLayout  = nullptr;
+
+};
+
+static std::unique_ptr<LLGL::RenderSystem> LoadHeadlessOpenGL(LLGL::RenderingDebugger* debugger = nullptr)
+{
+    LLGL::RendererConfigurationOpenGL configGL;
+    {
+        configGL.headless = true;
+    }
+    LLGL::RenderSystemDescriptor rendererDesc;
+    {
+        rendererDesc.moduleName         = "OpenGL";
+        rendererDesc.rendererConfig     = &configGL;
+        rendererDesc.rendererConfigSize = sizeof(configGL);
+    }
+    return LLGL::RenderSystem::Load(rendererDesc, nullptr, debugger);
+}
+
+static void Test_ResourceHeaps()
+{
+    auto renderer = LoadHeadlessOpenGL();
+    const bool isSupported = renderer->GetRenderingCaps().features.hasBindlessResources;
+
+    HeapResources resources{ *renderer };
+
+    /* Regular resource heaps consume one resource view per binding, regardless of array size */
+    auto heap = renderer->CreateResourceHeap(resources.GetHeapDesc(false, 2));
+    Check(heap->GetNumDescriptorSets() == 2, "regular resource heap with texture array binding");
+    renderer->Release(*heap);
+
+    if (isSupported)
+    {
+        /* Bindless resource heaps consume one resource view per table entry */
+        auto bindlessHeap = renderer->CreateResourceHeap(resources.GetHeapDesc(true, 2));
+        Check(bindlessHeap->GetNumDescriptorSets() == 2, "bindless resource heap with texture table");
+        renderer->Release(*bindlessHeap);
+    }
+    else
+    {
+        /* Creating a bindless heap must fail if it is not supported */
+        bool hasThrown = false;
+        try
+        {
+            renderer->CreateResourceHeap(resources.GetHeapDesc(true, 2));
+        }
+        catch (const std::exception&)
+        {
+            hasThrown = true;
+        }
+        Check(hasThrown, "bindless resource heap fails without support");
+    }
+}
+
+static void Test_DebugLayerValidation()
+{
+    ErrorCounter debugger;
+    auto renderer = LoadHeadlessOpenGL(&debugger);
+    const bool isSupported = renderer->GetRenderingCaps().features.hasBindlessResources;
+
+    HeapResources resources{ *renderer };
+
+    /* Only count errors of the resource heap creation */
+    debugger.numUnsupportedFeatures = 0;
+
+    try
+    {
+        renderer->CreateResourceHeap(resources.GetHeapDesc(true, 1));
+    }
+    catch (const std::exception&)
+    {
+        /* Renderer throws after the debug layer reported the error */
+    }
+
+    if (isSupported)
+        Check(debugger.numUnsupportedFeatures == 0, "debug layer accepts bindless resource heap");
+    else
+        Check(debugger.numUnsupportedFeatures == 1, "debug layer reports unsupported bindless resource heap");
+}
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        Test_TableBindings();
+        Test_ResourceHeaps();
+        Test_DebugLayerValidation();
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        ++g_numFailures;
+    }
+
+    std::cout << (g_numFailures == 0 ? "all tests passed" : std::to_string(g_numFailures) + " test(s) failed") << std::endl;
+
+    return (g_numFailures == 0 ? 0 : 1);
+}
+
+
+
+// ================================================================================
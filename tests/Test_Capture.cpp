@@ -0,0 +1,316 @@
+/*
+ * Test_Capture.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/LLGL.h>
+#include <LLGL/RenderingCapture.h>
+#include <LLGL/RendererConfiguration.h>
+#include <LLGL/Blob.h>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
+#include <cstdint>
+
+
+static int g_numFailures = 0;
+
+static void Check(bool condition, const std::string& testName)
+{
+    if (!condition)
+    {
+        std::cerr << "FAILED: " << testName << std::endl;
+        ++g_numFailures;
+    }
+    else
+        std::cout << "passed: " << testName << std::endl;
+}
+
+// Returns true if the specified function throws an std::runtime_error, which is the only exception ReplayCapture is allowed to throw.
+template <typename TFunc>
+static bool ThrowsRuntimeError(TFunc func)
+{
+    try
+    {
+        func();
+    }
+    catch (const std::runtime_error& e)
+    {
+        std::cout << "  (expected exception: " << e.what() << ")" << std::endl;
+        return true;
+    }
+    return false;
+}
+
+// Size of a segment header in the capture: 16-bit identifier followed by the segment size.
+static const std::size_t g_segmentHeaderSize = sizeof(std::uint16_t) + sizeof(std::size_t);
+
+// Byte pattern that is written into the mapped vertex buffer, so the UnmapBuffer segment can be found in the capture.
+static const char g_mappedPattern = static_cast<char>(0x5A);
+
+static std::unique_ptr<LLGL::RenderSystem> LoadRenderer(const std::string& rendererModule, LLGL::RenderingCapture* capture = nullptr)
+{
+    LLGL::RendererConfigurationOpenGL configGL;
+    configGL.headless = true;
+
+    LLGL::RenderSystemDescriptor rendererDesc{ rendererModule };
+    if (rendererModule == "OpenGL")
+    {
+        rendererDesc.rendererConfig     = &configGL;
+        rendererDesc.rendererConfigSize = sizeof(configGL);
+    }
+
+    return LLGL::RenderSystem::Load(rendererDesc, nullptr, nullptr, capture);
+}
+
+// Records a few resources and a single command buffer submission and returns the finalized capture.
+static std::unique_ptr<LLGL::Blob> RecordCapture(const std::string& rendererModule)
+{
+    LLGL::RenderingCapture capture;
+    auto renderer = LoadRenderer(rendererModule, &capture);
+
+    /* Create vertex buffer and overwrite its content via mapped memory */
+    const float vertices[] = { 0.0f, 0.5f, 0.5f, -0.5f, -0.5f, -0.5f };
+
+    LLGL::VertexFormat vertexFormat;
+    vertexFormat.AppendAttribute({ "position", LLGL::Format::RG32Float });
+
+    LLGL::BufferDescriptor bufferDesc;
+    {
+        bufferDesc.size             = sizeof(vertices);
+        bufferDesc.bindFlags        = LLGL::BindFlags::VertexBuffer;
+        bufferDesc.cpuAccessFlags   = LLGL::CPUAccessFlags::ReadWrite;
+        bufferDesc.vertexAttribs    = vertexFormat.attributes;
+    }
+    auto vertexBuffer = renderer->CreateBuffer(bufferDesc, vertices);
+
+    if (auto mappedData = renderer->MapBuffer(*vertexBuffer, LLGL::CPUAccess::WriteOnly))
+        ::memset(mappedData, g_mappedPattern, sizeof(vertices));
+    renderer->UnmapBuffer(*vertexBuffer);
+
+    renderer->WriteBuffer(*vertexBuffer, 0, vertices, sizeof(vertices));
+
+    /* Create texture and sampler */
+    const std::uint32_t texels[4] = { 0xFF0000FF, 0xFF00FF00, 0xFFFF0000, 0xFFFFFFFF };
+
+    LLGL::TextureDescriptor textureDesc;
+    {
+        textureDesc.type        = LLGL::TextureType::Texture2D;
+        textureDesc.format      = LLGL::Format::RGBA8UNorm;
+        textureDesc.extent      = { 2, 2, 1 };
+        textureDesc.mipLevels   = 1;
+    }
+    LLGL::SrcImageDescriptor imageDesc{ LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, texels, sizeof(texels) };
+    auto texture = renderer->CreateTexture(textureDesc, &imageDesc);
+    renderer->CreateSampler({});
+
+    /* Create render target with a color attachment */
+    LLGL::TextureDescriptor colorDesc;
+    {
+        colorDesc.type      = LLGL::TextureType::Texture2D;
+        colorDesc.bindFlags = LLGL::BindFlags::ColorAttachment;
+        colorDesc.format    = LLGL::Format::RGBA8UNorm;
+        colorDesc.extent    = { 16, 16, 1 };
+        colorDesc.mipLevels = 1;
+    }
+    auto colorTexture = renderer->CreateTexture(colorDesc);
+
+    LLGL::RenderTargetDescriptor renderTargetDesc;
+    {
+        renderTargetDesc.resolution = { 16, 16 };
+        renderTargetDesc.attachments.push_back({ LLGL::AttachmentType::Color, colorTexture });
+    }
+    auto renderTarget = renderer->CreateRenderTarget(renderTargetDesc);
+
+    /* Create shaders and graphics pipeline */
+    LLGL::ShaderDescriptor vertShaderDesc{ LLGL::ShaderType::Vertex, "#version 330 core\nin vec2 position;\nvoid main() { gl_Position = vec4(position, 0.0, 1.0); }\n" };
+    LLGL::ShaderDescriptor fragShaderDesc{ LLGL::ShaderType::Fragment, "#version 330 core\nout vec4 color;\nvoid main() { color = vec4(1.0); }\n" };
+    vertShaderDesc.sourceType           = LLGL::ShaderSourceType::CodeString;
+    vertShaderDesc.vertex.inputAttribs  = vertexFormat.attributes;
+    fragShaderDesc.sourceType           = LLGL::ShaderSourceType::CodeString;
+
+    LLGL::ShaderProgramDescriptor programDesc;
+    {
+        programDesc.vertexShader    = renderer->CreateShader(vertShaderDesc);
+        programDesc.fragmentShader  = renderer->CreateShader(fragShaderDesc);
+    }
+    auto shaderProgram = renderer->CreateShaderProgram(programDesc);
+    if (shaderProgram->HasErrors())
+        throw std::runtime_error(shaderProgram->GetReport());
+
+    LLGL::GraphicsPipelineDescriptor pipelineDesc;
+    {
+        pipelineDesc.shaderProgram  = shaderProgram;
+        pipelineDesc.renderPass     = renderTarget->GetRenderPass();
+    }
+    auto pipeline = renderer->CreatePipelineState(pipelineDesc);
+
+    /* Record and submit a single draw call */
+    auto commandQueue = renderer->GetCommandQueue();
+    auto commandBuffer = renderer->CreateCommandBuffer();
+
+    commandBuffer->Begin();
+    {
+        commandBuffer->SetViewport(LLGL::Viewport{ 0.0f, 0.0f, 16.0f, 16.0f });
+        commandBuffer->SetVertexBuffer(*vertexBuffer);
+        commandBuffer->BeginRenderPass(*renderTarget);
+        {
+            commandBuffer->Clear(LLGL::ClearFlags::Color);
+            commandBuffer->SetPipelineState(*pipeline);
+            commandBuffer->Draw(3, 0);
+        }
+        commandBuffer->EndRenderPass();
+        commandBuffer->GenerateMips(*texture);
+    }
+    commandBuffer->End();
+    commandQueue->Submit(*commandBuffer);
+    commandQueue->WaitIdle();
+
+    /* Release an object before the capture ends */
+    renderer->Release(*pipeline);
+
+    return capture.Finalize();
+}
+
+// Returns a copy of the specified capture.
+static std::vector<char> CopyCapture(const LLGL::Blob& capture)
+{
+    auto data = reinterpret_cast<const char*>(capture.GetData());
+    return std::vector<char>(data, data + capture.GetSize());
+}
+
+static LLGL::CaptureReplayStatistics Replay(LLGL::RenderSystem& renderer, const std::vector<char>& capture)
+{
+    auto blob = LLGL::Blob::CreateWeakRef(capture.data(), capture.size());
+    return LLGL::ReplayCapture(renderer, *blob);
+}
+
+// Returns the offset of the data size field of the UnmapBuffer segment, or zero if the segment could not be found.
+static std::size_t FindMappedDataSize(const std::vector<char>& capture, std::uint64_t dataSize)
+{
+    std::vector<char> needle(sizeof(dataSize) + static_cast<std::size_t>(dataSize), g_mappedPattern);
+    ::memcpy(needle.data(), &dataSize, sizeof(dataSize));
+    auto it = std::search(capture.begin(), capture.end(), needle.begin(), needle.end());
+    return (it != capture.end() ? static_cast<std::size_t>(it - capture.begin()) : 0);
+}
+
+static void Test_RoundTrip(const std::string& rendererModule)
+{
+    auto capture = RecordCapture(rendererModule);
+    Check(capture != nullptr && capture->GetSize() > 0, "capture finalized");
+    if (!capture)
+        return;
+
+    auto renderer = LoadRenderer(rendererModule);
+    const auto data = CopyCapture(*capture);
+
+    /* Replay intact capture twice to make sure the replay does not depend on leftover state */
+    auto stats = Replay(*renderer, data);
+    Check(stats.numCommands > 20, "replay intact capture (" + std::to_string(stats.numCommands) + " commands)");
+    Check(stats.numFrames == 0 && stats.frameTimes.empty(), "replay without Present has no frames");
+    Check(Replay(*renderer, data).numCommands == stats.numCommands, "replay intact capture again");
+
+    /* Truncated captures must be rejected at any position */
+    bool allTruncationsRejected = true;
+    const std::size_t stride = std::max<std::size_t>(1, data.size() / 64);
+    for (std::size_t size = 0; size + 1 < data.size(); size += stride)
+    {
+        std::vector<char> truncated(data.begin(), data.begin() + size);
+        try
+        {
+            Replay(*renderer, truncated);
+            std::cerr << "  truncated capture with " << size << " bytes was accepted" << std::endl;
+            allTruncationsRejected = false;
+        }
+        catch (const std::runtime_error&)
+        {
+        }
+    }
+    Check(allTruncationsRejected, "reject truncated captures");
+    Check(ThrowsRuntimeError([&]() { Replay(*renderer, std::vector<char>(data.begin(), data.end() - 1)); }), "reject capture with incomplete terminating segment");
+    Check(ThrowsRuntimeError([&]() { Replay(*renderer, std::vector<char>(data.begin(), data.end() - g_segmentHeaderSize)); }), "reject capture without terminating segment");
+
+    /* Content of mapped memory must match the size of the mapped buffer */
+    const std::uint64_t mappedSize = sizeof(float) * 6;
+    const auto mappedSizeOffset = FindMappedDataSize(data, mappedSize);
+    Check(mappedSizeOffset != 0, "find mapped buffer content in capture");
+    if (mappedSizeOffset != 0)
+    {
+        auto corrupted = data;
+        const std::uint64_t smallerSize = mappedSize - 4;
+        ::memcpy(&corrupted[mappedSizeOffset], &smallerSize, sizeof(smallerSize));
+        Check(ThrowsRuntimeError([&]() { Replay(*renderer, corrupted); }), "reject mapped content smaller than buffer");
+
+        const std::uint64_t largerSize = mappedSize + 4;
+        ::memcpy(&corrupted[mappedSizeOffset], &largerSize, sizeof(largerSize));
+        Check(ThrowsRuntimeError([&]() { Replay(*renderer, corrupted); }), "reject mapped content larger than segment");
+
+        const std::uint64_t hugeSize = ~0ull;
+        ::memcpy(&corrupted[mappedSizeOffset], &hugeSize, sizeof(hugeSize));
+        Check(ThrowsRuntimeError([&]() { Replay(*renderer, corrupted); }), "reject mapped content with overflowing size");
+    }
+
+    /* Corrupted segment sizes must be rejected without reading beyond the capture */
+    std::size_t numSegments = 0;
+    bool allCorruptionsRejected = true;
+    for (std::size_t offset = 0; offset + g_segmentHeaderSize <= data.size(); ++numSegments)
+    {
+        std::uint64_t segmentSize = 0;
+        ::memcpy(&segmentSize, &data[offset + sizeof(std::uint16_t)], sizeof(segmentSize));
+
+        const std::uint64_t corruptedSizes[] =
+        {
+            ~0ull,                                                  // Overflowing size
+            data.size() - offset - g_segmentHeaderSize + 1,         // One byte beyond the capture
+            (segmentSize > 0 ? segmentSize - 1 : segmentSize),      // One byte short (for non-empty segments)
+        };
+
+        for (auto corruptedSize : corruptedSizes)
+        {
+            if (corruptedSize == segmentSize)
+                continue;
+
+            auto corrupted = data;
+            ::memcpy(&corrupted[offset + sizeof(std::uint16_t)], &corruptedSize, sizeof(corruptedSize));
+            try
+            {
+                Replay(*renderer, corrupted);
+                std::cerr << "  corrupted size " << corruptedSize << " of segment " << numSegments << " was accepted" << std::endl;
+                allCorruptionsRejected = false;
+            }
+            catch (const std::runtime_error&)
+            {
+            }
+        }
+
+        offset += g_segmentHeaderSize + static_cast<std::size_t>(segmentSize);
+    }
+    Check(allCorruptionsRejected, "reject corrupted sizes of " + std::to_string(numSegments) + " segments");
+}
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        // OpenGL renderer runs headless, so no window is required
+        Test_RoundTrip(argc > 1 ? argv[1] : "OpenGL");
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        ++g_numFailures;
+    }
+
+    std::cout << (g_numFailures == 0 ? "all tests passed" : std::to_string(g_numFailures) + " test(s) failed") << std::endl;
+
+    return (g_numFailures == 0 ? 0 : 1);
+}
+
+
+
+// ================================================================================
@@ -0,0 +1,212 @@
+/*
+ * Test_FrameGraph.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/LLGL.h>
+#include <LLGL/FrameGraph.h>
+#include <LLGL/RendererConfiguration.h>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <stdexcept>
+#include <cstdint>
+
+
+static int g_numFailures = 0;
+
+static void Check(bool condition, const std::string& testName)
+{
+    if (!condition)
+    {
+        std::cerr << "FAILED: " << testName << std::endl;
+        ++g_numFailures;
+    }
+    else
+        std::cout << "passed: " << testName << std::endl;
+}
+
+// Resolution of all textures in the frame graph
+static const std::uint32_t g_resolution = 64;
+
+// Memory footprint (in bytes) of each texture in the frame graph
+static const std::uint64_t g_textureSize = g_resolution * g_resolution * 4;
+
+// Number of post-processing passes between the scene pass and the final pass
+static const std::uint32_t g_numPostProcessPasses = 4;
+
+static std::unique_ptr<LLGL::RenderSystem> LoadHeadlessOpenGL()
+{
+    LLGL::RendererConfigurationOpenGL configGL;
+    {
+        configGL.headless = true;
+    }
+    LLGL::RenderSystemDescriptor rendererDesc;
+    {
+        rendererDesc.moduleName         = "OpenGL";
+        rendererDesc.rendererConfig     = &configGL;
+        rendererDesc.rendererConfigSize = sizeof(configGL);
+    }
+    return LLGL::RenderSystem::Load(rendererDesc);
+}
+
+static LLGL::TextureDescriptor GetColorTextureDesc()
+{
+    LLGL::TextureDescriptor textureDesc;
+    {
+        textureDesc.type        = LLGL::TextureType::Texture2D;
+        textureDesc.bindFlags   = LLGL::BindFlags::Sampled | LLGL::BindFlags::ColorAttachment;
+        textureDesc.format      = LLGL::Format::RGBA8UNorm;
+        textureDesc.extent      = { g_resolution, g_resolution, 1 };
+        textureDesc.mipLevels   = 1;
+        textureDesc.miscFlags   = LLGL::MiscFlags::NoInitialData;
+    }
+    return textureDesc;
+}
+
+// Adds a pass with a single color attachment that appends its name to the list of executed passes.
+static void AddPass(
+    LLGL::FrameGraph&                               frameGraph,
+    const std::string&                              name,
+    const std::vector<LLGL::FrameGraphResource>&    inputs,
+    const LLGL::FrameGraphAttachment&               colorAttachment,
+    std::vector<std::string>&                       executedPasses)
+{
+    LLGL::FrameGraphPassDescriptor passDesc;
+    {
+        passDesc.name               = name;
+        passDesc.inputs             = inputs;
+        passDesc.colorAttachments   = { colorAttachment };
+        passDesc.execute            = [name, &executedPasses](LLGL::CommandBuffer&) { executedPasses.push_back(name); };
+    }
+    frameGraph.AddPass(passDesc);
+}
+
+// Builds a post-processing chain of equally sized transient textures that ends in the imported output texture,
+// plus three passes whose outputs are never used.
+static void BuildPostProcessGraph(
+    LLGL::FrameGraph&           frameGraph,
+    LLGL::Texture&              outputTexture,
+    const LLGL::ColorRGBAf&     outputColor,
+    std::vector<std::string>&   executedPasses)
+{
+    const auto textureDesc = GetColorTextureDesc();
+
+    auto output = frameGraph.ImportTexture("Output", outputTexture);
+
+    /* Scene pass writes the first transient texture */
+    auto input = frameGraph.CreateTexture("Scene", textureDesc);
+    AddPass(frameGraph, "Scene", {}, { input, LLGL::ClearValue{} }, executedPasses);
+
+    /* Pass whose output is never read is culled */
+    auto unused = frameGraph.CreateTexture("Unused", textureDesc);
+    AddPass(frameGraph, "Unused", { input }, unused, executedPasses);
+
+    /* Post-processing chain ping-pongs between two physical textures */
+    for (std::uint32_t i = 0; i < g_numPostProcessPasses; ++i)
+    {
+        const auto name = "PostProcess" + std::to_string(i);
+        auto target = frameGraph.CreateTexture(name.c_str(), textureDesc);
+        AddPass(frameGraph, name, { input }, target, executedPasses);
+        input = target;
+    }
+
+    /* Chain of passes whose final output is never read is culled entirely */
+    auto debugView = frameGraph.CreateTexture("DebugView", textureDesc);
+    AddPass(frameGraph, "DebugView", { input }, debugView, executedPasses);
+    auto debugOverlay = frameGraph.CreateTexture("DebugOverlay", textureDesc);
+    AddPass(frameGraph, "DebugOverlay", { debugView }, debugOverlay, executedPasses);
+
+    /* Final pass writes the imported texture and is never culled */
+    LLGL::ClearValue clearValue;
+    clearValue.color = outputColor;
+    AddPass(frameGraph, "Final", { input }, { output, clearValue }, executedPasses);
+}
+
+static void Test_PostProcessGraph()
+{
+    auto renderer = LoadHeadlessOpenGL();
+
+    const LLGL::ColorRGBAf outputColor = { 1.0f, 0.0f, 0.0f, 1.0f };
+    auto outputTexture = renderer->CreateTexture(GetColorTextureDesc());
+
+    {
+        std::vector<std::string> executedPasses;
+
+        LLGL::FrameGraph frameGraph{ *renderer };
+        BuildPostProcessGraph(frameGraph, *outputTexture, outputColor, executedPasses);
+        frameGraph.Compile();
+
+        /* Scene pass, post-processing passes, and final pass remain */
+        const auto& stats = frameGraph.GetStatistics();
+        Check(stats.numPasses == g_numPostProcessPasses + 2, "number of executed passes");
+        Check(stats.numCulledPasses == 3, "number of culled passes");
+        Check(stats.numTransientTextures == g_numPostProcessPasses + 1, "number of transient textures");
+        Check(stats.numPhysicalTextures == 2, "post-processing chain aliases two textures");
+        Check(stats.transientMemory == (g_numPostProcessPasses + 1) * g_textureSize, "memory of transient textures");
+        Check(stats.physicalMemory == 2 * g_textureSize, "memory of physical textures");
+
+        /* Imported textures are returned as is */
+        Check(frameGraph.GetTexture(0) == outputTexture, "imported texture");
+
+        /* Record and submit the frame graph */
+        auto commandBuffer = renderer->CreateCommandBuffer();
+        {
+            commandBuffer->Begin();
+            frameGraph.Execute(*commandBuffer);
+            commandBuffer->End();
+        }
+        renderer->GetCommandQueue()->Submit(*commandBuffer);
+        renderer->GetCommandQueue()->WaitIdle();
+
+        std::vector<std::string> expectedPasses = { "Scene" };
+        for (std::uint32_t i = 0; i < g_numPostProcessPasses; ++i)
+            expectedPasses.push_back("PostProcess" + std::to_string(i));
+        expectedPasses.push_back("Final");
+        Check(executedPasses == expectedPasses, "culled passes are not executed and order is preserved");
+
+        /* Recompiling an unchanged frame graph reuses all textures */
+        auto sceneTexture = frameGraph.GetTexture(1);
+        frameGraph.Reset();
+        executedPasses.clear();
+        BuildPostProcessGraph(frameGraph, *outputTexture, outputColor, executedPasses);
+        frameGraph.Compile();
+        Check(frameGraph.GetStatistics().numPhysicalTextures == 2, "recompiled frame graph aliases two textures");
+        Check(frameGraph.GetTexture(1) == sceneTexture, "recompiled frame graph reuses textures");
+        Check(frameGraph.GetTexture(2) == nullptr, "texture of culled pass is not allocated");
+
+        renderer->Release(*commandBuffer);
+    }
+
+    /* Final pass must have cleared the output texture */
+    std::uint8_t texel[4] = {};
+    LLGL::DstImageDescriptor imageDesc{ LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, texel, sizeof(texel) };
+    renderer->ReadTexture(*outputTexture, LLGL::TextureRegion{ LLGL::Offset3D{}, LLGL::Extent3D{ 1, 1, 1 } }, imageDesc);
+    Check(texel[0] == 0xFF && texel[1] == 0x00 && texel[2] == 0x00 && texel[3] == 0xFF, "final pass writes imported texture");
+
+    renderer->Release(*outputTexture);
+}
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        Test_PostProcessGraph();
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        ++g_numFailures;
+    }
+
+    std::cout << (g_numFailures == 0 ? "all tests passed" : std::to_string(g_numFailures) + " test(s) failed") << std::endl;
+
+    return (g_numFailures == 0 ? 0 : 1);
+}
+
+
+
+// ================================================================================
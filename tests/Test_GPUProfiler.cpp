@@ -0,0 +1,258 @@
+/*
+ * Test_GPUProfiler.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/LLGL.h>
+#include <LLGL/GPUProfiler.h>
+#include <LLGL/RendererConfiguration.h>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <stdexcept>
+#include <cstdint>
+
+
+static int g_numFailures = 0;
+
+static void Check(bool condition, const std::string& testName)
+{
+    if (!condition)
+    {
+        std::cerr << "FAILED: " << testName << std::endl;
+        ++g_numFailures;
+    }
+    else
+        std::cout << "passed: " << testName << std::endl;
+}
+
+// Resolution of the render target that is cleared to generate GPU work
+static const std::uint32_t g_resolution = 1024;
+
+// Number of clear commands per measured scope
+static const int g_numClears = 8;
+
+static std::unique_ptr<LLGL::RenderSystem> LoadHeadlessOpenGL()
+{
+    LLGL::RendererConfigurationOpenGL configGL;
+    {
+        configGL.headless = true;
+    }
+    LLGL::RenderSystemDescriptor rendererDesc;
+    {
+        rendererDesc.moduleName         = "OpenGL";
+        rendererDesc.rendererConfig     = &configGL;
+        rendererDesc.rendererConfigSize = sizeof(configGL);
+    }
+    return LLGL::RenderSystem::Load(rendererDesc);
+}
+
+// Creates a render target whose clear commands generate measurable GPU work.
+class ClearTarget
+{
+
+    public:
+
+        ClearTarget(LLGL::RenderSystem& renderer) :
+            renderer_ { renderer }
+        {
+            LLGL::TextureDescriptor textureDesc;
+            {
+                textureDesc.type        = LLGL::TextureType::Texture2D;
+                textureDesc.bindFlags   = LLGL::BindFlags::ColorAttachment;
+                textureDesc.format      = LLGL::Format::RGBA8UNorm;
+                textureDesc.extent      = { g_resolution, g_resolution, 1 };
+                textureDesc.mipLevels   = 1;
+                textureDesc.miscFlags   = LLGL::MiscFlags::NoInitialData;
+            }
+            texture_ = renderer.CreateTexture(textureDesc);
+
+            LLGL::RenderTargetDescriptor renderTargetDesc;
+            {
+                renderTargetDesc.resolution     = { g_resolution, g_resolution };
+                renderTargetDesc.attachments    = { LLGL::AttachmentDescriptor{ LLGL::AttachmentType::Color, texture_ } };
+            }
+            renderTarget_ = renderer.CreateRenderTarget(renderTargetDesc);
+        }
+
+        ~ClearTarget()
+        {
+            renderer_.Release(*renderTarget_);
+            renderer_.Release(*texture_);
+        }
+
+        // Clears the render target several times with alternating colors.
+        void Draw(LLGL::CommandBuffer& commandBuffer)
+        {
+            commandBuffer.BeginRenderPass(*renderTarget_);
+            {
+                for (int i = 0; i < g_numClears; ++i)
+                {
+                    const float value = static_cast<float>(i % 2);
+                    commandBuffer.SetClearColor({ value, 1.0f - value, value, 1.0f });
+                    commandBuffer.Clear(LLGL::ClearFlags::Color);
+                }
+            }
+            commandBuffer.EndRenderPass();
+        }
+
+    private:
+
+        LLGL::RenderSystem& renderer_;
+        LLGL::Texture*      texture_        = nullptr;
+        LLGL::RenderTarget* renderTarget_   = nullptr;
+
+};
+
+// Records one frame with nested scopes, submits it, and waits for the GPU.
+static void RecordFrame(LLGL::RenderSystem& renderer, LLGL::CommandBuffer& commandBuffer, LLGL::GPUProfiler& profiler, ClearTarget& target)
+{
+    auto commandQueue = renderer.GetCommandQueue();
+
+    profiler.BeginFrame();
+    commandBuffer.Begin();
+    {
+        profiler.PushScope(commandBuffer, "Frame");
+        {
+            profiler.PushScope(commandBuffer, "Pass0");
+            {
+                target.Draw(commandBuffer);
+
+                profiler.PushScope(commandBuffer, "Pass0.Inner");
+                target.Draw(commandBuffer);
+                profiler.PopScope(commandBuffer);
+            }
+            profiler.PopScope(commandBuffer);
+
+            profiler.PushScope(commandBuffer, "Pass1");
+            target.Draw(commandBuffer);
+            profiler.PopScope(commandBuffer);
+        }
+        profiler.PopScope(commandBuffer);
+    }
+    commandBuffer.End();
+    commandQueue->Submit(commandBuffer);
+    commandQueue->WaitIdle();
+    profiler.EndFrame();
+}
+
+static bool IsScope(const LLGL::GPUProfileScope& scope, const char* name, std::uint32_t depth)
+{
+    return (scope.name == name && scope.depth == depth);
+}
+
+static void Test_NestedScopes()
+{
+    auto renderer = LoadHeadlessOpenGL();
+    auto commandBuffer = renderer->CreateCommandBuffer();
+    ClearTarget target{ *renderer };
+
+    LLGL::GPUProfilerDescriptor profilerDesc;
+    {
+        profilerDesc.numFramesInFlight = 2;
+    }
+    LLGL::GPUProfiler profiler{ *renderer, *renderer->GetCommandQueue(), profilerDesc };
+
+    Check(profiler.GetLatestFrame().scopes.empty(), "profile is empty before the first frame");
+
+    /* Results of the previous frames are collected at the beginning of the next frame */
+    const int numFrames = 3;
+    for (int i = 0; i < numFrames; ++i)
+        RecordFrame(*renderer, *commandBuffer, profiler, target);
+
+    const auto& frame = profiler.GetLatestFrame();
+    Check(frame.frameIndex == numFrames - 2, "latest frame profile is the newest one available");
+    Check(profiler.GetNumDroppedFrames() == 0, "no frames are dropped when the GPU is idle");
+
+    /* Scopes are listed in the order they were pushed with their nesting depth */
+    const auto& scopes = frame.scopes;
+    Check(scopes.size() == 4, "number of scopes");
+    if (scopes.size() == 4)
+    {
+        Check(IsScope(scopes[0], "Frame", 0), "scope 'Frame' is first at depth 0");
+        Check(IsScope(scopes[1], "Pass0", 1), "scope 'Pass0' is second at depth 1");
+        Check(IsScope(scopes[2], "Pass0.Inner", 2), "scope 'Pass0.Inner' is third at depth 2");
+        Check(IsScope(scopes[3], "Pass1", 1), "scope 'Pass1' is fourth at depth 1");
+
+        bool allNonZero = true;
+        for (const auto& scope : scopes)
+        {
+            std::cout << "  " << std::string(scope.depth * 2, ' ') << scope.name << ": " << scope.elapsedTime << " ns" << std::endl;
+            if (scope.elapsedTime == 0)
+                allNonZero = false;
+        }
+        Check(allNonZero, "all scopes have non-zero timings");
+
+        /* Nested scopes cannot take longer than their parent scope */
+        Check(scopes[0].elapsedTime >= scopes[1].elapsedTime + scopes[3].elapsedTime, "scope 'Frame' encloses its child scopes");
+        Check(scopes[1].elapsedTime >= scopes[2].elapsedTime, "scope 'Pass0' encloses its child scope");
+    }
+
+    renderer->Release(*commandBuffer);
+}
+
+static void Test_ScopeLimit()
+{
+    auto renderer = LoadHeadlessOpenGL();
+    auto commandBuffer = renderer->CreateCommandBuffer();
+    ClearTarget target{ *renderer };
+
+    LLGL::GPUProfilerDescriptor profilerDesc;
+    {
+        profilerDesc.numFramesInFlight = 2;
+        profilerDesc.maxScopesPerFrame = 2;
+    }
+    LLGL::GPUProfiler profiler{ *renderer, *renderer->GetCommandQueue(), profilerDesc };
+
+    /* Scopes that exceed the limit are not measured */
+    for (int i = 0; i < 2; ++i)
+        RecordFrame(*renderer, *commandBuffer, profiler, target);
+    profiler.BeginFrame();
+    profiler.EndFrame();
+
+    const auto& scopes = profiler.GetLatestFrame().scopes;
+    Check(scopes.size() == 2, "scopes that exceed the limit are not measured");
+    if (scopes.size() == 2)
+        Check(IsScope(scopes[0], "Frame", 0) && IsScope(scopes[1], "Pass0", 1), "first scopes within the limit are measured");
+
+    /* Unbalanced scopes are rejected */
+    bool hasThrown = false;
+    try
+    {
+        profiler.BeginFrame();
+        profiler.PushScope(*commandBuffer, "Unbalanced");
+        profiler.EndFrame();
+    }
+    catch (const std::runtime_error&)
+    {
+        hasThrown = true;
+    }
+    Check(hasThrown, "ending frame with open scope fails");
+
+    renderer->Release(*commandBuffer);
+}
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        Test_NestedScopes();
+        Test_ScopeLimit();
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        ++g_numFailures;
+    }
+
+    std::cout << (g_numFailures == 0 ? "all tests passed" : std::to_string(g_numFailures) + " test(s) failed") << std::endl;
+
+    return (g_numFailures == 0 ? 0 : 1);
+}
+
+
+
+// ================================================================================
@@ -0,0 +1,217 @@
+/*
+ * Test_HWObjectCache.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/LLGL.h>
+#include "../sources/Renderer/ContainerTypes.h"
+#include "../sources/Renderer/SamplerUtils.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <stdexcept>
+
+
+static int g_numFailures = 0;
+
+static void Check(bool condition, const std::string& testName)
+{
+    if (!condition)
+    {
+        std::cerr << "FAILED: " << testName << std::endl;
+        ++g_numFailures;
+    }
+    else
+        std::cout << "passed: " << testName << std::endl;
+}
+
+// Descriptor with a single key for the test objects.
+struct TestDescriptor
+{
+    int key;
+};
+
+// Compares the two descriptors in a strict-weak-order (SWO) as required by HWObjectCache.
+static int CompareSWO(const TestDescriptor& lhs, const TestDescriptor& rhs)
+{
+    return (lhs.key < rhs.key ? -1 : (lhs.key > rhs.key ? 1 : 0));
+}
+
+// Object that tracks how many instances are alive.
+struct TestObject
+{
+    TestObject(int key) :
+        key { key }
+    {
+        ++numAlive;
+    }
+
+    ~TestObject()
+    {
+        --numAlive;
+    }
+
+    int         key;
+    static int  numAlive;
+};
+
+int TestObject::numAlive = 0;
+
+using TestObjectCache = LLGL::HWObjectCache<TestObject, TestDescriptor>;
+
+// Acquires the object for the specified key and counts how often the factory is invoked.
+static TestObject* Acquire(TestObjectCache& cache, int key, int& numCreated)
+{
+    return cache.acquire(
+        TestDescriptor{ key },
+        [key, &numCreated]()
+        {
+            ++numCreated;
+            return std::unique_ptr<TestObject>(new TestObject{ key });
+        }
+    );
+}
+
+static void Test_InsertAndLookup()
+{
+    TestObjectCache cache;
+    int numCreated = 0;
+
+    /* Insert objects in unsorted order */
+    const int keys[] = { 5, 1, 9, 3, 7, 0, 8, 2, 6, 4 };
+    std::vector<TestObject*> objects(10, nullptr);
+    for (auto key : keys)
+        objects[key] = Acquire(cache, key, numCreated);
+
+    Check(cache.size() == 10, "insert unique descriptors");
+    Check(numCreated == 10, "factory is invoked once per unique descriptor");
+
+    /* Lookup objects in a different order than they were inserted */
+    bool allFound = true;
+    for (int key = 9; key >= 0; --key)
+    {
+        auto object = Acquire(cache, key, numCreated);
+        if (object != objects[key] || object->key != key)
+            allFound = false;
+    }
+    Check(allFound, "lookup returns the object of an equal descriptor");
+    Check(numCreated == 10, "factory is not invoked for lookup");
+    Check(cache.size() == 10, "lookup does not insert new objects");
+
+    cache.clear();
+    Check(TestObject::numAlive == 0, "clear destroys all objects");
+}
+
+static void Test_DuplicateKeys()
+{
+    TestObjectCache cache;
+    int numCreated = 0;
+
+    /* Acquire the same descriptor three times */
+    auto object0 = Acquire(cache, 42, numCreated);
+    auto object1 = Acquire(cache, 42, numCreated);
+    auto object2 = Acquire(cache, 42, numCreated);
+
+    Check(object0 == object1 && object1 == object2, "duplicate descriptors share the same object");
+    Check(numCreated == 1 && cache.size() == 1, "duplicate descriptors create only one object");
+
+    /* Object is only evicted after it has been released as often as it has been acquired */
+    Check(cache.release(object0) && TestObject::numAlive == 1, "first release keeps shared object alive");
+    Check(cache.release(object1) && TestObject::numAlive == 1, "second release keeps shared object alive");
+    Check(cache.release(object2) && TestObject::numAlive == 0, "last release destroys shared object");
+    Check(cache.size() == 0, "released object is evicted");
+
+    /* Reacquiring an evicted descriptor creates a new object */
+    Acquire(cache, 42, numCreated);
+    Check(numCreated == 2, "evicted descriptor is created again");
+}
+
+static void Test_Eviction()
+{
+    TestObjectCache cache;
+    int numCreated = 0;
+
+    std::vector<TestObject*> objects;
+    for (int key = 0; key < 8; ++key)
+        objects.push_back(Acquire(cache, key, numCreated));
+
+    /* Evict every other object, so the sorted entries must be compacted */
+    for (int key = 0; key < 8; key += 2)
+        cache.release(objects[key]);
+
+    Check(cache.size() == 4 && TestObject::numAlive == 4, "release evicts unreferenced objects");
+
+    /* Remaining objects can still be found, evicted ones are created again */
+    bool remainingFound = true;
+    for (int key = 1; key < 8; key += 2)
+    {
+        if (Acquire(cache, key, numCreated) != objects[key])
+            remainingFound = false;
+    }
+    Check(remainingFound && numCreated == 8, "remaining objects are found after eviction");
+
+    Acquire(cache, 4, numCreated);
+    Check(numCreated == 9 && cache.size() == 5, "evicted object is recreated");
+
+    /* Releasing objects that are not part of the cache fails */
+    TestObject foreignObject{ 4 };
+    Check(!cache.release(&foreignObject), "release of unknown object fails");
+
+    cache.clear();
+    Check(cache.size() == 0 && TestObject::numAlive == 1, "clear destroys objects regardless of their references");
+}
+
+static void Test_SamplerDescriptors()
+{
+    LLGL::HWSamplerCache<TestObject> cache;
+
+    auto Acquire = [&cache](const LLGL::SamplerDescriptor& desc, int key)
+    {
+        return cache.acquire(desc, [key]() { return std::unique_ptr<TestObject>(new TestObject{ key }); });
+    };
+
+    /* Equal sampler descriptors share the same object, while any different attribute creates a new one */
+    LLGL::SamplerDescriptor defaultDesc;
+
+    LLGL::SamplerDescriptor anisotropyDesc;
+    anisotropyDesc.maxAnisotropy = 16;
+
+    LLGL::SamplerDescriptor addressModeDesc;
+    addressModeDesc.addressModeU = LLGL::SamplerAddressMode::Clamp;
+
+    auto object0 = Acquire(defaultDesc, 0);
+    auto object1 = Acquire(anisotropyDesc, 1);
+    auto object2 = Acquire(addressModeDesc, 2);
+    auto object3 = Acquire(LLGL::SamplerDescriptor{}, 3);
+
+    Check(object0 != object1 && object0 != object2 && object1 != object2, "different sampler descriptors create different objects");
+    Check(object3 == object0, "equal sampler descriptors share the same object");
+    Check(cache.size() == 3, "number of unique sampler objects");
+}
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        Test_InsertAndLookup();
+        Test_DuplicateKeys();
+        Test_Eviction();
+        Test_SamplerDescriptors();
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        ++g_numFailures;
+    }
+
+    std::cout << (g_numFailures == 0 ? "all tests passed" : std::to_string(g_numFailures) + " test(s) failed") << std::endl;
+
+    return (g_numFailures == 0 ? 0 : 1);
+}
+
+
+
+// ================================================================================
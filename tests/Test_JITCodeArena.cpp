@@ -0,0 +1,158 @@
+/*
+ * Test_JITCodeArena.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "../sources/JIT/JITCodeArena.h"
+#include "../sources/JIT/JITProgram.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <stdexcept>
+#include <cstdint>
+
+
+static int g_numFailures = 0;
+
+static void Check(bool condition, const std::string& testName)
+{
+    if (!condition)
+    {
+        std::cerr << "FAILED: " << testName << std::endl;
+        ++g_numFailures;
+    }
+    else
+        std::cout << "passed: " << testName << std::endl;
+}
+
+#if defined __x86_64__ || defined _M_X64 || defined __i386__ || defined _M_IX86
+#   define TEST_JIT_EXECUTE
+#endif
+
+// Returns a program that immediately returns to the caller, padded with NOPs to the specified size.
+static std::vector<std::uint8_t> GetReturnProgram(std::size_t size)
+{
+    #ifdef TEST_JIT_EXECUTE
+    std::vector<std::uint8_t> code(size, 0x90); // NOP
+    code[0] = 0xC3;                             // RET
+    #else
+    std::vector<std::uint8_t> code(size, 0x00);
+    #endif
+    return code;
+}
+
+static std::unique_ptr<LLGL::JITProgram> CreateProgram(std::size_t size)
+{
+    const auto code = GetReturnProgram(size);
+    return LLGL::JITProgram::Create(code.data(), code.size());
+}
+
+// Owns a program that is only freed after main() returned, i.e. during static destruction.
+struct StaticProgram
+{
+    ~StaticProgram()
+    {
+        program.reset();
+        std::cout << "passed: free program during static destruction" << std::endl;
+    }
+
+    std::unique_ptr<LLGL::JITProgram> program;
+};
+
+static StaticProgram g_staticProgram;
+
+static void Test_Singleton()
+{
+    Check(&LLGL::JITCodeArena::Get() == &LLGL::JITCodeArena::Get(), "arena is a singleton");
+}
+
+static void Test_SmallPrograms()
+{
+    auto& arena = LLGL::JITCodeArena::Get();
+    const auto initialStats = arena.GetStatistics();
+
+    /* Small programs share the same chunk */
+    const std::size_t numPrograms = 64;
+    std::vector<std::unique_ptr<LLGL::JITProgram>> programs;
+    for (std::size_t i = 0; i < numPrograms; ++i)
+        programs.push_back(CreateProgram(10));
+
+    auto stats = arena.GetStatistics();
+    Check(stats.numChunks == 1, "small programs share one chunk");
+    Check(stats.numPrograms == initialStats.numPrograms + numPrograms, "number of live programs");
+    Check(stats.liveSize == initialStats.liveSize + numPrograms * 16, "programs are aligned to 16 bytes");
+
+    #ifdef TEST_JIT_EXECUTE
+    /* Programs are executable after allocation */
+    for (const auto& program : programs)
+        program->GetEntryPoint()();
+    Check(true, "execute programs");
+    #endif
+
+    /* Chunk is reclaimed once all of its programs are freed */
+    programs.clear();
+
+    stats = arena.GetStatistics();
+    Check(stats.numPrograms == initialStats.numPrograms, "all programs are freed");
+    Check(stats.usedSize == 0, "chunk is reclaimed after all programs are freed");
+    Check(stats.numReclaimedChunks > initialStats.numReclaimedChunks, "number of reclaimed chunks");
+}
+
+static void Test_LargeProgram()
+{
+    auto& arena = LLGL::JITCodeArena::Get();
+
+    /* Programs larger than the default chunk size get their own chunk, which is filled up entirely by this program */
+    const std::size_t largeSize = 128 * 1024;
+    auto largeProgram = CreateProgram(largeSize);
+
+    auto stats = arena.GetStatistics();
+    Check(stats.reservedSize >= largeSize, "large program is allocated in a larger chunk");
+
+    #ifdef TEST_JIT_EXECUTE
+    largeProgram->GetEntryPoint()();
+    #endif
+
+    /* Next program does not fit into the chunk of the large program anymore */
+    auto smallProgram = CreateProgram(10);
+    stats = arena.GetStatistics();
+    Check(stats.numChunks == 2, "small program is allocated in a new chunk");
+
+    /* Chunk of the large program is released once it is freed, because it is no longer the current chunk */
+    const auto numReclaimedChunks = stats.numReclaimedChunks;
+    largeProgram.reset();
+    stats = arena.GetStatistics();
+    Check(stats.numChunks == 1, "chunk of freed large program is released");
+    Check(stats.numReclaimedChunks == numReclaimedChunks + 1, "release of large chunk is counted");
+
+    smallProgram.reset();
+}
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        Test_Singleton();
+        Test_SmallPrograms();
+        Test_LargeProgram();
+
+        /* Keep one program alive until static destruction */
+        g_staticProgram.program = CreateProgram(10);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        ++g_numFailures;
+    }
+
+    std::cout << (g_numFailures == 0 ? "all tests passed" : std::to_string(g_numFailures) + " test(s) failed") << std::endl;
+
+    return (g_numFailures == 0 ? 0 : 1);
+}
+
+
+
+// ================================================================================
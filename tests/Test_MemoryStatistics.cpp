@@ -0,0 +1,160 @@
+/*
+ * Test_MemoryStatistics.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/LLGL.h>
+#include <LLGL/RendererConfiguration.h>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <stdexcept>
+#include <cstdint>
+
+
+static int g_numFailures = 0;
+
+static void Check(bool condition, const std::string& testName)
+{
+    if (!condition)
+    {
+        std::cerr << "FAILED: " << testName << std::endl;
+        ++g_numFailures;
+    }
+    else
+        std::cout << "passed: " << testName << std::endl;
+}
+
+static std::unique_ptr<LLGL::RenderSystem> LoadHeadlessOpenGL()
+{
+    LLGL::RendererConfigurationOpenGL configGL;
+    {
+        configGL.headless = true;
+    }
+    LLGL::RenderSystemDescriptor rendererDesc;
+    {
+        rendererDesc.moduleName         = "OpenGL";
+        rendererDesc.rendererConfig     = &configGL;
+        rendererDesc.rendererConfigSize = sizeof(configGL);
+    }
+    return LLGL::RenderSystem::Load(rendererDesc);
+}
+
+static LLGL::TextureDescriptor GetTextureDesc(LLGL::Format format, long bindFlags, std::uint32_t size, std::uint32_t mipLevels)
+{
+    LLGL::TextureDescriptor textureDesc;
+    {
+        textureDesc.type        = LLGL::TextureType::Texture2D;
+        textureDesc.bindFlags   = bindFlags;
+        textureDesc.format      = format;
+        textureDesc.extent      = { size, size, 1 };
+        textureDesc.mipLevels   = mipLevels;
+        textureDesc.miscFlags   = LLGL::MiscFlags::NoInitialData;
+    }
+    return textureDesc;
+}
+
+// Returns the statistics of the single heap the GL backend reports.
+static LLGL::MemoryStatistics QueryStats(LLGL::RenderSystem& renderer)
+{
+    LLGL::MemoryStatistics stats;
+    if (!renderer.QueryMemoryStatistics(stats))
+        throw std::runtime_error("failed to query memory statistics");
+    if (stats.heaps.size() != 1)
+        throw std::runtime_error("expected a single memory heap for OpenGL, but got " + std::to_string(stats.heaps.size()));
+    return stats;
+}
+
+static std::uint64_t GetAllocatedBytes(LLGL::RenderSystem& renderer)
+{
+    return QueryStats(renderer).heaps.front().allocatedBytes;
+}
+
+static void Test_Buffers(LLGL::RenderSystem& renderer)
+{
+    const auto initialStats = QueryStats(renderer);
+
+    LLGL::BufferDescriptor bufferDesc;
+    {
+        bufferDesc.size         = 1024;
+        bufferDesc.bindFlags    = LLGL::BindFlags::VertexBuffer;
+    }
+    auto buffer0 = renderer.CreateBuffer(bufferDesc);
+
+    bufferDesc.size         = 256;
+    bufferDesc.bindFlags    = LLGL::BindFlags::ConstantBuffer;
+    auto buffer1 = renderer.CreateBuffer(bufferDesc);
+
+    const auto stats = QueryStats(renderer);
+    const auto& heap = stats.heaps.front();
+    const auto& initialHeap = initialStats.heaps.front();
+
+    Check(stats.numBuffers == initialStats.numBuffers + 2, "number of buffers");
+    Check(heap.allocatedBytes == initialHeap.allocatedBytes + 1024 + 256, "allocated bytes of buffers");
+    Check(heap.usedBytes == heap.allocatedBytes, "used bytes equal allocated bytes");
+    Check(heap.numAllocations == initialHeap.numAllocations + 2, "number of allocations for buffers");
+    Check(heap.deviceLocal, "heap is device local");
+
+    renderer.Release(*buffer0);
+    renderer.Release(*buffer1);
+
+    const auto finalStats = QueryStats(renderer);
+    Check(finalStats.numBuffers == initialStats.numBuffers, "number of buffers after release");
+    Check(finalStats.heaps.front().allocatedBytes == initialHeap.allocatedBytes, "allocated bytes after releasing buffers");
+}
+
+static void Test_Textures(LLGL::RenderSystem& renderer)
+{
+    const auto initialStats = QueryStats(renderer);
+    const auto initialBytes = initialStats.heaps.front().allocatedBytes;
+
+    /* Texture with a single MIP-map: 64 * 64 * 4 bytes */
+    auto texture0 = renderer.CreateTexture(GetTextureDesc(LLGL::Format::RGBA8UNorm, LLGL::BindFlags::Sampled, 64, 1));
+    Check(GetAllocatedBytes(renderer) == initialBytes + 16384, "allocated bytes of texture with one MIP-map");
+
+    /* Texture with full MIP-chain: (64^2 + 32^2 + 16^2 + 8^2 + 4^2 + 2^2 + 1^2) * 4 bytes */
+    auto texture1 = renderer.CreateTexture(GetTextureDesc(LLGL::Format::RGBA8UNorm, LLGL::BindFlags::Sampled, 64, 0));
+    Check(GetAllocatedBytes(renderer) == initialBytes + 16384 + 21844, "allocated bytes of texture with full MIP-chain");
+
+    /* Depth attachment is stored in a renderbuffer: 64 * 64 * 4 bytes */
+    auto texture2 = renderer.CreateTexture(GetTextureDesc(LLGL::Format::D32Float, LLGL::BindFlags::DepthStencilAttachment, 64, 1));
+    Check(GetAllocatedBytes(renderer) == initialBytes + 16384 + 21844 + 16384, "allocated bytes of depth renderbuffer");
+
+    const auto stats = QueryStats(renderer);
+    Check(stats.numTextures == initialStats.numTextures + 3, "number of textures");
+    Check(stats.heaps.front().numAllocations == initialStats.heaps.front().numAllocations + 3, "number of allocations for textures");
+
+    renderer.Release(*texture0);
+    renderer.Release(*texture1);
+    renderer.Release(*texture2);
+
+    const auto finalStats = QueryStats(renderer);
+    Check(finalStats.numTextures == initialStats.numTextures, "number of textures after release");
+    Check(finalStats.heaps.front().allocatedBytes == initialBytes, "allocated bytes after releasing textures");
+}
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        auto renderer = LoadHeadlessOpenGL();
+        Test_Buffers(*renderer);
+        Test_Textures(*renderer);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        ++g_numFailures;
+    }
+
+    std::cout << (g_numFailures == 0 ? "all tests passed" : std::to_string(g_numFailures) + " test(s) failed") << std::endl;
+
+    return (g_numFailures == 0 ? 0 : 1);
+}
+
+
+
+// ================================================================================
@@ -52,6 +52,7 @@ struct TestConfig
     std::uint32_t   textureSize = 512;
     std::uint32_t   arrayLayers = 32;
     std::uint32_t   numMipMaps  = 5;
+    bool            computeMips = false;
 };
 
 class PerformanceTest
@@ -99,6 +100,8 @@ class PerformanceTest
                 textureDesc.extent.width    = image.GetExtent().width;
                 textureDesc.extent.height   = image.GetExtent().height;
                 textureDesc.arrayLayers     = image.GetExtent().depth;
+                if (config.computeMips)
+                    textureDesc.bindFlags |= LLGL::BindFlags::Storage;
             }
             for (std::size_t i = 0; i < numTextures; ++i)
             {
@@ -157,8 +160,17 @@ class PerformanceTest
             // Store test configuration
             config = testConfig;
 
-            // Load renderer
-            renderer = LLGL::RenderSystem::Load(rendererModule);
+            // Load renderer (optionally with compute shader MIP-map generation for Vulkan)
+            LLGL::RendererConfigurationVulkan configVK;
+            configVK.computeMips = config.computeMips;
+
+            LLGL::RenderSystemDescriptor rendererDesc = rendererModule;
+            if (rendererModule == "Vulkan")
+            {
+                rendererDesc.rendererConfig     = &configVK;
+                rendererDesc.rendererConfigSize = sizeof(configVK);
+            }
+            renderer = LLGL::RenderSystem::Load(rendererDesc);
 
             // Create render context
             LLGL::RenderContextDescriptor contextDesc;
@@ -215,6 +227,14 @@ int main(int argc, char* argv[])
     testConfig.arrayLayers  = 32;//512 or 32
     testConfig.numMipMaps   = 3;
 
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::string(argv[i]) == "-compute-mips")
+            testConfig.computeMips = true;
+        else
+            rendererModule = argv[i];
+    }
+
     PerformanceTest test;
     test.Load(rendererModule, testConfig);
     test.Run();
@@ -0,0 +1,345 @@
+/*
+ * Test_ShaderCache.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/LLGL.h>
+#include <LLGL/RendererConfiguration.h>
+#include "../sources/Renderer/ShaderCache.h"
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <iterator>
+#include <stdexcept>
+#include <cstdio>
+#include <cstdint>
+
+#ifdef _WIN32
+#   include <direct.h>
+#else
+#   include <sys/stat.h>
+#endif
+
+
+static int g_numFailures = 0;
+
+static void Check(bool condition, const std::string& testName)
+{
+    if (!condition)
+    {
+        std::cerr << "FAILED: " << testName << std::endl;
+        ++g_numFailures;
+    }
+    else
+        std::cout << "passed: " << testName << std::endl;
+}
+
+// Size of the header of each cache entry file (see ShaderCacheEntryHeader in ShaderCache.cpp).
+static const std::size_t g_entryHeaderSize = 32;
+
+static const LLGL::ShaderCache::Key g_key0 = 0x0123456789ABCDEFull;
+static const LLGL::ShaderCache::Key g_key1 = 0xFEDCBA9876543210ull;
+
+static std::string GetEntryFilename(const std::string& path, LLGL::ShaderCache::Key key)
+{
+    char name[17];
+    std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(key));
+    return path + "/" + name + ".bin";
+}
+
+static bool FileExists(const std::string& filename)
+{
+    return std::ifstream{ filename }.good();
+}
+
+static LLGL::ShaderCacheDescriptor GetCacheDesc(const std::string& path, std::uint64_t maxSize = 1024*1024)
+{
+    LLGL::ShaderCacheDescriptor desc;
+    {
+        desc.path       = path;
+        desc.maxSize    = maxSize;
+    }
+    return desc;
+}
+
+// Creates an empty cache directory for the specified test.
+static std::string MakeCacheDir(const std::string& name)
+{
+    const std::string path = "ShaderCacheTest_" + name;
+
+    #ifdef _WIN32
+    _mkdir(path.c_str());
+    #else
+    mkdir(path.c_str(), 0755);
+    #endif
+
+    /* Evict all entries from previous runs with a cache of zero size */
+    LLGL::ShaderCache cache{ GetCacheDesc(path, 0) };
+
+    return path;
+}
+
+static bool BlobEquals(const LLGL::Blob* blob, const std::string& data)
+{
+    return (blob != nullptr && blob->GetSize() == data.size() && std::string(static_cast<const char*>(blob->GetData()), blob->GetSize()) == data);
+}
+
+static void Test_RoundTrip()
+{
+    const auto path = MakeCacheDir("RoundTrip");
+    const std::string data0 = "first shader cache entry";
+    const std::string data1 = "second shader cache entry";
+
+    {
+        LLGL::ShaderCache cache{ GetCacheDesc(path) };
+        Check(cache.Load(g_key0) == nullptr, "round trip: empty cache misses");
+        Check(cache.Store(g_key0, data0.data(), data0.size()), "round trip: store entry");
+        Check(cache.Store(g_key1, data1.data(), data1.size()), "round trip: store second entry");
+        Check(BlobEquals(cache.Load(g_key0).get(), data0), "round trip: load entry from same cache");
+
+        const auto stats = cache.GetStatistics();
+        Check(stats.numHits == 1 && stats.numMisses == 1 && stats.numWrites == 2, "round trip: statistics count hits, misses, and writes");
+        Check(stats.totalSize == 2 * g_entryHeaderSize + data0.size() + data1.size(), "round trip: total size includes entry headers");
+    }
+
+    /* Index must have been written on destruction */
+    {
+        LLGL::ShaderCache cache{ GetCacheDesc(path) };
+        Check(BlobEquals(cache.Load(g_key0).get(), data0), "round trip: load first entry from new cache");
+        Check(BlobEquals(cache.Load(g_key1).get(), data1), "round trip: load second entry from new cache");
+        Check(cache.GetStatistics().numCorrupted == 0, "round trip: no corrupted entries");
+    }
+}
+
+static void Test_ReplaceEntry()
+{
+    const auto path = MakeCacheDir("ReplaceEntry");
+    const std::string dataOld = "old";
+    const std::string dataNew = "new entry with different size";
+
+    LLGL::ShaderCache cache{ GetCacheDesc(path) };
+    cache.Store(g_key0, dataOld.data(), dataOld.size());
+    cache.Store(g_key0, dataNew.data(), dataNew.size());
+
+    Check(BlobEquals(cache.Load(g_key0).get(), dataNew), "replace entry: load latest data");
+    Check(cache.GetStatistics().totalSize == g_entryHeaderSize + dataNew.size(), "replace entry: total size only counts latest entry");
+}
+
+// Stores a single entry in a new cache and modifies its file with the specified function before it is loaded by another cache.
+template <typename TModifier>
+static void TestModifiedEntry(const std::string& name, TModifier modifier)
+{
+    const auto path = MakeCacheDir(name);
+    const std::string data0 = "shader cache entry that will be modified";
+    const std::string data1 = std::string(data0.size(), 'k');
+
+    {
+        LLGL::ShaderCache cache{ GetCacheDesc(path) };
+        cache.Store(g_key0, data0.data(), data0.size());
+        cache.Store(g_key1, data1.data(), data1.size());
+    }
+
+    modifier(path);
+
+    LLGL::ShaderCache cache{ GetCacheDesc(path) };
+    Check(cache.Load(g_key0) == nullptr, name + ": modified entry is rejected");
+
+    const auto stats = cache.GetStatistics();
+    Check(stats.numCorrupted == 1 && stats.numMisses == 1 && stats.numHits == 0, name + ": entry is counted as corrupted");
+    Check(!FileExists(GetEntryFilename(path, g_key0)), name + ": modified entry file is removed");
+    Check(stats.totalSize == g_entryHeaderSize + data1.size(), name + ": total size no longer includes modified entry");
+
+    Check(cache.Load(g_key0) == nullptr && cache.GetStatistics().numCorrupted == 1, name + ": second lookup is a regular miss");
+    Check(BlobEquals(cache.Load(g_key1).get(), data1), name + ": other entry is still valid");
+}
+
+static void Test_CorruptedEntry()
+{
+    TestModifiedEntry(
+        "CorruptedEntry",
+        [](const std::string& path)
+        {
+            /* Flip one byte of the entry data, so the checksum does not match */
+            std::fstream file{ GetEntryFilename(path, g_key0), std::ios::in | std::ios::out | std::ios::binary };
+            file.seekg(g_entryHeaderSize + 4);
+            char c = 0;
+            file.read(&c, 1);
+            c ^= 0x5A;
+            file.seekp(g_entryHeaderSize + 4);
+            file.write(&c, 1);
+        }
+    );
+}
+
+static void Test_TruncatedEntry()
+{
+    TestModifiedEntry(
+        "TruncatedEntry",
+        [](const std::string& path)
+        {
+            /* Rewrite entry file with only the header and a few bytes of its data */
+            const auto filename = GetEntryFilename(path, g_key0);
+            std::string content;
+            {
+                std::ifstream file{ filename, std::ios::in | std::ios::binary };
+                content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            }
+            std::ofstream file{ filename, std::ios::out | std::ios::binary | std::ios::trunc };
+            file.write(content.data(), static_cast<std::streamsize>(g_entryHeaderSize + 8));
+        }
+    );
+}
+
+static void Test_KeyMismatch()
+{
+    TestModifiedEntry(
+        "KeyMismatch",
+        [](const std::string& path)
+        {
+            /* Replace entry file with the entry of another key that has the same size and a valid checksum */
+            std::ifstream src{ GetEntryFilename(path, g_key1), std::ios::in | std::ios::binary };
+            std::ofstream dst{ GetEntryFilename(path, g_key0), std::ios::out | std::ios::binary | std::ios::trunc };
+            dst << src.rdbuf();
+        }
+    );
+}
+
+static void Test_Eviction()
+{
+    const auto path = MakeCacheDir("Eviction");
+    const std::string data(64, 'x');
+    const std::uint64_t entrySize = g_entryHeaderSize + data.size();
+
+    /* Cache has room for two entries only */
+    LLGL::ShaderCache cache{ GetCacheDesc(path, entrySize * 2) };
+    cache.Store(1, data.data(), data.size());
+    cache.Store(2, data.data(), data.size());
+
+    /* Use entry 1, so entry 2 is the least recently used one */
+    cache.Load(1);
+    cache.Store(3, data.data(), data.size());
+
+    const auto stats = cache.GetStatistics();
+    Check(stats.numEvictions == 1 && stats.totalSize == entrySize * 2, "eviction: one entry is evicted");
+    Check(cache.Load(1) != nullptr && cache.Load(3) != nullptr, "eviction: recently used entries are kept");
+    Check(cache.Load(2) == nullptr && !FileExists(GetEntryFilename(path, 2)), "eviction: least recently used entry is removed");
+    Check(!cache.Store(4, nullptr, static_cast<std::size_t>(entrySize * 2)), "eviction: entry larger than the cache is rejected");
+}
+
+// Creates the specified number of distinct shader programs and returns the elapsed time in milliseconds.
+static double CreateShaderPrograms(LLGL::RenderSystem& renderer, int numPrograms)
+{
+    const auto startTime = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < numPrograms; ++i)
+    {
+        const std::string index     = std::to_string(i);
+        const std::string vertSrc   = "#version 330 core\nin vec2 position;\nout vec2 coord;\nvoid main() { coord = position * " + index + ".0; gl_Position = vec4(position, 0.0, 1.0); }\n";
+        const std::string fragSrc   = "#version 330 core\nin vec2 coord;\nout vec4 color;\nvoid main() { color = vec4(sin(coord * " + index + ".5), 0.0, 1.0); }\n";
+
+        LLGL::ShaderDescriptor vertShaderDesc{ LLGL::ShaderType::Vertex, vertSrc.c_str() };
+        LLGL::ShaderDescriptor fragShaderDesc{ LLGL::ShaderType::Fragment, fragSrc.c_str() };
+        vertShaderDesc.sourceType = LLGL::ShaderSourceType::CodeString;
+        vertShaderDesc.vertex.inputAttribs.push_back({ "position", LLGL::Format::RG32Float });
+        fragShaderDesc.sourceType = LLGL::ShaderSourceType::CodeString;
+
+        LLGL::ShaderProgramDescriptor programDesc;
+        {
+            programDesc.vertexShader    = renderer.CreateShader(vertShaderDesc);
+            programDesc.fragmentShader  = renderer.CreateShader(fragShaderDesc);
+        }
+        auto shaderProgram = renderer.CreateShaderProgram(programDesc);
+
+        if (shaderProgram->HasErrors())
+            throw std::runtime_error(shaderProgram->GetReport());
+
+        /* Reflection waits until the program is linked, which also stores the program in the cache */
+        LLGL::ShaderReflection reflection;
+        shaderProgram->Reflect(reflection);
+    }
+
+    const auto endTime = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(endTime - startTime).count();
+}
+
+static double GetHitRate(const LLGL::ShaderCacheStatistics& stats)
+{
+    const auto numLookups = stats.numHits + stats.numMisses;
+    return (numLookups > 0 ? static_cast<double>(stats.numHits) / static_cast<double>(numLookups) : 0.0);
+}
+
+// Creates the same shader programs with a cold and a warm cache on headless OpenGL and prints the hit rates and timings.
+static void Test_HitRateBenchmark()
+{
+    const int numPrograms = 24;
+
+    const auto path = MakeCacheDir("HitRate");
+
+    LLGL::RendererConfigurationOpenGL configGL;
+    configGL.headless           = true;
+    configGL.shaderCache.path   = path;
+
+    LLGL::RenderSystemDescriptor rendererDesc{ "OpenGL" };
+    {
+        rendererDesc.rendererConfig     = &configGL;
+        rendererDesc.rendererConfigSize = sizeof(configGL);
+    }
+
+    for (int run = 0; run < 2; ++run)
+    {
+        const bool isWarm   = (run > 0);
+        const auto runName  = std::string(isWarm ? "warm" : "cold");
+
+        auto renderer = LLGL::RenderSystem::Load(rendererDesc);
+
+        const double elapsedTime = CreateShaderPrograms(*renderer, numPrograms);
+
+        LLGL::ShaderCacheStatistics stats;
+        if (!renderer->QueryShaderCacheStatistics(stats))
+        {
+            /* Shader cache requires GL_ARB_get_program_binary */
+            std::cout << "skipped: hit-rate benchmark (shader cache not supported by OpenGL driver)" << std::endl;
+            return;
+        }
+
+        std::cout << "hit-rate benchmark (" << runName << " cache, " << numPrograms << " programs): "
+            << "hits = " << stats.numHits << ", misses = " << stats.numMisses << ", hit rate = " << (GetHitRate(stats) * 100.0) << "%, "
+            << "writes = " << stats.numWrites << ", time = " << elapsedTime << " ms" << std::endl;
+
+        if (isWarm)
+            Check(stats.numMisses == 0 && stats.numHits > 0 && stats.numWrites == 0, "hit-rate benchmark: warm cache serves all shaders and programs");
+        else
+            Check(stats.numHits == 0 && stats.numWrites == stats.numMisses, "hit-rate benchmark: cold cache stores all shaders and programs");
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        Test_RoundTrip();
+        Test_ReplaceEntry();
+        Test_CorruptedEntry();
+        Test_TruncatedEntry();
+        Test_KeyMismatch();
+        Test_Eviction();
+        Test_HitRateBenchmark();
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        ++g_numFailures;
+    }
+
+    std::cout << (g_numFailures == 0 ? "all tests passed" : std::to_string(g_numFailures) + " test(s) failed") << std::endl;
+
+    return (g_numFailures == 0 ? 0 : 1);
+}
+
+
+
+// ================================================================================
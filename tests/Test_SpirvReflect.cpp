@@ -0,0 +1,175 @@
+/*
+ * Test_SpirvReflect.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "../sources/Renderer/SPIRV/SPIRVReflect.h"
+#include "../sources/Core/Helper.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <stdexcept>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+
+
+static int g_numFailures = 0;
+
+static void Check(bool condition, const std::string& testName)
+{
+    if (!condition)
+    {
+        std::cerr << "FAILED: " << testName << std::endl;
+        ++g_numFailures;
+    }
+    else
+        std::cout << "passed: " << testName << std::endl;
+}
+
+static bool NameEquals(const char* name, const char* expectedName)
+{
+    return (name != nullptr && std::strcmp(name, expectedName) == 0);
+}
+
+static const LLGL::SPIRVReflect::SpvUniform* FindUniform(const LLGL::SPIRVReflect& reflect, std::uint32_t binding)
+{
+    for (const auto& uniform : reflect.GetUniforms())
+    {
+        if (uniform.binding == binding)
+            return &uniform;
+    }
+    return nullptr;
+}
+
+static const LLGL::SPIRVReflect::SpvVarying* FindVarying(const LLGL::SPIRVReflect& reflect, const char* name)
+{
+    for (const auto& varying : reflect.GetVaryings())
+    {
+        if (NameEquals(varying.name, name))
+            return &varying;
+    }
+    return nullptr;
+}
+
+static bool IsUniform(const LLGL::SPIRVReflect& reflect, std::uint32_t binding, const char* name, std::uint32_t size)
+{
+    auto uniform = FindUniform(reflect, binding);
+    return (uniform != nullptr && NameEquals(uniform->name, name) && uniform->size == size);
+}
+
+static bool IsVarying(const LLGL::SPIRVReflect& reflect, const char* name, std::uint32_t location, bool input)
+{
+    auto varying = FindVarying(reflect, name);
+    return (varying != nullptr && varying->location == location && varying->input == input);
+}
+
+static void Test_TriangleVert(const LLGL::SPIRVReflect& reflect)
+{
+    Check(reflect.GetUniforms().size() == 1, "Triangle.vert: number of uniforms");
+    Check(IsUniform(reflect, 2, "Matrices", 128), "Triangle.vert: uniform buffer 'Matrices'");
+    Check(IsVarying(reflect, "coord", 0, true), "Triangle.vert: input 'coord'");
+    Check(IsVarying(reflect, "texCoord", 1, true), "Triangle.vert: input 'texCoord'");
+    Check(IsVarying(reflect, "color", 2, true), "Triangle.vert: input 'color'");
+    Check(IsVarying(reflect, "vColor", 0, false), "Triangle.vert: output 'vColor'");
+    Check(IsVarying(reflect, "vTexCoord", 1, false), "Triangle.vert: output 'vTexCoord'");
+}
+
+static void Test_TriangleFrag(const LLGL::SPIRVReflect& reflect)
+{
+    Check(reflect.GetUniforms().size() == 3, "Triangle.frag: number of uniforms");
+    Check(IsUniform(reflect, 5, "Colors", 16), "Triangle.frag: uniform buffer 'Colors'");
+    Check(IsUniform(reflect, 4, "tex", 0), "Triangle.frag: texture 'tex'");
+    Check(IsUniform(reflect, 3, "texSampler", 0), "Triangle.frag: sampler 'texSampler'");
+    Check(IsVarying(reflect, "vColor", 0, true), "Triangle.frag: input 'vColor'");
+    Check(IsVarying(reflect, "vTexCoord", 1, true), "Triangle.frag: input 'vTexCoord'");
+    Check(IsVarying(reflect, "fColor", 0, false), "Triangle.frag: output 'fColor'");
+}
+
+static void Test_SpirvReflectTestComp(const LLGL::SPIRVReflect& reflect)
+{
+    Check(reflect.GetUniforms().size() == 6, "SpirvReflectTest.comp: number of uniforms");
+    Check(IsUniform(reflect, 1, "constBuffer", 16), "SpirvReflectTest.comp: uniform buffer 'constBuffer'");
+    Check(IsUniform(reflect, 2, "outBuffer", 0), "SpirvReflectTest.comp: storage buffer 'outBuffer'");
+    Check(IsUniform(reflect, 3, "colorMap", 0), "SpirvReflectTest.comp: texture 'colorMap'");
+    Check(IsUniform(reflect, 4, "colorMapOut", 0), "SpirvReflectTest.comp: image 'colorMapOut'");
+    Check(IsUniform(reflect, 5, "linearSampler", 0), "SpirvReflectTest.comp: sampler 'linearSampler'");
+    Check(IsUniform(reflect, 6, "combinedTexSamplers", 0), "SpirvReflectTest.comp: sampler array 'combinedTexSamplers'");
+
+    auto globalID = FindVarying(reflect, "gl_GlobalInvocationID");
+    Check(globalID != nullptr && globalID->builtin == spv::BuiltIn::GlobalInvocationId, "SpirvReflectTest.comp: built-in 'gl_GlobalInvocationID'");
+}
+
+struct ShaderModule
+{
+    const char* filename;
+    void (*testProc)(const LLGL::SPIRVReflect&);
+};
+
+// Reflects the specified SPIR-V module once for validation and then measures the average time per reflection.
+static void ReflectAndMeasure(const ShaderModule& module, int numIterations)
+{
+    const std::string path = std::string("Shaders/") + module.filename;
+    const auto byteCode = LLGL::ReadFileBuffer(path.c_str());
+
+    /* Validate reflection (the module must outlive the reflection object) */
+    {
+        LLGL::SPIRVReflect reflect;
+        reflect.Parse(byteCode.data(), byteCode.size());
+        module.testProc(reflect);
+    }
+
+    /* Measure reflection with a new object each time, i.e. including the arena allocation */
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < numIterations; ++i)
+    {
+        LLGL::SPIRVReflect reflect;
+        reflect.Parse(byteCode.data(), byteCode.size());
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto elapsedTime = std::chrono::duration<double, std::micro>(endTime - startTime).count();
+
+    std::cout
+        << "reflection benchmark (" << module.filename << ", " << byteCode.size() << " bytes): "
+        << (elapsedTime / numIterations) << " us per reflection" << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    /* Number of reflections per shader module can be specified as first argument */
+    const int numIterations = (argc > 1 ? std::max(1, std::atoi(argv[1])) : 10000);
+
+    const ShaderModule modules[] =
+    {
+        { "Triangle.vert.spv",          Test_TriangleVert         },
+        { "Triangle.frag.spv",          Test_TriangleFrag         },
+        { "SpirvReflectTest.comp.spv",  Test_SpirvReflectTestComp },
+    };
+
+    for (const auto& module : modules)
+    {
+        try
+        {
+            ReflectAndMeasure(module, numIterations);
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << module.filename << ": " << e.what() << std::endl;
+            ++g_numFailures;
+        }
+    }
+
+    std::cout << (g_numFailures == 0 ? "all tests passed" : std::to_string(g_numFailures) + " test(s) failed") << std::endl;
+
+    return (g_numFailures == 0 ? 0 : 1);
+}
+
+
+
+// ================================================================================
@@ -0,0 +1,351 @@
+/*
+ * Test_TextureContainer.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/LLGL.h>
+#include <LLGL/TextureContainer.h>
+#include <LLGL/RendererConfiguration.h>
+#include <LLGL/Blob.h>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+
+
+static int g_numFailures = 0;
+
+static void Check(bool condition, const std::string& testName)
+{
+    if (!condition)
+    {
+        std::cerr << "FAILED: " << testName << std::endl;
+        ++g_numFailures;
+    }
+    else
+        std::cout << "passed: " << testName << std::endl;
+}
+
+// Returns true if the specified function throws an std::exception.
+template <typename TFunc>
+static bool Throws(TFunc func)
+{
+    try
+    {
+        func();
+    }
+    catch (const std::exception& e)
+    {
+        std::cout << "  (expected exception: " << e.what() << ")" << std::endl;
+        return true;
+    }
+    return false;
+}
+
+static void Append32(std::vector<char>& buf, std::uint32_t value)
+{
+    buf.insert(buf.end(), reinterpret_cast<const char*>(&value), reinterpret_cast<const char*>(&value) + sizeof(value));
+}
+
+static void Append64(std::vector<char>& buf, std::uint64_t value)
+{
+    buf.insert(buf.end(), reinterpret_cast<const char*>(&value), reinterpret_cast<const char*>(&value) + sizeof(value));
+}
+
+static void Overwrite32(std::vector<char>& buf, std::size_t offset, std::uint32_t value)
+{
+    ::memcpy(&buf[offset], &value, sizeof(value));
+}
+
+/*
+ * DDS container
+ */
+
+static const std::size_t g_ddsOffsetFourCC      = 4 + 76 + 8;
+static const std::size_t g_ddsOffsetDX10Misc    = 4 + 124 + 8;
+static const std::size_t g_ddsOffsetDX10Array   = 4 + 124 + 12;
+
+// Builds a DDS container with RGBA8 format and the specified number of pixel bytes.
+static std::vector<char> MakeDDS(std::uint32_t width, std::uint32_t height, std::uint32_t mipCount, std::size_t dataSize, bool dx10 = false)
+{
+    std::vector<char> buf;
+    Append32(buf, 0x20534444);                          // "DDS "
+    Append32(buf, 124);                                 // size
+    Append32(buf, 0x00021007);                          // flags: CAPS | HEIGHT | WIDTH | PIXELFORMAT | MIPMAPCOUNT
+    Append32(buf, height);
+    Append32(buf, width);
+    Append32(buf, 0);                                   // pitchOrLinearSize
+    Append32(buf, 0);                                   // depth
+    Append32(buf, mipCount);
+    for (int i = 0; i < 11; ++i)
+        Append32(buf, 0);                               // reserved1
+    Append32(buf, 32);                                  // pixelFormat.size
+    Append32(buf, (dx10 ? 0x04 : 0x41));                // pixelFormat.flags: FOURCC or RGB | ALPHAPIXELS
+    Append32(buf, (dx10 ? 0x30315844 : 0));             // pixelFormat.fourCC: "DX10"
+    Append32(buf, 32);                                  // pixelFormat.rgbBitCount
+    Append32(buf, 0x000000FF);                          // pixelFormat.rBitMask
+    Append32(buf, 0x0000FF00);                          // pixelFormat.gBitMask
+    Append32(buf, 0x00FF0000);                          // pixelFormat.bBitMask
+    Append32(buf, 0xFF000000);                          // pixelFormat.aBitMask
+    Append32(buf, 0x1000);                              // caps
+    for (int i = 0; i < 4; ++i)
+        Append32(buf, 0);                               // caps2, caps3, caps4, reserved2
+
+    if (dx10)
+    {
+        Append32(buf, 28);                              // DXGI_FORMAT_R8G8B8A8_UNORM
+        Append32(buf, 3);                               // D3D11_RESOURCE_DIMENSION_TEXTURE2D
+        Append32(buf, 0);                               // miscFlag
+        Append32(buf, 1);                               // arraySize
+        Append32(buf, 0);                               // miscFlags2
+    }
+
+    for (std::size_t i = 0; i < dataSize; ++i)
+        buf.push_back(static_cast<char>(i & 0xFF));
+
+    return buf;
+}
+
+/*
+ * KTX2 container
+ */
+
+static const std::size_t g_ktx2OffsetLayerCount = 12 + 20;
+static const std::size_t g_ktx2OffsetFaceCount  = 12 + 24;
+static const std::size_t g_ktx2OffsetLevelCount = 12 + 28;
+static const std::size_t g_ktx2OffsetLevels     = 80;
+
+// Builds a KTX2 container with RGBA8 format, where each MIP-map level is stored tightly packed after the level index.
+static std::vector<char> MakeKTX2(std::uint32_t width, std::uint32_t height, std::uint32_t levelCount)
+{
+    static const unsigned char identifier[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+    std::vector<char> buf(identifier, identifier + sizeof(identifier));
+    Append32(buf, 37);                                  // VK_FORMAT_R8G8B8A8_UNORM
+    Append32(buf, 1);                                   // typeSize
+    Append32(buf, width);
+    Append32(buf, height);
+    Append32(buf, 0);                                   // pixelDepth
+    Append32(buf, 0);                                   // layerCount
+    Append32(buf, 1);                                   // faceCount
+    Append32(buf, levelCount);
+    Append32(buf, 0);                                   // supercompressionScheme
+    for (int i = 0; i < 4; ++i)
+        Append32(buf, 0);                               // dfd and kvd offsets/lengths
+    Append64(buf, 0);                                   // sgdByteOffset
+    Append64(buf, 0);                                   // sgdByteLength
+
+    std::uint64_t offset = g_ktx2OffsetLevels + 24 * levelCount;
+    for (std::uint32_t level = 0; level < levelCount; ++level)
+    {
+        const std::uint64_t size = std::max(1u, width >> level) * std::max(1u, height >> level) * 4;
+        Append64(buf, offset);
+        Append64(buf, size);
+        Append64(buf, size);
+        offset += size;
+    }
+
+    buf.resize(static_cast<std::size_t>(offset), 0x7F);
+
+    return buf;
+}
+
+static LLGL::TextureDescriptor GetDesc(const std::vector<char>& buf)
+{
+    auto blob = LLGL::Blob::CreateWeakRef(buf.data(), buf.size());
+    return LLGL::GetTextureContainerDesc(*blob);
+}
+
+static void Test_DDSHeaders()
+{
+    /* Valid legacy header */
+    {
+        auto desc = GetDesc(MakeDDS(16, 8, 5, 0));
+        Check(
+            desc.type == LLGL::TextureType::Texture2D && desc.format == LLGL::Format::RGBA8UNorm &&
+            desc.extent.width == 16 && desc.extent.height == 8 && desc.mipLevels == 5,
+            "DDS: legacy header"
+        );
+    }
+
+    /* Valid DX10 header */
+    {
+        auto desc = GetDesc(MakeDDS(4, 4, 1, 0, true));
+        Check(desc.type == LLGL::TextureType::Texture2D && desc.format == LLGL::Format::RGBA8UNorm, "DDS: DX10 header");
+    }
+
+    /* Truncated headers */
+    {
+        auto buf = MakeDDS(16, 16, 1, 0);
+        buf.resize(64);
+        Check(Throws([&]() { GetDesc(buf); }), "DDS: truncated header");
+    }
+    {
+        auto buf = MakeDDS(16, 16, 1, 0, true);
+        buf.resize(4 + 124 + 10);
+        Check(Throws([&]() { GetDesc(buf); }), "DDS: truncated DX10 header");
+    }
+
+    /* Malformed headers */
+    {
+        auto buf = MakeDDS(16, 16, 1, 0);
+        Overwrite32(buf, 4, 100);
+        Check(Throws([&]() { GetDesc(buf); }), "DDS: invalid header size");
+    }
+    {
+        auto buf = MakeDDS(0, 16, 1, 0);
+        Check(Throws([&]() { GetDesc(buf); }), "DDS: zero width");
+    }
+    {
+        auto buf = MakeDDS(16, 16, 0xFFFFFFFF, 0);
+        Check(Throws([&]() { GetDesc(buf); }), "DDS: too many MIP-map levels");
+    }
+    {
+        auto buf = MakeDDS(16, 16, 1, 0);
+        Overwrite32(buf, g_ddsOffsetFourCC - 4, 0x04);
+        Overwrite32(buf, g_ddsOffsetFourCC, 0x12345678);
+        Check(Throws([&]() { GetDesc(buf); }), "DDS: unknown FourCC");
+    }
+    {
+        auto buf = MakeDDS(16, 16, 1, 0, true);
+        Overwrite32(buf, g_ddsOffsetDX10Misc, 0x04);
+        Overwrite32(buf, g_ddsOffsetDX10Array, 0xFFFFFFFF);
+        Check(Throws([&]() { GetDesc(buf); }), "DDS: cube array layer count overflow");
+    }
+}
+
+static void Test_KTX2Headers()
+{
+    /* Valid header */
+    {
+        auto desc = GetDesc(MakeKTX2(8, 4, 4));
+        Check(
+            desc.type == LLGL::TextureType::Texture2D && desc.format == LLGL::Format::RGBA8UNorm &&
+            desc.extent.width == 8 && desc.extent.height == 4 && desc.mipLevels == 4,
+            "KTX2: header"
+        );
+    }
+
+    /* Truncated header and level index */
+    {
+        auto buf = MakeKTX2(8, 8, 1);
+        buf.resize(40);
+        Check(Throws([&]() { GetDesc(buf); }), "KTX2: truncated header");
+    }
+    {
+        auto buf = MakeKTX2(8, 8, 4);
+        buf.resize(g_ktx2OffsetLevels + 24 * 2);
+        Check(Throws([&]() { GetDesc(buf); }), "KTX2: truncated level index");
+    }
+
+    /* Malformed headers */
+    {
+        auto buf = MakeKTX2(8, 8, 1);
+        Overwrite32(buf, g_ktx2OffsetFaceCount, 3);
+        Check(Throws([&]() { GetDesc(buf); }), "KTX2: face count other than 1 or 6");
+    }
+    {
+        auto buf = MakeKTX2(8, 8, 1);
+        Overwrite32(buf, g_ktx2OffsetFaceCount, 0);
+        Check(Throws([&]() { GetDesc(buf); }), "KTX2: zero face count");
+    }
+    {
+        auto buf = MakeKTX2(8, 8, 1);
+        Overwrite32(buf, g_ktx2OffsetFaceCount, 6);
+        Overwrite32(buf, g_ktx2OffsetLayerCount, 0x40000000);
+        Check(Throws([&]() { GetDesc(buf); }), "KTX2: cube array layer count overflow");
+    }
+    {
+        auto buf = MakeKTX2(8, 8, 1);
+        Overwrite32(buf, g_ktx2OffsetLevelCount, 0xFFFFFFFF);
+        Check(Throws([&]() { GetDesc(buf); }), "KTX2: too many MIP-map levels");
+    }
+}
+
+static void Test_ImageData(LLGL::RenderSystem& renderer)
+{
+    /* Valid containers */
+    {
+        auto buf = MakeDDS(4, 4, 3, (16 + 4 + 1) * 4);
+        auto blob = LLGL::Blob::CreateWeakRef(buf.data(), buf.size());
+        auto tex = LLGL::CreateTextureFromContainer(renderer, *blob);
+
+        std::vector<char> pixels(16 * 4);
+        LLGL::DstImageDescriptor imageDesc{ LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, pixels.data(), pixels.size() };
+        renderer.ReadTexture(*tex, LLGL::TextureRegion{ LLGL::Offset3D{}, LLGL::Extent3D{ 4, 4, 1 } }, imageDesc);
+        Check(::memcmp(pixels.data(), buf.data() + 4 + 124, pixels.size()) == 0, "DDS: image data");
+
+        renderer.Release(*tex);
+    }
+    {
+        auto buf = MakeKTX2(8, 4, 4);
+        auto blob = LLGL::Blob::CreateWeakRef(buf.data(), buf.size());
+        auto tex = LLGL::CreateTextureFromContainer(renderer, *blob);
+        Check(tex != nullptr, "KTX2: image data");
+        renderer.Release(*tex);
+    }
+
+    /* Truncated image data */
+    {
+        auto buf = MakeDDS(4, 4, 3, (16 + 4 + 1) * 4 - 1);
+        auto blob = LLGL::Blob::CreateWeakRef(buf.data(), buf.size());
+        Check(Throws([&]() { LLGL::CreateTextureFromContainer(renderer, *blob); }), "DDS: truncated image data");
+    }
+    {
+        auto buf = MakeKTX2(8, 4, 4);
+        buf.pop_back();
+        auto blob = LLGL::Blob::CreateWeakRef(buf.data(), buf.size());
+        Check(Throws([&]() { LLGL::CreateTextureFromContainer(renderer, *blob); }), "KTX2: truncated image data");
+    }
+
+    /* Level index with offset and length that wrap around when added */
+    {
+        auto buf = MakeKTX2(8, 4, 1);
+        const std::uint64_t byteOffset = ~0ull - 7;
+        ::memcpy(&buf[g_ktx2OffsetLevels], &byteOffset, sizeof(byteOffset));
+        auto blob = LLGL::Blob::CreateWeakRef(buf.data(), buf.size());
+        Check(Throws([&]() { LLGL::CreateTextureFromContainer(renderer, *blob); }), "KTX2: level offset overflow");
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    Test_DDSHeaders();
+    Test_KTX2Headers();
+
+    try
+    {
+        // Load render system module (OpenGL renderer runs headless, so no window is required)
+        const std::string rendererModule = (argc > 1 ? argv[1] : "OpenGL");
+
+        LLGL::RendererConfigurationOpenGL configGL;
+        configGL.headless = true;
+
+        LLGL::RenderSystemDescriptor rendererDesc{ rendererModule };
+        if (rendererModule == "OpenGL")
+        {
+            rendererDesc.rendererConfig     = &configGL;
+            rendererDesc.rendererConfigSize = sizeof(configGL);
+        }
+
+        auto renderer = LLGL::RenderSystem::Load(rendererDesc);
+        Test_ImageData(*renderer);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        ++g_numFailures;
+    }
+
+    std::cout << (g_numFailures == 0 ? "all tests passed" : std::to_string(g_numFailures) + " test(s) failed") << std::endl;
+
+    return (g_numFailures == 0 ? 0 : 1);
+}
+
+
+
+// ================================================================================
@@ -0,0 +1,310 @@
+/*
+ * Test_TextureResidency.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/LLGL.h>
+#include <LLGL/TextureResidency.h>
+#include <LLGL/RendererConfiguration.h>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <functional>
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <chrono>
+#include <cstdint>
+
+
+static int g_numFailures = 0;
+
+static void Check(bool condition, const std::string& testName)
+{
+    if (!condition)
+    {
+        std::cerr << "FAILED: " << testName << std::endl;
+        ++g_numFailures;
+    }
+    else
+        std::cout << "passed: " << testName << std::endl;
+}
+
+// Returns true if the specified function throws an std::invalid_argument.
+template <typename TFunc>
+static bool ThrowsInvalidArgument(TFunc func)
+{
+    try
+    {
+        func();
+    }
+    catch (const std::invalid_argument& e)
+    {
+        std::cout << "  (expected exception: " << e.what() << ")" << std::endl;
+        return true;
+    }
+    return false;
+}
+
+// Textures of 64x64 RGBA8 texels with 7 MIP-map levels, of which the 3 smallest ones always stay resident.
+static const std::uint32_t  g_textureSize       = 64;
+static const std::uint32_t  g_numMipLevels      = 7;
+static const std::uint32_t  g_numTailLevels     = 3;
+static const std::uint32_t  g_tailLevel         = g_numMipLevels - g_numTailLevels;
+static const std::uint64_t  g_tailMemory        = (4*4 + 2*2 + 1*1) * 4;
+static const std::uint64_t  g_textureMemory     = (64*64 + 32*32 + 16*16 + 8*8) * 4 + g_tailMemory;
+
+// Returns the byte each texel of the specified MIP-map level is filled with, so copied MIP-map levels can be verified.
+static char GetTexelPattern(std::uint32_t textureIndex, std::uint32_t mipLevel)
+{
+    return static_cast<char>(((textureIndex & 0xF) << 4) | (mipLevel & 0xF));
+}
+
+static LLGL::TextureDescriptor GetTextureDesc()
+{
+    LLGL::TextureDescriptor textureDesc;
+    {
+        textureDesc.type        = LLGL::TextureType::Texture2D;
+        textureDesc.bindFlags   = LLGL::BindFlags::Sampled;
+        textureDesc.format      = LLGL::Format::RGBA8UNorm;
+        textureDesc.extent      = { g_textureSize, g_textureSize, 1 };
+        textureDesc.mipLevels   = g_numMipLevels;
+    }
+    return textureDesc;
+}
+
+static LLGL::ResidentTexture AddTexture(LLGL::TextureResidencyManager& residency, std::uint32_t textureIndex)
+{
+    return residency.AddTexture(
+        GetTextureDesc(),
+        [textureIndex](std::uint32_t mipLevel, std::vector<char>& imageData)
+        {
+            const auto extent = std::max(1u, g_textureSize >> mipLevel);
+            imageData.assign(extent * extent * 4, GetTexelPattern(textureIndex, mipLevel));
+            return true;
+        }
+    );
+}
+
+// Returns true if all resident MIP-map levels of the specified texture contain the texel pattern of its load function.
+static bool VerifyTexture(LLGL::RenderSystem& renderer, LLGL::TextureResidencyManager& residency, LLGL::ResidentTexture texture, std::uint32_t textureIndex)
+{
+    const auto residentLevel = residency.GetResidentMipLevel(texture);
+    for (auto mipLevel = residentLevel; mipLevel < g_numMipLevels; ++mipLevel)
+    {
+        const auto extent = std::max(1u, g_textureSize >> mipLevel);
+        std::vector<char> imageData(extent * extent * 4, 0);
+
+        LLGL::TextureRegion region;
+        {
+            region.subresource.baseMipLevel = mipLevel - residentLevel;
+            region.subresource.numMipLevels = 1;
+            region.extent                   = { extent, extent, 1 };
+        }
+        LLGL::DstImageDescriptor imageDesc{ LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, imageData.data(), imageData.size() };
+        renderer.ReadTexture(*residency.GetTexture(texture), region, imageDesc);
+
+        const auto pattern = GetTexelPattern(textureIndex, mipLevel);
+        if (std::find_if(imageData.begin(), imageData.end(), [pattern](char c) { return (c != pattern); }) != imageData.end())
+        {
+            std::cerr << "  MIP-map level " << mipLevel << " of texture " << textureIndex << " has unexpected content" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// Updates the residency manager every frame until the specified condition is met. Loads run on worker threads, so this waits between frames.
+static bool UpdateUntil(LLGL::TextureResidencyManager& residency, const std::function<void()>& useTextures, const std::function<bool()>& condition)
+{
+    for (int frame = 0; frame < 1000; ++frame)
+    {
+        residency.Update();
+        if (condition())
+            return true;
+        useTextures();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+static LLGL::TextureResidencyDescriptor GetResidencyDesc(std::uint64_t budget)
+{
+    LLGL::TextureResidencyDescriptor residencyDesc;
+    {
+        residencyDesc.budget                = budget;
+        residencyDesc.minResidentMipLevels  = g_numTailLevels;
+        residencyDesc.evictionDelay         = 2;
+        residencyDesc.numFramesInFlight     = 2;
+    }
+    return residencyDesc;
+}
+
+static void Test_EvictionOrder(LLGL::RenderSystem& renderer)
+{
+    /* Budget fits two entirely resident textures and the tail of a third one */
+    LLGL::TextureResidencyManager residency{ renderer, GetResidencyDesc(g_textureMemory * 2 + g_tailMemory) };
+
+    auto textureA = AddTexture(residency, 0);
+    auto textureB = AddTexture(residency, 1);
+    auto textureC = AddTexture(residency, 2);
+
+    Check(
+        residency.GetResidentMipLevel(textureA) == g_tailLevel &&
+        residency.GetResidentMipLevel(textureB) == g_tailLevel &&
+        residency.GetResidentMipLevel(textureC) == g_tailLevel,
+        "only smallest MIP-map levels are resident after AddTexture"
+    );
+
+    /* Use textures A and B until they are entirely resident */
+    Check(
+        UpdateUntil(
+            residency,
+            [&]() { residency.UseTexture(textureA); residency.UseTexture(textureB); },
+            [&]() { return (residency.GetResidentMipLevel(textureA) == 0 && residency.GetResidentMipLevel(textureB) == 0); }
+        ),
+        "upgrade used textures"
+    );
+    Check(residency.GetResidentMipLevel(textureC) == g_tailLevel, "keep unused texture at its smallest MIP-map levels");
+
+    /* Use textures B and C, so the least recently used texture A must make room for texture C */
+    Check(
+        UpdateUntil(
+            residency,
+            [&]() { residency.UseTexture(textureB); residency.UseTexture(textureC); },
+            [&]() { return (residency.GetResidentMipLevel(textureC) == 0); }
+        ),
+        "upgrade texture within budget by downgrading least recently used texture"
+    );
+    Check(residency.GetResidentMipLevel(textureA) == g_tailLevel, "downgrade least recently used texture");
+    Check(residency.GetResidentMipLevel(textureB) == 0, "keep recently used texture resident");
+    Check(residency.GetStatistics().residentMemory <= residency.GetStatistics().budget, "resident memory within budget");
+
+    Check(
+        VerifyTexture(renderer, residency, textureA, 0) &&
+        VerifyTexture(renderer, residency, textureB, 1) &&
+        VerifyTexture(renderer, residency, textureC, 2),
+        "preserve MIP-map content across upgrades and downgrades"
+    );
+}
+
+static void Test_HandleReuse(LLGL::RenderSystem& renderer, LLGL::PipelineLayout& pipelineLayout)
+{
+    LLGL::TextureResidencyManager residency{ renderer, GetResidencyDesc(0) };
+
+    auto textureA = AddTexture(residency, 0);
+    auto textureB = AddTexture(residency, 1);
+
+    /* Textures cannot be removed while a resource heap refers to them */
+    LLGL::ResourceHeapDescriptor heapDesc;
+    {
+        heapDesc.pipelineLayout = &pipelineLayout;
+        heapDesc.resourceViews  = { residency.GetTexture(textureB) };
+    }
+    auto heap = residency.CreateResourceHeap(heapDesc);
+
+    Check(ThrowsInvalidArgument([&]() { residency.RemoveTexture(textureB); }), "refuse to remove texture that is referred to by a resource heap");
+    Check(residency.GetTexture(textureB) != nullptr, "keep texture after refused removal");
+
+    residency.ReleaseResourceHeap(heap);
+    residency.RemoveTexture(textureB);
+    Check(ThrowsInvalidArgument([&]() { residency.GetTexture(textureB); }), "invalidate handle of removed texture");
+
+    /* Handles of removed textures are reused */
+    auto textureC = AddTexture(residency, 2);
+    Check(textureC == textureB, "reuse handle of removed texture");
+    Check(residency.GetTexture(textureA) != residency.GetTexture(textureC), "reused handle refers to new texture");
+    Check(VerifyTexture(renderer, residency, textureC, 2), "reused handle has content of new texture");
+
+    residency.Update();
+    Check(residency.GetStatistics().numTextures == 2, "count textures after handle reuse");
+    Check(residency.GetStatistics().requestedMemory == g_textureMemory * 2, "requested memory after handle reuse");
+}
+
+static void Test_HeapRebinding(LLGL::RenderSystem& renderer, LLGL::PipelineLayout& pipelineLayout)
+{
+    LLGL::TextureResidencyManager residency{ renderer, GetResidencyDesc(0) };
+
+    auto texture = AddTexture(residency, 0);
+
+    LLGL::ResourceHeapDescriptor heapDesc;
+    {
+        heapDesc.pipelineLayout = &pipelineLayout;
+        heapDesc.resourceViews  = { residency.GetTexture(texture) };
+    }
+    auto heap = residency.CreateResourceHeap(heapDesc);
+
+    /* Resource heap is recreated once its texture has been replaced */
+    auto initialHeap        = &(residency.UseResourceHeap(heap));
+    auto initialTexture     = residency.GetTexture(texture);
+    auto prevHeap           = initialHeap;
+    auto prevTexture        = initialTexture;
+    bool rebindOnReplace    = true;
+
+    Check(
+        UpdateUntil(
+            residency,
+            [&]()
+            {
+                auto currentHeap = &(residency.UseResourceHeap(heap));
+                if ((residency.GetTexture(texture) != prevTexture) != (currentHeap != prevHeap))
+                    rebindOnReplace = false;
+                prevHeap    = currentHeap;
+                prevTexture = residency.GetTexture(texture);
+            },
+            [&]() { return (residency.GetResidentMipLevel(texture) == 0); }
+        ),
+        "upgrade texture that is used by a resource heap"
+    );
+    Check(rebindOnReplace, "recreate resource heap exactly when its texture is replaced");
+    Check(&(residency.UseResourceHeap(heap)) != initialHeap, "resource heap refers to upgraded texture");
+    Check(VerifyTexture(renderer, residency, texture, 0), "content of texture that is used by a resource heap");
+
+    /* Replaced textures and resource heaps are still retired here, so the destructor must wait for the GPU before it releases them */
+}
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        // Load render system module (OpenGL renderer runs headless, so no window is required)
+        const std::string rendererModule = (argc > 1 ? argv[1] : "OpenGL");
+
+        LLGL::RendererConfigurationOpenGL configGL;
+        configGL.headless = true;
+
+        LLGL::RenderSystemDescriptor rendererDesc{ rendererModule };
+        if (rendererModule == "OpenGL")
+        {
+            rendererDesc.rendererConfig     = &configGL;
+            rendererDesc.rendererConfigSize = sizeof(configGL);
+        }
+
+        auto renderer = LLGL::RenderSystem::Load(rendererDesc);
+
+        LLGL::PipelineLayoutDescriptor layoutDesc;
+        {
+            layoutDesc.bindings = { LLGL::BindingDescriptor{ LLGL::ResourceType::Texture, LLGL::BindFlags::Sampled, LLGL::StageFlags::FragmentStage, 0 } };
+        }
+        auto pipelineLayout = renderer->CreatePipelineLayout(layoutDesc);
+
+        Test_EvictionOrder(*renderer);
+        Test_HandleReuse(*renderer, *pipelineLayout);
+        Test_HeapRebinding(*renderer, *pipelineLayout);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        ++g_numFailures;
+    }
+
+    std::cout << (g_numFailures == 0 ? "all tests passed" : std::to_string(g_numFailures) + " test(s) failed") << std::endl;
+
+    return (g_numFailures == 0 ? 0 : 1);
+}
+
+
+
+// ================================================================================
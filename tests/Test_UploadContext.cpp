@@ -0,0 +1,306 @@
+/*
+ * Test_UploadContext.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/LLGL.h>
+#include <LLGL/RendererConfiguration.h>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <functional>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <thread>
+#include <cstdint>
+
+
+static int g_numFailures = 0;
+
+static void Check(bool condition, const std::string& testName)
+{
+    if (!condition)
+    {
+        std::cerr << "FAILED: " << testName << std::endl;
+        ++g_numFailures;
+    }
+    else
+        std::cout << "passed: " << testName << std::endl;
+}
+
+// Runs the specified function on a thread without GL context, so all resource creation goes through the upload context.
+static void RunOnWorker(const std::function<void()>& func)
+{
+    std::string error;
+    std::thread worker(
+        [&]()
+        {
+            try
+            {
+                func();
+            }
+            catch (const std::exception& e)
+            {
+                error = e.what();
+            }
+        }
+    );
+    worker.join();
+    if (!error.empty())
+        throw std::runtime_error(error);
+}
+
+static const std::uint32_t  g_targetSize    = 16;
+static const std::uint32_t  g_drawColor     = 0xFFFFFFFF;
+
+// Draws a white triangle that covers the entire render target, with vertex buffers that might have been created on another thread.
+class TriangleRenderer
+{
+
+    public:
+
+        TriangleRenderer(LLGL::RenderSystem& renderer) :
+            renderer_ { renderer }
+        {
+            vertexFormat_.AppendAttribute({ "position", LLGL::Format::RG32Float });
+
+            /* Create render target with a color attachment */
+            LLGL::TextureDescriptor colorDesc;
+            {
+                colorDesc.type      = LLGL::TextureType::Texture2D;
+                colorDesc.bindFlags = LLGL::BindFlags::ColorAttachment;
+                colorDesc.format    = LLGL::Format::RGBA8UNorm;
+                colorDesc.extent    = { g_targetSize, g_targetSize, 1 };
+                colorDesc.mipLevels = 1;
+            }
+            colorTexture_ = renderer.CreateTexture(colorDesc);
+
+            LLGL::RenderTargetDescriptor renderTargetDesc;
+            {
+                renderTargetDesc.resolution = { g_targetSize, g_targetSize };
+                renderTargetDesc.attachments.push_back({ LLGL::AttachmentType::Color, colorTexture_ });
+            }
+            renderTarget_ = renderer.CreateRenderTarget(renderTargetDesc);
+
+            /* Create shaders and graphics pipeline */
+            LLGL::ShaderDescriptor vertShaderDesc{ LLGL::ShaderType::Vertex, "#version 330 core\nin vec2 position;\nvoid main() { gl_Position = vec4(position, 0.0, 1.0); }\n" };
+            LLGL::ShaderDescriptor fragShaderDesc{ LLGL::ShaderType::Fragment, "#version 330 core\nout vec4 color;\nvoid main() { color = vec4(1.0); }\n" };
+            vertShaderDesc.sourceType           = LLGL::ShaderSourceType::CodeString;
+            vertShaderDesc.vertex.inputAttribs  = vertexFormat_.attributes;
+            fragShaderDesc.sourceType           = LLGL::ShaderSourceType::CodeString;
+
+            LLGL::ShaderProgramDescriptor programDesc;
+            {
+                programDesc.vertexShader    = renderer.CreateShader(vertShaderDesc);
+                programDesc.fragmentShader  = renderer.CreateShader(fragShaderDesc);
+            }
+            auto shaderProgram = renderer.CreateShaderProgram(programDesc);
+            if (shaderProgram->HasErrors())
+                throw std::runtime_error(shaderProgram->GetReport());
+
+            LLGL::GraphicsPipelineDescriptor pipelineDesc;
+            {
+                pipelineDesc.shaderProgram  = shaderProgram;
+                pipelineDesc.renderPass     = renderTarget_->GetRenderPass();
+            }
+            pipeline_ = renderer.CreatePipelineState(pipelineDesc);
+
+            commandBuffer_ = renderer.CreateCommandBuffer();
+        }
+
+        // Returns the descriptor for a vertex buffer with a single triangle that covers the entire render target.
+        LLGL::BufferDescriptor GetVertexBufferDesc() const
+        {
+            LLGL::BufferDescriptor bufferDesc;
+            {
+                bufferDesc.size             = sizeof(vertices);
+                bufferDesc.bindFlags        = LLGL::BindFlags::VertexBuffer;
+                bufferDesc.vertexAttribs    = vertexFormat_.attributes;
+            }
+            return bufferDesc;
+        }
+
+        // Draws the triangle with either the specified vertex buffer or buffer array and returns the center pixel of the render target.
+        std::uint32_t Draw(LLGL::Buffer* vertexBuffer, LLGL::BufferArray* vertexBufferArray)
+        {
+            commandBuffer_->Begin();
+            {
+                if (vertexBuffer != nullptr)
+                    commandBuffer_->SetVertexBuffer(*vertexBuffer);
+                else
+                    commandBuffer_->SetVertexBufferArray(*vertexBufferArray);
+                commandBuffer_->BeginRenderPass(*renderTarget_);
+                {
+                    commandBuffer_->SetViewport(LLGL::Viewport{ 0.0f, 0.0f, static_cast<float>(g_targetSize), static_cast<float>(g_targetSize) });
+                    commandBuffer_->SetClearColor({ 0.0f, 0.0f, 0.0f, 1.0f });
+                    commandBuffer_->Clear(LLGL::ClearFlags::Color);
+                    commandBuffer_->SetPipelineState(*pipeline_);
+                    commandBuffer_->Draw(3, 0);
+                }
+                commandBuffer_->EndRenderPass();
+            }
+            commandBuffer_->End();
+            renderer_.GetCommandQueue()->Submit(*commandBuffer_);
+
+            std::vector<std::uint32_t> pixels(g_targetSize * g_targetSize, 0);
+            LLGL::TextureRegion region;
+            {
+                region.subresource.numMipLevels = 1;
+                region.extent                   = { g_targetSize, g_targetSize, 1 };
+            }
+            LLGL::DstImageDescriptor imageDesc{ LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, pixels.data(), pixels.size() * sizeof(std::uint32_t) };
+            renderer_.ReadTexture(*colorTexture_, region, imageDesc);
+
+            return pixels[(g_targetSize / 2) * g_targetSize + g_targetSize / 2];
+        }
+
+    public:
+
+        static const float      vertices[6];
+
+    private:
+
+        LLGL::RenderSystem&     renderer_;
+        LLGL::VertexFormat      vertexFormat_;
+        LLGL::Texture*          colorTexture_   = nullptr;
+        LLGL::RenderTarget*     renderTarget_   = nullptr;
+        LLGL::PipelineState*    pipeline_       = nullptr;
+        LLGL::CommandBuffer*    commandBuffer_  = nullptr;
+
+};
+
+const float TriangleRenderer::vertices[6] = { -1.0f, -1.0f, -1.0f, 3.0f, 3.0f, -1.0f };
+
+// Vertex buffers created on another thread can be used in a buffer array before their vertex arrays are built on the render thread.
+static void Test_BufferArrayBeforeSynchronize(LLGL::RenderSystem& renderer, TriangleRenderer& triangle)
+{
+    LLGL::Buffer* vertexBuffer = nullptr;
+    RunOnWorker([&]() { vertexBuffer = renderer.CreateBuffer(triangle.GetVertexBufferDesc(), TriangleRenderer::vertices); });
+    Check(vertexBuffer != nullptr, "vertex buffer is created on worker thread");
+
+    /* Create buffer array before any command buffer synchronized with the upload context */
+    auto vertexBufferArray = renderer.CreateBufferArray(1, &vertexBuffer);
+    Check(triangle.Draw(nullptr, vertexBufferArray) == g_drawColor, "buffer array of worker buffer is drawn before synchronization");
+
+    /* Draw with the same buffer after it has been synchronized */
+    Check(triangle.Draw(vertexBuffer, nullptr) == g_drawColor, "worker buffer is drawn after synchronization");
+
+    renderer.Release(*vertexBufferArray);
+    renderer.Release(*vertexBuffer);
+}
+
+// Buffer arrays can also be created on another thread; their vertex array is built on the next synchronization.
+static void Test_BufferArrayOnWorker(LLGL::RenderSystem& renderer, TriangleRenderer& triangle)
+{
+    LLGL::Buffer*       vertexBuffer        = nullptr;
+    LLGL::BufferArray*  vertexBufferArray   = nullptr;
+
+    RunOnWorker(
+        [&]()
+        {
+            vertexBuffer        = renderer.CreateBuffer(triangle.GetVertexBufferDesc(), TriangleRenderer::vertices);
+            vertexBufferArray   = renderer.CreateBufferArray(1, &vertexBuffer);
+        }
+    );
+    Check(vertexBufferArray != nullptr, "buffer array is created on worker thread");
+    Check(triangle.Draw(nullptr, vertexBufferArray) == g_drawColor, "worker buffer array is drawn");
+
+    /* Release both objects on the worker thread; they are removed on the next synchronization */
+    RunOnWorker(
+        [&]()
+        {
+            renderer.Release(*vertexBufferArray);
+            renderer.Release(*vertexBuffer);
+        }
+    );
+    auto renderThreadBuffer = renderer.CreateBuffer(triangle.GetVertexBufferDesc(), TriangleRenderer::vertices);
+    Check(triangle.Draw(renderThreadBuffer, nullptr) == g_drawColor, "render thread buffer is drawn after worker release");
+    renderer.Release(*renderThreadBuffer);
+}
+
+// Textures created on another thread can be read and released on the render thread right away.
+static void Test_TextureBeforeSynchronize(LLGL::RenderSystem& renderer)
+{
+    const std::uint32_t texels[4] = { 0xFF0000FF, 0xFF00FF00, 0xFFFF0000, 0xFFFFFFFF };
+
+    LLGL::TextureDescriptor textureDesc;
+    {
+        textureDesc.type        = LLGL::TextureType::Texture2D;
+        textureDesc.format      = LLGL::Format::RGBA8UNorm;
+        textureDesc.extent      = { 2, 2, 1 };
+        textureDesc.mipLevels   = 1;
+    }
+    LLGL::SrcImageDescriptor srcImageDesc{ LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, texels, sizeof(texels) };
+
+    LLGL::Texture* textures[2] = {};
+    RunOnWorker(
+        [&]()
+        {
+            textures[0] = renderer.CreateTexture(textureDesc, &srcImageDesc);
+            textures[1] = renderer.CreateTexture(textureDesc, &srcImageDesc);
+        }
+    );
+
+    /* Release one texture while the upload context still has pending tasks */
+    renderer.Release(*textures[1]);
+
+    std::uint32_t readTexels[4] = {};
+    LLGL::TextureRegion region;
+    {
+        region.subresource.numMipLevels = 1;
+        region.extent                   = { 2, 2, 1 };
+    }
+    LLGL::DstImageDescriptor dstImageDesc{ LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, readTexels, sizeof(readTexels) };
+    renderer.ReadTexture(*textures[0], region, dstImageDesc);
+
+    Check(std::equal(std::begin(texels), std::end(texels), readTexels), "worker texture content is visible to render thread");
+
+    /* Update the texture on the worker thread and read it again after synchronization */
+    const std::uint32_t newTexels[4] = { 0xFF123456, 0xFF123456, 0xFF123456, 0xFF123456 };
+    LLGL::SrcImageDescriptor newImageDesc{ LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, newTexels, sizeof(newTexels) };
+    RunOnWorker([&]() { renderer.WriteTexture(*textures[0], region, newImageDesc); });
+
+    renderer.ReadTexture(*textures[0], region, dstImageDesc);
+    Check(std::equal(std::begin(newTexels), std::end(newTexels), readTexels), "worker texture update is visible to render thread");
+
+    renderer.Release(*textures[0]);
+}
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        // Load OpenGL render system with a background upload context (renderer runs headless, so no window is required)
+        LLGL::RendererConfigurationOpenGL configGL;
+        configGL.headless       = true;
+        configGL.uploadContext  = true;
+
+        LLGL::RenderSystemDescriptor rendererDesc{ "OpenGL" };
+        {
+            rendererDesc.rendererConfig     = &configGL;
+            rendererDesc.rendererConfigSize = sizeof(configGL);
+        }
+        auto renderer = LLGL::RenderSystem::Load(rendererDesc);
+
+        TriangleRenderer triangle{ *renderer };
+        Test_BufferArrayBeforeSynchronize(*renderer, triangle);
+        Test_BufferArrayOnWorker(*renderer, triangle);
+        Test_TextureBeforeSynchronize(*renderer);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        ++g_numFailures;
+    }
+
+    std::cout << (g_numFailures == 0 ? "all tests passed" : std::to_string(g_numFailures) + " test(s) failed") << std::endl;
+
+    return (g_numFailures == 0 ? 0 : 1);
+}
+
+
+
+// ================================================================================